@@ -4,6 +4,7 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser_manager.h"
 #include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
 #include "hal_core/netlist/project_manager.h"
 #include "hal_core/plugin_system/plugin_interface_base.h"
@@ -52,6 +53,8 @@ void initialize_cli_options(ProgramOptions& cli_options)
     generic_options.add({"-e", "--empty-project"}, "create an empty project (requires gate library to be specified)");
     generic_options.add("--volatile-mode", "prevent HAL from creating a .hal progress file (e.g., for cluster use)");
     generic_options.add("--no-log", "prevent hal from creating a .log file");
+    generic_options.add("--netlist-format", "file format of the project netlist, either 'json' (.hal) or 'binary' (.halb)", {ProgramOptions::A_REQUIRED_PARAMETER});
+    generic_options.add("--convert-netlist", "write the netlist to the given .hal or .halb file", {ProgramOptions::A_REQUIRED_PARAMETER});
 
     /* initialize netlist parser options */
     generic_options.add(netlist_parser_manager::get_cli_options());
@@ -292,6 +295,23 @@ int main(int argc, const char* argv[])
             return cleanup();
         }
     }
+    if (args.is_option_set("--netlist-format"))
+    {
+        std::string format = utils::to_lower(args.get_parameter("--netlist-format"));
+        if (format == "json")
+        {
+            pm->set_netlist_format(ProjectManager::NetlistFormat::JSON);
+        }
+        else if (format == "binary")
+        {
+            pm->set_netlist_format(ProjectManager::NetlistFormat::BINARY);
+        }
+        else
+        {
+            log_error("core", "Unknown netlist format '{}', expected 'json' or 'binary'!", format);
+            return cleanup(ERROR);
+        }
+    }
     if (args.is_option_set("--no-log"))
     {
         log_warning("core",
@@ -311,6 +331,11 @@ int main(int argc, const char* argv[])
         auto lib = gate_library_manager::load(args.get_parameter("--gate-library"));
         netlist  = netlist_factory::create_netlist(lib);
     }
+    else if (openExisting)
+    {
+        // the netlist has already been loaded when opening the project
+        netlist = std::move(pm->get_netlist());
+    }
     else
     {
         netlist = netlist_factory::load_netlist(pm->get_project_directory(), args);
@@ -398,6 +423,19 @@ int main(int argc, const char* argv[])
         pm->serialize_project(netlist.get());
     }
 
+    /* convert netlist to another persistent file format */
+    if (args.is_option_set("--convert-netlist"))
+    {
+        std::filesystem::path convert_path = std::filesystem::absolute(args.get_parameter("--convert-netlist"));
+        bool converted                     = (convert_path.extension() == netlist_binary_serializer::FILE_EXTENSION) ? netlist_binary_serializer::serialize_to_file(netlist.get(), convert_path)
+                                                                                                                   : netlist_serializer::serialize_to_file(netlist.get(), convert_path);
+        if (!converted)
+        {
+            log_error("core", "Cannot convert netlist to <" + convert_path.string() + ">");
+            return cleanup(ERROR);
+        }
+    }
+
     /* handle file writer */
     if (!netlist_writer_manager::write(netlist.get(), args))
     {
@@ -0,0 +1,175 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/utilities/result.h"
+
+#include <string>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A single-bit Boolean function compiled into a flat program that is evaluated against an array of input slots.
+     * 
+     * Compilation resolves every variable name to the index of its slot once, so that evaluation neither hashes nor compares strings and does not allocate.
+     * Evaluation uses the same three-valued logic as `BooleanFunction::evaluate`, i.e., `X` and `Z` operands yield `X` unless the result is determined by the other operand.
+     * 
+     * @ingroup netlist
+     */
+    class NETLIST_API CompiledBooleanFunction final
+    {
+    public:
+        /**
+         * The values of a single-bit signal in 64 independent lanes, one bit per lane.
+         * A lane holds `ONE` if its bit is set in both `value` and `known`, `ZERO` if it is only set in `known`, and `X` otherwise.
+         * `Z` is not distinguished from `X`.
+         */
+        struct Lanes
+        {
+            /// The value of each lane, the bits of lanes whose value is not known are kept clear.
+            u64 value = 0;
+            /// The lanes whose value is known.
+            u64 known = 0;
+
+            /**
+             * Get the value of a single lane.
+             * 
+             * @param[in] lane - The lane, must be smaller than 64.
+             * @returns The value of the lane.
+             */
+            BooleanFunction::Value get(u32 lane) const;
+
+            /**
+             * Set the value of a single lane.
+             * 
+             * @param[in] lane - The lane, must be smaller than 64.
+             * @param[in] v - The value to set.
+             */
+            void set(u32 lane, BooleanFunction::Value v);
+
+            /**
+             * Construct lanes that all hold the same value.
+             * 
+             * @param[in] v - The value.
+             * @returns The lanes.
+             */
+            static Lanes broadcast(BooleanFunction::Value v);
+
+            bool operator==(const Lanes& other) const
+            {
+                return value == other.value && known == other.known;
+            }
+
+            bool operator!=(const Lanes& other) const
+            {
+                return !(*this == other);
+            }
+        };
+
+        /**
+         * Constructs an empty compiled Boolean function that always evaluates to `X`.
+         */
+        CompiledBooleanFunction() = default;
+
+        /**
+         * Compiles a single-bit Boolean function.
+         * Only the operations `And`, `Or`, `Not`, `Xor`, and `Ite` on single-bit operands are supported.
+         * 
+         * @param[in] function - The Boolean function to compile.
+         * @param[in] slots - The names of the variables in the order of the slots they are read from during evaluation.
+         * @returns The compiled Boolean function on success, an error otherwise.
+         */
+        static Result<CompiledBooleanFunction> compile(const BooleanFunction& function, const std::vector<std::string>& slots);
+
+        /**
+         * Evaluates the compiled Boolean function.
+         * 
+         * @param[in] slots - The values of the variables, must hold at least `get_slot_count()` values.
+         * @returns The resulting value.
+         */
+        BooleanFunction::Value evaluate(const BooleanFunction::Value* slots) const;
+
+        /**
+         * Evaluates the compiled Boolean function for 64 independent assignments at once.
+         * Every operation is a handful of bitwise instructions on the 64 lanes, which yields the same result as evaluating each lane on its own, except that `Z` is treated as `X`.
+         * 
+         * @param[in] slots - The values of the variables, must hold at least `get_slot_count()` entries.
+         * @returns The resulting values.
+         */
+        Lanes evaluate(const Lanes* slots) const;
+
+        /**
+         * Get the number of slots the compiled Boolean function was compiled for.
+         * 
+         * @returns The number of slots.
+         */
+        u32 get_slot_count() const;
+
+        /**
+         * Get the number of instructions of the compiled program.
+         * 
+         * @returns The number of instructions.
+         */
+        u32 get_instruction_count() const;
+
+    private:
+        /// An operand either refers to a slot, to the result of a previous instruction, or holds a constant.
+        using Operand = u32;
+
+        struct Instruction
+        {
+            u16 type;
+            Operand p0;
+            Operand p1;
+            Operand p2;
+        };
+
+        std::vector<Instruction> m_program;
+        Operand m_result = (OPERAND_CONSTANT << OPERAND_KIND_SHIFT) | (BooleanFunction::Value::X + 2);
+        u32 m_slot_count = 0;
+
+        static constexpr u32 OPERAND_KIND_SHIFT = 30;
+        static constexpr u32 OPERAND_INDEX_MASK = (1u << OPERAND_KIND_SHIFT) - 1;
+        static constexpr u32 OPERAND_SLOT       = 0;
+        static constexpr u32 OPERAND_REGISTER   = 1;
+        static constexpr u32 OPERAND_CONSTANT   = 2;
+
+        /// The number of registers that are held on the stack during evaluation, larger programs allocate.
+        static constexpr u32 STACK_REGISTERS = 64;
+
+        static Operand make_operand(u32 kind, u32 index);
+        static Operand make_constant(BooleanFunction::Value value);
+        static bool is_constant(Operand operand);
+        static BooleanFunction::Value get_constant(Operand operand);
+        static BooleanFunction::Value apply(u16 type, BooleanFunction::Value p0, BooleanFunction::Value p1, BooleanFunction::Value p2);
+
+        void run(const BooleanFunction::Value* slots, BooleanFunction::Value* registers) const;
+        void run(const Lanes* slots, Lanes* registers) const;
+    };
+}    // namespace hal
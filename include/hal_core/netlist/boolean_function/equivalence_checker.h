@@ -0,0 +1,184 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/netlist/boolean_function/types.h"
+
+#include <array>
+#include <atomic>
+#include <string>
+
+namespace hal
+{
+    namespace SMT
+    {
+        class SolverSessionPool;
+
+        /**
+         * Decides whether two Boolean functions are equivalent, calling an SMT solver only for the pairs that cheaper checks cannot decide.
+         *
+         * A check runs up to three stages:
+         * 1. If the two functions have no more than `MAX_TRUTH_TABLE_VARIABLES` input bits in total, their truth tables are computed 64 rows at a time and compared, which decides the check either way.
+         * 2. Otherwise, both functions are simulated for a number of random input assignments 64 at a time, which refutes equivalence as soon as one assignment yields different outputs.
+         * 3. Only pairs that agree on all simulated assignments are handed to the SMT solver through the shared `SolverSessionPool` of the query configuration.
+         *
+         * The first two stages only apply to functions of the operations that are defined for two-valued inputs without division and remainder, and whose constants do not hold `X` or `Z`.
+         * All other functions go to the solver right away.
+         * The checker counts how many checks were decided by which stage and may be used by multiple threads at once.
+         */
+        class EquivalenceChecker final
+        {
+        public:
+            /// The largest number of input bits for which the exhaustive truth tables of two functions are compared.
+            static constexpr u32 MAX_TRUTH_TABLE_VARIABLES = 16;
+
+            /**
+             * The stage of an equivalence check.
+             */
+            enum class Stage
+            {
+                TruthTable,
+                Simulation,
+                Solver
+            };
+
+            /**
+             * The outcome of an equivalence check.
+             */
+            struct Verdict
+            {
+                /// `UnSat` if the functions are equivalent, `Sat` if they are not, and `Unknown` if the solver could not decide in time. Refutations carry a distinguishing input assignment as model if model generation is enabled.
+                SolverResult result;
+                /// The stage that decided the check.
+                Stage stage = Stage::Solver;
+
+                /**
+                 * Checks whether the functions were proven to be equivalent.
+                 *
+                 * @returns `true` if the functions are equivalent, `false` otherwise.
+                 */
+                bool is_equivalent() const;
+            };
+
+            /**
+             * The number of checks decided by each stage.
+             */
+            struct Statistics
+            {
+                /// The number of checks that proved equivalence by comparing truth tables.
+                u64 truth_table_equivalent = 0;
+                /// The number of checks that refuted equivalence by comparing truth tables.
+                u64 truth_table_different = 0;
+                /// The number of checks that refuted equivalence by random simulation.
+                u64 simulation_different = 0;
+                /// The number of checks the solver proved equivalence for.
+                u64 solver_equivalent = 0;
+                /// The number of checks the solver refuted equivalence for.
+                u64 solver_different = 0;
+                /// The number of checks the solver could not decide.
+                u64 solver_unknown = 0;
+
+                /**
+                 * Returns the total number of checks.
+                 *
+                 * @returns The number of checks.
+                 */
+                u64 get_num_checks() const;
+
+                /**
+                 * Returns the number of checks that were decided without calling the solver.
+                 *
+                 * @returns The number of checks.
+                 */
+                u64 get_num_filtered() const;
+
+                /**
+                 * Returns a single-line summary of the statistics.
+                 *
+                 * @returns The summary.
+                 */
+                std::string to_string() const;
+            };
+
+            /**
+             * Constructs an equivalence checker.
+             *
+             * @param[in] config - The SMT query configuration for the checks that reach the solver.
+             * @param[in] num_simulation_rounds - The number of rounds of 64 random input assignments each that are simulated before calling the solver.
+             * @param[in] seed - The seed of the random input assignments.
+             */
+            explicit EquivalenceChecker(const QueryConfig& config = QueryConfig(), u32 num_simulation_rounds = 16, u64 seed = 0);
+
+            EquivalenceChecker(const EquivalenceChecker&) = delete;
+            EquivalenceChecker& operator=(const EquivalenceChecker&) = delete;
+
+            /**
+             * Returns the query configuration of the checks that reach the solver.
+             *
+             * @returns The SMT query configuration.
+             */
+            const QueryConfig& get_config() const;
+
+            /**
+             * Checks whether two Boolean functions are equivalent, i.e., evaluate to the same value for every assignment of their variables.
+             *
+             * @param[in] lhs - The first Boolean function.
+             * @param[in] rhs - The second Boolean function, must be of the same size as the first one.
+             * @returns The verdict on success, an error otherwise.
+             */
+            Result<Verdict> check(const BooleanFunction& lhs, const BooleanFunction& rhs);
+
+            /**
+             * Returns the number of checks decided by each stage since construction or the last call to `reset_statistics`.
+             *
+             * @returns The statistics.
+             */
+            Statistics get_statistics() const;
+
+            /**
+             * Resets all counters of the statistics to zero.
+             */
+            void reset_statistics();
+
+        private:
+            enum Counter
+            {
+                TRUTH_TABLE_EQUIVALENT,
+                TRUTH_TABLE_DIFFERENT,
+                SIMULATION_DIFFERENT,
+                SOLVER_EQUIVALENT,
+                SOLVER_DIFFERENT,
+                SOLVER_UNKNOWN,
+                NUM_COUNTERS
+            };
+
+            QueryConfig m_config;
+            SolverSessionPool& m_solver_pool;
+            u32 m_num_simulation_rounds;
+            u64 m_seed;
+            std::array<std::atomic<u64>, NUM_COUNTERS> m_counters = {};
+        };
+    }    // namespace SMT
+}    // namespace hal
@@ -52,5 +52,11 @@ namespace hal
 	 * @returns Simplified boolean function on success, error otherwise.
 	 * */
         Result<BooleanFunction> abc_simplification(const BooleanFunction& function);
+
+        /**
+	 * Removes all results of previous simplifications using ABC, which are shared by all functions that only differ in the names of their inputs.
+	 * Subsequent simplifications run ABC again.
+	 * */
+        void clear_abc_cache();
     }    // namespace Simplification
 }    // namespace hal
\ No newline at end of file
@@ -0,0 +1,271 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/netlist/boolean_function/types.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace subprocess
+{
+    class Popen;
+}    // namespace subprocess
+
+namespace hal
+{
+    namespace SMT
+    {
+        /**
+         * An SMT solver process that is kept alive across queries and is used incrementally.
+         * Unlike `Solver::query`, which starts a new solver process and translates all constraints for every single query, a session starts its solver once and keeps the constraints that were added to it.
+         * Constraints are scoped by `push` and `pop`, and `check` decides the constraints of the session together with a list of assumptions through `check-sat-assuming`.
+         *
+         * Sessions are available for the Z3 and Boolector binaries. The timeout of the query configuration applies to every single check of a Z3 session, Boolector sessions run without a timeout.
+         * A session must not be used by multiple threads at once, see `SolverSessionPool` to share sessions between threads.
+         */
+        class SolverSession final
+        {
+        public:
+            /**
+             * Checks whether sessions are available for the given query configuration, i.e., whether it asks for a local binary of a solver that sessions are implemented for.
+             *
+             * @param[in] config - The SMT query configuration.
+             * @returns `true` if sessions are available, `false` otherwise.
+             */
+            static bool is_supported(const QueryConfig& config);
+
+            /**
+             * Starts a solver process for a new session.
+             *
+             * @param[in] config - The SMT query configuration used for all checks of the session.
+             * @returns The session on success, an error otherwise.
+             */
+            static Result<std::unique_ptr<SolverSession>> start(const QueryConfig& config);
+
+            /**
+             * Terminates the solver process.
+             */
+            ~SolverSession();
+
+            SolverSession(const SolverSession&) = delete;
+            SolverSession& operator=(const SolverSession&) = delete;
+
+            /**
+             * Returns the query configuration of the session.
+             *
+             * @returns The SMT query configuration.
+             */
+            const QueryConfig& get_config() const;
+
+            /**
+             * Checks whether the solver process is still running and has not reported an error it cannot recover from.
+             *
+             * @returns `true` if the session can be used, `false` otherwise.
+             */
+            bool is_alive() const;
+
+            /**
+             * Returns the number of scopes that have been opened by `push` and not yet closed by `pop`.
+             *
+             * @returns The number of open scopes.
+             */
+            u32 get_num_scopes() const;
+
+            /**
+             * Opens a new scope. Constraints added afterwards are removed by the matching `pop`.
+             *
+             * @returns OK() on success, an error otherwise.
+             */
+            Result<std::monostate> push();
+
+            /**
+             * Closes the innermost scope and removes all constraints that were added within it.
+             *
+             * @returns OK() on success, an error otherwise.
+             */
+            Result<std::monostate> pop();
+
+            /**
+             * Adds constraints to the innermost scope of the session. Variables that were not used by the session before are declared on the fly.
+             *
+             * @param[in] constraints - The constraints.
+             * @returns OK() on success, an error otherwise.
+             */
+            Result<std::monostate> add_constraints(const std::vector<Constraint>& constraints);
+
+            /**
+             * Checks whether the constraints of the session are satisfiable if all assumptions hold.
+             * Each assumption is a Boolean function of size 1 that is assumed to evaluate to `1`, the assumptions are not kept for subsequent checks.
+             * A model is generated if the query configuration of the session asks for it.
+             *
+             * @param[in] assumptions - The assumptions.
+             * @returns OK() and the result on success, an error otherwise.
+             */
+            Result<SolverResult> check(const std::vector<BooleanFunction>& assumptions = {});
+
+            /**
+             * Checks whether the constraints of the session together with the given constraints are satisfiable, leaving the session unchanged.
+             * This is the equivalent of `Solver::query` on a running solver process.
+             *
+             * @param[in] constraints - The constraints.
+             * @returns OK() and the result on success, an error otherwise.
+             */
+            Result<SolverResult> query(const std::vector<Constraint>& constraints);
+
+        private:
+            /// The variables and assumption literals declared within a scope, which the solver forgets once the scope is closed.
+            struct Scope
+            {
+                std::vector<std::string> variables;
+                std::vector<std::string> assumptions;
+            };
+
+            SolverSession(const QueryConfig& config);
+
+            /**
+             * Sends commands to the solver process and collects its output up to the end of the commands.
+             *
+             * @param[in] commands - The SMT-LIB v2 commands.
+             * @returns OK() and the output of the solver on success, an error otherwise.
+             */
+            Result<std::string> run(const std::string& commands);
+
+            /**
+             * Appends declarations of all variables of a Boolean function that are not declared yet to a command string.
+             *
+             * @param[in] function - The Boolean function.
+             * @param[out] commands - The command string.
+             */
+            void declare_variables(const BooleanFunction& function, std::string& commands);
+
+            QueryConfig m_config;
+            std::unique_ptr<subprocess::Popen> m_process;
+            bool m_alive = false;
+
+            /// the scopes of the session, the outermost scope first
+            std::vector<Scope> m_scopes;
+            /// maps every declared variable to its size
+            std::map<std::string, u16> m_variables;
+            /// maps the SMT-LIB v2 representation of every assumption to the literal that stands in for it
+            std::map<std::string, std::string> m_assumptions;
+            u32 m_next_literal = 0;
+        };
+
+        /**
+         * A pool of solver sessions of one query configuration that are shared between threads.
+         * A thread leases a session for as long as it needs it, sessions are started on demand up to a maximum number and are reused once they have been returned.
+         */
+        class SolverSessionPool final
+        {
+        public:
+            /**
+             * A session that is leased from a pool and returned to it on destruction.
+             * A leased session already has one scope open, so that all constraints added by the lessee, even those added without calling `push`, are removed once the session is returned.
+             * Closing that scope by calling `pop` more often than `push` would leave the constraints added afterwards in the session for every later lessee and must be avoided.
+             * A session that is no longer alive is dropped instead of being returned.
+             */
+            class Lease final
+            {
+            public:
+                Lease(SolverSessionPool* pool, std::unique_ptr<SolverSession> session);
+                Lease(Lease&& other) = default;
+                Lease& operator=(Lease&& other);
+                ~Lease();
+
+                SolverSession* operator->() const;
+                SolverSession& operator*() const;
+
+            private:
+                void release();
+
+                SolverSessionPool* m_pool;
+                std::unique_ptr<SolverSession> m_session;
+            };
+
+            /**
+             * Constructs an empty pool.
+             *
+             * @param[in] config - The SMT query configuration of all sessions of the pool.
+             * @param[in] max_sessions - The maximum number of sessions running at once, `0` for the number of hardware threads.
+             */
+            SolverSessionPool(const QueryConfig& config, u32 max_sessions = 0);
+
+            /**
+             * Returns a pool that is shared by all callers using the same query configuration throughout the process.
+             *
+             * @param[in] config - The SMT query configuration.
+             * @returns The shared pool.
+             */
+            static SolverSessionPool& get_shared(const QueryConfig& config);
+
+            /**
+             * Returns the query configuration of the sessions of the pool.
+             *
+             * @returns The SMT query configuration.
+             */
+            const QueryConfig& get_config() const;
+
+            /**
+             * Returns the number of sessions of the pool that are currently running, whether leased or not.
+             *
+             * @returns The number of sessions.
+             */
+            u32 get_num_sessions() const;
+
+            /**
+             * Leases a session, which is an idle session if there is one or a newly started one otherwise.
+             * Waits for a session to be returned if the maximum number of sessions is running.
+             * The session is handed out with one scope open on top of its outermost scope, see `Lease`.
+             *
+             * @returns The leased session on success, an error if no session could be started.
+             */
+            Result<Lease> acquire();
+
+            /**
+             * Checks whether the given constraints are satisfiable on a leased session.
+             * Falls back to `Solver::query` if sessions are not available for the query configuration of the pool.
+             *
+             * @param[in] constraints - The constraints.
+             * @returns OK() and the result on success, an error otherwise.
+             */
+            Result<SolverResult> query(const std::vector<Constraint>& constraints);
+
+        private:
+            void release(std::unique_ptr<SolverSession> session);
+
+            QueryConfig m_config;
+            u32 m_max_sessions;
+
+            mutable std::mutex m_mutex;
+            std::condition_variable m_released;
+            std::vector<std::unique_ptr<SolverSession>> m_idle_sessions;
+            u32 m_num_sessions = 0;
+        };
+    }    // namespace SMT
+}    // namespace hal
@@ -31,6 +31,7 @@
 
 #include <map>
 #include <optional>
+#include <set>
 #include <string>
 
 namespace hal
@@ -284,6 +285,18 @@ namespace hal
 			 */
             static Result<Model> parse(const std::string& model_str, const SolverType& solver);
 
+            /**
+			 * Parses only the given variables of an SMT-Lib model from a string output by a solver of the given type.
+			 * The remaining definitions of the model are skipped without being parsed and scanning stops as soon as all given variables have been found, which makes this considerably faster than `parse` for large models.
+			 * Variables that are not defined in the model are not part of the returned model.
+			 *
+			 * @param[in] model_str - The SMT-Lib model string.
+			 * @param[in] solver - The solver that computed the model.
+			 * @param[in] variables - The names of the variables to extract.
+			 * @returns The model restricted to the given variables on success, an error otherwise.
+			 */
+            static Result<Model> parse(const std::string& model_str, const SolverType& solver, const std::set<std::string>& variables);
+
             /**
 			 * Evaluates the given Boolean function by replacing all variables contained in the model with their corresponding value and simplifying the result.
 			 *
@@ -28,6 +28,7 @@
 #include "hal_core/defines.h"
 
 #include <map>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -106,11 +107,12 @@ namespace hal
         bool delete_data(const std::string& category, const std::string& key, const bool log_with_info_level = false);
 
         /**
-         * Get a map from ((1) category, (2) key) to ((1) type, (2) value) containing all stored data entries.
+         * Get a map from ((1) category, (2) key) to ((1) type, (2) value) containing all stored data entries.<br>
+         * The map is assembled on every call.
          *
          * @returns The stored data as a map.
          */
-        const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& get_data_map() const;
+        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> get_data_map() const;
 
         /**
          * Overwrite the existing data with a new map from ((1) category, (2) key) to ((1) type, (2) value).
@@ -120,6 +122,24 @@ namespace hal
         void set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map);
 
     protected:
-        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> m_data;
+        /**
+         * A data entry. Category, key, and type are shared through the global string pool since the same few of them are used by almost all entries.
+         */
+        struct Entry
+        {
+            const std::string* category;
+            const std::string* key;
+            const std::string* type;
+            std::string value;
+
+            bool operator==(const Entry& other) const;
+        };
+
+        /* the entries sorted by the addresses of their category and key */
+        std::vector<Entry> m_data;
+
+    private:
+        std::vector<Entry>::const_iterator lower_bound_entry(const std::string* category, const std::string* key) const;
+        std::vector<Entry>::const_iterator find_entry(const std::string* category, const std::string* key) const;
     };
 }    // namespace hal
@@ -29,6 +29,8 @@
 #include "hal_core/utilities/enums.h"
 
 #include <iostream>
+#include <map>
+#include <set>
 
 namespace hal
 {
@@ -157,6 +159,57 @@ namespace hal
     template<>
     std::map<GroupingEvent::event, std::string> EnumStrings<GroupingEvent::event>::data;
 
+    /**
+     * Holds the enumeration of the events that enclose a bulk of netlist modifications.
+     */
+    class BulkEvent
+    {
+    public:
+        enum class event
+        {
+            bulk_begin,    ///< no associated_data
+            bulk_end       ///< associated_data = all changes recorded since the beginning of the bulk
+        };
+    };
+
+    template<>
+    std::map<BulkEvent::event, std::string> EnumStrings<BulkEvent::event>::data;
+
+    /**
+     * Summarizes the events that were emitted during a bulk of netlist modifications.
+     * For every event type, the IDs of the affected netlist elements are recorded together with the associated data of the event, i.e., repeated events are recorded only once.
+     * Since removed elements do not exist anymore when the bulk ends, they are only referenced by their IDs.
+     */
+    struct NETLIST_API BulkChanges
+    {
+        /// associated data of all netlist events
+        std::map<NetlistEvent::event, std::set<u32>> netlist_events;
+
+        /// pairs of module ID and associated data of all module events
+        std::map<ModuleEvent::event, std::set<std::pair<u32, u32>>> module_events;
+
+        /// IDs of the gates of all gate events
+        std::map<GateEvent::event, std::set<u32>> gate_events;
+
+        /// pairs of net ID and associated data of all net events
+        std::map<NetEvent::event, std::set<std::pair<u32, u32>>> net_events;
+
+        /// pairs of grouping ID and associated data of all grouping events
+        std::map<GroupingEvent::event, std::set<std::pair<u32, u32>>> grouping_events;
+
+        /**
+         * Check whether no event has been recorded.
+         *
+         * @returns `true` if no event has been recorded, `false` otherwise.
+         */
+        bool empty() const;
+
+        /**
+         * Remove all recorded events.
+         */
+        void clear();
+    };
+
     /**
      * The event handler distributes the events emitted by the netlist and its elements to all registered callbacks.
      * Callbacks are registered per event type and can be enabled or disabled individually.
@@ -169,12 +222,18 @@ namespace hal
         CallbackHook<void(GateEvent::event, Gate*, u32)> m_gate_callback;
         CallbackHook<void(NetEvent::event, Net*, u32)> m_net_callback;
         CallbackHook<void(GroupingEvent::event, Grouping*, u32)> m_grouping_callback;
+        CallbackHook<void(BulkEvent::event, const BulkChanges&)> m_bulk_callback;
         bool netlist_event_enabled;
         bool module_event_enabled;
         bool gate_event_enabled;
         bool net_event_enabled;
         bool grouping_event_enabled;
 
+        u32 m_bulk_depth = 0;
+        BulkChanges m_bulk_changes;
+
+        bool is_recording_bulk() const;
+
     public:
         EventHandler();
 
@@ -231,6 +290,26 @@ namespace hal
          */
         NETLIST_API void notify(GroupingEvent::event ev, Grouping* grouping, u32 associated_data = 0xFFFFFFFF);
 
+        /**
+         * Starts a bulk of netlist modifications.<br>
+         * All events emitted until the bulk ends are still distributed to the registered callbacks as usual, but are additionally recorded and handed to the bulk callbacks as a whole once the outermost bulk ends.
+         * Bulks can be nested.
+         */
+        NETLIST_API void begin_bulk();
+
+        /**
+         * Ends a bulk of netlist modifications.<br>
+         * When the outermost bulk ends, all bulk callbacks are executed with the changes recorded since the beginning of the bulk.
+         */
+        NETLIST_API void end_bulk();
+
+        /**
+         * Checks whether a bulk of netlist modifications is in progress.
+         *
+         * @returns `true` if a bulk is in progress, `false` otherwise.
+         */
+        NETLIST_API bool is_bulk_active() const;
+
         /**
          * Registers a callback function.
          *
@@ -271,6 +350,14 @@ namespace hal
          */
         NETLIST_API void register_callback(const std::string& name, std::function<void(GroupingEvent::event e, Grouping* grouping, u32 associated_data)> function);
 
+        /**
+         * Registers a callback function for the beginning and the end of a bulk of netlist modifications.
+         *
+         * @param[in] name - name of the callback, used for callback removal.
+         * @param[in] function - The callback function.
+         */
+        NETLIST_API void register_callback(const std::string& name, std::function<void(BulkEvent::event e, const BulkChanges& changes)> function);
+
         /**
          * Removes a callback function.
          *
@@ -279,4 +366,29 @@ namespace hal
         NETLIST_API void unregister_callback(const std::string& name);
 
     };    // class event_handler
+
+    /**
+     * Starts a bulk of netlist modifications on construction and ends it on destruction, so that the bulk also ends on early returns and exceptions.
+     */
+    class NETLIST_API EventBulkScope
+    {
+    public:
+        /**
+         * Starts a bulk of netlist modifications.
+         *
+         * @param[in] event_handler - The event handler of the modified netlist.
+         */
+        explicit EventBulkScope(EventHandler* event_handler);
+
+        /**
+         * Ends the bulk of netlist modifications.
+         */
+        ~EventBulkScope();
+
+        EventBulkScope(const EventBulkScope&)            = delete;
+        EventBulkScope& operator=(const EventBulkScope&) = delete;
+
+    private:
+        EventHandler* m_event_handler;
+    };
 }    // namespace hal
@@ -577,8 +577,8 @@ namespace hal
         std::vector<Net*> m_in_nets;
         std::vector<Net*> m_out_nets;
 
-        /* dedicated functions */
-        std::unordered_map<std::string, BooleanFunction> m_functions;
+        /* dedicated functions, only allocated once the first one is added since most gates have none */
+        std::unique_ptr<std::unordered_map<std::string, BooleanFunction>> m_functions;
 
         EventHandler* m_event_handler;
     };
@@ -67,6 +67,7 @@ namespace hal
     std::map<PinEvent, std::string> EnumStrings<PinEvent>::data;
 
     class Module;
+    class Netlist;
 
     /**
      * Wrapper class for core pin_changed events.
@@ -111,7 +112,14 @@ namespace hal
 
         static std::unordered_map<Module*,EventStack*> s_event_stack;
         static u64 s_order;
-        static int s_bulk_depth;
+        static std::unordered_map<const Netlist*,int> s_bulk_depth;
+
+        /**
+         * Checks whether a bulk scope is open for the netlist of a module.
+         * @param m The module comprising pins and pin groups
+         * @return `true` if the events of the module are collected by a bulk scope, `false` otherwise.
+         */
+        static bool is_bulk_active(const Module* m);
 
         Module* m_module;
         PinEvent m_event;
@@ -181,9 +189,10 @@ namespace hal
     };
 
     /**
-     * By creating an instance of this class all pin events of a bulk operation get collected, no matter which
-     * module they belong to. Upon destruction of the outermost instance each affected module receives a single
-     * PinEvent::PinsReload event instead of the individual events.
+     * By creating an instance of this class all pin events of a bulk operation on a netlist get collected, no matter
+     * which module of the netlist they belong to. Upon destruction of the outermost instance for that netlist each
+     * affected module receives a single PinEvent::PinsReload event instead of the individual events.
+     * Bulk scopes of different netlists are independent of each other, the pin events of other netlists are still sent immediately.
      *
      * Bulk operations like assigning thousands of gates to a module emit several pin events per pin, which is
      * both expensive to deliver and useless to a listener that has to re-read the whole module anyway.
@@ -193,15 +202,22 @@ namespace hal
     {
     public:
         /**
-         * Constructor for bulk scope instance incrementing bulk scope count
+         * Constructor for bulk scope instance incrementing bulk scope count of the netlist
+         * @param nl The netlist whose pin events are collected
          */
-        PinChangedBulkScope();
+        explicit PinChangedBulkScope(const Netlist* nl);
 
         /**
          * Destructor for bulk scope instance decrementing bulk scope count.
          * Sends the coalesced events if this was the outermost bulk scope.
          */
         ~PinChangedBulkScope();
+
+        PinChangedBulkScope(const PinChangedBulkScope&)            = delete;
+        PinChangedBulkScope& operator=(const PinChangedBulkScope&) = delete;
+
+    private:
+        const Netlist* m_netlist;
     };
 
     /**
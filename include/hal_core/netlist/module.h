@@ -36,6 +36,7 @@
 #include "hal_core/netlist/pins/pin_group.h"
 #include "hal_core/utilities/enums.h"
 #include "hal_core/utilities/result.h"
+#include "hal_core/utilities/id_allocator.h"
 
 #include <functional>
 #include <list>
@@ -718,13 +719,13 @@ namespace hal
         std::unordered_map<u32, Module*> m_submodules_map;
         std::vector<Module*> m_submodules;
 
+        /* interval of the module in a depth-first traversal of the hierarchy, maintained by the internal manager */
+        mutable u32 m_hierarchy_enter = 0;
+        mutable u32 m_hierarchy_exit  = 0;
+
         // pins
-        u32 m_next_pin_id;
-        std::set<u32> m_used_pin_ids;
-        std::set<u32> m_free_pin_ids;
-        u32 m_next_pin_group_id;
-        std::set<u32> m_used_pin_group_ids;
-        std::set<u32> m_free_pin_group_ids;
+        IdAllocator m_pin_ids;
+        IdAllocator m_pin_group_ids;
 
         u32 m_next_input_index  = 0;
         u32 m_next_inout_index  = 0;
@@ -419,11 +419,9 @@ namespace hal
         /* grouping */
         Grouping* m_grouping = nullptr;
 
-        /* stores the dst gate and pin id of the dst gate */
-        std::vector<std::unique_ptr<Endpoint>> m_destinations;
-        std::vector<std::unique_ptr<Endpoint>> m_sources;
-        std::vector<Endpoint*> m_destinations_raw;
-        std::vector<Endpoint*> m_sources_raw;
+        /* stores the dst gate and pin id of the dst gate, the endpoints are owned by the internal manager */
+        std::vector<Endpoint*> m_destinations;
+        std::vector<Endpoint*> m_sources;
 
         EventHandler* m_event_handler;
     };
@@ -28,6 +28,7 @@
 #include "hal_core/defines.h"
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/utilities/id_allocator.h"
 
 #include <functional>
 #include <memory>
@@ -452,6 +453,37 @@ namespace hal
          */
         void enable_automatic_net_checks(bool enable_checks = true);
 
+        /*
+         * ################################################################
+         *      transaction functions
+         * ################################################################
+         */
+
+        /**
+         * Start an edit transaction.<br>
+         * Within a transaction, assigning gates to modules, changing the module hierarchy, and connecting or disconnecting nets no longer update the input, output, and internal nets and the pins of all affected modules after every single change.
+         * Instead, every affected net is checked exactly once for every affected module when the transaction is committed, and all pin events of a module are replaced by a single `PinEvent::PinsReload`.
+         * Until then, the nets and pins of the modules may be outdated.<br>
+         * Transactions can be nested, only committing the outermost transaction updates the modules.
+         * See `NetlistTransaction` for a transaction that is committed when it goes out of scope.
+         */
+        void begin_transaction();
+
+        /**
+         * Commit the edit transaction that has been started last.<br>
+         * Committing the outermost transaction updates the nets and pins of all modules affected by the transaction and sends the pin events.
+         *
+         * @returns Ok() on success, an error otherwise.
+         */
+        Result<std::monostate> commit_transaction();
+
+        /**
+         * Check whether an edit transaction is active.
+         *
+         * @returns `true` if a transaction is active, `false` otherwise.
+         */
+        bool is_transaction_active() const;
+
         /*
          * ################################################################
          *      module functions
@@ -838,18 +870,10 @@ namespace hal
         std::unique_ptr<EventHandler> m_event_handler;
 
         /* stores the auto generated ids for fast next id */
-        u32 m_next_gate_id;
-        std::set<u32> m_used_gate_ids;
-        std::set<u32> m_free_gate_ids;
-        u32 m_next_net_id;
-        std::set<u32> m_used_net_ids;
-        std::set<u32> m_free_net_ids;
-        u32 m_next_module_id;
-        std::set<u32> m_used_module_ids;
-        std::set<u32> m_free_module_ids;
-        u32 m_next_grouping_id;
-        std::set<u32> m_used_grouping_ids;
-        std::set<u32> m_free_grouping_ids;
+        IdAllocator m_gate_ids;
+        IdAllocator m_net_ids;
+        IdAllocator m_module_ids;
+        IdAllocator m_grouping_ids;
 
         /* stores the modules */
         Module* m_top_module;
@@ -878,4 +902,41 @@ namespace hal
         std::vector<Gate*> m_gnd_gates;
         std::vector<Gate*> m_vcc_gates;
     };
+
+    /**
+     * An edit transaction on a netlist that is started on construction and committed on destruction, unless it has been committed before.
+     * See `Netlist::begin_transaction` for the effects of a transaction.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API NetlistTransaction
+    {
+    public:
+        /**
+         * Start an edit transaction on the given netlist.
+         *
+         * @param[in] netlist - The netlist.
+         */
+        explicit NetlistTransaction(Netlist* netlist);
+
+        /**
+         * Commit the transaction unless it has been committed before.
+         */
+        ~NetlistTransaction();
+
+        NetlistTransaction(const NetlistTransaction&)            = delete;
+        NetlistTransaction& operator=(const NetlistTransaction&) = delete;
+
+        /**
+         * Commit the transaction.<br>
+         * Does nothing if the transaction has been committed before.
+         *
+         * @returns Ok() on success, an error otherwise.
+         */
+        Result<std::monostate> commit();
+
+    private:
+        Netlist* m_netlist;
+        bool m_committed = false;
+    };
 }    // namespace hal
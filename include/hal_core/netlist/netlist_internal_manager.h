@@ -26,10 +26,18 @@
 #pragma once
 
 #include "hal_core/defines.h"
+#include "hal_core/netlist/endpoint.h"
 #include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/gate_library/enums/pin_event.h"
 #include "hal_core/netlist/pins/gate_pin.h"
+#include "hal_core/utilities/object_pool.h"
+#include "hal_core/utilities/result.h"
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace hal
@@ -40,7 +48,6 @@ namespace hal
     class GateType;
     class Net;
     class Module;
-    class Endpoint;
     class Grouping;
     class BooleanFunction;
 
@@ -80,6 +87,7 @@ namespace hal
         bool net_remove_source(Net* net, Endpoint* ep);
         Endpoint* net_add_destination(Net* net, Gate* gate, GatePin* pin);
         bool net_remove_destination(Net* net, Endpoint* ep);
+        ObjectPool<Endpoint> m_endpoint_pool;
 
         // module functions
         Module* create_module(u32 id, Module* parent, const std::string& name);
@@ -87,6 +95,13 @@ namespace hal
         bool module_assign_gate(Module* m, Gate* g);
         bool module_assign_gates(Module* module, const std::vector<Gate*>& gates);
         bool module_check_net(Module* module, Net* net, bool recursive = false);
+        Result<std::monostate> module_update_net(Module* module, Net* net);
+
+        // module hierarchy index
+        void invalidate_module_hierarchy();
+        void update_module_hierarchy() const;
+        mutable std::mutex m_module_hierarchy_mutex;
+        mutable std::atomic<bool> m_module_hierarchy_valid{false};
 
         // grouping functions
         Grouping* create_grouping(u32 id, const std::string name);
@@ -98,6 +113,15 @@ namespace hal
         bool grouping_assign_module(Grouping* grouping, Module* module, bool force = false);
         bool grouping_remove_module(Grouping* grouping, Module* module);
 
+        // transaction functions
+        void begin_transaction();
+        Result<std::monostate> commit_transaction();
+        Result<std::monostate> flush_net_checks(Net* net);
+        bool check_net_for_modules(Net* net, const std::vector<Module*>& modules);
+        u32 m_transaction_depth = 0;
+        std::unordered_map<Net*, std::vector<Module*>> m_transaction_net_checks;
+        std::unique_ptr<PinChangedBulkScope> m_transaction_pin_scope;
+
         // caches
         void clear_caches();
         mutable std::map<std::pair<std::vector<GatePin*>, u64>, BooleanFunction> m_lut_function_cache;
@@ -0,0 +1,185 @@
+// MIT License
+// 
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/memory_mapped_file.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <string_view>
+
+namespace hal
+{
+    /* forward declaration */
+    class Netlist;
+
+    class GateLibrary;
+
+    /**
+     * @file
+     *
+     * \namespace netlist_binary_serializer
+     * Contains the functions that serialize a netlist to and deserialize it from HAL's binary `.halb` file format.<br>
+     * Other than the JSON-based `.hal` format, the binary format stores gates, nets, endpoints, modules, pins, and data entries in compact tables of fixed-size records that reference each other by ID and share a common string table.
+     * Files are mapped into memory for reading and the netlist is only built from the tables on request.
+     *
+     * @ingroup persistent
+     */
+    namespace netlist_binary_serializer
+    {
+        /**
+         * The version of the binary file format written by this serializer.
+         */
+        const u32 BINARY_FORMAT_VERSION = 1;
+
+        /**
+         * The file extension of binary netlist files.
+         */
+        const std::string FILE_EXTENSION = ".halb";
+
+        /**
+         * A binary netlist file that has been mapped into memory.<br>
+         * General information about the netlist and the sizes of its tables can be queried directly from the mapped file, the netlist itself is only materialized on request.
+         *
+         * @ingroup persistent
+         */
+        class NETLIST_API NetlistImage
+        {
+        public:
+            /**
+             * Map a binary netlist file into memory and validate its header and string table.
+             *
+             * @param[in] halb_file - The path to the `.halb` file.
+             * @returns The netlist image on success, an error otherwise.
+             */
+            static Result<std::unique_ptr<NetlistImage>> open(const std::filesystem::path& halb_file);
+
+            /**
+             * Get the version of the binary file format the file was written with.
+             *
+             * @returns The format version.
+             */
+            u32 get_format_version() const;
+
+            /**
+             * Get the ID of the stored netlist.
+             *
+             * @returns The netlist ID.
+             */
+            u32 get_netlist_id() const;
+
+            /**
+             * Get the path to the gate library of the stored netlist.
+             *
+             * @returns The gate library path.
+             */
+            std::string_view get_gate_library_path() const;
+
+            /**
+             * Get the name of the file the stored netlist was originally parsed from.
+             *
+             * @returns The input file name.
+             */
+            std::string_view get_input_filename() const;
+
+            /**
+             * Get the design name of the stored netlist.
+             *
+             * @returns The design name.
+             */
+            std::string_view get_design_name() const;
+
+            /**
+             * Get the device name of the stored netlist.
+             *
+             * @returns The device name.
+             */
+            std::string_view get_device_name() const;
+
+            /**
+             * Get the number of gates of the stored netlist.
+             *
+             * @returns The number of gates.
+             */
+            u32 get_gate_count() const;
+
+            /**
+             * Get the number of nets of the stored netlist.
+             *
+             * @returns The number of nets.
+             */
+            u32 get_net_count() const;
+
+            /**
+             * Get the number of modules of the stored netlist including the top module.
+             *
+             * @returns The number of modules.
+             */
+            u32 get_module_count() const;
+
+            /**
+             * Build the stored netlist using the provided gate library.<br>
+             * If no gate library is provided, the gate library stored within the file is loaded.
+             *
+             * @param[in] gate_lib - The gate library. Defaults to a `nullptr`.
+             * @returns The netlist on success, an error otherwise.
+             */
+            Result<std::unique_ptr<Netlist>> materialize(const GateLibrary* gate_lib = nullptr) const;
+
+        private:
+            NetlistImage() = default;
+
+            template<typename T>
+            std::pair<const T*, u32> get_table(u32 section) const;
+            std::string_view get_string(u32 string_id) const;
+
+            MemoryMappedFile m_file;
+            std::vector<std::string_view> m_sections;
+            const u64* m_string_offsets = nullptr;
+            u32 m_num_strings           = 0;
+        };
+
+        /**
+         * Serializes a netlist into a `.halb` file.
+         *
+         * @param[in] netlist - The netlist to serialize.
+         * @param[in] halb_file - The path to the `.halb` file.
+         * @returns `true` on success, `false` otherwise.
+         */
+        NETLIST_API bool serialize_to_file(const Netlist* netlist, const std::filesystem::path& halb_file);
+
+        /**
+         * Deserializes a netlist from a `.halb` file using the provided gate library.
+         * If no gate library is provided, the gate library path stored within the `.halb` file is used.
+         *
+         * @param[in] halb_file - The path to the `.halb` file.
+         * @param[in] gate_lib - The gate library. Defaults to a `nullptr`.
+         * @returns The deserialized netlist on success, a `nullptr` otherwise.
+         */
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& halb_file, const GateLibrary* gate_lib = nullptr);
+    }    // namespace netlist_binary_serializer
+}    // namespace hal
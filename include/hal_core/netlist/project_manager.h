@@ -57,12 +57,22 @@ namespace hal
             SAVED   /**< Represents a saved project state. */
         };
 
+        /**
+         * Represents the file format the netlist of the project is serialized to.
+         */
+        enum NetlistFormat
+        {
+            JSON,  /**< Represents the JSON-based `.hal` format. */
+            BINARY /**< Represents the binary `.halb` format. */
+        };
+
     private:
         ProjectManager();
 
         static ProjectManager* inst;
 
         ProjectStatus m_project_status;
+        NetlistFormat m_netlist_format;
         Netlist* m_netlist_save;
         std::unique_ptr<Netlist> m_netlist_load;
         ProjectDirectory m_proj_dir;
@@ -74,6 +84,8 @@ namespace hal
 
         bool serialize_external(bool shadow);
 
+        std::string get_netlist_extension() const;
+
         /**
          * Internal method to deserialize hal project, called by open_project()
          *
@@ -145,6 +157,21 @@ namespace hal
          */
         void dump() const;
 
+        /**
+         * Returns the file format the netlist is serialized to when saving the project.
+         *
+         * @return The netlist format.
+         */
+        NetlistFormat get_netlist_format() const;
+
+        /**
+         * Set the file format the netlist is serialized to when saving the project.
+         * Opening a project sets the format to the one of the stored netlist file.
+         *
+         * @param[in] format - The netlist format.
+         */
+        void set_netlist_format(NetlistFormat format);
+
         /**
          * Set the path to the gate library file.
          *
@@ -50,6 +50,7 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/netlist/netlist_utils.h"
 #include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
 #include "hal_core/netlist/pins/base_pin.h"
 #include "hal_core/netlist/pins/gate_pin.h"
@@ -61,6 +62,7 @@
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/program_arguments.h"
 #include "hal_core/utilities/program_options.h"
+#include "hal_core/utilities/thread_pool.h"
 #include "hal_core/utilities/utils.h"
 
 #pragma GCC diagnostic push
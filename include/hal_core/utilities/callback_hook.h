@@ -209,7 +209,7 @@ namespace hal
          *
          * @returns The amount of all registered callback functions.
          */
-        size_t size()
+        size_t size() const
         {
             return m_callbacks.size();
         }
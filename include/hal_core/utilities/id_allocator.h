@@ -0,0 +1,174 @@
+// MIT License
+// 
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Keeps track of the IDs that are used and freed for one kind of object, e.g., the gates of a netlist.<br>
+     * IDs are stored as ranges of consecutive IDs instead of one by one, so that the IDs of objects that were created one after another take up a single entry.
+     * An ID that was freed is handed out again before any ID that has never been used.
+     *
+     * @ingroup utilities
+     */
+    class CORE_API IdAllocator
+    {
+    public:
+        /**
+         * A range of consecutive IDs given by its first and its last ID.
+         */
+        using Range = std::pair<u32, u32>;
+
+        /**
+         * Get an ID that is not in use.<br>
+         * This is the smallest freed ID if there is one, otherwise the smallest unused ID that is not smaller than the next ID. The ID is not marked as used.
+         *
+         * @returns The ID.
+         */
+        u32 get_unique_id();
+
+        /**
+         * Check whether an ID is in use.
+         *
+         * @param[in] id - The ID.
+         * @returns `true` if the ID is in use, `false` otherwise.
+         */
+        bool is_used(u32 id) const;
+
+        /**
+         * Mark an ID as used, which also removes it from the freed IDs.
+         *
+         * @param[in] id - The ID.
+         */
+        void mark_used(u32 id);
+
+        /**
+         * Mark a used ID as freed so that it is handed out again.
+         *
+         * @param[in] id - The ID.
+         */
+        void release(u32 id);
+
+        /**
+         * Get the ID from which the search for an unused ID starts if no ID has been freed.
+         *
+         * @returns The next ID.
+         */
+        u32 get_next_id() const;
+
+        /**
+         * Set the ID from which the search for an unused ID starts if no ID has been freed.
+         *
+         * @param[in] id - The next ID.
+         */
+        void set_next_id(u32 id);
+
+        /**
+         * Get all used IDs.
+         *
+         * @returns The used IDs.
+         */
+        std::set<u32> get_used_ids() const;
+
+        /**
+         * Replace all used IDs.
+         *
+         * @param[in] ids - The used IDs.
+         */
+        void set_used_ids(const std::set<u32>& ids);
+
+        /**
+         * Get all freed IDs.
+         *
+         * @returns The freed IDs.
+         */
+        std::set<u32> get_free_ids() const;
+
+        /**
+         * Replace all freed IDs.
+         *
+         * @param[in] ids - The freed IDs.
+         */
+        void set_free_ids(const std::set<u32>& ids);
+
+        /**
+         * Get the used IDs as ranges of consecutive IDs in ascending order.
+         *
+         * @returns The ranges of used IDs.
+         */
+        std::vector<Range> get_used_ranges() const;
+
+        /**
+         * Replace all used IDs by the given ranges of consecutive IDs.
+         *
+         * @param[in] ranges - The ranges of used IDs.
+         */
+        void set_used_ranges(const std::vector<Range>& ranges);
+
+        /**
+         * Get the freed IDs as ranges of consecutive IDs in ascending order.
+         *
+         * @returns The ranges of freed IDs.
+         */
+        std::vector<Range> get_free_ranges() const;
+
+        /**
+         * Replace all freed IDs by the given ranges of consecutive IDs.
+         *
+         * @param[in] ranges - The ranges of freed IDs.
+         */
+        void set_free_ranges(const std::vector<Range>& ranges);
+
+    private:
+        /**
+         * A set of IDs that is stored as disjoint ranges, mapping the first ID of every range to its last ID.
+         */
+        class RangeSet
+        {
+        public:
+            bool contains(u32 id) const;
+            void insert(u32 id);
+            void erase(u32 id);
+            void assign(const std::vector<Range>& ranges);
+            void assign(const std::set<u32>& ids);
+            std::set<u32> get_ids() const;
+            std::vector<Range> get_ranges() const;
+
+            std::map<u32, u32> m_ranges;
+        };
+
+        u32 m_next_id = 1;
+        RangeSet m_used;
+        RangeSet m_free;
+    };
+}    // namespace hal
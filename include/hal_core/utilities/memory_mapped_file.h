@@ -0,0 +1,87 @@
+// MIT License
+// 
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <string_view>
+
+namespace hal
+{
+    /**
+     * A read-only view of a file that is mapped into memory.<br>
+     * The contents of the file are paged in by the operating system on access instead of being copied into a buffer, so that even files larger than the available memory can be read sequentially.
+     * The view stays valid until the file is closed or the object is destroyed.
+     *
+     * @ingroup utilities
+     */
+    class CORE_API MemoryMappedFile
+    {
+    public:
+        MemoryMappedFile() = default;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&)            = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+        /**
+         * Map a file into memory for reading.<br>
+         * Any previously mapped file is closed first.
+         *
+         * @param[in] file_path - The path to the file.
+         * @returns Ok() on success, an error otherwise.
+         */
+        Result<std::monostate> open(const std::filesystem::path& file_path);
+
+        /**
+         * Unmap the file. All views handed out before are invalidated.
+         */
+        void close();
+
+        /**
+         * Check whether a file is mapped.
+         *
+         * @returns `true` if a file is mapped, `false` otherwise.
+         */
+        bool is_open() const;
+
+        /**
+         * Get the contents of the mapped file.
+         *
+         * @returns A view of the contents of the file, which is empty if no file is mapped.
+         */
+        std::string_view get_data() const;
+
+    private:
+        const char* m_data = nullptr;
+        u64 m_size         = 0;
+        bool m_is_open     = false;
+    };
+}    // namespace hal
@@ -0,0 +1,108 @@
+// MIT License
+// 
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A pool that hands out storage for objects of a single type from large blocks of memory.<br>
+     * Objects created one after another are placed next to each other instead of being scattered across the heap by individual allocations, and the storage of destroyed objects is reused by the next object created.
+     * All storage is released when the pool is destroyed, no matter whether the objects in it have been destroyed before. Hence, the pool only accepts trivially destructible types.
+     *
+     * @ingroup utilities
+     */
+    template<typename T>
+    class ObjectPool
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "objects in the pool are released without running their destructors");
+
+    public:
+        /**
+         * Construct an empty pool.
+         *
+         * @param[in] objects_per_block - The number of objects that fit into each block of memory.
+         */
+        explicit ObjectPool(u32 objects_per_block = 4096) : m_objects_per_block(objects_per_block > 0 ? objects_per_block : 1)
+        {
+        }
+
+        ObjectPool(const ObjectPool&)            = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        /**
+         * Get uninitialized storage for one object, which is to be constructed in place by the caller.
+         *
+         * @returns The storage.
+         */
+        void* allocate()
+        {
+            if (m_free_slots != nullptr)
+            {
+                Slot* slot   = m_free_slots;
+                m_free_slots = slot->next;
+                return slot->storage;
+            }
+
+            if (m_blocks.empty() || m_next_slot == m_objects_per_block)
+            {
+                m_blocks.push_back(std::make_unique<Slot[]>(m_objects_per_block));
+                m_next_slot = 0;
+            }
+            return m_blocks.back()[m_next_slot++].storage;
+        }
+
+        /**
+         * Destroy an object created in storage of this pool and keep its storage for the next object.
+         *
+         * @param[in] object - The object.
+         */
+        void destroy(T* object)
+        {
+            object->~T();
+            Slot* slot   = reinterpret_cast<Slot*>(object);
+            slot->next   = m_free_slots;
+            m_free_slots = slot;
+        }
+
+    private:
+        union Slot
+        {
+            Slot* next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        u32 m_objects_per_block;
+        u32 m_next_slot    = 0;
+        Slot* m_free_slots = nullptr;
+        std::vector<std::unique_ptr<Slot[]>> m_blocks;
+    };
+}    // namespace hal
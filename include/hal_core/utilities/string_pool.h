@@ -0,0 +1,87 @@
+// MIT License
+// 
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace hal
+{
+    /**
+     * Stores every distinct string once so that equal strings can be shared and compared by their address.<br>
+     * Strings are never removed from the pool, the returned pointers stay valid for the lifetime of the pool. All functions may be called from multiple threads at once.
+     *
+     * @ingroup utilities
+     */
+    class CORE_API StringPool
+    {
+    public:
+        StringPool() = default;
+
+        StringPool(const StringPool&)            = delete;
+        StringPool& operator=(const StringPool&) = delete;
+
+        /**
+         * Get the pool that is shared by the entire process.
+         *
+         * @returns The pool.
+         */
+        static StringPool& get_global();
+
+        /**
+         * Get the pooled copy of a string, adding the string to the pool if it is not part of it yet.
+         *
+         * @param[in] str - The string.
+         * @returns The pooled string.
+         */
+        const std::string* intern(std::string_view str);
+
+        /**
+         * Get the pooled copy of a string without adding it to the pool.
+         *
+         * @param[in] str - The string.
+         * @returns The pooled string, or a `nullptr` if the string is not part of the pool.
+         */
+        const std::string* find(std::string_view str) const;
+
+        /**
+         * Get the number of distinct strings in the pool.
+         *
+         * @returns The number of strings.
+         */
+        u64 size() const;
+
+    private:
+        mutable std::shared_mutex m_mutex;
+        std::deque<std::string> m_strings;
+        std::unordered_map<std::string_view, const std::string*> m_index;
+    };
+}    // namespace hal
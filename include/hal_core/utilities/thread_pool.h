@@ -0,0 +1,357 @@
+// MIT License
+// 
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A pool of worker threads that execute tasks, shared by all parts of HAL through `ThreadPool::get_global`.<br>
+     * Every worker owns a queue of tasks. Tasks submitted by a worker are put into its own queue and executed last in, first out, tasks submitted by any other thread are put into a shared queue.
+     * A worker that runs out of tasks steals the oldest task from the queue of another worker.
+     * A thread that waits for a `TaskGroup` executes pending tasks in the meantime, so that parallel loops may be nested without spawning additional threads or blocking the pool.
+     *
+     * @ingroup utilities
+     */
+    class CORE_API ThreadPool
+    {
+    public:
+        /**
+         * A task that is executed by the thread pool.
+         */
+        using Task = std::function<void()>;
+
+        /**
+         * Construct a thread pool and start its worker threads.
+         *
+         * @param[in] num_threads - The number of worker threads. Defaults to `ThreadPool::get_default_num_threads`.
+         */
+        explicit ThreadPool(u32 num_threads = 0);
+
+        /**
+         * Execute all pending tasks and stop the worker threads.
+         */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * Get the thread pool that is shared by all parts of HAL.<br>
+         * The pool is created with `ThreadPool::get_default_num_threads` workers on first use.
+         *
+         * @returns The global thread pool.
+         */
+        static ThreadPool& get_global();
+
+        /**
+         * Get the number of worker threads a thread pool is created with by default.<br>
+         * This is one less than the number of hardware threads, since the thread that waits for the tasks executes tasks as well, but at least one.
+         *
+         * @returns The default number of worker threads.
+         */
+        static u32 get_default_num_threads();
+
+        /**
+         * Get the number of worker threads.
+         *
+         * @returns The number of worker threads.
+         */
+        u32 get_num_threads() const;
+
+        /**
+         * Change the number of worker threads.<br>
+         * The current workers execute all pending tasks before they are replaced, so this must not be called while a task of this pool is being executed.
+         *
+         * @param[in] num_threads - The number of worker threads, `0` for `ThreadPool::get_default_num_threads`.
+         * @returns `true` on success, `false` if called from within a task of this pool.
+         */
+        bool set_num_threads(u32 num_threads);
+
+        /**
+         * Submit a task to be executed by any thread of the pool.<br>
+         * The task must not throw, use a `TaskGroup` to wait for tasks to finish and to receive their exceptions.
+         *
+         * @param[in] task - The task.
+         */
+        void submit(Task task);
+
+        /**
+         * Execute a single pending task on the calling thread, if there is one.<br>
+         * A worker prefers the most recent task of its own queue, any other thread prefers the oldest task that was submitted from outside the pool.
+         *
+         * @returns `true` if a task was executed, `false` if no task was pending.
+         */
+        bool run_pending_task();
+
+        /**
+         * Check whether the calling thread is a worker of this pool.
+         *
+         * @returns `true` if the calling thread is a worker of this pool, `false` otherwise.
+         */
+        bool is_worker_thread() const;
+
+    private:
+        struct TaskQueue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void start(u32 num_threads);
+        void stop();
+        void work(u32 index);
+        bool pop_task(u32 index, Task& task);
+
+        // one queue per worker followed by the shared queue for tasks submitted from outside the pool
+        std::vector<std::unique_ptr<TaskQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_wake_up;
+        std::atomic<u64> m_num_pending = 0;
+        bool m_stop                    = false;
+    };
+
+    /**
+     * A group of tasks that are executed by a thread pool and can be waited for and cancelled together.<br>
+     * Tasks of a group that are still pending when the group is cancelled are skipped, running tasks may check `TaskGroup::is_cancelled` to stop early.
+     * If a task throws an exception, the group is cancelled and the exception is rethrown by `TaskGroup::wait`.
+     * The destructor waits for all tasks of the group.
+     *
+     * @ingroup utilities
+     */
+    class CORE_API TaskGroup
+    {
+    public:
+        /**
+         * A callback that receives the number of finished tasks and the number of all tasks of a group.
+         */
+        using ProgressCallback = std::function<void(u32, u32)>;
+
+        /**
+         * Construct an empty task group.
+         *
+         * @param[in] pool - The thread pool to execute the tasks. Defaults to the global thread pool.
+         */
+        explicit TaskGroup(ThreadPool& pool = ThreadPool::get_global());
+
+        /**
+         * Wait for all tasks of the group, dropping exceptions thrown by the tasks.
+         */
+        ~TaskGroup();
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        /**
+         * Submit a task to the thread pool as part of this group.
+         *
+         * @param[in] task - The task.
+         */
+        void run(ThreadPool::Task task);
+
+        /**
+         * Wait until all tasks of the group are finished or skipped, executing pending tasks of the pool in the meantime.<br>
+         * The progress callback is invoked on the waiting thread whenever it notices that further tasks have finished.
+         * Rethrows the first exception thrown by a task of the group.
+         *
+         * @param[in] on_progress - The progress callback, may be empty.
+         */
+        void wait(const ProgressCallback& on_progress = nullptr);
+
+        /**
+         * Cancel the group, so that its pending tasks are skipped.
+         */
+        void cancel();
+
+        /**
+         * Check whether the group has been cancelled.
+         *
+         * @returns `true` if the group has been cancelled, `false` otherwise.
+         */
+        bool is_cancelled() const;
+
+        /**
+         * Get the number of tasks submitted as part of this group.
+         *
+         * @returns The number of tasks.
+         */
+        u32 get_num_tasks() const;
+
+        /**
+         * Get the number of tasks of this group that are finished or were skipped.
+         *
+         * @returns The number of finished tasks.
+         */
+        u32 get_num_finished() const;
+
+        /**
+         * Get the thread pool that executes the tasks of this group.
+         *
+         * @returns The thread pool.
+         */
+        ThreadPool& get_pool() const;
+
+    private:
+        ThreadPool& m_pool;
+        std::atomic<u32> m_num_tasks    = 0;
+        std::atomic<u32> m_num_finished = 0;
+        std::atomic<bool> m_cancelled   = false;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_finished;
+        std::exception_ptr m_exception;
+    };
+
+    namespace thread_pool_utils
+    {
+        /**
+         * Get the number of indices executed by a single task when splitting the range [begin, end) among the threads of a pool.<br>
+         * The range is split into about four chunks per thread, so that threads that finish early can steal the remaining chunks.
+         *
+         * @param[in] pool - The thread pool.
+         * @param[in] begin - The first index.
+         * @param[in] end - The index after the last index.
+         * @returns The number of indices per task.
+         */
+        CORE_API u32 get_chunk_size(const ThreadPool& pool, u32 begin, u32 end);
+    }    // namespace thread_pool_utils
+
+    /**
+     * Execute a function for every index in [begin, end) using the thread pool of a task group, which is waited for before returning.<br>
+     * Cancelling the group skips all indices that have not been started yet.
+     *
+     * @param[in] group - The task group.
+     * @param[in] begin - The first index.
+     * @param[in] end - The index after the last index.
+     * @param[in] func - The function that is executed for every index.
+     * @param[in] on_progress - A callback that receives the number of processed indices and the number of all indices, may be empty.
+     */
+    template<typename F>
+    void parallel_for(TaskGroup& group, u32 begin, u32 end, F&& func, const TaskGroup::ProgressCallback& on_progress = nullptr)
+    {
+        if (end <= begin)
+        {
+            return;
+        }
+
+        const u32 chunk_size = thread_pool_utils::get_chunk_size(group.get_pool(), begin, end);
+        std::atomic<u32> num_processed = 0;
+        for (u32 chunk_begin = begin; chunk_begin < end; chunk_begin += std::min(chunk_size, end - chunk_begin))
+        {
+            const u32 chunk_end = chunk_begin + std::min(chunk_size, end - chunk_begin);
+            group.run([&group, &func, &num_processed, chunk_begin, chunk_end]() {
+                for (u32 i = chunk_begin; i < chunk_end && !group.is_cancelled(); i++)
+                {
+                    func(i);
+                    num_processed.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        if (on_progress)
+        {
+            group.wait([&on_progress, &num_processed, begin, end](u32, u32) { on_progress(num_processed.load(std::memory_order_relaxed), end - begin); });
+        }
+        else
+        {
+            group.wait();
+        }
+    }
+
+    /**
+     * Execute a function for every index in [begin, end) using the global thread pool.
+     *
+     * @param[in] begin - The first index.
+     * @param[in] end - The index after the last index.
+     * @param[in] func - The function that is executed for every index.
+     */
+    template<typename F>
+    void parallel_for(u32 begin, u32 end, F&& func)
+    {
+        TaskGroup group;
+        parallel_for(group, begin, end, std::forward<F>(func));
+    }
+
+    /**
+     * Map every index in [begin, end) to a value and combine all values using the global thread pool.<br>
+     * Every task combines the values of a consecutive chunk of indices starting from the initial value, and the results of the chunks are combined in the order of the indices.
+     * Hence, the initial value must not change the result when combined with any value, e.g., `0` for a sum, and the combining function must be associative.
+     *
+     * @param[in] begin - The first index.
+     * @param[in] end - The index after the last index.
+     * @param[in] init - The initial value.
+     * @param[in] map - The function mapping an index to a value.
+     * @param[in] reduce - The function combining two values.
+     * @returns The combination of all values, or the initial value if the range is empty.
+     */
+    template<typename T, typename Map, typename Reduce>
+    T parallel_map_reduce(u32 begin, u32 end, T init, Map&& map, Reduce&& reduce)
+    {
+        if (end <= begin)
+        {
+            return init;
+        }
+
+        TaskGroup group;
+        const u32 chunk_size = thread_pool_utils::get_chunk_size(group.get_pool(), begin, end);
+        const u32 num_chunks = (end - begin - 1) / chunk_size + 1;
+        std::deque<T> partial_results(num_chunks, init);
+        for (u32 chunk = 0; chunk < num_chunks; chunk++)
+        {
+            group.run([&map, &reduce, &partial_results, chunk, chunk_size, begin, end]() {
+                const u32 chunk_begin = begin + chunk * chunk_size;
+                const u32 chunk_end   = chunk_begin + std::min(chunk_size, end - chunk_begin);
+                T& result             = partial_results[chunk];
+                for (u32 i = chunk_begin; i < chunk_end; i++)
+                {
+                    result = reduce(std::move(result), map(i));
+                }
+            });
+        }
+        group.wait();
+
+        T result = std::move(init);
+        for (auto& partial_result : partial_results)
+        {
+            result = reduce(std::move(result), std::move(partial_result));
+        }
+        return result;
+    }
+}    // namespace hal
@@ -176,6 +176,21 @@ namespace hal
             m_data = init;
         }
 
+        /**
+         * Construct a token stream from a vector of tokens without copying them.<br>
+         * The increase-level and decrease-level tokens are used for level-aware iteration. If active, all operations are only executed on tokens on level 0.<br>
+         * Example: consuming until "b" in 'a,(,b,),b,c' would consume 'a,(,b,)', if "(" and ")" are level increase/decrease tokens.
+         *
+         * @param[in] init - The vector of tokens.
+         * @param[in] increase_level_tokens - A vector of tokens that mark the start of a new level, i.e., increase the level.
+         * @param[in] decrease_level_tokens - A vector of tokens that mark the end of a level, i.e., decrease the level.
+         */
+        TokenStream(std::vector<Token<T>>&& init, const std::vector<T>& increase_level_tokens = {"("}, const std::vector<T>& decrease_level_tokens = {")"})
+            : TokenStream(increase_level_tokens, decrease_level_tokens)
+        {
+            m_data = std::move(init);
+        }
+
         /**
          * Construct a token stream from another one (i.e., copy constructor).
          *
@@ -204,6 +219,21 @@ namespace hal
             return *this;
         }
 
+        /**
+         * Construct a token stream by taking over the tokens of another one (i.e., move constructor).
+         *
+         * @param[in] other - The token stream to move from.
+         */
+        TokenStream(TokenStream<T>&& other) = default;
+
+        /**
+         * Assign a token stream by taking over its tokens.
+         *
+         * @param[in] other - The token stream to move from.
+         * @returns A reference to the token stream.
+         */
+        TokenStream<T>& operator=(TokenStream<T>&& other) = default;
+
         /**
          * Consume the next token(s) in the stream.<br>
          * Advances the stream by the given number and returns the last consumed token.
@@ -29,7 +29,10 @@ namespace hal
     {
         /**
          * Compute the Boolean influence of each input variable of a Boolean function.
-         * The influence is approximated by evaluating the function on randomly sampled input assignments.
+         * The influence is approximated by evaluating the function on randomly sampled input assignments, 64 of which are evaluated at once.
+         * If the function has no more input assignments than `num_evaluations`, all of them are evaluated instead and the influence is exact.
+         * The function must only consist of single-bit operations.
+         * Calls are independent of each other and may run concurrently.
          *
          * @param[in] bf - The Boolean function.
          * @param[in] num_evaluations - The number of evaluations that are performed for each input variable.
@@ -40,7 +43,7 @@ namespace hal
         /**
          * Compute the Boolean influence of each input variable of a Boolean function using only HAL-internal functionality.
          * The influence is approximated by evaluating the function on randomly sampled input assignments.
-         * This variant is slower than `get_boolean_influence`, but it is better suited for use in a multi-threaded environment.
+         * This variant is considerably slower than `get_boolean_influence` and mainly serves as a reference.
          *
          * @param[in] bf - The Boolean function.
          * @param[in] num_evaluations - The number of evaluations that are performed for each input variable.
@@ -51,7 +54,7 @@ namespace hal
         /**
          * Compute the Boolean influence of each input variable of a Boolean function using only z3 substitution and simplification.
          * The influence is approximated by evaluating the function on randomly sampled input assignments.
-         * This variant is slower than `get_boolean_influence`, but it is better suited for use in a multi-threaded environment.
+         * This variant is considerably slower than `get_boolean_influence` and mainly serves as a reference.
          *
          * @param[in] bf - The Boolean function.
          * @param[in] num_evaluations - The number of evaluations that are performed for each input variable.
@@ -61,7 +64,10 @@ namespace hal
 
         /**
          * Compute the Boolean influence of each input variable of a Boolean function.
-         * The influence is approximated by evaluating the function on randomly sampled input assignments.
+         * The influence is approximated by evaluating the function on randomly sampled input assignments, 64 of which are evaluated at once.
+         * If the function has no more input assignments than `num_evaluations`, all of them are evaluated instead and the influence is exact.
+         * The expression must only consist of single-bit operations.
+         * Calls are independent of each other and may run concurrently.
          *
          * @param[in] e - The z3 expression representing the Boolean function.
          * @param[in] num_evaluations - The number of evaluations that are performed for each input variable.
@@ -91,8 +97,8 @@ namespace hal
 
         /**
          * Compute the Boolean influence of each input net of a subcircuit on one of its output nets.
-         * The Boolean function of the start net is built from the given gates, translated into C code, and then compiled and executed for speed.
-         * The influence is approximated by evaluating that function on randomly sampled input assignments.
+         * The Boolean function of the start net is built from the given gates and evaluated for 64 input assignments at once.
+         * The influence is approximated by evaluating that function on randomly sampled input assignments, or computed exactly if there are no more assignments than samples.
          *
          * @param[in] gates - The gates of the subcircuit.
          * @param[in] start_net - The output net of the subcircuit at which to start the analysis.
@@ -103,8 +109,8 @@ namespace hal
 
         /**
          * Compute the Boolean influence of each net that drives the data input of the given flip-flop.
-         * The Boolean function of the data input net is built, translated into C code, and then compiled and executed for speed.
-         * The influence is approximated by evaluating that function on randomly sampled input assignments.
+         * The Boolean function of the data input net is built and evaluated for 64 input assignments at once.
+         * The influence is approximated by evaluating that function on randomly sampled input assignments, or computed exactly if there are no more assignments than samples.
          *
          * @param[in] gate - The flip-flop whose data input net is used to build the Boolean function.
          * @param[in] num_evaluations - The number of evaluations that are performed for each input variable.
@@ -136,10 +142,14 @@ namespace hal
         /**
          * Get the flip-flop dependency matrix of a netlist, i.e., a matrix that holds an entry for every pair of flip-flops that are connected through combinational logic.
          *
+         * The Boolean influences of the flip-flops are computed in parallel.
+         *
          * @param[in] netlist - The netlist to extract the dependency matrix from.
          * @param[in] with_boolean_influence - Set `true` to use the Boolean influence as the matrix entry, `false` to use `1.0` for every connection.
+         * @param[in] num_threads - The maximum number of threads to compute the Boolean influences with, which is further bounded by the size of the global thread pool. Defaults to `0`, which uses the whole pool.
          * @returns A pair consisting of a map from the original gate IDs to the corresponding matrix indices and the flip-flop dependency matrix itself, an error otherwise.
          */
-        Result<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> get_ff_dependency_matrix(const Netlist* netlist, bool with_boolean_influence);
+        Result<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>>
+            get_ff_dependency_matrix(const Netlist* netlist, bool with_boolean_influence, u32 num_threads = 0);
     }    // namespace boolean_influence
 }    // namespace hal
\ No newline at end of file
@@ -97,7 +97,8 @@ namespace hal
             py::arg("num_evaluations") = 32000,
             R"(
             Compute the Boolean influence of each input variable of a Boolean function.
-            The influence is approximated by evaluating the function on randomly sampled input assignments.
+            The influence is approximated by evaluating the function on randomly sampled input assignments, 64 of which are evaluated at once.
+            If the function has no more input assignments than ``num_evaluations``, all of them are evaluated instead and the influence is exact.
 
             :param hal_py.BooleanFunction bf: The Boolean function.
             :param int num_evaluations: The number of evaluations that are performed for each input variable.
@@ -124,7 +125,7 @@ namespace hal
             R"(
             Compute the Boolean influence of each input variable of a Boolean function using only HAL-internal functionality.
             The influence is approximated by evaluating the function on randomly sampled input assignments.
-            This variant is slower than ``get_boolean_influence``, but it is better suited for use in a multi-threaded environment.
+            This variant is considerably slower than ``get_boolean_influence`` and mainly serves as a reference.
 
             :param hal_py.BooleanFunction bf: The Boolean function.
             :param int num_evaluations: The number of evaluations that are performed for each input variable.
@@ -151,7 +152,7 @@ namespace hal
             R"(
             Compute the Boolean influence of each input variable of a Boolean function using only z3 substitution and simplification.
             The influence is approximated by evaluating the function on randomly sampled input assignments.
-            This variant is slower than ``get_boolean_influence``, but it is better suited for use in a multi-threaded environment.
+            This variant is considerably slower than ``get_boolean_influence`` and mainly serves as a reference.
 
             :param hal_py.BooleanFunction bf: The Boolean function.
             :param int num_evaluations: The number of evaluations that are performed for each input variable.
@@ -178,8 +179,8 @@ namespace hal
             py::arg("num_evaluations") = 32000,
             R"(
             Compute the Boolean influence of each input net of a subcircuit on one of its output nets.
-            The Boolean function of the start net is built from the given gates, translated into C code, and then compiled and executed for speed.
-            The influence is approximated by evaluating that function on randomly sampled input assignments.
+            The Boolean function of the start net is built from the given gates and evaluated for 64 input assignments at once.
+            The influence is approximated by evaluating that function on randomly sampled input assignments, or computed exactly if there are no more assignments than samples.
 
             :param list[hal_py.Gate] gates: The gates of the subcircuit.
             :param hal_py.Net start_net: The output net of the subcircuit at which to start the analysis.
@@ -206,8 +207,8 @@ namespace hal
             py::arg("num_evaluations") = 32000,
             R"(
             Compute the Boolean influence of each net that drives the data input of the given flip-flop.
-            The Boolean function of the data input net is built, translated into C code, and then compiled and executed for speed.
-            The influence is approximated by evaluating that function on randomly sampled input assignments.
+            The Boolean function of the data input net is built and evaluated for 64 input assignments at once.
+            The influence is approximated by evaluating that function on randomly sampled input assignments, or computed exactly if there are no more assignments than samples.
 
             :param hal_py.Gate gate: The flip-flop whose data input net is used to build the Boolean function.
             :param int num_evaluations: The number of evaluations that are performed for each input variable.
@@ -294,8 +295,8 @@ namespace hal
 
         m.def(
             "get_ff_dependency_matrix",
-            [](const Netlist* nl, bool with_boolean_influence) -> std::optional<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> {
-                const auto res = boolean_influence::get_ff_dependency_matrix(nl, with_boolean_influence);
+            [](const Netlist* nl, bool with_boolean_influence, u32 num_threads) -> std::optional<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> {
+                const auto res = boolean_influence::get_ff_dependency_matrix(nl, with_boolean_influence, num_threads);
                 if (res.is_ok())
                 {
                     return res.get();
@@ -308,11 +309,14 @@ namespace hal
             },
             py::arg("netlist"),
             py::arg("with_boolean_influence"),
+            py::arg("num_threads") = 0,
             R"(
             Get the flip-flop dependency matrix of a netlist, i.e., a matrix that holds an entry for every pair of flip-flops that are connected through combinational logic.
+            The Boolean influences of the flip-flops are computed in parallel.
 
             :param hal_py.Netlist netlist: The netlist to extract the dependency matrix from.
             :param bool with_boolean_influence: Set ``True`` to use the Boolean influence as the matrix entry, ``False`` to use ``1.0`` for every connection.
+            :param int num_threads: The maximum number of threads to compute the Boolean influences with, which is further bounded by the size of the global thread pool. Defaults to ``0``, which uses the whole pool.
             :returns: A tuple consisting of a dict from the original gate IDs to the corresponding matrix indices and the flip-flop dependency matrix itself, ``None`` otherwise.
             :rtype: tuple(dict[int,hal_py.Gate], list[list[float]]) or None
         )");
@@ -6,11 +6,12 @@
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/utilities/thread_pool.h"
 #include "z3_utils/subgraph_function_generation.h"
 #include "z3_utils/z3_utils.h"
 
-#include <filesystem>
-#include <fstream>
+#include <atomic>
+#include <mutex>
 
 namespace hal
 {
@@ -18,108 +19,6 @@ namespace hal
     {
         namespace
         {
-            const std::string probabilistic_function = R"(
-#include <stdbool.h> 
-#include <stdio.h>
-#include <stdlib.h>
-
-static unsigned long x=123456789, y=362436069, z=521288629;
-
-// period 2^96-1
-unsigned long xorshf96(void) {          
-    unsigned long t;
-
-    x ^= x << 16;
-    x ^= x >> 5;
-    x ^= x << 1;
-
-    t = x;
-    x = y;
-    y = z;
-    z = t ^ x ^ y;
-
-    return z;
-}
-
-<C_FUNCTION>
-
-const int input_size = <INPUT_SIZE>;
-
-void build_values(bool* values) {
-    for (int i = 0; i < input_size; i++) {
-        bool random_value = xorshf96() % 2;
-        values[i] = random_value;
-    }
-
-    return;
-}
-
-int main(int argc, char *argv[]) {
-    unsigned long long b     = strtoull(argv[1], 0, 10);
-    unsigned long long num   = strtoull(argv[2], 0, 10);
-    unsigned long long count = 0;
-
-    bool values[input_size];
-    for (unsigned long long i = 0; i < num; i++) {
-        build_values(values);
-
-        values[b] = true;
-        bool r1 = func(values);
-
-        values[b] = false;
-        bool r2 = func(values);
-
-        if (r1 != r2) {
-            count++;
-        }
-    }
-
-    printf("%lld\n", count);
-
-    return int(count);
-})";
-
-            const std::string deterministic_function = R"(
-#include <stdbool.h> 
-#include <stdio.h>
-#include <stdlib.h>
-
-<C_FUNCTION>
-
-const int input_size = <INPUT_SIZE>;
-
-void build_values(bool* values, unsigned long long val) {
-    for (int idx = 0; idx < input_size; idx++) {
-        values[idx] = (val >> idx) & 0x1;
-    }
-
-    return;
-}
-
-int main(int argc, char *argv[]) {
-    unsigned long long b     = strtoull(argv[1], 0, 10);
-    unsigned long long count = 0;
-
-    bool values[input_size];
-    for (unsigned long long i = 0; i < (1 << input_size); i++) {
-        build_values(values, i);
-
-        values[b] = true;
-        bool r1 = func(values);
-
-        values[b] = false;
-        bool r2 = func(values);
-
-        if (r1 != r2) {
-            count++;
-        }
-    }
-
-    printf("%lld\n", count);
-
-    return int(count);
-})";
-
             // period 2^96-1
             unsigned long xorshf96(u64& x, u64& y, u64& z)
             {
@@ -137,159 +36,278 @@ int main(int argc, char *argv[]) {
                 return z;
             }
 
-            Result<std::unordered_map<std::string, double>> get_boolean_influence_internal(const z3::expr& expr, const u32 num_evaluations, const bool deterministic)
+            /**
+             * A single-bit function translated from a z3 expression into a flat program that evaluates it bit-sliced, i.e., for 64 input assignments at once.
+             * Every register holds one bit per assignment, the first registers hold the input variables in the order passed to `build`.
+             */
+            class BitslicedFunction
             {
-                const auto to_replacement_var = [](const u32 var_idx) -> std::string { return "var_" + std::to_string(var_idx); };
+            public:
+                static Result<BitslicedFunction> build(const z3::expr& expr, const std::vector<std::string>& variables)
+                {
+                    BitslicedFunction f;
+                    f.m_num_inputs = variables.size();
 
-                const auto extract_index = [](const std::string& var) -> Result<u32> {
-                    if (!utils::starts_with(var, std::string("var_")))
+                    std::unordered_map<std::string, u32> variable_registers;
+                    for (u32 i = 0; i < variables.size(); i++)
                     {
-                        return ERR("variable " + var + " does not start with prefix 'var_', so we cannot extract an index.");
+                        variable_registers[variables.at(i)] = i;
                     }
 
-                    try
-                    {
-                        return OK(u32(std::stoul(var.substr(4))));
-                    }
-                    catch (const std::invalid_argument& e)
+                    // translate the expression in post-order, subexpressions shared within the expression are translated only once
+                    std::unordered_map<u32, u32> registers;
+                    std::vector<std::pair<z3::expr, bool>> stack = {{expr, false}};
+                    while (!stack.empty())
                     {
-                        return ERR("could not get index from string '" + var + "': " + e.what());
-                    }
-                    catch (const std::out_of_range& e)
-                    {
-                        return ERR("could not get index from string '" + var + "': " + e.what());
-                    }
-                };
+                        auto [e, children_done] = stack.back();
+                        stack.pop_back();
 
-                const auto to_original_var = [extract_index](const std::string& replacement_var, const std::vector<std::string>& original_vars) -> Result<std::string> {
-                    const auto var_idx_res = extract_index(replacement_var);
-                    if (var_idx_res.is_error())
-                    {
-                        return ERR_APPEND(var_idx_res.get_error(), "unable to reconstruct original variable from replacement variable" + replacement_var + ": failed to extract index.");
-                    }
-                    const auto var_idx = var_idx_res.get();
+                        if (registers.find(e.id()) != registers.end())
+                        {
+                            continue;
+                        }
 
-                    if (var_idx > original_vars.size())
-                    {
-                        return ERR("unable to reconstruct original variable from replacement variable" + replacement_var + ": extracted index " + std::to_string(var_idx)
-                                   + " is bigger than the size of the original vars (" + std::to_string(original_vars.size()) + ").");
-                    }
+                        if ((e.is_bv() && e.get_sort().bv_size() != 1) || !(e.is_bv() || e.is_bool()) || !e.is_app())
+                        {
+                            return ERR("cannot translate expression '" + e.to_string() + "': only single-bit bit-vector and Boolean expressions are supported");
+                        }
 
-                    return OK(original_vars.at(var_idx));
-                };
+                        if (e.is_numeral() || e.is_true() || e.is_false())
+                        {
+                            const bool value = e.is_bool() ? e.is_true() : (e.get_numeral_uint64() & 1) != 0;
+                            registers[e.id()] = f.append(value ? Operation::ONE : Operation::ZERO, {});
+                            continue;
+                        }
 
-                std::unordered_map<std::string, double> influences;
+                        if (e.is_const())
+                        {
+                            const auto it = variable_registers.find(e.to_string());
+                            if (it == variable_registers.end())
+                            {
+                                return ERR("cannot translate expression: unknown variable '" + e.to_string() + "'");
+                            }
+                            registers[e.id()] = it->second;
+                            continue;
+                        }
 
-                // substitute all variables in the expression to be of the format var_<INDEX>.
-                // This allows for a more efficient translation into a c function
-                std::vector<std::string> input_vars = utils::to_vector(z3_utils::get_variable_names(expr));
+                        if (!children_done)
+                        {
+                            stack.push_back({e, true});
+                            for (u32 i = 0; i < e.num_args(); i++)
+                            {
+                                stack.push_back({e.arg(i), false});
+                            }
+                            continue;
+                        }
 
-                if (input_vars.empty())
-                {
-                    return OK(influences);
+                        std::vector<u32> operands;
+                        for (u32 i = 0; i < e.num_args(); i++)
+                        {
+                            operands.push_back(registers.at(e.arg(i).id()));
+                        }
+
+                        u32 result;
+                        switch (e.decl().decl_kind())
+                        {
+                            case Z3_OP_BAND:
+                            case Z3_OP_AND:
+                                result = f.append(Operation::AND, operands);
+                                break;
+                            case Z3_OP_BOR:
+                            case Z3_OP_OR:
+                                result = f.append(Operation::OR, operands);
+                                break;
+                            case Z3_OP_BXOR:
+                            case Z3_OP_XOR:
+                                result = f.append(Operation::XOR, operands);
+                                break;
+                            case Z3_OP_BNOT:
+                            case Z3_OP_NOT:
+                                result = f.append(Operation::NOT, operands);
+                                break;
+                            case Z3_OP_BNAND:
+                                result = f.append(Operation::NOT, {f.append(Operation::AND, operands)});
+                                break;
+                            case Z3_OP_BNOR:
+                                result = f.append(Operation::NOT, {f.append(Operation::OR, operands)});
+                                break;
+                            case Z3_OP_BXNOR:
+                            case Z3_OP_EQ:
+                            case Z3_OP_IFF:
+                                if (operands.size() != 2)
+                                {
+                                    return ERR("cannot translate expression '" + e.to_string() + "': expected two operands");
+                                }
+                                result = f.append(Operation::NOT, {f.append(Operation::XOR, operands)});
+                                break;
+                            case Z3_OP_ITE:
+                                result = f.append(Operation::ITE, operands);
+                                break;
+                            default:
+                                return ERR("cannot translate expression '" + e.to_string() + "': unsupported operation '" + e.decl().name().str() + "'");
+                        }
+                        registers[e.id()] = result;
+                    }
+
+                    f.m_result = registers.at(expr.id());
+                    return OK(f);
                 }
 
-                if (deterministic && input_vars.size() > 16)
+                /**
+                 * Evaluate the function.
+                 * The first registers have to hold the values of the input variables, all other registers are overwritten.
+                 *
+                 * @param[inout] registers - The registers, resized as required.
+                 * @returns The value of the function for each of the 64 assignments.
+                 */
+                u64 evaluate(std::vector<u64>& registers) const
                 {
-                    return ERR("unable to generate Boolean influence: Cannot evaluate Boolean function deterministically for more than 16 variables but got " + std::to_string(input_vars.size()));
-                }
+                    registers.resize(m_num_inputs + m_instructions.size());
 
-                std::vector<std::string> replacement_vars;
+                    u64* out = registers.data() + m_num_inputs;
+                    for (const Instruction& instr : m_instructions)
+                    {
+                        const u32* op = m_operands.data() + instr.first_operand;
+                        u64 value;
+                        switch (instr.operation)
+                        {
+                            case Operation::ZERO:
+                                value = 0;
+                                break;
+                            case Operation::ONE:
+                                value = ~(u64)0;
+                                break;
+                            case Operation::AND:
+                                value = registers[op[0]];
+                                for (u32 i = 1; i < instr.num_operands; i++)
+                                {
+                                    value &= registers[op[i]];
+                                }
+                                break;
+                            case Operation::OR:
+                                value = registers[op[0]];
+                                for (u32 i = 1; i < instr.num_operands; i++)
+                                {
+                                    value |= registers[op[i]];
+                                }
+                                break;
+                            case Operation::XOR:
+                                value = registers[op[0]];
+                                for (u32 i = 1; i < instr.num_operands; i++)
+                                {
+                                    value ^= registers[op[i]];
+                                }
+                                break;
+                            case Operation::NOT:
+                                value = ~registers[op[0]];
+                                break;
+                            case Operation::ITE:
+                                value = (registers[op[0]] & registers[op[1]]) | (~registers[op[0]] & registers[op[2]]);
+                                break;
+                        }
+                        *out++ = value;
+                    }
 
-                z3::expr_vector from_vec(expr.ctx());
-                z3::expr_vector to_vec(expr.ctx());
+                    return registers[m_result];
+                }
 
-                for (u32 var_idx = 0; var_idx < input_vars.size(); var_idx++)
+            private:
+                enum class Operation : u8
                 {
-                    replacement_vars.push_back(to_replacement_var(var_idx));
-
-                    z3::expr from = expr.ctx().bv_const(input_vars.at(var_idx).c_str(), 1);
-                    z3::expr to   = expr.ctx().bv_const(to_replacement_var(var_idx).c_str(), 1);
+                    ZERO,
+                    ONE,
+                    AND,
+                    OR,
+                    XOR,
+                    NOT,
+                    ITE
+                };
 
-                    from_vec.push_back(from);
-                    to_vec.push_back(to);
-                }
+                struct Instruction
+                {
+                    Operation operation;
+                    u32 first_operand;
+                    u32 num_operands;
+                };
 
-                auto replaced_e = expr;
-                replaced_e      = replaced_e.substitute(from_vec, to_vec);
+                u32 m_num_inputs = 0;
+                u32 m_result     = 0;
+                std::vector<Instruction> m_instructions;
+                std::vector<u32> m_operands;
 
-                // translate expression into a c program
-                auto directory_res = utils::get_unique_temp_directory("boolean_influence_");
-                if (directory_res.is_error())
+                u32 append(Operation operation, const std::vector<u32>& operands)
                 {
-                    return ERR_APPEND(directory_res.get_error(), "unable to generate Boolean influence: could not create temporary directory");
+                    m_instructions.push_back({operation, (u32)m_operands.size(), (u32)operands.size()});
+                    m_operands.insert(m_operands.end(), operands.begin(), operands.end());
+                    return m_num_inputs + m_instructions.size() - 1;
                 }
-                const std::filesystem::path directory = directory_res.get();
-                std::filesystem::create_directory(directory);
-                const std::filesystem::path file_path = directory / "boolean_func.cpp";
+            };
 
-                std::string cpp_program = deterministic ? deterministic_function : probabilistic_function;
-                cpp_program             = utils::replace(cpp_program, std::string("<C_FUNCTION>"), z3_utils::to_cpp(replaced_e));
-                cpp_program             = utils::replace(cpp_program, std::string("<INPUT_SIZE>"), std::to_string(replacement_vars.size()));
+            Result<std::unordered_map<std::string, double>> get_boolean_influence_internal(const z3::expr& expr, const u32 num_evaluations, const bool deterministic)
+            {
+                std::unordered_map<std::string, double> influences;
 
-                // write cpp program to file
-                std::ofstream ofs(file_path);
-                if (!ofs.is_open())
+                const std::vector<std::string> input_vars = utils::to_vector(z3_utils::get_variable_names(expr));
+                if (input_vars.empty())
                 {
-                    return ERR("unable to generate Boolean influence: could not open file " + file_path.string() + ".");
+                    return OK(influences);
                 }
-                ofs << cpp_program;
-
-                ofs.close();
 
-                // compile the cpp file
-                const std::string program_name    = file_path.string().substr(0, file_path.string().size() - 4);
-                const std::string compile_command = "g++ -o " + program_name + " " + file_path.string() + " -O3";
-                int res                           = system(compile_command.c_str());
-                UNUSED(res);
+                if (deterministic && input_vars.size() > 16)
+                {
+                    return ERR("unable to generate Boolean influence: Cannot evaluate Boolean function deterministically for more than 16 variables but got " + std::to_string(input_vars.size()));
+                }
 
-                // run boolean function program for every input
-                for (const auto& var : replacement_vars)
+                const auto func_res = BitslicedFunction::build(expr, input_vars);
+                if (func_res.is_error())
                 {
-                    const auto idx_res = extract_index(var);
-                    if (idx_res.is_error())
-                    {
-                        return ERR_APPEND(idx_res.get_error(), "unable to generate Boolean influence: failed to extract index from variable " + var + ".");
-                    }
-                    const auto idx = idx_res.get();
+                    return ERR_APPEND(func_res.get_error(), "unable to generate Boolean influence: failed to translate expression into a bit-sliced function");
+                }
+                const BitslicedFunction func = func_res.get();
 
-                    const std::string num_evaluations_str = deterministic ? "" : std::to_string(num_evaluations);
+                // evaluate every assignment if there are no more of them than random samples
+                const u32 num_vars    = input_vars.size();
+                const bool exhaustive = deterministic || (num_vars < 32 && ((u64)1 << num_vars) <= num_evaluations);
+                const u64 total       = exhaustive ? ((u64)1 << num_vars) : num_evaluations;
 
-                    const std::string run_command = program_name + " " + std::to_string(idx) + " " + num_evaluations_str + " 2>&1";
+                u64 x = 123456789, y = 362436069, z = 521288629;
 
-                    std::array<char, 128> buffer;
-                    std::string result;
+                // in exhaustive mode, the first six variables enumerate the 64 assignments of a word, the others are constant within a word
+                static constexpr u64 lane_patterns[6] = {0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull, 0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
 
-                    FILE* pipe = popen(run_command.c_str(), "r");
-                    if (!pipe)
-                    {
-                        return ERR("unable to generate Boolean influence: error during execution of compiled boolean program");
-                    }
-                    while (fgets(buffer.data(), 128, pipe) != NULL)
+                std::vector<u64> counts(num_vars, 0);
+                std::vector<u64> registers(num_vars);
+                for (u64 word = 0; word * 64 < total; word++)
+                {
+                    const u64 lanes = std::min<u64>(64, total - word * 64);
+                    const u64 mask  = (lanes == 64) ? ~(u64)0 : (((u64)1 << lanes) - 1);
+
+                    for (u32 i = 0; i < num_vars; i++)
                     {
-                        result += buffer.data();
+                        if (exhaustive)
+                        {
+                            registers[i] = (i < 6) ? lane_patterns[i] : (((word >> (i - 6)) & 1) ? ~(u64)0 : 0);
+                        }
+                        else
+                        {
+                            registers[i] = xorshf96(x, y, z);
+                        }
                     }
 
-                    pclose(pipe);
-
-                    const u32 count            = std::stoi(result);
-                    const u32 real_evaluations = deterministic ? (1 << input_vars.size()) : num_evaluations;
-                    double cv                  = (double)(count) / (double)(real_evaluations);
-
-                    const auto org_var_res = to_original_var(var, input_vars);
-                    if (org_var_res.is_error())
+                    // the influence of a variable is the probability that flipping it flips the result
+                    const u64 result = func.evaluate(registers);
+                    for (u32 i = 0; i < num_vars; i++)
                     {
-                        return ERR_APPEND(org_var_res.get_error(), "unable to generate Boolean influence: failed to reconstruct original variable from replacement variable " + var + ".");
+                        registers[i] = ~registers[i];
+                        counts[i] += __builtin_popcountll((result ^ func.evaluate(registers)) & mask);
+                        registers[i] = ~registers[i];
                     }
-                    const auto org_var = org_var_res.get();
-
-                    influences.insert({org_var, cv});
                 }
 
-                // delete files and temp directory
-                std::remove(file_path.string().c_str());
-                std::remove(program_name.c_str());
-                std::filesystem::remove(directory);
+                for (u32 i = 0; i < num_vars; i++)
+                {
+                    influences.insert({input_vars.at(i), (double)counts[i] / (double)total});
+                }
 
                 return OK(influences);
             }
@@ -583,13 +601,10 @@ int main(int argc, char *argv[]) {
             return OK(influences);
         }
 
-        Result<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> get_ff_dependency_matrix(const Netlist* nl, bool with_boolean_influence)
+        Result<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> get_ff_dependency_matrix(const Netlist* nl, bool with_boolean_influence, u32 num_threads)
         {
             std::map<u32, Gate*> matrix_id_to_gate;
             std::map<Gate*, u32> gate_to_matrix_id;
-            std::vector<std::vector<double>> matrix;
-
-            std::unordered_map<const Net*, std::set<Gate*>>* cache;
 
             u32 matrix_gates = 0;
             for (const auto& gate : nl->get_gates())
@@ -603,18 +618,12 @@ int main(int argc, char *argv[]) {
                 matrix_gates++;
             }
 
-            u32 status_counter = 0;
+            // the traversal shares its cache between the flip-flops, so it runs ahead of the parallel part
+            std::unordered_map<const Net*, std::set<Gate*>> cache;
+            std::vector<std::set<u32>> gates_to_add(matrix_gates);
             for (const auto& [id, gate] : matrix_id_to_gate)
             {
-                if (status_counter % 100 == 0)
-                {
-                    log_info("boolean_influence", "status {}/{} processed", status_counter, matrix_id_to_gate.size());
-                }
-                status_counter++;
-                std::vector<double> line_of_matrix;
-
-                std::set<u32> gates_to_add;
-                const auto next_seq_gates = NetlistTraversalDecorator(*nl).get_next_sequential_gates(gate, false, {}, cache);
+                const auto next_seq_gates = NetlistTraversalDecorator(*nl).get_next_sequential_gates(gate, false, {}, &cache);
                 if (next_seq_gates.is_error())
                 {
                     return ERR_APPEND(next_seq_gates.get_error(),
@@ -623,52 +632,109 @@ int main(int argc, char *argv[]) {
                 }
                 for (const auto& pred_gate : next_seq_gates.get())
                 {
-                    gates_to_add.insert(gate_to_matrix_id[pred_gate]);
+                    gates_to_add[id].insert(gate_to_matrix_id[pred_gate]);
                 }
-                std::map<Net*, double> boolean_influence_for_gate;
-                if (with_boolean_influence)
+            }
+
+            std::vector<std::vector<double>> matrix(matrix_gates);
+
+            std::atomic<u32> next_id   = 0;
+            std::atomic<u32> processed = 0;
+            std::mutex error_mutex;
+            std::optional<Error> error;
+
+            const auto work = [&]() {
+                while (true)
                 {
-                    const auto inf_res = get_boolean_influences_of_gate(gate);
-                    if (inf_res.is_error())
+                    const u32 id = next_id++;
+                    if (id >= matrix_gates)
                     {
-                        return ERR_APPEND(inf_res.get_error(),
-                                          "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
-                                              + ".");
+                        return;
                     }
-                    boolean_influence_for_gate = inf_res.get();
-                }
-
-                for (u32 i = 0; i < matrix_gates; i++)
-                {
-                    if (gates_to_add.find(i) != gates_to_add.end())
                     {
-                        if (with_boolean_influence)
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (error.has_value())
                         {
-                            double influence = 0.0;
+                            return;
+                        }
+                    }
 
-                            Gate* pred_ff = matrix_id_to_gate[i];
+                    Gate* gate = matrix_id_to_gate.at(id);
+
+                    std::map<Net*, double> boolean_influence_for_gate;
+                    if (with_boolean_influence)
+                    {
+                        const auto inf_res = get_boolean_influences_of_gate(gate);
+                        if (inf_res.is_error())
+                        {
+                            std::lock_guard<std::mutex> lock(error_mutex);
+                            if (!error.has_value())
+                            {
+                                error = Error(__FILE__,
+                                              __LINE__,
+                                              inf_res.get_error(),
+                                              "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
+                                                  + ".");
+                            }
+                            return;
+                        }
+                        boolean_influence_for_gate = inf_res.get();
+                    }
 
-                            for (const auto& output_net : pred_ff->get_fan_out_nets())
+                    std::vector<double>& line_of_matrix = matrix.at(id);
+                    line_of_matrix.reserve(matrix_gates);
+                    for (u32 i = 0; i < matrix_gates; i++)
+                    {
+                        if (gates_to_add[id].find(i) != gates_to_add[id].end())
+                        {
+                            if (with_boolean_influence)
                             {
-                                if (boolean_influence_for_gate.find(output_net) != boolean_influence_for_gate.end())
+                                double influence = 0.0;
+
+                                Gate* pred_ff = matrix_id_to_gate.at(i);
+
+                                for (const auto& output_net : pred_ff->get_fan_out_nets())
                                 {
-                                    influence += boolean_influence_for_gate[output_net];
+                                    if (const auto it = boolean_influence_for_gate.find(output_net); it != boolean_influence_for_gate.end())
+                                    {
+                                        influence += it->second;
+                                    }
                                 }
-                            }
 
-                            line_of_matrix.push_back(influence);
+                                line_of_matrix.push_back(influence);
+                            }
+                            else
+                            {
+                                line_of_matrix.push_back(1.0);
+                            }
                         }
                         else
                         {
-                            line_of_matrix.push_back(1.0);
+                            line_of_matrix.push_back(0.0);
                         }
                     }
-                    else
+
+                    if (const u32 done = ++processed; done % 100 == 0)
                     {
-                        line_of_matrix.push_back(0.0);
+                        log_info("boolean_influence", "status {}/{} processed", done, matrix_gates);
                     }
                 }
-                matrix.push_back(line_of_matrix);
+            };
+
+            // the workers run on the global thread pool, the calling thread is one of them
+            TaskGroup workers;
+            const u32 max_threads = workers.get_pool().get_num_threads() + 1;
+            num_threads           = std::max(1u, std::min({(num_threads == 0) ? max_threads : num_threads, max_threads, matrix_gates}));
+            for (u32 i = 1; i < num_threads; i++)
+            {
+                workers.run(work);
+            }
+            work();
+            workers.wait();
+
+            if (error.has_value())
+            {
+                return ERR(error.value());
             }
 
             return OK(std::make_pair(matrix_id_to_gate, matrix));
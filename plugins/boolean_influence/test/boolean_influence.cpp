@@ -0,0 +1,324 @@
+#include "boolean_influence/boolean_influence.h"
+
+#include "hal_core/netlist/boolean_function.h"
+#include "netlist_test_utils.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    class BooleanInfluenceTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+
+        /**
+         * Compute the exact Boolean influence of each variable of a single-bit function by evaluating it on every input assignment.
+         *
+         * @param[in] bf - The Boolean function.
+         * @returns A map from each variable of the function to its Boolean influence.
+         */
+        static std::unordered_map<std::string, double> get_exhaustive_influence(const BooleanFunction& bf)
+        {
+            const std::vector<std::string> variables = utils::to_vector(bf.get_variable_names());
+            const u64 num_assignments                = (u64)1 << variables.size();
+
+            std::vector<u64> counts(variables.size(), 0);
+            for (u64 assignment = 0; assignment < num_assignments; assignment++)
+            {
+                std::unordered_map<std::string, BooleanFunction::Value> values;
+                for (u32 i = 0; i < variables.size(); i++)
+                {
+                    values[variables.at(i)] = ((assignment >> i) & 1) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO;
+                }
+                const BooleanFunction::Value result = bf.evaluate(values).get();
+
+                for (u32 i = 0; i < variables.size(); i++)
+                {
+                    auto& value = values.at(variables.at(i));
+                    value       = (value == BooleanFunction::Value::ONE) ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE;
+                    if (bf.evaluate(values).get() != result)
+                    {
+                        counts[i]++;
+                    }
+                    value = (value == BooleanFunction::Value::ONE) ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE;
+                }
+            }
+
+            std::unordered_map<std::string, double> influences;
+            for (u32 i = 0; i < variables.size(); i++)
+            {
+                influences[variables.at(i)] = (double)counts[i] / (double)num_assignments;
+            }
+            return influences;
+        }
+
+        /**
+         * Check that two influence maps hold the same variables and that their influences differ by at most the given tolerance.
+         *
+         * @param[in] actual - The influences to check.
+         * @param[in] expected - The reference influences.
+         * @param[in] tolerance - The maximum difference of the influence of a variable.
+         */
+        static void expect_influences_near(const std::unordered_map<std::string, double>& actual, const std::unordered_map<std::string, double>& expected, const double tolerance)
+        {
+            EXPECT_EQ(actual.size(), expected.size());
+            for (const auto& [var, influence] : expected)
+            {
+                const auto it = actual.find(var);
+                ASSERT_NE(it, actual.end()) << "missing variable " << var;
+                EXPECT_NEAR(it->second, influence, tolerance) << "influence of variable " << var;
+            }
+        }
+
+        /**
+         * Build a vector of single-bit variables named with the given prefix followed by their index.
+         *
+         * @param[in] prefix - The prefix of the variable names.
+         * @param[in] count - The number of variables.
+         * @returns The variables.
+         */
+        static std::vector<BooleanFunction> create_variables(const std::string& prefix, const u32 count)
+        {
+            std::vector<BooleanFunction> variables;
+            for (u32 i = 0; i < count; i++)
+            {
+                variables.push_back(BooleanFunction::Var(prefix + std::to_string(i)));
+            }
+            return variables;
+        }
+    };
+
+    /**
+     * Testing the influences computed by the bit-sliced evaluation against an exhaustive evaluation of the Boolean function for functions with few variables.
+     * As these functions have fewer assignments than samples, the sampling variant evaluates them exhaustively as well.
+     *
+     * Functions: get_boolean_influence, get_boolean_influence_deterministic, get_boolean_influence_with_hal_boolean_function_class, get_boolean_influence_with_z3_expr
+     */
+    TEST_F(BooleanInfluenceTest, check_small_functions)
+    {
+        TEST_START
+        {
+            const auto a = BooleanFunction::Var("A");
+            const auto b = BooleanFunction::Var("B");
+            const auto c = BooleanFunction::Var("C");
+            const auto d = BooleanFunction::Var("D");
+            const auto x = create_variables("X", 10);
+
+            // multiplexer of eight inputs with a three bit select
+            auto mux = BooleanFunction::Const(0, 1);
+            for (u32 i = 0; i < 8; i++)
+            {
+                auto select = (i & 1) ? x.at(0) : ~x.at(0);
+                select &= (i & 2) ? x.at(1) : ~x.at(1);
+                select &= (i & 4) ? x.at(2) : ~x.at(2);
+                mux |= select & x.at(3 + i % 7);
+            }
+
+            const std::vector<BooleanFunction> functions = {
+                a,
+                ~a,
+                a & b,
+                a | b,
+                a ^ b ^ c,
+                (a & b) | (~c ^ d),
+                (a & ~b) | (b & c),
+                ((a | b) & (c | d)) ^ (a & d),
+                mux,
+            };
+
+            for (const auto& bf : functions)
+            {
+                const auto expected = get_exhaustive_influence(bf);
+
+                const auto deterministic_res = boolean_influence::get_boolean_influence_deterministic(bf);
+                ASSERT_TRUE(deterministic_res.is_ok()) << bf.to_string();
+                expect_influences_near(deterministic_res.get(), expected, 1e-12);
+
+                const auto sampled_res = boolean_influence::get_boolean_influence(bf);
+                ASSERT_TRUE(sampled_res.is_ok()) << bf.to_string();
+                expect_influences_near(sampled_res.get(), expected, 1e-12);
+
+                // the reference implementations sample random assignments even for small functions
+                const auto hal_res = boolean_influence::get_boolean_influence_with_hal_boolean_function_class(bf, 4000);
+                ASSERT_TRUE(hal_res.is_ok()) << bf.to_string();
+                expect_influences_near(hal_res.get(), expected, 0.05);
+
+                const auto z3_res = boolean_influence::get_boolean_influence_with_z3_expr(bf, 400);
+                ASSERT_TRUE(z3_res.is_ok()) << bf.to_string();
+                expect_influences_near(z3_res.get(), expected, 0.1);
+            }
+
+            {
+                // the number of samples decides whether a function is evaluated exhaustively
+                const auto bf       = x.at(0) & x.at(1) & x.at(2) & x.at(3) & x.at(4) & x.at(5) & x.at(6);
+                const auto expected = get_exhaustive_influence(bf);
+
+                const auto exhaustive_res = boolean_influence::get_boolean_influence(bf, 128);
+                ASSERT_TRUE(exhaustive_res.is_ok());
+                expect_influences_near(exhaustive_res.get(), expected, 1e-12);
+
+                const auto sampled_res = boolean_influence::get_boolean_influence(bf, 127);
+                ASSERT_TRUE(sampled_res.is_ok());
+                EXPECT_EQ(sampled_res.get().size(), expected.size());
+            }
+
+            {
+                // deterministic evaluation is limited to 16 variables
+                const auto many_vars = create_variables("Y", 17);
+                auto bf              = many_vars.front();
+                for (u32 i = 1; i < many_vars.size(); i++)
+                {
+                    bf ^= many_vars.at(i);
+                }
+                EXPECT_TRUE(boolean_influence::get_boolean_influence_deterministic(bf).is_error());
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the influences computed by the bit-sliced evaluation for functions with more than 64 variables, i.e., more variables than assignments per machine word.
+     * The sampled influences are compared against the exact influences and against the reference implementation.
+     *
+     * Functions: get_boolean_influence, get_boolean_influence_with_hal_boolean_function_class
+     */
+    TEST_F(BooleanInfluenceTest, check_functions_with_many_variables)
+    {
+        TEST_START
+        {
+            const u32 num_vars = 70;
+            const auto x       = create_variables("X", num_vars);
+
+            {
+                // parity of all variables but the first two, which only contribute their conjunction
+                auto bf = x.at(0) & x.at(1);
+                for (u32 i = 2; i < num_vars; i++)
+                {
+                    bf ^= x.at(i);
+                }
+
+                std::unordered_map<std::string, double> expected;
+                for (u32 i = 0; i < num_vars; i++)
+                {
+                    expected["X" + std::to_string(i)] = (i < 2) ? 0.5 : 1.0;
+                }
+
+                const auto sampled_res = boolean_influence::get_boolean_influence(bf);
+                ASSERT_TRUE(sampled_res.is_ok());
+                expect_influences_near(sampled_res.get(), expected, 0.02);
+
+                // a number of samples that does not fill the last machine word
+                const auto partial_res = boolean_influence::get_boolean_influence(bf, 1000);
+                ASSERT_TRUE(partial_res.is_ok());
+                expect_influences_near(partial_res.get(), expected, 0.06);
+
+                const auto hal_res = boolean_influence::get_boolean_influence_with_hal_boolean_function_class(bf, 200);
+                ASSERT_TRUE(hal_res.is_ok());
+                expect_influences_near(hal_res.get(), expected, 0.15);
+
+                // deterministic evaluation is infeasible for this many variables
+                EXPECT_TRUE(boolean_influence::get_boolean_influence_deterministic(bf).is_error());
+            }
+
+            {
+                // the conjunction of all variables is almost never influenced by a single variable
+                auto bf = x.at(0);
+                for (u32 i = 1; i < num_vars; i++)
+                {
+                    bf &= x.at(i);
+                }
+
+                const auto sampled_res = boolean_influence::get_boolean_influence(bf);
+                ASSERT_TRUE(sampled_res.is_ok());
+                const auto hal_res = boolean_influence::get_boolean_influence_with_hal_boolean_function_class(bf, 200);
+                ASSERT_TRUE(hal_res.is_ok());
+                expect_influences_near(sampled_res.get(), hal_res.get(), 1e-12);
+                for (const auto& [var, influence] : sampled_res.get())
+                {
+                    EXPECT_EQ(influence, 0.0) << "influence of variable " << var;
+                }
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the influences of constant functions, which either have no variables at all or do not depend on their variables.
+     *
+     * Functions: get_boolean_influence, get_boolean_influence_deterministic, get_boolean_influence_with_hal_boolean_function_class
+     */
+    TEST_F(BooleanInfluenceTest, check_constant_functions)
+    {
+        TEST_START
+        {
+            for (const auto& bf : {BooleanFunction::Const(0, 1), BooleanFunction::Const(1, 1)})
+            {
+                const auto sampled_res = boolean_influence::get_boolean_influence(bf);
+                ASSERT_TRUE(sampled_res.is_ok());
+                EXPECT_TRUE(sampled_res.get().empty());
+
+                const auto deterministic_res = boolean_influence::get_boolean_influence_deterministic(bf);
+                ASSERT_TRUE(deterministic_res.is_ok());
+                EXPECT_TRUE(deterministic_res.get().empty());
+
+                const auto hal_res = boolean_influence::get_boolean_influence_with_hal_boolean_function_class(bf, 100);
+                ASSERT_TRUE(hal_res.is_ok());
+                EXPECT_TRUE(hal_res.get().empty());
+            }
+
+            const auto a = BooleanFunction::Var("A");
+            const auto b = BooleanFunction::Var("B");
+            const auto x = create_variables("X", 66);
+
+            auto wide_tautology = x.front() | ~x.front();
+            for (u32 i = 1; i < x.size(); i++)
+            {
+                wide_tautology &= x.at(i) | ~x.at(i);
+            }
+
+            const std::vector<BooleanFunction> functions = {
+                a ^ a,
+                a & ~a,
+                a | ~a,
+                (a & b) ^ (b & a),
+                wide_tautology,
+            };
+
+            for (const auto& bf : functions)
+            {
+                std::unordered_map<std::string, double> expected;
+                for (const auto& var : bf.get_variable_names())
+                {
+                    expected[var] = 0.0;
+                }
+
+                const auto sampled_res = boolean_influence::get_boolean_influence(bf);
+                ASSERT_TRUE(sampled_res.is_ok()) << bf.to_string();
+                expect_influences_near(sampled_res.get(), expected, 0.0);
+
+                const auto hal_res = boolean_influence::get_boolean_influence_with_hal_boolean_function_class(bf, 100);
+                ASSERT_TRUE(hal_res.is_ok()) << bf.to_string();
+                expect_influences_near(hal_res.get(), expected, 0.0);
+
+                if (expected.size() <= 16)
+                {
+                    const auto deterministic_res = boolean_influence::get_boolean_influence_deterministic(bf);
+                    ASSERT_TRUE(deterministic_res.is_ok()) << bf.to_string();
+                    expect_influences_near(deterministic_res.get(), expected, 0.0);
+                }
+            }
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -34,6 +34,7 @@
 #include "hal_core/defines.h"
 
 #include <map>
+#include <optional>
 #include <set>
 #include <shared_mutex>
 #include <unordered_map>
@@ -102,12 +103,23 @@ namespace hal
              * @brief Check two groupings for equality.
              * 
              * Two groupings are equal if the comprise the same number of groups and if these groups are made up from the same gates. 
+             * Groupings with different fingerprints are unequal without comparing their groups.
              * 
              * @param[in] other - The other grouping.
              * @return `true` if the groupings are equal, `false` otherwise.
              */
             bool operator==(const Grouping& other) const;
 
+            /**
+             * @brief Get a fingerprint of the grouping that only depends on which gates are grouped together.
+             * 
+             * Equal groupings have equal fingerprints, independent of the IDs of their groups and the order in which groups and gates were added.
+             * The fingerprint is computed on first use, so it must not be requested before the grouping is complete.
+             * 
+             * @return The fingerprint of the grouping.
+             */
+            u64 get_fingerprint() const;
+
             /**
              * @brief Check two groupings for inequality.
              * 
@@ -126,6 +138,15 @@ namespace hal
              */
             std::map<PinType, std::unordered_set<u32>> get_control_signals_of_group(u32 group_id) const;
 
+            /**
+             * @brief Get the group of every target gate by gate index.
+             * 
+             * The vector is built from `parent_group_of_gate` on first use, so it must not be requested before the grouping is complete.
+             * 
+             * @returns A vector holding the ID of the group of each target gate at the gate index of that gate.
+             */
+            const std::vector<u32>& get_parent_groups_by_index() const;
+
             /** 
              * @brief Get the successor groups of a group.
              * 
@@ -209,6 +230,12 @@ namespace hal
 
                 /** The sets of groups that have already been compared against each other. */
                 std::set<std::set<u32>> comparison_cache;
+
+                /** The fingerprint of the grouping once it has been computed. */
+                std::optional<u64> fingerprint;
+
+                /** The group of each target gate by gate index. */
+                std::vector<u32> parent_group_by_index;
             } cache;
 
             const std::set<std::set<u32>>& get_comparison_data() const;
@@ -33,6 +33,7 @@
 #include "hal_core/defines.h"
 #include "hal_core/netlist/gate_library/enums/pin_type.h"
 
+#include <map>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -48,9 +49,53 @@ namespace hal
     {
         struct Grouping;
 
+        /**
+         * @struct GateIndexRange
+         * @brief A contiguous range of target gate indices within the adjacency arrays of a netlist abstraction.
+         */
+        struct GateIndexRange
+        {
+            /** Pointer to the first index of the range. */
+            const u32* first;
+
+            /** Pointer past the last index of the range. */
+            const u32* last;
+
+            const u32* begin() const
+            {
+                return first;
+            }
+
+            const u32* end() const
+            {
+                return last;
+            }
+
+            u32 size() const
+            {
+                return last - first;
+            }
+
+            bool empty() const
+            {
+                return first == last;
+            }
+
+            /**
+             * @brief Check whether the range contains a gate index.
+             * 
+             * @param[in] gate_index - The gate index.
+             * @returns `true` if the range contains the index, `false` otherwise.
+             */
+            bool contains(u32 gate_index) const;
+        };
+
         /**
          * @struct NetlistAbstraction
          * @brief The abstraction of the netlist that only contains gates of a specified type, e.g., flip-flops.
+         * 
+         * Each target gate is assigned a dense index, which is its position in `target_gates`.
+         * The successors and predecessors of all target gates are stored by index in contiguous arrays in compressed sparse row format.
          */
         struct NetlistAbstraction
         {
@@ -70,10 +115,16 @@ namespace hal
             bool yosys;
 
             /**
-             * The target gates that should be grouped by dataflow analysis.
+             * The target gates that should be grouped by dataflow analysis, sorted by ID.
              */
             std::vector<Gate*> target_gates;
 
+            /** The IDs of the target gates by gate index. */
+            std::vector<u32> target_gate_ids;
+
+            /** A map from each target gate ID to its gate index. */
+            std::unordered_map<u32, u32> gate_to_index;
+
             /* pre_processed_data */
 
             /** A map from each target gate to the fingerprint that summarizes its type and connectivity. */
@@ -85,11 +136,17 @@ namespace hal
             /** A map from each target gate to the register stages it belongs to. */
             std::unordered_map<u32, std::unordered_set<u32>> gate_to_register_stages;
 
-            /** A map from each target gate to the target gates that precede it. */
-            std::unordered_map<u32, std::unordered_set<u32>> gate_to_predecessors;
+            /** The successors of the gate at index `i` are stored in `successor_indices` from `successor_offsets[i]` up to `successor_offsets[i + 1]`. */
+            std::vector<u32> successor_offsets;
 
-            /** A map from each target gate to the target gates that succeed it. */
-            std::unordered_map<u32, std::unordered_set<u32>> gate_to_successors;
+            /** The indices of the successor target gates of all target gates, sorted per gate. */
+            std::vector<u32> successor_indices;
+
+            /** The predecessors of the gate at index `i` are stored in `predecessor_indices` from `predecessor_offsets[i]` up to `predecessor_offsets[i + 1]`. */
+            std::vector<u32> predecessor_offsets;
+
+            /** The indices of the predecessor target gates of all target gates, sorted per gate. */
+            std::vector<u32> predecessor_indices;
 
             /** A map from each target gate to the previously known groups that precede it. */
             std::unordered_map<u32, std::unordered_set<u32>> gate_to_known_predecessor_groups;
@@ -102,6 +159,31 @@ namespace hal
 
             /** A map from each target gate to the sizes of the pin groups that drive its inputs. */
             std::unordered_map<u32, std::vector<std::vector<u32>>> gate_to_input_shape;
+
+            /**
+             * @brief Assign gate indices to the target gates and store their successors and predecessors.
+             * 
+             * Must be called once `target_gates` is complete. The predecessors are derived from the successors.
+             * 
+             * @param[in] successors - A map from each target gate ID to the IDs of its successor target gates, gates without successors may be omitted.
+             */
+            void set_successors(const std::unordered_map<u32, std::unordered_set<u32>>& successors);
+
+            /**
+             * @brief Get the indices of the successor target gates of a target gate.
+             * 
+             * @param[in] gate_index - The gate index of the target gate.
+             * @returns The sorted indices of the successors.
+             */
+            GateIndexRange get_successor_indices(u32 gate_index) const;
+
+            /**
+             * @brief Get the indices of the predecessor target gates of a target gate.
+             * 
+             * @param[in] gate_index - The gate index of the target gate.
+             * @returns The sorted indices of the predecessors.
+             */
+            GateIndexRange get_predecessor_indices(u32 gate_index) const;
         };
     }    // namespace dataflow
 }    // namespace hal
\ No newline at end of file
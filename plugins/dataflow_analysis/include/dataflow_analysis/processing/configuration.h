@@ -41,7 +41,7 @@ namespace hal
                 /** The number of pass layers, i.e., how often the set of passes is applied one after another. */
                 u32 pass_layers;
 
-                /** The number of worker threads that passes are executed on in parallel. */
+                /** The maximum number of threads that passes are executed on in parallel, further bounded by the size of the global thread pool. */
                 u32 num_threads;
 
                 /** Set `true` to keep gates of different types from ending up in the same group, `false` otherwise. */
@@ -31,6 +31,7 @@
 
 #include <map>
 #include <shared_mutex>
+#include <unordered_map>
 
 namespace hal
 {
@@ -84,6 +85,9 @@ namespace hal
                 /** The groupings produced in this iteration that had already been seen before. */
                 std::vector<std::tuple<std::shared_ptr<Grouping>, pass_id, std::shared_ptr<Grouping>>> new_recurring_results;
 
+                /** All unique groupings of `result` by their fingerprint. Only modified between pass layers, so worker threads read it without locking. */
+                std::unordered_map<u64, std::vector<std::shared_ptr<Grouping>>> unique_groupings_by_fingerprint;
+
                 /* progress printing */
 
                 /** Guards the progress output, which is written from several worker threads. */
@@ -5,6 +5,7 @@
 #include "dataflow_analysis/processing/processing.h"
 #include "hal_core/plugin_system/user_feedback.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/thread_pool.h"
 
 namespace hal
 {
@@ -37,7 +38,7 @@ namespace hal
 
             dataflow::processing::Configuration proc_config;
             proc_config.pass_layers              = 2;
-            proc_config.num_threads              = std::thread::hardware_concurrency();
+            proc_config.num_threads              = ThreadPool::get_global().get_num_threads() + 1;
             proc_config.enforce_type_consistency = config.enforce_type_consistency;
             proc_config.has_known_groups         = !config.known_net_groups.empty();
 
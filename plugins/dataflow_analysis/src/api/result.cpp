@@ -37,19 +37,16 @@ namespace hal
             {
                 auto gate_id = gate->get_id();
 
-                if (const auto it = na.gate_to_successors.find(gate_id); it != na.gate_to_successors.end())
+                if (const auto it = na.gate_to_index.find(gate_id); it != na.gate_to_index.end())
                 {
-                    for (auto suc_gate_id : std::get<1>(*it))
+                    for (auto suc_index : na.get_successor_indices(it->second))
                     {
-                        this->m_gate_successors[gate].insert(nl->get_gate_by_id(suc_gate_id));
+                        this->m_gate_successors[gate].insert(na.target_gates[suc_index]);
                     }
-                }
 
-                if (const auto it = na.gate_to_predecessors.find(gate_id); it != na.gate_to_predecessors.end())
-                {
-                    for (auto pred_gate_id : std::get<1>(*it))
+                    for (auto pred_index : na.get_predecessor_indices(it->second))
                     {
-                        this->m_gate_predecessors[gate].insert(nl->get_gate_by_id(pred_gate_id));
+                        this->m_gate_predecessors[gate].insert(na.target_gates[pred_index]);
                     }
                 }
 
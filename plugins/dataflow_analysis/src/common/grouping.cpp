@@ -81,6 +81,16 @@ namespace hal
 
         const std::set<std::set<u32>>& Grouping::get_comparison_data() const
         {
+            {
+                std::shared_lock lock(cache.mutex);
+                if (!cache.comparison_cache.empty())
+                {
+                    return cache.comparison_cache;
+                }
+            }
+            std::unique_lock lock(cache.mutex);
+
+            // check again, since another thread might have gotten the unique lock first
             if (cache.comparison_cache.empty())
             {
                 for (const auto& it : gates_of_group)
@@ -91,6 +101,47 @@ namespace hal
             return cache.comparison_cache;
         }
 
+        namespace
+        {
+            u64 mix(u64 x)
+            {
+                // finalizer of splitmix64, spreads every input bit over the whole word
+                x ^= x >> 30;
+                x *= 0xbf58476d1ce4e5b9ull;
+                x ^= x >> 27;
+                x *= 0x94d049bb133111ebull;
+                x ^= x >> 31;
+                return x;
+            }
+        }    // namespace
+
+        u64 Grouping::get_fingerprint() const
+        {
+            {
+                std::shared_lock lock(cache.mutex);
+                if (cache.fingerprint.has_value())
+                {
+                    return *cache.fingerprint;
+                }
+            }
+
+            // sums are independent of the iteration order, mixing each summand keeps distinct groups from cancelling out
+            u64 fingerprint = mix(gates_of_group.size());
+            for (const auto& it : gates_of_group)
+            {
+                u64 group_hash = it.second.size();
+                for (u32 gate_id : it.second)
+                {
+                    group_hash += mix(gate_id);
+                }
+                fingerprint += mix(group_hash);
+            }
+
+            std::unique_lock lock(cache.mutex);
+            cache.fingerprint = fingerprint;
+            return fingerprint;
+        }
+
         bool Grouping::operator==(const Grouping& other) const
         {
             if (gates_of_group.size() != other.gates_of_group.size())
@@ -98,6 +149,11 @@ namespace hal
                 return false;
             }
 
+            if (get_fingerprint() != other.get_fingerprint())
+            {
+                return false;
+            }
+
             return get_comparison_data() == other.get_comparison_data();
         }
 
@@ -170,6 +226,29 @@ namespace hal
             return std::set<u32>(intersect.begin(), intersect.end());
         }
 
+        const std::vector<u32>& Grouping::get_parent_groups_by_index() const
+        {
+            {
+                std::shared_lock lock(cache.mutex);
+                if (!cache.parent_group_by_index.empty() || parent_group_of_gate.empty())
+                {
+                    return cache.parent_group_by_index;
+                }
+            }
+            std::unique_lock lock(cache.mutex);
+
+            // check again, since another thread might have gotten the unique lock first
+            if (cache.parent_group_by_index.empty())
+            {
+                cache.parent_group_by_index.resize(netlist_abstr.target_gate_ids.size());
+                for (const auto& [gate_id, group_id] : parent_group_of_gate)
+                {
+                    cache.parent_group_by_index[netlist_abstr.gate_to_index.at(gate_id)] = group_id;
+                }
+            }
+            return cache.parent_group_by_index;
+        }
+
         std::unordered_set<u32> Grouping::get_successor_groups_of_group(u32 group_id) const
         {
             {
@@ -179,6 +258,9 @@ namespace hal
                     return it->second;
                 }
             }
+            // acquires the lock on its own
+            const auto& parent_groups = get_parent_groups_by_index();
+
             std::unique_lock lock(cache.mutex);
 
             // check again, since another thread might have gotten the unique lock first
@@ -190,9 +272,9 @@ namespace hal
             std::unordered_set<u32> successors;
             for (auto gate : gates_of_group.at(group_id))
             {
-                for (auto gate_id : this->netlist_abstr.gate_to_successors.at(gate))
+                for (auto gate_index : this->netlist_abstr.get_successor_indices(this->netlist_abstr.gate_to_index.at(gate)))
                 {
-                    successors.insert(parent_group_of_gate.at(gate_id));
+                    successors.insert(parent_groups[gate_index]);
                 }
             }
 
@@ -210,6 +292,9 @@ namespace hal
                     return it->second;
                 }
             }
+            // acquires the lock on its own
+            const auto& parent_groups = get_parent_groups_by_index();
+
             std::unique_lock lock(cache.mutex);
 
             // check again, since another thread might have gotten the unique lock first
@@ -221,9 +306,9 @@ namespace hal
             std::unordered_set<u32> predecessors;
             for (auto gate : gates_of_group.at(group_id))
             {
-                for (auto gate_id : this->netlist_abstr.gate_to_predecessors.at(gate))
+                for (auto gate_index : this->netlist_abstr.get_predecessor_indices(this->netlist_abstr.gate_to_index.at(gate)))
                 {
-                    predecessors.insert(parent_group_of_gate.at(gate_id));
+                    predecessors.insert(parent_groups[gate_index]);
                 }
             }
 
@@ -6,12 +6,82 @@
 #include "hal_core/plugin_system/plugin_manager.h"
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
+
 namespace hal
 {
     namespace dataflow
     {
+        bool GateIndexRange::contains(u32 gate_index) const
+        {
+            return std::binary_search(first, last, gate_index);
+        }
+
         NetlistAbstraction::NetlistAbstraction(const Netlist* nl_arg) : nl(nl_arg)
         {
         }
+
+        void NetlistAbstraction::set_successors(const std::unordered_map<u32, std::unordered_set<u32>>& successors)
+        {
+            const u32 num_gates = target_gates.size();
+
+            target_gate_ids.clear();
+            target_gate_ids.reserve(num_gates);
+            gate_to_index.clear();
+            gate_to_index.reserve(num_gates);
+            for (const auto* gate : target_gates)
+            {
+                gate_to_index[gate->get_id()] = target_gate_ids.size();
+                target_gate_ids.push_back(gate->get_id());
+            }
+
+            successor_offsets.assign(num_gates + 1, 0);
+            successor_indices.clear();
+            predecessor_offsets.assign(num_gates + 1, 0);
+
+            // successors are appended gate by gate, predecessors are counted first and scattered afterwards
+            for (u32 gate_index = 0; gate_index < num_gates; gate_index++)
+            {
+                successor_offsets[gate_index] = successor_indices.size();
+                if (const auto it = successors.find(target_gate_ids[gate_index]); it != successors.end())
+                {
+                    for (u32 suc_id : it->second)
+                    {
+                        u32 suc_index = gate_to_index.at(suc_id);
+                        successor_indices.push_back(suc_index);
+                        predecessor_offsets[suc_index + 1]++;
+                    }
+                    std::sort(successor_indices.begin() + successor_offsets[gate_index], successor_indices.end());
+                }
+            }
+            successor_offsets[num_gates] = successor_indices.size();
+            successor_indices.shrink_to_fit();
+
+            for (u32 gate_index = 0; gate_index < num_gates; gate_index++)
+            {
+                predecessor_offsets[gate_index + 1] += predecessor_offsets[gate_index];
+            }
+
+            // visiting the gates in index order fills the predecessors of every gate in sorted order
+            predecessor_indices.assign(successor_indices.size(), 0);
+            std::vector<u32> fill(predecessor_offsets.begin(), predecessor_offsets.end() - 1);
+            for (u32 gate_index = 0; gate_index < num_gates; gate_index++)
+            {
+                for (u32 suc_index : get_successor_indices(gate_index))
+                {
+                    predecessor_indices[fill[suc_index]++] = gate_index;
+                }
+            }
+        }
+
+        GateIndexRange NetlistAbstraction::get_successor_indices(u32 gate_index) const
+        {
+            return {successor_indices.data() + successor_offsets[gate_index], successor_indices.data() + successor_offsets[gate_index + 1]};
+        }
+
+        GateIndexRange NetlistAbstraction::get_predecessor_indices(u32 gate_index) const
+        {
+            return {predecessor_indices.data() + predecessor_offsets[gate_index], predecessor_indices.data() + predecessor_offsets[gate_index + 1]};
+        }
     }    // namespace dataflow
 }    // namespace hal
@@ -107,20 +107,13 @@ namespace hal
                     // find successors
                     std::unordered_map<const Net*, std::pair<std::unordered_set<Gate*>, std::unordered_set<u32>>> suc_cache;
                     std::unordered_map<const Net*, std::unordered_set<u32>> pred_cache;
+                    std::unordered_map<u32, std::unordered_set<u32>> successors;
                     for (const auto& gate : netlist_abstr.target_gates)
                     {
                         cnt++;
                         progress_bar.report(cnt / netlist_abstr.target_gates.size());
 
                         // create sets even if there are no successors
-                        if (netlist_abstr.gate_to_successors.find(gate->get_id()) == netlist_abstr.gate_to_successors.end())
-                        {
-                            netlist_abstr.gate_to_successors[gate->get_id()] = std::unordered_set<u32>();
-                        }
-                        if (netlist_abstr.gate_to_predecessors.find(gate->get_id()) == netlist_abstr.gate_to_predecessors.end())
-                        {
-                            netlist_abstr.gate_to_predecessors[gate->get_id()] = std::unordered_set<u32>();
-                        }
                         if (netlist_abstr.gate_to_known_successor_groups.find(gate->get_id()) == netlist_abstr.gate_to_known_successor_groups.end())
                         {
                             netlist_abstr.gate_to_known_successor_groups[gate->get_id()] = std::unordered_set<u32>();
@@ -309,11 +302,12 @@ namespace hal
 
                         for (const auto& suc : next_target_gates)
                         {
-                            netlist_abstr.gate_to_successors[gate->get_id()].insert(suc->get_id());
-                            netlist_abstr.gate_to_predecessors[suc->get_id()].insert(gate->get_id());
+                            successors[gate->get_id()].insert(suc->get_id());
                         }
                     }
                     progress_bar.clear();
+
+                    netlist_abstr.set_successors(successors);
                 }
             }    // namespace
 
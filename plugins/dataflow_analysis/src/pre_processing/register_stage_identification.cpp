@@ -25,23 +25,28 @@ namespace hal
             {
                 measure_block_time("pre_processing_pass 'identify_register_stages'");
 
+                // stages are computed on gate indices, which are ordered like the gate IDs
                 struct stage_context
                 {
                     std::string name;
-                    const std::unordered_map<u32, std::unordered_set<u32>>& connections;
+                    bool successors;
                     std::vector<std::vector<u32>> stages;
                 };
 
-                std::vector<stage_context> directional_stages = {{"forward", netlist_abstr.gate_to_successors, {}}, {"backward", netlist_abstr.gate_to_predecessors, {}}};
+                std::vector<stage_context> directional_stages = {{"forward", true, {}}, {"backward", false, {}}};
 
                 for (auto& ctx : directional_stages)
                 {
                     log_info("dataflow", "directional register stages: {}", ctx.name);
 
+                    auto connections = [&netlist_abstr, &ctx](u32 gate_index) {
+                        return ctx.successors ? netlist_abstr.get_successor_indices(gate_index) : netlist_abstr.get_predecessor_indices(gate_index);
+                    };
+
                     std::unordered_set<u32> unassigned_gates;
-                    for (const auto& g : netlist_abstr.target_gates)
+                    for (u32 gate_index = 0; gate_index < netlist_abstr.target_gates.size(); ++gate_index)
                     {
-                        unassigned_gates.insert(g->get_id());
+                        unassigned_gates.insert(gate_index);
                     }
 
                     {
@@ -50,18 +55,16 @@ namespace hal
                         float cnt = 0;
                         std::unordered_map<u32, u32> stage_index_of_gate;
 
-                        for (const auto& sequential_gate : netlist_abstr.target_gates)
+                        for (u32 current = 0; current < netlist_abstr.target_gates.size(); ++current)
                         {
                             cnt++;
                             progress_bar.report(cnt / netlist_abstr.target_gates.size());
 
-                            auto current = sequential_gate->get_id();
-
                             std::unordered_set<u32> next_stages;
 
-                            if (!ctx.connections.at(current).empty())
+                            if (!connections(current).empty())
                             {
-                                for (auto suc : ctx.connections.at(current))
+                                for (auto suc : connections(current))
                                 {
                                     if (auto it = stage_index_of_gate.find(suc); it != stage_index_of_gate.end())
                                     {
@@ -72,9 +75,9 @@ namespace hal
                                 // no stages
                                 if (next_stages.empty())
                                 {
-                                    ctx.stages.emplace_back(ctx.connections.at(current).begin(), ctx.connections.at(current).end());
+                                    ctx.stages.emplace_back(connections(current).begin(), connections(current).end());
                                     auto new_stage_id = ctx.stages.size() - 1;
-                                    for (auto g : ctx.connections.at(current))
+                                    for (auto g : connections(current))
                                     {
                                         stage_index_of_gate[g] = new_stage_id;
                                     }
@@ -102,7 +105,7 @@ namespace hal
                                 if (next_stages.size() == 1)
                                 {
                                     auto stage_index      = *(next_stages.begin());
-                                    auto& connected_gates = ctx.connections.at(current);
+                                    auto connected_gates  = connections(current);
                                     ctx.stages[stage_index].insert(ctx.stages[stage_index].end(), connected_gates.begin(), connected_gates.end());
                                     for (auto g : connected_gates)
                                     {
@@ -110,7 +113,7 @@ namespace hal
                                     }
                                 }
 
-                                for (auto g : ctx.connections.at(current))
+                                for (auto g : connections(current))
                                 {
                                     if (auto it = unassigned_gates.find(g); it != unassigned_gates.end())
                                     {
@@ -145,11 +148,11 @@ namespace hal
                             std::unordered_map<u32, std::vector<u32>> move_out_reasons;
                             for (auto g : ctx.stages[i])
                             {
-                                for (auto next : ctx.connections.at(g))
+                                for (auto next : connections(g))
                                 {
                                     if (next != g)
                                     {
-                                        if (std::binary_search(ctx.stages[i].begin(), ctx.stages[i].end(), next) && ctx.connections.at(next).find(g) == ctx.connections.at(next).end())
+                                        if (std::binary_search(ctx.stages[i].begin(), ctx.stages[i].end(), next) && !connections(next).contains(g))
                                         {
                                             move_out_reasons[next].push_back(g);
                                         }
@@ -279,7 +282,7 @@ namespace hal
                     {
                         for (auto g : final_stages[s])
                         {
-                            netlist_abstr.gate_to_register_stages[g].insert(s);
+                            netlist_abstr.gate_to_register_stages[netlist_abstr.target_gate_ids[g]].insert(s);
                         }
                     }
                 }
@@ -340,9 +343,9 @@ namespace hal
 
                         for (auto stage_id : combine)
                         {
-                            for (auto gate_id : final_stages[stage_id])
+                            for (auto g : final_stages[stage_id])
                             {
-                                netlist_abstr.gate_to_register_stages[gate_id] = combine;
+                                netlist_abstr.gate_to_register_stages[netlist_abstr.target_gate_ids[g]] = combine;
                             }
                         }
                     }
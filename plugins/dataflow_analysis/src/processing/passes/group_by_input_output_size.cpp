@@ -27,13 +27,14 @@ namespace hal
                     for (auto g : gates)
                     {
                         u32 val;
+                        u32 gate_index = state->netlist_abstr.gate_to_index.at(g);
                         if (successors)
                         {
-                            val = state->netlist_abstr.gate_to_successors.at(g).size();
+                            val = state->netlist_abstr.get_successor_indices(gate_index).size();
                         }
                         else
                         {
-                            val = state->netlist_abstr.gate_to_predecessors.at(g).size();
+                            val = state->netlist_abstr.get_predecessor_indices(gate_index).size();
                         }
 
                         if (first)
@@ -35,22 +35,25 @@ namespace hal
                     }
                     else
                     {
+                        const auto& parent_groups = state->get_parent_groups_by_index();
+
                         std::map<std::set<u32>, std::unordered_set<u32>> characteristics_map;
                         for (auto gate : gates)
                         {
                             std::set<u32> characteristics_of_gate;
+                            u32 gate_index = state->netlist_abstr.gate_to_index.at(gate);
                             if (successors)
                             {
-                                for (auto gate_successors : state->netlist_abstr.gate_to_successors.at(gate))
+                                for (auto suc_index : state->netlist_abstr.get_successor_indices(gate_index))
                                 {
-                                    characteristics_of_gate.insert(state->parent_group_of_gate.at(gate_successors));
+                                    characteristics_of_gate.insert(parent_groups[suc_index]);
                                 }
                             }
                             else
                             {
-                                for (auto gate_predecessors : state->netlist_abstr.gate_to_predecessors.at(gate))
+                                for (auto pred_index : state->netlist_abstr.get_predecessor_indices(gate_index))
                                 {
-                                    characteristics_of_gate.insert(state->parent_group_of_gate.at(gate_predecessors));
+                                    characteristics_of_gate.insert(parent_groups[pred_index]);
                                 }
                             }
                             characteristics_map[characteristics_of_gate].insert(gate);
@@ -11,10 +11,10 @@
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/thread_pool.h"
 
 #include <iomanip>
 #include <iostream>
-#include <thread>
 
 namespace hal
 {
@@ -94,14 +94,17 @@ namespace hal
                             // process work
                             auto new_state = current_pass.function(current_state);
 
-                            // aggregate result
+                            // aggregate result, only groupings of equal fingerprint can be equal
                             std::shared_ptr<Grouping> duplicate = nullptr;
-                            for (const auto& other : ctx.result.unique_groupings)
+                            if (auto it = ctx.unique_groupings_by_fingerprint.find(new_state->get_fingerprint()); it != ctx.unique_groupings_by_fingerprint.end())
                             {
-                                if (*new_state == *other)
+                                for (const auto& other : it->second)
                                 {
-                                    duplicate = other;
-                                    break;
+                                    if (*new_state == *other)
+                                    {
+                                        duplicate = other;
+                                        break;
+                                    }
                                 }
                             }
                             {
@@ -177,20 +180,18 @@ namespace hal
 
                     m_progress_printer = std::make_unique<user_feedback::ProgressPrinter>("dataflow: processing …", 30);
 
-                    // spawn threads
-                    std::vector<std::thread> workers;
-                    for (u32 t = 0; t < config.num_threads - 1; ++t)
+                    // run the workers on the global thread pool, which bounds the number of threads no matter how many are configured
+                    TaskGroup workers;
+                    const u32 num_workers = std::min(config.num_threads, workers.get_pool().get_num_threads() + 1);
+                    for (u32 t = 1; t < num_workers; ++t)
                     {
-                        workers.emplace_back([&]() { process_pass_configuration(config, ctx); });
+                        workers.run([&]() { process_pass_configuration(config, ctx); });
                     }
 
                     process_pass_configuration(config, ctx);
 
-                    // wait for threads to finish
-                    for (auto& worker : workers)
-                    {
-                        worker.join();
-                    }
+                    // wait for workers to finish
+                    workers.wait();
 
                     m_progress_printer.reset();
 
@@ -202,31 +203,28 @@ namespace hal
 
                     // filter same results of different threads
                     u32 num_unique_filtered = 0;
-                    std::vector<bool> do_not_consider(ctx.new_unique_groupings.size(), false);
-                    for (u32 i = 0; i < ctx.new_unique_groupings.size(); ++i)
+                    for (const auto& [start_state, pass, new_state] : ctx.new_unique_groupings)
                     {
-                        if (do_not_consider[i])
+                        auto& candidates                    = ctx.unique_groupings_by_fingerprint[new_state->get_fingerprint()];
+                        std::shared_ptr<Grouping> duplicate = nullptr;
+                        for (const auto& other : candidates)
                         {
-                            continue;
-                        }
-                        const auto& [start_state_i, pass_i, new_state_i] = ctx.new_unique_groupings[i];
-                        for (u32 j = i + 1; j < ctx.new_unique_groupings.size(); ++j)
-                        {
-                            if (do_not_consider[j])
+                            if (*new_state == *other)
                             {
-                                continue;
+                                duplicate = other;
+                                break;
                             }
-                            const auto& [start_state_j, pass_j, new_state_j] = ctx.new_unique_groupings[j];
+                        }
 
-                            // j is a duplicate of i
-                            if (*new_state_i == *new_state_j)
-                            {
-                                do_not_consider[j] = true;
-                                all_new_results.emplace_back(start_state_j, pass_j, new_state_i);
-                            }
+                        if (duplicate != nullptr)
+                        {
+                            all_new_results.emplace_back(start_state, pass, duplicate);
+                            continue;
                         }
-                        ctx.result.unique_groupings.push_back(new_state_i);
-                        all_new_results.push_back(ctx.new_unique_groupings[i]);
+
+                        candidates.push_back(new_state);
+                        ctx.result.unique_groupings.push_back(new_state);
+                        all_new_results.emplace_back(start_state, pass, new_state);
                         num_unique_filtered++;
                     }
                     log_info("dataflow", "  filtered results in {:3.2f}s, got {} new unique results", seconds_since(begin_time), num_unique_filtered);
@@ -32,6 +32,7 @@
 
 namespace hal {
     class Module;
+    struct BulkChanges;
 
     /**
      * Adds the dataflow analysis actions to the context menu of the nodes and edges of a displayed DOT graph.
@@ -75,6 +76,13 @@ namespace hal {
          */
         void handleHALModuleNameChanged(Module* m);
 
+        /**
+         * Update the labels of the graph nodes that represent modules renamed during a bulk of netlist modifications.
+         *
+         * @param[in] changes - The IDs of all netlist elements affected during the bulk.
+         */
+        void handleHALNetlistBulkChanged(const BulkChanges& changes);
+
         /**
          * Select the modules that correspond to the graph nodes selected in the scene.
          */
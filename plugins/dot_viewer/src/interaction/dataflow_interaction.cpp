@@ -25,6 +25,7 @@ namespace hal {
     {
         connect(gSelectionRelay, &SelectionRelay::selectionChanged, this, &DataflowInteraction::handleHALSelectionChanged);
         connect(gNetlistRelay, &NetlistRelay::moduleNameChanged, this, &DataflowInteraction::handleHALModuleNameChanged);
+        connect(gNetlistRelay, &NetlistRelay::netlistBulkChanged, this, &DataflowInteraction::handleHALNetlistBulkChanged);
         connect(parent, &QGVScene::edgeContextMenu, this, &DataflowInteraction::handleEdgeContextMenu);
         connect(parent, &QGraphicsScene::selectionChanged, this, &DataflowInteraction::handleQGVSelectionChanged);
     }
@@ -101,6 +102,14 @@ namespace hal {
         mDisableHandler = false;
     }
 
+    void DataflowInteraction::handleHALNetlistBulkChanged(const BulkChanges& changes)
+    {
+        if (auto it = changes.module_events.find(ModuleEvent::event::name_changed); it != changes.module_events.end())
+            for (const auto& [id, data] : it->second)
+                if (Module* m = gNetlist->get_module_by_id(id); m)
+                    handleHALModuleNameChanged(m);
+    }
+
     void DataflowInteraction::handleHALSelectionChanged(void* sender)
     {
         Q_UNUSED(sender);
@@ -37,6 +37,7 @@ namespace hal
     class Gate;
     class Module;
     class Net;
+    struct BulkChanges;
 
     class GraphContext;
     class GraphLayouter;
@@ -363,6 +364,15 @@ namespace hal
          */
         void handleUnmarkedGlobalOutput(u32 mNetId);
 
+        /**
+         * Handler to be called after a bulk of netlist modifications has ended. <br>
+         * Applies all module, gate, and net changes of the bulk to the affected contexts at once, so that each
+         * context is laid out at most once.
+         *
+         * @param changes - The IDs of all netlist elements affected during the bulk
+         */
+        void handleBulkChanges(const BulkChanges& changes);
+
         /**
          * Assigns new ID to context if this id is not in use
          *
@@ -56,6 +56,9 @@ namespace hal
         static const qreal sNetFadeInLod = 0.1;
         static const qreal sNetFadeOutLod = 0.4;
 
+        static const qreal sOverviewMaxLod = 0.05; // if current lod < than this draw aggregated tiles instead of single items
+        static const int sOverviewMinItems = 10000; // scenes with fewer items are always drawn item by item
+
         static const qreal sGridFadeStartLod = 0.4;
         static const qreal sGridFadeEndLod = 1.0;
 
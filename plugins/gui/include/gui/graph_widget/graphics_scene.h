@@ -30,6 +30,7 @@
 #include "gui/gui_globals.h"
 #include "gui/module_model/module_item.h"
 #include "gui/graph_widget/graphics_qss_adapter.h"
+#include "gui/graph_widget/scene_overview.h"
 #include "hal_core/defines.h"
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/module.h"
@@ -276,6 +277,15 @@ namespace hal
          */
         void updateAllItems();
 
+        /**
+         * Switches between drawing every single item and drawing an aggregated overview of the scene. The overview
+         * is only used for scenes of at least graph_widget_constants::sOverviewMinItems items. The items remain in
+         * the scene and keep their selection, they are merely made transparent while the overview is drawn.
+         *
+         * @param enabled - `true` to draw the overview, `false` to draw the single items
+         */
+        void setOverviewEnabled(bool enabled);
+
         /**
          * Set reference pointer to drag controller on start drag, `nullptr` when drag ended
          * @param dc - Reference to drag controller
@@ -305,11 +315,16 @@ namespace hal
         using QGraphicsScene::clear;
 
         void drawBackground(QPainter* painter, const QRectF& rect) override;
+        void drawForeground(QPainter* painter, const QRectF& rect) override;
 
         QVector<GraphicsModule*> mModuleItems;
         QVector<GraphicsGate*> mGateItems;
         QVector<GraphicsNet*> mNetItems;
 
+        SceneOverview mOverview;
+        bool mOverviewEnabled;
+        bool mOverviewDirty;
+
 #ifdef GUI_DEBUG_GRID
         void debugDrawLayouterGrid(QPainter* painter, const int x_from, const int x_to, const int y_from, const int y_to);
         QVector<qreal> mDebugXLines;
@@ -136,6 +136,13 @@ namespace hal
          */
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
 
+        /**
+         * Gets the lines the StandardGraphicsNet consists of in item coordinates.
+         *
+         * @returns the lines of the net
+         */
+        const QVector<QLineF>& lines() const { return mLines; }
+
     private:
         static qreal sAlpha;
 
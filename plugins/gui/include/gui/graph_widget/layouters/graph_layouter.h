@@ -284,7 +284,8 @@ namespace hal
         virtual void remove(const QSet<u32> modules, const QSet<u32> gates, const QSet<u32> nets) = 0;
 
         /**
-         * Does the actual layout process.
+         * Does the actual layout process. The grid placement of nodes that are already placed is kept and
+         * junctions whose entries did not change since the previous layout are reused instead of being routed again.
          */
         void layout();
 
@@ -425,6 +426,8 @@ namespace hal
         QHash<NetLayoutPoint, SeparatedNetWidth> mSeparatedWidth;
         QHash<NetLayoutPoint, float> mSpaceSeparatedOutputs;
         NetLayoutJunctionHash mJunctionHash;
+        NetLayoutJunctionHash mJunctionCache;
+        QHash<NetLayoutPoint, NetLayoutJunctionEntries> mJunctionCacheEntries;
         QMap<int, SceneCoordinate> mCoordX;
         QMap<int, SceneCoordinate> mCoordY;
         QMap<int, float> mJunctionMinDistanceY;
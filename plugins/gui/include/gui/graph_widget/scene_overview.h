@@ -0,0 +1,111 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <QColor>
+#include <QHash>
+#include <QPoint>
+#include <QRect>
+#include <QRectF>
+#include <QVector>
+
+class QPainter;
+
+uint qHash(const QPoint& p);
+
+namespace hal
+{
+    class GraphicsGate;
+    class GraphicsModule;
+    class GraphicsNet;
+
+    /**
+     * @ingroup graph
+     * @brief Aggregated picture of a GraphicsScene that is drawn instead of the single items when zoomed out far.
+     *
+     * The scene is divided into square tiles. Every tile records how many nodes it contains and how many net
+     * lines cross over into its right and its lower neighbor. Drawing only visits the tiles within the exposed
+     * rectangle, so the effort depends on the size of the viewport rather than on the number of items in the scene.
+     *
+     * The tiles serve as the spatial index of the overview only. The single items are still created for the whole
+     * scene and stay in it, where the BSP tree of QGraphicsScene limits painting and hit tests to the viewport.
+     * Materializing items for the viewport only would require the layouter to route nets without creating their
+     * items, and the scene to keep the selection of items outside the viewport, which it currently reads back
+     * from the items through QGraphicsScene::selectedItems.
+     */
+    class SceneOverview
+    {
+    public:
+        /**
+         * Edge length of a tile in scene coordinates.
+         */
+        static const int sTileSize;
+
+        /**
+         * Rebuilds the tiles from the items of a scene.
+         *
+         * @param modules - The module items of the scene
+         * @param gates - The gate items of the scene
+         * @param nets - The net items of the scene
+         */
+        void build(const QVector<GraphicsModule*>& modules, const QVector<GraphicsGate*>& gates, const QVector<GraphicsNet*>& nets);
+
+        /**
+         * Removes all tiles.
+         */
+        void clear();
+
+        /**
+         * Draws the tiles that intersect the given rectangle.
+         *
+         * @param painter - The painter to draw with
+         * @param rect - The exposed rectangle in scene coordinates
+         * @param nodeColor - The color of the nodes
+         * @param netColor - The color of the net bundles
+         */
+        void draw(QPainter* painter, const QRectF& rect, const QColor& nodeColor, const QColor& netColor) const;
+
+    private:
+        struct Tile
+        {
+            int mNodes = 0;
+            QRectF mNodeRect;
+            int mNetsRight = 0;
+            int mNetsDown  = 0;
+        };
+
+        static QPoint tileIndex(const QPointF& pos);
+        void addNode(const QRectF& rect);
+        void addHorizontalLine(qreal x0, qreal x1, qreal y);
+        void addVerticalLine(qreal x, qreal y0, qreal y1);
+
+        QHash<QPoint, Tile> mTiles;
+        QRect mTileBounds;
+        int mMaxNodes = 0;
+    };
+}    // namespace hal
@@ -335,6 +335,15 @@ namespace hal
 
         void handleNetUpdated(Net* net, u32 data);
 
+        /**
+         * Applies all module, gate, and net changes of a bulk of netlist modifications in a single pass.
+         * Removed elements are deleted from the tree, new and moved elements are inserted under their final
+         * parent, and the parents of all affected nets are determined only once.
+         *
+         * @param changes - The IDs of all netlist elements affected during the bulk.
+         */
+        void handleNetlistBulkChanged(const BulkChanges& changes);
+
     protected:
         /**
          * Factory method to append new tree items. Insert signals are sent to view. New items are put into hash table.
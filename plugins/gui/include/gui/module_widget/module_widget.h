@@ -46,6 +46,7 @@ class QTreeView;
 namespace hal
 {
     class ModuleModel;
+    struct BulkChanges;
     class ModuleProxyModel;
 
     /**
@@ -209,6 +210,13 @@ namespace hal
          */
         void handleModuleRemoved(Module* module, u32 module_id);
 
+        /**
+         * Q_SLOT to handle that a bulk of netlist modifications has ended, during which submodules might have been removed.
+         *
+         * @param changes - The IDs of all netlist elements affected during the bulk
+         */
+        void handleNetlistBulkChanged(const BulkChanges& changes);
+
     private Q_SLOTS:
         /**
          * Q_SLOT to toggle the visibility of nets in the module widget. Called when the 'Toggle Net Visibility'-buttons was clicked.
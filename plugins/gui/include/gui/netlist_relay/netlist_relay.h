@@ -150,6 +150,8 @@ namespace hal
 
         void signalThreadEvent(int type, int evt, void* object, u32 associated_data);
 
+        void signalThreadBulkEvent(int evt, void* changes);
+
         /**
          * Q_SIGNAL to notify that the netlists id has been changed. <br>
          * Relays the following hal-core event: <i>NetlistEvent::event::id_changed</i>
@@ -590,6 +592,23 @@ namespace hal
         */
         void groupingModuleRemoved(Grouping* grp, u32 id) const;
 
+        /*=======================================
+           Bulk Event Signals
+         ========================================*/
+
+        /**
+         * Q_SIGNAL to notify that a bulk of netlist modifications has ended. <br>
+         * Relays the following hal-core event: <i>BulkEvent::event::bulk_end</i>
+         *
+         * While a bulk is in progress, module, gate, and net events are not relayed individually. Instead, the
+         * affected elements are handed over at once so that models can be refreshed in a single pass.
+         * Removals and module pin changes are still relayed individually, since receivers must not keep
+         * referring to removed elements or pins until the bulk ends.
+         *
+         * @param changes - The IDs of all netlist elements affected during the bulk
+         */
+        void netlistBulkChanged(const BulkChanges& changes) const;
+
     public Q_SLOTS:
         /**
          * Q_SLOT to handle that a netlist has been opened.
@@ -604,16 +623,20 @@ namespace hal
 
         void handleThreadEvent(int type, int evt, void* object, u32 associated_data);
 
+        void handleThreadBulkEvent(int evt, void* changes);
+
     private:
         void relayNetlistEvent(NetlistEvent::event ev, Netlist* object, u32 associated_data);
         void relayModuleEvent(ModuleEvent::event ev, Module* mod, u32 associated_data);
         void relayGateEvent(GateEvent::event ev, Gate* gat, u32 associated_data);
         void relayNetEvent(NetEvent::event ev, Net* net, u32 associated_data);
         void relayGroupingEvent(GroupingEvent::event ev, Grouping* grp, u32 associated_data);
+        void relayBulkEvent(BulkEvent::event ev, const BulkChanges& changes);
         static void dumpModuleRecursion(Module* m);
 
         void handleNetlistModified();
         bool mNotified;
+        bool mBulkActive;
 
         QMap<u32, QColor> mModuleColors;
         ModuleColorManager* mModuleColorManager;
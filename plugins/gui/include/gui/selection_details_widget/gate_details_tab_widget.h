@@ -35,6 +35,7 @@
 namespace hal
 {
     class Gate;
+    struct BulkChanges;
     class DetailsFrameWidget;
     class GateInfoTable;
     class GatePinTree;
@@ -76,6 +77,8 @@ namespace hal
 
         void handleGateBooleanFunctionChanged(Gate* g);
 
+        void handleNetlistBulkChanged(const BulkChanges& changes);
+
 
     private:
         /**
@@ -91,7 +91,7 @@ namespace hal
             if (!QFile::copy(src,dst))
             {
                 log_warning("gui", "Failed to copy file '{}' into project export folder.", s.toStdString());
-                if (s == ".project.json" || s.endsWith(".hal") || s.endsWith(".hgl"))
+                if (s == ".project.json" || s.endsWith(".hal") || s.endsWith(".halb") || s.endsWith(".hgl"))
                 {
                     mStatus = ErrorCopy;
                     return;
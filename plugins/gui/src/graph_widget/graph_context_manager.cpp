@@ -29,6 +29,37 @@
 
 namespace hal
 {
+    namespace
+    {
+        template<typename E>
+        QSet<u32> recordedIds(const std::map<E, std::set<std::pair<u32, u32>>>& events, std::initializer_list<E> types, bool associated = false)
+        {
+            QSet<u32> ids;
+            for (E type : types)
+                if (auto it = events.find(type); it != events.end())
+                    for (const std::pair<u32, u32>& rec : it->second)
+                        ids.insert(associated ? rec.second : rec.first);
+            return ids;
+        }
+
+        QSet<u32> recordedIds(const std::map<GateEvent::event, std::set<u32>>& events, GateEvent::event type)
+        {
+            QSet<u32> ids;
+            if (auto it = events.find(type); it != events.end())
+                for (u32 id : it->second)
+                    ids.insert(id);
+            return ids;
+        }
+
+        struct ModuleContentChange
+        {
+            QSet<u32> addedModules;
+            QSet<u32> addedGates;
+            QSet<u32> removedModules;
+            QSet<u32> removedGates;
+        };
+    }    // namespace
+
     SettingsItemCheckbox* GraphContextManager::sSettingNetGroupingToPins = new SettingsItemCheckbox("Net Grouping Color to Gate Pins",
                                                                                                     "graph_view/net_grp_pin",
                                                                                                     true,
@@ -692,6 +723,152 @@ namespace hal
             }
     }
 
+    void GraphContextManager::handleBulkChanges(const BulkChanges& changes)
+    {
+        // all changes are scheduled first, so that every context is updated only once
+        const QVector<GraphContext*> contexts = mContextTreeModel->list();
+        QSet<GraphContext*> deletedContexts;
+        for (GraphContext* context : contexts)
+            context->beginChange();
+
+        // removed modules and gates do not exist anymore and are therefore handled by ID
+        QSet<u32> removedModules = recordedIds(changes.module_events, {ModuleEvent::event::removed});
+        QSet<u32> removedGates   = recordedIds(changes.gate_events, GateEvent::event::removed);
+
+        // only the final assignment of each gate and submodule is of interest
+        QMap<u32, ModuleContentChange> contentChanges;
+        for (u32 id : recordedIds(changes.module_events, {ModuleEvent::event::submodule_added}, true))
+        {
+            const Module* sm = gNetlist->get_module_by_id(id);
+            if (sm && sm->get_parent_module())
+                contentChanges[sm->get_parent_module()->get_id()].addedModules.insert(id);
+        }
+        if (auto it = changes.module_events.find(ModuleEvent::event::submodule_removed); it != changes.module_events.end())
+            for (const auto& [moduleId, submoduleId] : it->second)
+            {
+                const Module* sm = gNetlist->get_module_by_id(submoduleId);
+                if (sm && gNetlist->get_module_by_id(moduleId) && sm->get_parent_module() && sm->get_parent_module()->get_id() != moduleId)
+                    contentChanges[moduleId].removedModules.insert(submoduleId);
+            }
+        for (u32 id : recordedIds(changes.module_events, {ModuleEvent::event::gate_assigned}, true))
+        {
+            const Gate* g = gNetlist->get_gate_by_id(id);
+            if (g && g->get_module())
+                contentChanges[g->get_module()->get_id()].addedGates.insert(id);
+        }
+        if (auto it = changes.module_events.find(ModuleEvent::event::gate_removed); it != changes.module_events.end())
+            for (const auto& [moduleId, gateId] : it->second)
+            {
+                const Gate* g = gNetlist->get_gate_by_id(gateId);
+                if (g && gNetlist->get_module_by_id(moduleId) && g->get_module()->get_id() != moduleId)
+                    contentChanges[moduleId].removedGates.insert(gateId);
+            }
+
+        QSet<u32> changedNets = recordedIds(changes.net_events,
+                                            {NetEvent::event::removed,
+                                             NetEvent::event::name_changed,
+                                             NetEvent::event::src_added,
+                                             NetEvent::event::src_removed,
+                                             NetEvent::event::dst_added,
+                                             NetEvent::event::dst_removed});
+        QSet<u32> connectedGates = recordedIds(changes.net_events, {NetEvent::event::src_added, NetEvent::event::dst_added}, true);
+        QSet<u32> pinModules     = recordedIds(changes.module_events, {ModuleEvent::event::pin_changed});
+        QSet<u32> renamedGates   = recordedIds(changes.gate_events, GateEvent::event::name_changed);
+
+        for (GraphContext* context : contexts)
+        {
+            if (removedModules.contains(context->getExclusiveModuleId()))
+            {
+                context->setExclusiveModuleId(0, false);
+                deleteGraphContext(context);
+                deletedContexts.insert(context);
+                continue;
+            }
+
+            QSet<u32> contextModules = context->modules() & removedModules;
+            QSet<u32> contextGates   = context->gates() & removedGates;
+            if (!contextModules.isEmpty() || !contextGates.isEmpty())
+            {
+                context->remove(contextModules, contextGates);
+                if (context->empty() || context->willBeEmptied())
+                {
+                    deleteGraphContext(context);
+                    deletedContexts.insert(context);
+                    continue;
+                }
+            }
+
+            if (!context->isShowingFoldedTopModule())
+            {
+                for (auto it = contentChanges.constBegin(); it != contentChanges.constEnd(); ++it)
+                {
+                    const ModuleContentChange& cc = it.value();
+
+                    // a context showing the unfolded module follows the changes of the module content
+                    if (context->isShowingModule(it.key(), cc.addedModules, cc.addedGates, cc.removedModules, cc.removedGates))
+                    {
+                        context->add(cc.addedModules, cc.addedGates);
+                        context->remove(cc.removedModules, cc.removedGates);
+
+                        // when the module is empty, add the empty folded module to the view
+                        const Module* m = gNetlist->get_module_by_id(it.key());
+                        if (!context->willBeEmptied() && m->get_gates().empty() && m->get_submodules().empty())
+                            context->add({it.key()}, {});
+                    }
+                    else if (context->modules().contains(it.key()) || context->gates().intersects(cc.addedGates + cc.removedGates)
+                             || context->modules().intersects(cc.addedModules + cc.removedModules))
+                        context->scheduleSceneUpdate();
+
+                    // gates and unfolded submodules that moved into a folded module visible in view are removed
+                    QSet<u32> ancestorIds;
+                    for (const Module* m = gNetlist->get_module_by_id(it.key()); m; m = m->get_parent_module())
+                        ancestorIds.insert(m->get_id());
+                    if (!context->modules().intersects(ancestorIds))
+                        continue;
+                    context->remove({}, cc.addedGates & context->gates());
+                    for (u32 id : cc.addedModules)
+                        if (context->isShowingModule(id, {}, {}, {}, {}))
+                            context->removeModuleContents(id);
+                }
+
+                if (context->empty() || context->willBeEmptied())
+                {
+                    deleteGraphContext(context);
+                    deletedContexts.insert(context);
+                    continue;
+                }
+            }
+
+            if (context->nets().intersects(changedNets) || context->gates().intersects(connectedGates))
+            {
+                // forcibly apply changes since nets need to be recalculated
+                context->applyChanges();
+                context->scheduleSceneUpdate();
+            }
+            if (context->modules().intersects(pinModules))
+            {
+                context->updateNets();
+                context->scheduleSceneUpdate();
+            }
+            if (context->gates().intersects(renamedGates))
+                context->scheduleSceneUpdate();
+        }
+
+        for (u32 id : recordedIds(changes.module_events, {ModuleEvent::event::created}))
+            if (Module* m = gNetlist->get_module_by_id(id); m)
+                handleModuleCreated(m);
+        for (u32 id : recordedIds(changes.module_events, {ModuleEvent::event::name_changed}))
+            if (Module* m = gNetlist->get_module_by_id(id); m)
+                handleModuleNameChanged(m);
+        for (u32 id : recordedIds(changes.module_events, {ModuleEvent::event::type_changed}))
+            if (Module* m = gNetlist->get_module_by_id(id); m)
+                handleModuleTypeChanged(m);
+
+        for (GraphContext* context : contexts)
+            if (!deletedContexts.contains(context))
+                context->endChange();
+    }
+
     GraphLayouter* GraphContextManager::getDefaultLayouter(GraphContext* const context) const
     {
         StandardGraphLayouter* layouter = new StandardGraphLayouter(context);
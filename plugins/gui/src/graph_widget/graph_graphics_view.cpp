@@ -39,6 +39,7 @@
 #include "gui/module_dialog/gate_dialog.h"
 #include "gui/comment_system/widgets/comment_dialog.h"
 #include "gui/settings/settings_items/settings_item_checkbox.h"
+#include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/grouping.h"
 #include "hal_core/netlist/module.h"
@@ -189,6 +190,8 @@ namespace hal
 
         // USE CONSISTENT METHOD NAMES
         GraphicsScene::setLod(lod);
+        if (GraphicsScene* sc = dynamic_cast<GraphicsScene*>(scene()))
+            sc->setOverviewEnabled(lod < graph_widget_constants::sOverviewMaxLod);
         GraphicsScene::setGridEnabled(mGridEnabled);
         GraphicsScene::setGridClustersEnabled(mGridClustersEnabled);
         GraphicsScene::setGridType(mGridType);
@@ -688,10 +691,14 @@ namespace hal
         ContextMenuContribution* cmc = static_cast<ContextMenuContribution*>(act->data().value<void*>());
         Q_ASSERT(cmc);
         Q_ASSERT(cmc->mContributer);
-        cmc->mContributer->execute_function(cmc->mTagname,gNetlist,
-                                            gSelectionRelay->selectedModulesVector(),
-                                            gSelectionRelay->selectedGatesVector(),
-                                            gSelectionRelay->selectedNetsVector());
+        // the plugin might modify large parts of the netlist, hence the GUI is only updated once it is done
+        {
+            EventBulkScope bulk(gNetlist->get_event_handler());
+            cmc->mContributer->execute_function(cmc->mTagname,gNetlist,
+                                                gSelectionRelay->selectedModulesVector(),
+                                                gSelectionRelay->selectedGatesVector(),
+                                                gSelectionRelay->selectedNetsVector());
+        }
         if (gPythonContext->pythonThread())
             gPythonContext->pythonThread()->unlock();
     }
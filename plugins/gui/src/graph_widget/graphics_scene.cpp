@@ -21,6 +21,8 @@
 #include <QPainter>
 #include <QString>
 
+#include <algorithm>
+
 #include <QDebug>
 
 namespace hal
@@ -34,6 +36,37 @@ namespace hal
     bool GraphicsScene::sGridClustersEnabled = true;
     GraphicsScene::GridType GraphicsScene::sGridType = GraphicsScene::GridType::Dots;
 
+    // item lists are sorted by ID, items of equal ID keep the order they were added in
+    template<typename T>
+    static void insertSorted(QVector<T*>& items, T* item)
+    {
+        auto it = std::upper_bound(items.begin(), items.end(), item->id(), [](u32 value, const T* other) { return value < other->id(); });
+        items.insert(it, item);
+    }
+
+    template<typename T>
+    static typename QVector<T*>::const_iterator lowerBound(const QVector<T*>& items, u32 id)
+    {
+        return std::lower_bound(items.constBegin(), items.constEnd(), id, [](const T* item, u32 value) { return item->id() < value; });
+    }
+
+    template<typename T>
+    static T* findSorted(const QVector<T*>& items, u32 id)
+    {
+        auto it = lowerBound(items, id);
+        return (it != items.constEnd() && (*it)->id() == id) ? *it : nullptr;
+    }
+
+    template<typename T>
+    static bool removeSorted(QVector<T*>& items, u32 id)
+    {
+        auto it = lowerBound(items, id);
+        if (it == items.constEnd() || (*it)->id() != id)
+            return false;
+        items.remove(it - items.constBegin());
+        return true;
+    }
+
     void GraphicsScene::setLod(const qreal& lod)
     {
         sLod = lod;
@@ -75,6 +108,8 @@ namespace hal
     }
 
     GraphicsScene::GraphicsScene(QObject* parent) : QGraphicsScene(parent),
+        mOverviewEnabled(false),
+        mOverviewDirty(true),
         mDebugGridEnable(false),
         mDragController(nullptr),
         mSelectionStatus(NotPressed)
@@ -117,50 +152,21 @@ namespace hal
         switch (item->itemType())
         {
         case ItemType::Gate:
-        {
-            GraphicsGate* g = static_cast<GraphicsGate*>(item);
-            int i = 0;
-            while (i < mGateItems.size())
-            {
-                if (g->id() < mGateItems.at(i)->id())
-                    break;
-
-                i++;
-            }
-            mGateItems.insert(i, g);
-            return;
-        }
+            insertSorted(mGateItems, static_cast<GraphicsGate*>(item));
+            break;
         case ItemType::Net:
-        {
-            GraphicsNet* n = static_cast<GraphicsNet*>(item);
-            int i = 0;
-            while (i < mNetItems.size())
-            {
-                if (n->id() < mNetItems.at(i)->id())
-                    break;
-
-                i++;
-            }
-            mNetItems.insert(i, n);
-            return;
-        }
+            insertSorted(mNetItems, static_cast<GraphicsNet*>(item));
+            break;
         case ItemType::Module:
-        {
-            GraphicsModule* m = static_cast<GraphicsModule*>(item);
-            int i = 0;
-            while (i < mModuleItems.size())
-            {
-                if (m->id() < mModuleItems.at(i)->id())
-                    break;
-
-                i++;
-            }
-            mModuleItems.insert(i, m);
-            return;
-        }
+            insertSorted(mModuleItems, static_cast<GraphicsModule*>(item));
+            break;
         default:
             return;
         }
+
+        mOverviewDirty = true;
+        if (mOverviewEnabled)
+            item->setOpacity(0);
     }
 
     void GraphicsScene::removeGraphItem(GraphicsItem* item)
@@ -172,113 +178,42 @@ namespace hal
 
         QGraphicsScene::removeItem(item);
 
+        bool removed = false;
         switch (item->itemType())
         {
         case ItemType::Gate:
-        {
-            GraphicsGate* g = static_cast<GraphicsGate*>(item);
-            u32 id = g->id();
-
-            int i = 0;
-            while (i < mGateItems.size())
-            {
-                if (mGateItems.at(i)->id() == id)
-                {
-                    mGateItems.remove(i);
-                    delete g;
-                    return;
-                }
-
-                ++i;
-            }
-
-            return;
-        }
+            removed = removeSorted(mGateItems, item->id());
+            break;
         case ItemType::Net:
-        {
-            GraphicsNet* n = static_cast<GraphicsNet*>(item);
-            u32 id = n->id();
-
-            int i = 0;
-            while (i < mNetItems.size())
-            {
-                if (mNetItems.at(i)->id() == id)
-                {
-                    mNetItems.remove(i);
-                    delete n;
-                    return;
-                }
-
-                ++i;
-            }
-
-            return;
-        }
+            removed = removeSorted(mNetItems, item->id());
+            break;
         case ItemType::Module:
-        {
-            GraphicsModule* m = static_cast<GraphicsModule*>(item);
-            u32 id = m->id();
-
-            int i = 0;
-            while (i < mModuleItems.size())
-            {
-                if (mModuleItems.at(i)->id() == id)
-                {
-                    mModuleItems.remove(i);
-                    delete m;
-                    return;
-                }
-
-                ++i;
-            }
-
-            return;
-        }
+            removed = removeSorted(mModuleItems, item->id());
+            break;
         default:
             return;
         }
-    }
 
-    const GraphicsGate* GraphicsScene::getGateItem(const u32 id) const
-    {
-        for (const GraphicsGate* gg : mGateItems)
+        if (removed)
         {
-            if (gg->id() > id)
-                break;
-
-            if (gg->id() == id)
-                return gg;
+            mOverviewDirty = true;
+            delete item;
         }
+    }
 
-        return nullptr;
+    const GraphicsGate* GraphicsScene::getGateItem(const u32 id) const
+    {
+        return findSorted(mGateItems, id);
     }
 
     const GraphicsNet* GraphicsScene::getNetItem(const u32 id) const
     {
-        for (const GraphicsNet* gn : mNetItems)
-        {
-            if (gn->id() > id)
-                break;
-
-            if (gn->id() == id)
-                return gn;
-        }
-
-        return nullptr;
+        return findSorted(mNetItems, id);
     }
 
     const GraphicsModule* GraphicsScene::getModuleItem(const u32 id) const
     {
-        for (const GraphicsModule* gm : mModuleItems)
-        {
-            if (gm->id() > id)
-                break;
-
-            if (gm->id() == id)
-                return gm;
-        }
-
-        return nullptr;
+        return findSorted(mModuleItems, id);
     }
 
     void GraphicsScene::connectAll()
@@ -325,9 +260,31 @@ namespace hal
         mModuleItems.clear();
         mGateItems.clear();
         mNetItems.clear();
+        mOverview.clear();
+        mOverviewDirty = true;
         GraphicsQssAdapter::instance()->repolish();
     }
 
+    void GraphicsScene::setOverviewEnabled(bool enabled)
+    {
+        if (mModuleItems.size() + mGateItems.size() + mNetItems.size() < graph_widget_constants::sOverviewMinItems)
+            enabled = false;
+
+        if (enabled == mOverviewEnabled)
+            return;
+
+        mOverviewEnabled = enabled;
+
+        // fully transparent items are skipped by the scene without being painted, unlike hidden items they stay selectable
+        const qreal opacity = enabled ? 0 : 1;
+        for (GraphicsModule* gm : mModuleItems)
+            gm->setOpacity(opacity);
+        for (GraphicsGate* gg : mGateItems)
+            gg->setOpacity(opacity);
+        for (GraphicsNet* gn : mNetItems)
+            gn->setOpacity(opacity);
+    }
+
     void GraphicsScene::updateVisuals(const GraphShader::Shading &s)
     {
         for (GraphicsModule* gm : mModuleItems)
@@ -682,6 +639,20 @@ namespace hal
         painter->setRenderHints(original_flags); // UNNECESSARY ?
     }
 
+    void GraphicsScene::drawForeground(QPainter* painter, const QRectF& rect)
+    {
+        if (!mOverviewEnabled)
+            return;
+
+        if (mOverviewDirty)
+        {
+            mOverview.build(mModuleItems, mGateItems, mNetItems);
+            mOverviewDirty = false;
+        }
+
+        mOverview.draw(painter, rect, GraphicsQssAdapter::instance()->gateBaseColor(), GraphicsQssAdapter::instance()->netBaseColor());
+    }
+
     #ifdef GUI_DEBUG_GRID
     void GraphicsScene::debugSetLayouterGrid(const QVector<qreal>& debug_x_lines, const QVector<qreal>& debug_y_lines, qreal debug_default_height, qreal debug_default_width)
     {
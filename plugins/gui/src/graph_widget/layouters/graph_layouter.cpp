@@ -19,6 +19,7 @@
 #include <QDebug>
 #include <QApplication>
 #include <QElapsedTimer>
+#include <QtConcurrent>
 #include <qmath.h>
 
 namespace hal
@@ -39,6 +40,22 @@ namespace hal
     const static qreal sMinimumVChannelWidth  = 20;
     const static qreal sMinimumHChannelHeight = 20;
 
+    namespace
+    {
+        struct ConnectionRequest
+        {
+            u32 mId;
+            QList<NetLayoutPoint> mSources;
+            QList<NetLayoutPoint> mDestinations;
+        };
+
+        NetLayoutConnection* computeConnection(const ConnectionRequest& req)
+        {
+            NetLayoutConnectionFactory nlcf(req.mSources, req.mDestinations);
+            return nlcf.connection;
+        }
+    }    // namespace
+
     GraphLayouter::GraphLayouter(GraphContext* context, QObject* parent)
         : QObject(parent), mScene(new GraphicsScene(this)), mParentContext(context), mDone(false), mRollbackStatus(0), mDumpJunctions(false)
     {
@@ -250,32 +267,43 @@ namespace hal
         if (mDumpJunctions)
             NetLayoutJunctionEntries::resetFile();
         QElapsedTimer timer;
+        QElapsedTimer phaseTimer;
+        QString phaseTimes;
+        auto finishPhase = [&phaseTimer, &phaseTimes](const char* phase) { phaseTimes += QString(" %1:%2").arg(phase).arg(phaseTimer.restart()); };
+
         timer.start();
+        phaseTimer.start();
         mParentContext->layoutProgress(0);
         mScene->deleteAllItems();
         clearLayoutData();
 
         createBoxes();
+        finishPhase("boxes");
 
         mParentContext->layoutProgress(1);
         getWireHash();
+        finishPhase("wires");
 
         mParentContext->layoutProgress(2);
         findMaxBoxDimensions();
         mParentContext->layoutProgress(3);
         findMaxChannelLanes();
+        finishPhase("lanes");
         mParentContext->layoutProgress(4);
         calculateJunctionMinDistance();
         mParentContext->layoutProgress(5);
         calculateGateOffsets();
+        finishPhase("offsets");
         mParentContext->layoutProgress(6);
 
         mCoordArrayX = new SceneCoordinateArray(mCoordX);
         mCoordArrayY = new SceneCoordinateArray(mCoordY);
 
         placeGates();
+        finishPhase("gates");
         mParentContext->layoutProgress(7);
         drawNets();
+        finishPhase("nets");
         drawComments();
         updateSceneRect();
 
@@ -287,7 +315,7 @@ namespace hal
 #endif
         mRollbackStatus = 0;
 
-        qDebug() << "elapsed time (experimental new) layout [ms]" << timer.elapsed();
+        qDebug().noquote() << "elapsed time (experimental new) layout [ms]" << timer.elapsed() << "phases [ms]:" << phaseTimes;
 
         delete mCoordArrayX;
         delete mCoordArrayY;
@@ -357,7 +385,10 @@ namespace hal
         mMaxNodeHeight = 0;
 
         mConnectionMetric.clearAll();
-        mJunctionHash.clearAll();
+        // keep the junctions of the previous layout, getWireHash() reuses those with unchanged entries
+        mJunctionCache.clearAll();
+        mJunctionCache.swap(mJunctionHash);
+        mJunctionCacheEntries.swap(mJunctionEntries);
         mEndpointHash.clear();
         mWireHash.clear();
         mJunctionEntries.clear();
@@ -446,6 +477,8 @@ namespace hal
 
     void GraphLayouter::getWireHash()
     {
+        QList<ConnectionRequest> connectionRequests;
+
         for (const u32 id : mParentContext->nets())
         {
             qApp->processEvents(QEventLoop::AllEvents, 100);
@@ -552,17 +585,22 @@ namespace hal
                 break;
                 case EndpointList::SourceAndDestination:
                 case EndpointList::HasGlobalEndpoint:
-                {
-                    NetLayoutConnectionFactory nlcf(srcPoints.toList(), dstPoints.toList());
-                    // nlcf.dump(QString("wire %1").arg(id));
-                    mConnectionMetric.insert(NetLayoutMetric(id, nlcf.connection), nlcf.connection);
-                }
-                break;
+                    // connections are independent of each other and are computed in parallel below
+                    connectionRequests.append({id, srcPoints.toList(), dstPoints.toList()});
+                    break;
                 default:
                     break;
             }
         }
 
+        QFuture<NetLayoutConnection*> connections = QtConcurrent::mapped(connectionRequests, computeConnection);
+        connections.waitForFinished();
+        for (int i = 0; i < connectionRequests.size(); i++)
+        {
+            NetLayoutConnection* nlc = connections.resultAt(i);
+            mConnectionMetric.insert(NetLayoutMetric(connectionRequests.at(i).mId, nlc), nlc);
+        }
+
         /// logic nets -> wire mLanes
         for (auto it = mConnectionMetric.constBegin(); it != mConnectionMetric.constEnd(); ++it)
         {
@@ -627,15 +665,28 @@ namespace hal
                 {
                     if (mDumpJunctions)
                         it.value().dumpToFile(it.key());
-                    JunctionThread* jt = new JunctionThread(it.key(), it.value());
-                    connect(jt,&QThread::finished,this,&GraphLayouter::handleJunctionThreadFinished);
-                    mJunctionThreads.append(jt);
-                    jt->start();
+                    NetLayoutJunction* cached = mJunctionCache.value(it.key());
+                    if (cached && mJunctionCacheEntries.value(it.key()) == it.value())
+                    {
+                        // entries unchanged since previous layout, no need to route junction again
+                        mJunctionHash.insert(it.key(), cached);
+                        mJunctionCache.remove(it.key());
+                    }
+                    else
+                    {
+                        JunctionThread* jt = new JunctionThread(it.key(), it.value());
+                        connect(jt,&QThread::finished,this,&GraphLayouter::handleJunctionThreadFinished);
+                        mJunctionThreads.append(jt);
+                        jt->start();
+                    }
                 }
                 ++it;
             }
             qApp->processEvents();
         }
+
+        mJunctionCache.clearAll();
+        mJunctionCacheEntries.clear();
     }
 
     void GraphLayouter::findMaxBoxDimensions()
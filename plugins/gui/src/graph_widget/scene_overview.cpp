@@ -0,0 +1,136 @@
+#include "gui/graph_widget/scene_overview.h"
+
+#include "gui/graph_widget/graph_widget_constants.h"
+#include "gui/graph_widget/items/nets/graphics_net.h"
+#include "gui/graph_widget/items/nets/standard_graphics_net.h"
+#include "gui/graph_widget/items/nodes/gates/graphics_gate.h"
+#include "gui/graph_widget/items/nodes/modules/graphics_module.h"
+
+#include <QPainter>
+#include <QtMath>
+
+namespace hal
+{
+    const int SceneOverview::sTileSize = 4 * graph_widget_constants::sGridSize * graph_widget_constants::sClusterSize;
+
+    QPoint SceneOverview::tileIndex(const QPointF& pos)
+    {
+        return QPoint(qFloor(pos.x() / sTileSize), qFloor(pos.y() / sTileSize));
+    }
+
+    void SceneOverview::clear()
+    {
+        mTiles.clear();
+        mTileBounds = QRect();
+        mMaxNodes   = 0;
+    }
+
+    void SceneOverview::build(const QVector<GraphicsModule*>& modules, const QVector<GraphicsGate*>& gates, const QVector<GraphicsNet*>& nets)
+    {
+        clear();
+
+        for (const GraphicsModule* gm : modules)
+            addNode(gm->sceneBoundingRect());
+
+        for (const GraphicsGate* gg : gates)
+            addNode(gg->sceneBoundingRect());
+
+        for (const GraphicsNet* gn : nets)
+        {
+            // separated nets are short stubs next to their endpoints and do not connect tiles
+            const StandardGraphicsNet* sgn = dynamic_cast<const StandardGraphicsNet*>(gn);
+            if (!sgn)
+                continue;
+
+            const QPointF offset = sgn->scenePos();
+            for (const QLineF& line : sgn->lines())
+            {
+                const QLineF l = line.translated(offset);
+                if (l.y1() == l.y2())
+                    addHorizontalLine(qMin(l.x1(), l.x2()), qMax(l.x1(), l.x2()), l.y1());
+                else if (l.x1() == l.x2())
+                    addVerticalLine(l.x1(), qMin(l.y1(), l.y2()), qMax(l.y1(), l.y2()));
+            }
+        }
+    }
+
+    void SceneOverview::addNode(const QRectF& rect)
+    {
+        const QPoint index = tileIndex(rect.center());
+        Tile& tile         = mTiles[index];
+        tile.mNodes++;
+        tile.mNodeRect = tile.mNodeRect.isNull() ? rect : tile.mNodeRect.united(rect);
+
+        mMaxNodes   = qMax(mMaxNodes, tile.mNodes);
+        mTileBounds = mTileBounds.isNull() ? QRect(index, index) : mTileBounds.united(QRect(index, index));
+    }
+
+    void SceneOverview::addHorizontalLine(qreal x0, qreal x1, qreal y)
+    {
+        const QPoint first = tileIndex(QPointF(x0, y));
+        const QPoint last  = tileIndex(QPointF(x1, y));
+        for (int ix = first.x(); ix < last.x(); ix++)
+            mTiles[QPoint(ix, first.y())].mNetsRight++;
+    }
+
+    void SceneOverview::addVerticalLine(qreal x, qreal y0, qreal y1)
+    {
+        const QPoint first = tileIndex(QPointF(x, y0));
+        const QPoint last  = tileIndex(QPointF(x, y1));
+        for (int iy = first.y(); iy < last.y(); iy++)
+            mTiles[QPoint(first.x(), iy)].mNetsDown++;
+    }
+
+    void SceneOverview::draw(QPainter* painter, const QRectF& rect, const QColor& nodeColor, const QColor& netColor) const
+    {
+        if (mTiles.isEmpty())
+            return;
+
+        // net bundles may leave the bounding box of the nodes by one tile
+        const QRect visible = QRect(tileIndex(rect.topLeft()), tileIndex(rect.bottomRight())).intersected(mTileBounds.adjusted(-1, -1, 1, 1));
+        if (visible.isEmpty())
+            return;
+
+        const bool original_antialiasing = painter->renderHints().testFlag(QPainter::Antialiasing);
+        painter->setRenderHint(QPainter::Antialiasing, false);
+
+        QPen pen(netColor);
+        pen.setCosmetic(true);
+        const qreal half = sTileSize / 2.0;
+
+        for (int iy = visible.top(); iy <= visible.bottom(); iy++)
+        {
+            for (int ix = visible.left(); ix <= visible.right(); ix++)
+            {
+                auto it = mTiles.constFind(QPoint(ix, iy));
+                if (it == mTiles.constEnd())
+                    continue;
+
+                const Tile& tile = it.value();
+                const QPointF center((ix * sTileSize) + half, (iy * sTileSize) + half);
+
+                if (tile.mNetsRight)
+                {
+                    pen.setWidthF(1 + qLn(tile.mNetsRight) / M_LN2);
+                    painter->setPen(pen);
+                    painter->drawLine(center, center + QPointF(sTileSize, 0));
+                }
+                if (tile.mNetsDown)
+                {
+                    pen.setWidthF(1 + qLn(tile.mNetsDown) / M_LN2);
+                    painter->setPen(pen);
+                    painter->drawLine(center, center + QPointF(0, sTileSize));
+                }
+                if (tile.mNodes)
+                {
+                    // denser tiles are drawn more opaque
+                    QColor fill = nodeColor;
+                    fill.setAlphaF(0.3 + 0.7 * tile.mNodes / mMaxNodes);
+                    painter->fillRect(tile.mNodeRect, fill);
+                }
+            }
+        }
+
+        painter->setRenderHint(QPainter::Antialiasing, original_antialiasing);
+    }
+}    // namespace hal
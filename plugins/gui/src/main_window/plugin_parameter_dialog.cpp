@@ -1,6 +1,7 @@
 #include "gui/main_window/plugin_parameter_dialog.h"
 #include "hal_core/plugin_system/plugin_interface_base.h"
 #include "hal_core/plugin_system/gui_extension_interface.h"
+#include "hal_core/netlist/event_system/event_handler.h"
 #include "gui/module_dialog/module_dialog.h"
 #include "gui/module_dialog/gate_dialog.h"
 #include "gui/main_window/color_selection.h"
@@ -297,7 +298,11 @@ namespace hal {
 
         if (!buttonClicked.empty())
         {
-            mGuiExtensionInterface->execute_function(buttonClicked,gNetlist,gSelectionRelay->selectedModulesVector(),gSelectionRelay->selectedGatesVector(),gSelectionRelay->selectedNetsVector());
+            // the plugin might modify large parts of the netlist, hence the GUI is only updated once it is done
+            {
+                EventBulkScope bulk(gNetlist->get_event_handler());
+                mGuiExtensionInterface->execute_function(buttonClicked,gNetlist,gSelectionRelay->selectedModulesVector(),gSelectionRelay->selectedGatesVector(),gSelectionRelay->selectedNetsVector());
+            }
             if (gPythonContext->pythonThread())
                 gPythonContext->pythonThread()->unlock();
         }
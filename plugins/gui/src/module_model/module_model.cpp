@@ -8,6 +8,7 @@
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/net.h"
 #include <QMimeData>
+#include <algorithm>
 
 namespace hal
 {
@@ -34,6 +35,7 @@ namespace hal
         connect(gNetlistRelay, &NetlistRelay::netSourceRemoved,       this, &ModuleModel::handleNetUpdated);
         connect(gNetlistRelay, &NetlistRelay::netDestinationAdded,    this, &ModuleModel::handleNetUpdated);
         connect(gNetlistRelay, &NetlistRelay::netDestinationRemoved,  this, &ModuleModel::handleNetUpdated);
+        connect(gNetlistRelay, &NetlistRelay::netlistBulkChanged,     this, &ModuleModel::handleNetlistBulkChanged);
     }
 
     QVariant ModuleModel::data(const QModelIndex& index, int role) const
@@ -527,6 +529,103 @@ namespace hal
         Q_UNUSED(submodId);
     }
 
+    void ModuleModel::handleNetlistBulkChanged(const BulkChanges& changes)
+    {
+        auto moduleIds = [&changes](ModuleEvent::event ev) {
+            QList<u32> ids;
+            if (auto it = changes.module_events.find(ev); it != changes.module_events.end())
+                for (const auto& [id, data] : it->second)
+                    ids.append(id);
+            return ids;
+        };
+
+        // removed elements do not exist anymore and are therefore handled by ID
+        for (u32 id : moduleIds(ModuleEvent::event::removed))
+            removeModule(id);
+        if (auto it = changes.gate_events.find(GateEvent::event::removed); it != changes.gate_events.end())
+            for (u32 id : it->second)
+                removeGate(id);
+        if (auto it = changes.net_events.find(NetEvent::event::removed); it != changes.net_events.end())
+            for (const auto& [id, data] : it->second)
+                removeNet(id);
+
+        // new modules are inserted top-down, so that their parent items exist already
+        QList<Module*> createdModules;
+        for (u32 id : moduleIds(ModuleEvent::event::created))
+        {
+            Module* mod = gNetlist->get_module_by_id(id);
+            if (mod && mod->get_parent_module())
+                createdModules.append(mod);
+        }
+        std::sort(createdModules.begin(), createdModules.end(), [](const Module* a, const Module* b) { return a->get_submodule_depth() < b->get_submodule_depth(); });
+        for (const Module* mod : createdModules)
+            if (!mModuleMap.contains(mod->get_id()))
+                addModule(mod->get_id(), mod->get_parent_module()->get_id());
+
+        QSet<const Net*> netsToAssign;
+        for (u32 id : moduleIds(ModuleEvent::event::parent_changed))
+        {
+            Module* mod = gNetlist->get_module_by_id(id);
+            if (!mod || !mod->get_parent_module() || createdModules.contains(mod))
+                continue;
+            updateModuleParent(mod);
+            for (const Net* net : mod->get_nets())
+                netsToAssign.insert(net);
+        }
+
+        // gates are only moved once to their final module
+        if (auto it = changes.module_events.find(ModuleEvent::event::gate_assigned); it != changes.module_events.end())
+        {
+            QSet<u32> handledGates;
+            for (const auto& [moduleId, gateId] : it->second)
+            {
+                const Gate* gat = gNetlist->get_gate_by_id(gateId);
+                if (!gat || handledGates.contains(gateId))
+                    continue;
+                handledGates.insert(gateId);
+                moduleAssignGate(gat->get_module()->get_id(), gateId);
+                for (const Net* net : gat->get_fan_in_nets())
+                    netsToAssign.insert(net);
+                for (const Net* net : gat->get_fan_out_nets())
+                    netsToAssign.insert(net);
+            }
+        }
+
+        for (auto it = changes.net_events.begin(); it != changes.net_events.end(); ++it)
+        {
+            if (it->first == NetEvent::event::removed || it->first == NetEvent::event::name_changed)
+                continue;
+            for (const auto& [id, data] : it->second)
+                if (const Net* net = gNetlist->get_net_by_id(id); net)
+                    netsToAssign.insert(net);
+        }
+
+        // the parents of all affected nets are determined in a single pass over the tree
+        if (!netsToAssign.isEmpty())
+        {
+            QHash<const Net*,ModuleItem*> parentAssignment;
+            std::unordered_set<Net*> assignedNets;
+            findNetParentRecursion(mRootItem, parentAssignment, assignedNets);
+            for (const Net* net : netsToAssign)
+                updateNetParent(net, &parentAssignment);
+        }
+
+        for (u32 id : moduleIds(ModuleEvent::event::name_changed))
+            if (gNetlist->get_module_by_id(id))
+                updateModuleName(id);
+        for (u32 id : moduleIds(ModuleEvent::event::type_changed))
+            if (gNetlist->get_module_by_id(id))
+                updateModuleType(id);
+        if (auto it = changes.gate_events.find(GateEvent::event::name_changed); it != changes.gate_events.end())
+            for (u32 id : it->second)
+                if (gNetlist->get_gate_by_id(id))
+                    updateGateName(id);
+        if (auto it = changes.net_events.find(NetEvent::event::name_changed); it != changes.net_events.end())
+            for (const auto& [id, data] : it->second)
+                if (gNetlist->get_net_by_id(id))
+                    updateNetName(id);
+    }
+
     void ModuleModel::findNetParentRecursion(BaseTreeItem* parent, QHash<const Net *, ModuleItem *> &parentAssignment, std::unordered_set<Net*>& assignedNets) const
     {
         for (BaseTreeItem* bti : parent->getChildren())
@@ -93,6 +93,7 @@ namespace hal
         connect(mTreeView, &ModuleTreeView::doubleClicked, this, &ModuleWidget::handleItemDoubleClicked);
         connect(gSelectionRelay, &SelectionRelay::selectionChanged, this, &ModuleWidget::handleSelectionChanged, Qt::QueuedConnection);
         connect(gNetlistRelay, &NetlistRelay::moduleSubmoduleRemoved, this, &ModuleWidget::handleModuleRemoved);
+        connect(gNetlistRelay, &NetlistRelay::netlistBulkChanged, this, &ModuleWidget::handleNetlistBulkChanged);
 
         connect(mSearchAction, &QAction::triggered, this, &ModuleWidget::toggleSearchbar);
 
@@ -256,6 +257,12 @@ namespace hal
         mIgnoreSelectionChange = true;
     }
 
+    void ModuleWidget::handleNetlistBulkChanged(const BulkChanges& changes)
+    {
+        if (changes.module_events.find(ModuleEvent::event::submodule_removed) != changes.module_events.end())
+            handleModuleRemoved(nullptr, 0);
+    }
+
     void ModuleWidget::handleCurrentChanged(const QModelIndex& current, const QModelIndex& previous)
     {
         Q_UNUSED(previous);
@@ -31,10 +31,11 @@
 namespace hal
 {
     NetlistRelay::NetlistRelay(QObject* parent)
-        : QObject(parent), mNotified(false), mModuleColorManager(new ModuleColorManager(this))
+        : QObject(parent), mNotified(false), mBulkActive(false), mModuleColorManager(new ModuleColorManager(this))
     {
         connect(FileManager::get_instance(), &FileManager::fileOpened, this, &NetlistRelay::debugHandleFileOpened);    // DEBUG LINE
         connect(this, &NetlistRelay::signalThreadEvent, this, &NetlistRelay::handleThreadEvent, Qt::BlockingQueuedConnection);
+        connect(this, &NetlistRelay::signalThreadBulkEvent, this, &NetlistRelay::handleThreadBulkEvent, Qt::BlockingQueuedConnection);
     }
 
     NetlistRelay::~NetlistRelay()
@@ -51,6 +52,8 @@ namespace hal
         gNetlist->get_event_handler()->unregister_callback("gui_gate_handler");
         gNetlist->get_event_handler()->unregister_callback("gui_net_handler");
         gNetlist->get_event_handler()->unregister_callback("gui_grouping_handler");
+        gNetlist->get_event_handler()->unregister_callback("gui_bulk_handler");
+        mBulkActive = false;
     }
 
     void NetlistRelay::registerNetlistCallbacks()
@@ -72,6 +75,9 @@ namespace hal
         gNetlist->get_event_handler()->register_callback(
             "gui_grouping_handler",
             std::function<void(GroupingEvent::event, Grouping*, u32)>(std::bind(&NetlistRelay::relayGroupingEvent, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
+
+        gNetlist->get_event_handler()->register_callback(
+            "gui_bulk_handler", std::function<void(BulkEvent::event, const BulkChanges&)>(std::bind(&NetlistRelay::relayBulkEvent, this, std::placeholders::_1, std::placeholders::_2)));
     }
 
     void NetlistRelay::handleNetlistModified()
@@ -481,6 +487,10 @@ namespace hal
 
         handleNetlistModified();
 
+        // handled at once when the bulk ends, except for removals and pin changes since receivers must not keep referring to removed elements or pins
+        if (mBulkActive && ev != ModuleEvent::event::removed && ev != ModuleEvent::event::pin_changed)
+            return;
+
         if (dynamic_cast<PythonThread*>(QThread::currentThread()))
         {
             Q_EMIT signalThreadEvent(TetModule, (int)ev, mod, associated_data);
@@ -507,11 +517,15 @@ namespace hal
             case ModuleEvent::event::removed: {
                 //< no associated_data
 
-                mModuleColorManager->removeColor(mod->get_id());
+                // within a bulk, handled by ID when the bulk ends
+                if (!mBulkActive)
+                {
+                    mModuleColorManager->removeColor(mod->get_id());
 
-                gGraphContextManager->handleModuleRemoved(mod);
-                gSelectionRelay->handleModuleRemoved(mod->get_id());
-                SelectionDetailsIconProvider::instance()->handleModuleRemoved(mod->get_id());
+                    gGraphContextManager->handleModuleRemoved(mod);
+                    gSelectionRelay->handleModuleRemoved(mod->get_id());
+                    SelectionDetailsIconProvider::instance()->handleModuleRemoved(mod->get_id());
+                }
                 Q_EMIT moduleRemoved(mod);
                 break;
             }
@@ -578,7 +592,9 @@ namespace hal
                 std::cerr << "---------------------" << std::endl;
                 */
 
-                gGraphContextManager->handleModulePortsChanged(mod,pev,id);
+                // within a bulk, the graph contexts are updated when the bulk ends
+                if (!mBulkActive)
+                    gGraphContextManager->handleModulePortsChanged(mod,pev,id);
 
                 Q_EMIT modulePortsChanged(mod,pev,id);
                 break;
@@ -629,6 +645,10 @@ namespace hal
 
         handleNetlistModified();
 
+        // handled at once when the bulk ends, except for removals since receivers must not keep referring to removed gates
+        if (mBulkActive && ev != GateEvent::event::removed)
+            return;
+
         if (dynamic_cast<PythonThread*>(QThread::currentThread()))
         {
             Q_EMIT signalThreadEvent(TetGate, (int)ev, gat, associated_data);
@@ -647,9 +667,13 @@ namespace hal
             case GateEvent::event::removed: {
                 //< no associated_data
 
-                gSelectionRelay->handleGateRemoved(gat->get_id());
+                // within a bulk, handled by ID when the bulk ends
+                if (!mBulkActive)
+                {
+                    gSelectionRelay->handleGateRemoved(gat->get_id());
 
-                gGraphContextManager->handleGateRemoved(gat);
+                    gGraphContextManager->handleGateRemoved(gat);
+                }
 
                 Q_EMIT gateRemoved(gat);
                 break;
@@ -689,6 +713,10 @@ namespace hal
 
         handleNetlistModified();
 
+        // handled at once when the bulk ends, except for removals since receivers must not keep referring to removed nets
+        if (mBulkActive && ev != NetEvent::event::removed)
+            return;
+
         if (dynamic_cast<PythonThread*>(QThread::currentThread()))
         {
             Q_EMIT signalThreadEvent(TetNet, (int)ev, net, associated_data);
@@ -709,8 +737,12 @@ namespace hal
             case NetEvent::event::removed: {
                 //< no associated_data
 
-                gGraphContextManager->handleNetRemoved(net);
-                gSelectionRelay->handleNetRemoved(net->get_id());
+                // within a bulk, handled by ID when the bulk ends
+                if (!mBulkActive)
+                {
+                    gGraphContextManager->handleNetRemoved(net);
+                    gSelectionRelay->handleNetRemoved(net->get_id());
+                }
 
                 Q_EMIT netRemoved(net);
                 break;
@@ -768,6 +800,69 @@ namespace hal
         }
     }
 
+    void NetlistRelay::relayBulkEvent(BulkEvent::event ev, const BulkChanges& changes)
+    {
+        if (dynamic_cast<PythonThread*>(QThread::currentThread()))
+        {
+            Q_EMIT signalThreadBulkEvent((int)ev, const_cast<BulkChanges*>(&changes));
+            qApp->processEvents();
+            return;
+        }
+
+        switch (ev)
+        {
+            case BulkEvent::event::bulk_begin: {
+                //< no associated_data
+
+                mBulkActive = true;
+                break;
+            }
+            case BulkEvent::event::bulk_end: {
+                //< associated_data = all changes recorded during the bulk
+
+                mBulkActive = false;
+                if (changes.module_events.empty() && changes.gate_events.empty() && changes.net_events.empty())
+                    break;
+
+                // removed elements do not exist anymore and are therefore only handled by ID
+                if (auto it = changes.module_events.find(ModuleEvent::event::removed); it != changes.module_events.end())
+                    for (const auto& [id, data] : it->second)
+                    {
+                        mModuleColorManager->removeColor(id);
+                        gSelectionRelay->handleModuleRemoved(id);
+                        SelectionDetailsIconProvider::instance()->handleModuleRemoved(id);
+                    }
+                if (auto it = changes.gate_events.find(GateEvent::event::removed); it != changes.gate_events.end())
+                    for (u32 id : it->second)
+                        gSelectionRelay->handleGateRemoved(id);
+                if (auto it = changes.net_events.find(NetEvent::event::removed); it != changes.net_events.end())
+                    for (const auto& [id, data] : it->second)
+                        gSelectionRelay->handleNetRemoved(id);
+
+                if (auto it = changes.module_events.find(ModuleEvent::event::created); it != changes.module_events.end())
+                    for (const auto& [id, data] : it->second)
+                    {
+                        Module* mod = gNetlist->get_module_by_id(id);
+                        if (mod && mod->get_parent_module() != nullptr)
+                            mModuleColorManager->setRandomColor(id);
+                    }
+
+                gGraphContextManager->handleBulkChanges(changes);
+
+                Q_EMIT netlistBulkChanged(changes);
+
+                // details of the selected elements might have changed
+                gSelectionRelay->relaySelectionChanged(this);
+                break;
+            }
+        }
+    }
+
+    void NetlistRelay::handleThreadBulkEvent(int evt, void* changes)
+    {
+        relayBulkEvent((BulkEvent::event)evt, *static_cast<const BulkChanges*>(changes));
+    }
+
     void NetlistRelay::handleThreadEvent(int type, int evt, void* object, u32 associated_data)
     {
         switch (type)
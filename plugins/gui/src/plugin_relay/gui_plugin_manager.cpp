@@ -6,6 +6,7 @@
 #include "hal_core/plugin_system/gui_extension_interface.h"
 #include "hal_core/plugin_system/cli_extension_interface.h"
 #include "hal_core/plugin_system/plugin_interface_ui.h"
+#include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser_manager.h"
 #include "hal_core/utilities/log.h"
 #include <QMap>
@@ -332,7 +333,11 @@ namespace hal {
             {
                 QAction *act = subMenu->addAction(QString::fromStdString(cmc.mEntry));
                 connect(act,&QAction::triggered,contextMenu,[cmc, netlist, modules, gates, nets]()
-                    {cmc.mContributer->execute_function(cmc.mTagname, netlist, modules, gates, nets);}
+                    {
+                        // the plugin might modify large parts of the netlist, hence the GUI is only updated once it is done
+                        EventBulkScope bulk(netlist->get_event_handler());
+                        cmc.mContributer->execute_function(cmc.mTagname, netlist, modules, gates, nets);
+                    }
                 );
             }
         }
@@ -651,7 +656,10 @@ namespace hal {
     {
         QMap<QString,QString> pluginMap = *this; // might want to add hal format temporarily
         if (addHalFormat)
+        {
             pluginMap.insert(".hal", "HAL progress files ");
+            pluginMap.insert(".halb", "HAL binary progress files ");
+        }
 
         QString reStr = "(.*)";
         if (mFeature == FacExtensionInterface::FacGatelibParser || mFeature == FacExtensionInterface::FacNetlistParser)
@@ -81,6 +81,7 @@ namespace hal
 
         addTab("Boolean Functions", mBooleanFunctionsFrame, false);
         connect(gNetlistRelay, &NetlistRelay::gateBooleanFunctionChanged, this, &GateDetailsTabWidget::handleGateBooleanFunctionChanged);
+        connect(gNetlistRelay, &NetlistRelay::netlistBulkChanged, this, &GateDetailsTabWidget::handleNetlistBulkChanged);
 
         //data tab
         mDataTable = new DataTableWidget(this);
@@ -122,6 +123,18 @@ namespace hal
         }
     }
 
+    void GateDetailsTabWidget::handleNetlistBulkChanged(const BulkChanges& changes)
+    {
+        if (!mCurrentGate)
+            return;
+
+        // the current gate is only compared by its address, since it might have been removed during the bulk
+        if (auto it = changes.gate_events.find(GateEvent::event::boolean_function_changed); it != changes.gate_events.end())
+            for (u32 id : it->second)
+                if (Gate* g = gNetlist->get_gate_by_id(id); g && g == mCurrentGate)
+                    handleGateBooleanFunctionChanged(g);
+    }
+
     void GateDetailsTabWidget::hideOrShorMultiTab(GateDetailsTabWidget::GateTypeCategory gateTypeCategory)
     {
         if (gateTypeCategory != GateDetailsTabWidget::GateTypeCategory::none)
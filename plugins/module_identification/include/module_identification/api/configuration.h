@@ -81,7 +81,7 @@ namespace hal
             std::vector<module_identification::CandidateType> m_types_to_check = all_checkable_candidate_types;
 
             /**
-             * @brief Maximum number of concurrent threads created during execution. Defaults to 1.
+             * @brief Maximum number of concurrent threads used during execution. Any value above 1 processes the candidates on the global thread pool, whose size then determines the number of threads. Defaults to 1.
              */
             u32 m_max_thread_count = 1;
 
@@ -116,7 +116,7 @@ namespace hal
             /**
              * @brief Set the maximum number of threads.
              *
-             * @param[in] max_thread_count - The number of threads to be started at max.
+             * @param[in] max_thread_count - The maximum number of threads to be used.
              * @returns The updated module identification configuration.
              */
             Configuration& with_max_thread_count(const u32& max_thread_count);
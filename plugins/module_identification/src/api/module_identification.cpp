@@ -2,6 +2,7 @@
 
 #include "hal_core/netlist/decorators/netlist_modification_decorator.h"
 #include "hal_core/netlist/module.h"
+#include "hal_core/utilities/thread_pool.h"
 #include "module_identification/api/configuration.h"
 #include "module_identification/api/result.h"
 #include "module_identification/architectures/lattice_ice40.h"
@@ -14,10 +15,7 @@
 #include "module_identification/utils/statistics.h"
 #include "module_identification/utils/utils.h"
 
-#include <deque>
-#include <mutex>
-
-// #define PRINT_THREAD_INFO
+#include <optional>
 
 namespace hal
 {
@@ -191,183 +189,96 @@ namespace hal
 
         namespace
         {
-            // TODO this is a mess of multi threading and needs cleaning up badly at some point
-            void work(std::vector<StructuralCandidate*>& structural_candidates_work_queque,
-                      std::vector<std::unique_ptr<StructuralCandidate>>& structural_candidates,
-                      std::vector<std::unique_ptr<StructuralCandidate>>& done_structural_candidates,
-                      std::atomic<u32>& structural_workload,
-                      std::deque<std::pair<std::unique_ptr<StructuralCandidate>, std::vector<FunctionalCandidate>>>& functional_candidates,
-                      std::map<BaseCandidate*, std::vector<VerifiedCandidate>>& verified_candidates,
-                      const Configuration& config,
-                      Statistics& stats,
-                      std::vector<std::string>& status,
-                      std::vector<std::string>& candidate_info,
-                      std::mutex& thread_sync,
-                      const u32 thread_idx)
+            /**
+             * Runs the given function for every index in [0, size), in parallel on the global thread pool unless the configuration limits the analysis to a single thread.
+             *
+             * @param[in] size - The number of indices.
+             * @param[in] config - The module identification configuration.
+             * @param[in] func - The function to run for every index.
+             */
+            template<typename F>
+            void for_each_index(u32 size, const Configuration& config, F&& func)
             {
-                std::map<BaseCandidate*, std::vector<VerifiedCandidate>> verified_candidates_cache;
-
-                const auto work_structural =
-                    [&config, &structural_candidates_work_queque, &structural_candidates, &structural_workload, &functional_candidates, &stats, &status, &candidate_info, &thread_sync, &thread_idx]()
-                    -> bool {
-                    // check for structural OverarchingCandidate workloads
-                    if (!structural_candidates_work_queque.empty())
-                    {
-                        // const auto sc = structural_candidates_work_queque.back();
-                        structural_candidates_work_queque.pop_back();
-
-                        auto unique_sc = std::move(structural_candidates.back());
-                        structural_candidates.pop_back();
-
-                        thread_sync.unlock();
-
-                        candidate_info.at(thread_idx) = "S_" + unique_sc->base_candidate->m_gates.front()->get_name();
-
-                        auto new_functional_candidates_res = generate_functional_candidates(unique_sc.get(), config, stats);
-                        if (new_functional_candidates_res.is_error())
-                        {
-                            log_error("module_identification",
-                                      "failed to generate functional candidates for carry chain {}: {}",
-                                      unique_sc.get()->m_gates.front()->get_name(),
-                                      new_functional_candidates_res.get_error().get());
-                            return true;
-                        }
-                        std::vector<FunctionalCandidate> new_functional_candidates = new_functional_candidates_res.get();
-
-                        for (const auto& fc : new_functional_candidates)
-                        {
-                            const auto _bfs = unique_sc.get()->ctx.get_boolean_functions(fc.m_output_nets, fc.m_control_mapping);
-                        }
-
-                        structural_workload -= 1;
-                        if (!new_functional_candidates.empty())
-                        {
-                            thread_sync.lock();
-                            status.at(thread_idx) = "LOCKING STRUCTUAL at " + std::to_string(thread_idx);
-                            functional_candidates.push_back({std::move(unique_sc), new_functional_candidates});
-                            thread_sync.unlock();
-                        }
-
-                        return true;
-                    }
-
-                    return false;
-                };
-
-                const auto work_functional = [&config, &functional_candidates, &done_structural_candidates, &verified_candidates_cache, &candidate_info, &thread_sync, &thread_idx, &stats]() -> bool {
-                    // check for  functional OverarchingCandidate workloads
-                    if (!functional_candidates.empty())
-                    {
-                        auto& [sc, f_candidates] = functional_candidates.front();
-
-                        auto sc_ptr = functional_candidates.front().first.get();
-                        auto bc     = sc->base_candidate;
-                        auto fc     = f_candidates.back();
-
-                        if (f_candidates.size() == 1)
-                        {
-                            // if this was the last functional candidate from this structural candidate pop the pair from the deque
-                            done_structural_candidates.push_back(std::move(sc));
-                            sc_ptr = done_structural_candidates.back().get();
-
-                            functional_candidates.pop_front();
-                        }
-                        else
-                        {
-                            // ... otherwise just pop one candidate from the vector
-                            f_candidates.pop_back();
-                        }
-                        thread_sync.unlock();
-
-                        candidate_info.at(thread_idx) = "F_" + fc.m_base_gates.front()->get_name();
-
-                        const auto output_functions_res = sc_ptr->ctx.get_boolean_functions_const(fc.m_output_nets, fc.m_control_mapping);
-                        if (output_functions_res.is_error())
-                        {
-                            log_error("module_identification", "cannot check candidate: failed to get Boolean output functions before check.\n {}", output_functions_res.get_error().get());
-                        }
-                        const auto output_functions = output_functions_res.get();
-
-                        const auto res = fc.check(output_functions, config.m_known_registers);
-                        if (res.is_error())
-                        {
-                            log_error("module_identification",
-                                      "failed to check current overaching candidate at carry chain {} of type {}:\n{}",
-                                      fc.m_gates.front()->get_name(),
-                                      enum_to_string(fc.m_candidate_type),
-                                      res.get_error().get());
-                            return true;
-                        }
-                        stats.add_stat(bc, fc);
-
-                        auto vc         = res.get();
-                        vc.m_base_gates = bc->m_gates;
-
-                        if (vc.is_verified())
-                        {
-                            verified_candidates_cache[bc].push_back(vc);
-                        }
-                        return true;
-                    }
-
-                    return false;
-                };
+                if (config.m_max_thread_count > 1)
+                {
+                    parallel_for(0, size, func);
+                    return;
+                }
 
-                status.at(thread_idx) = "INIT";
-                while (true)
+                for (u32 i = 0; i < size; i++)
                 {
-                    // getting workload
-                    candidate_info.at(thread_idx) = "NONE";
-                    status.at(thread_idx)         = "LOCKED";
-                    thread_sync.lock();
+                    func(i);
+                }
+            }
 
-                    // all work is done, now return results
-                    if ((structural_workload == 0) && functional_candidates.empty())
-                    {
-                        for (auto [bc, vc] : verified_candidates_cache)
-                        {
-                            verified_candidates.at(bc).insert(verified_candidates.at(bc).end(), vc.begin(), vc.end());
-                        }
-                        thread_sync.unlock();
+            /**
+             * Generates the functional candidates of a structural candidate and populates the Boolean function cache of its context for them.
+             *
+             * @param[in] sc - The structural candidate.
+             * @param[in] config - The module identification configuration.
+             * @param[in] stats - The statistics to add to.
+             * @returns The functional candidates, empty if their generation failed.
+             */
+            std::vector<FunctionalCandidate> process_structural_candidate(StructuralCandidate* sc, const Configuration& config, Statistics& stats)
+            {
+                auto new_functional_candidates_res = generate_functional_candidates(sc, config, stats);
+                if (new_functional_candidates_res.is_error())
+                {
+                    log_error("module_identification",
+                              "failed to generate functional candidates for carry chain {}: {}",
+                              sc->m_gates.front()->get_name(),
+                              new_functional_candidates_res.get_error().get());
+                    return {};
+                }
+                std::vector<FunctionalCandidate> new_functional_candidates = new_functional_candidates_res.get();
 
-                        status.at(thread_idx) = "FINISHED";
-                        return;
-                    }
+                for (const auto& fc : new_functional_candidates)
+                {
+                    const auto _bfs = sc->ctx.get_boolean_functions(fc.m_output_nets, fc.m_control_mapping);
+                }
 
-                    if (config.m_multithreading_priority == MultithreadingPriority::time_priority)
-                    {
-                        status.at(thread_idx) = "RUNNING STRUCTURAL";
-                        if (work_structural())
-                        {
-                            continue;
-                        }
+                return new_functional_candidates;
+            }
 
-                        status.at(thread_idx) = "RUNNING FUNCTIONAL";
-                        if (work_functional())
-                        {
-                            continue;
-                        }
-                    }
-                    else
-                    {
-                        status.at(thread_idx) = "RUNNING FUNCTIONAL";
-                        if (work_functional())
-                        {
-                            continue;
-                        }
+            /**
+             * Checks a functional candidate against the Boolean functions of its structural candidate.
+             *
+             * @param[in] sc - The structural candidate the functional candidate was generated from.
+             * @param[in] fc - The functional candidate.
+             * @param[in] config - The module identification configuration.
+             * @param[in] stats - The statistics to add to.
+             * @returns The verified candidate if the check succeeded, an empty optional otherwise.
+             */
+            std::optional<VerifiedCandidate> process_functional_candidate(const StructuralCandidate* sc, FunctionalCandidate& fc, const Configuration& config, Statistics& stats)
+            {
+                const auto output_functions_res = sc->ctx.get_boolean_functions_const(fc.m_output_nets, fc.m_control_mapping);
+                if (output_functions_res.is_error())
+                {
+                    log_error("module_identification", "cannot check candidate: failed to get Boolean output functions before check.\n {}", output_functions_res.get_error().get());
+                    return std::nullopt;
+                }
+                const auto output_functions = output_functions_res.get();
 
-                        status.at(thread_idx) = "RUNNING STRUCTURAL";
-                        if (work_structural())
-                        {
-                            continue;
-                        }
-                    }
+                const auto res = fc.check(output_functions, config.m_known_registers);
+                if (res.is_error())
+                {
+                    log_error("module_identification",
+                              "failed to check current overaching candidate at carry chain {} of type {}:\n{}",
+                              fc.m_gates.front()->get_name(),
+                              enum_to_string(fc.m_candidate_type),
+                              res.get_error().get());
+                    return std::nullopt;
+                }
+                stats.add_stat(sc->base_candidate, fc);
 
-                    thread_sync.unlock();
+                auto vc         = res.get();
+                vc.m_base_gates = sc->base_candidate->m_gates;
 
-                    status.at(thread_idx) = "WAITING";
-                    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                if (!vc.is_verified())
+                {
+                    return std::nullopt;
                 }
+                return vc;
             }
 
             hal::Result<Result>
@@ -379,10 +290,7 @@ namespace hal
                 // contains a list of verified candidates for each base candidate
                 std::map<BaseCandidate*, std::vector<VerifiedCandidate>> verified_candidates;
 
-                std::vector<StructuralCandidate*> structural_candidates_work_queque;
                 std::vector<std::unique_ptr<StructuralCandidate>> structural_candidates;
-                std::vector<std::unique_ptr<StructuralCandidate>> done_structural_candidates;
-                std::deque<std::pair<std::unique_ptr<StructuralCandidate>, std::vector<FunctionalCandidate>>> functional_candidates;
 
                 for (auto& [base_cand, struct_cands] : base_to_structural_candidates)
                 {
@@ -392,19 +300,17 @@ namespace hal
                     // create a vector with all base candidates
                     for (auto& sc : struct_cands)
                     {
-                        structural_candidates_work_queque.push_back(sc.get());
                         structural_candidates.push_back(std::move(sc));
                     }
                 }
 
-                std::atomic<u32> structural_workload = structural_candidates.size();
-
                 if (structural_candidates.empty())
                 {
                     Result(nl, std::vector<std::pair<BaseCandidate, VerifiedCandidate>>());
                 }
 
-                const u32 num_threads = std::min(config.m_max_thread_count, std::thread::hardware_concurrency() - 1);
+                // the candidates are processed on the global thread pool, which bounds the number of threads no matter how many are configured
+                const u32 num_threads = (config.m_max_thread_count > 1) ? ThreadPool::get_global().get_num_threads() + 1 : 1;
 
                 log_info("module_identification", "running with {} threads and {} multithreading priority", num_threads, static_cast<int>(config.m_multithreading_priority));
 
@@ -423,72 +329,44 @@ namespace hal
                     log_error("module_identification", "failed to create VCC net: {}", vcc_res.get_error().get());
                 }
 
-                // creating workloads
                 log_info("module_identification", "running checks for {} possible candidates...", structural_candidates.size());
-                std::vector<std::thread> workers;
-                std::vector<std::string> status         = {num_threads + 1, "NOT STARTED"};
-                std::vector<std::string> candidate_info = {num_threads + 1, "NONE"};
 
-                std::mutex thread_sync;
+                // with memory priority, only the functional candidates of a batch of structural candidates are kept in memory at once
+                const u32 batch_size = (config.m_multithreading_priority == MultithreadingPriority::time_priority) ? structural_candidates.size() : 4 * num_threads;
 
-                for (u32 i = 0; i < num_threads; ++i)
+                for (u32 batch_begin = 0; batch_begin < structural_candidates.size(); batch_begin += batch_size)
                 {
-                    workers.emplace_back([&, i]() {
-                        return work(structural_candidates_work_queque,
-                                    structural_candidates,
-                                    done_structural_candidates,
-                                    structural_workload,
-                                    functional_candidates,
-                                    verified_candidates,
-                                    config,
-                                    stats,
-                                    status,
-                                    candidate_info,
-                                    thread_sync,
-                                    i);
-                    });
-                }
+                    const u32 batch_end = std::min<u32>(batch_begin + batch_size, structural_candidates.size());
 
-#ifdef PRINT_THREAD_INFO
-                while ((structural_workload != 0) || !functional_candidates.empty())
-                {
-                    std::cout << "WORKLOAD: " << structural_workload << std::endl;
-
-                    std::map<std::string, u32> status_collection;
-                    for (u32 i = 0; i < num_threads; i++)
-                    {
-                        status_collection[status.at(i)] += 1;
-                    }
+                    // first pass: generate the functional candidates of every structural candidate
+                    std::vector<std::vector<FunctionalCandidate>> functional_candidates(batch_end - batch_begin);
+                    for_each_index(batch_end - batch_begin, config, [&](u32 i) {
+                        functional_candidates[i] = process_structural_candidate(structural_candidates[batch_begin + i].get(), config, stats);
+                    });
 
-                    std::cout << "Thread status: " << std::endl;
-                    for (const auto& [sn, sc] : status_collection)
+                    std::vector<std::pair<const StructuralCandidate*, FunctionalCandidate*>> functional_work;
+                    for (u32 i = 0; i < functional_candidates.size(); i++)
                     {
-                        std::cout << "\t" << sn << ": " << sc << std::endl;
+                        for (auto& fc : functional_candidates[i])
+                        {
+                            functional_work.push_back({structural_candidates[batch_begin + i].get(), &fc});
+                        }
                     }
 
-                    std::map<std::string, u32> candidate_collection;
-                    for (u32 i = 0; i < num_threads; i++)
-                    {
-                        candidate_collection[candidate_info.at(i)] += 1;
-                    }
+                    // second pass: check every functional candidate
+                    std::vector<std::optional<VerifiedCandidate>> checked_candidates(functional_work.size());
+                    for_each_index(functional_work.size(), config, [&](u32 i) {
+                        const auto& [sc, fc] = functional_work[i];
+                        checked_candidates[i] = process_functional_candidate(sc, *fc, config, stats);
+                    });
 
-                    if (candidate_collection.size() < 10)
+                    for (u32 i = 0; i < functional_work.size(); i++)
                     {
-                        std::cout << "Candidate Info: " << std::endl;
-                        for (const auto& [sn, sc] : candidate_collection)
+                        if (checked_candidates[i].has_value())
                         {
-                            std::cout << "\t" << sn << ": " << sc << std::endl;
+                            verified_candidates.at(functional_work[i].first->base_candidate).push_back(std::move(checked_candidates[i].value()));
                         }
                     }
-
-                    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-                }
-#endif
-
-                // wait for threads to finish
-                for (auto& worker : workers)
-                {
-                    worker.join();
                 }
 
                 // if (config.s_progress_indicator_function)
@@ -1,5 +1,7 @@
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/equivalence_checker.h"
 #include "hal_core/netlist/boolean_function/solver.h"
+#include "hal_core/netlist/boolean_function/solver_session.h"
 #include "hal_core/utilities/log.h"
 #include "module_identification/candidates/functional_candidate.h"
 #include "module_identification/types/candidate_types.h"
@@ -128,7 +130,6 @@ namespace hal
                 const auto start_solver_timing = std::chrono::steady_clock::now();
 
                 auto config = SMT::QueryConfig();
-                auto solver = SMT::Solver();
 
 #ifdef BITWUZLA_LIBRARY
                 auto s_type = SMT::SolverType::Bitwuzla;
@@ -189,30 +190,25 @@ namespace hal
                     actual_funciton = bf_res.get();
                 }
 
-                // z == (a + b)
-                auto bf_eq_res = BooleanFunction::Eq(std::move(actual_funciton), std::move(expected_function), 1);
-                if (bf_eq_res.is_error())
+                // z == (a + b), truth tables and simulation decide most candidates before the shared solver processes are called
+                SMT::EquivalenceChecker checker(config);
+                auto verdict_res = checker.check(actual_funciton, expected_function);
+                if (verdict_res.is_error())
                 {
-                    return ERR_APPEND(bf_eq_res.get_error(), "failed to concatenate boolean functions");
+                    return ERR_APPEND(verdict_res.get_error(), "failed equivalence check for module identification utils");
                 }
-                auto bf_eq = bf_eq_res.get();
+                const auto verdict = verdict_res.get();
+                const auto& solver_result = verdict.result;
 
-                // z != (a + b)
-                auto bf_neq_res = BooleanFunction::Not(std::move(bf_eq), 1);
-                if (bf_neq_res.is_error())
-                {
-                    return ERR_APPEND(bf_eq_res.get_error(), "failed to concatenate boolean functions");
-                }
-                auto bf_neq = bf_neq_res.get();
+                const u64 solver_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_solver_timing).count();
 
-                auto solver_result_res = solver.with_constraint(SMT::Constraint(std::move(bf_neq))).query(config);
-                if (solver_result_res.is_error())
+                if (verdict.stage != SMT::EquivalenceChecker::Stage::Solver)
                 {
-                    return ERR_APPEND(solver_result_res.get_error(), "failed solver check for module identification utils");
+                    const std::string category = (verdict.stage == SMT::EquivalenceChecker::Stage::TruthTable) ? "Truth_Table_Check" : "Simulation_Check";
+                    timings[category]["Duration"] += solver_duration;
+                    timings[category][verdict.is_equivalent() ? "#Equal" : "#Different"] += 1;
+                    return OK(verdict.is_equivalent());
                 }
-                auto solver_result = solver_result_res.get();
-
-                const u64 solver_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_solver_timing).count();
 
                 if (solver_result.is_unsat())
                 {
@@ -940,7 +936,8 @@ namespace hal
 
             s = s.with_constraint(SMT::Constraint(output_functions.front().clone()));
 
-            auto first_result_res = s.query(config);
+            auto& solver_pool     = SMT::SolverSessionPool::get_shared(config);
+            auto first_result_res = solver_pool.query(s.get_constraints());
             if (first_result_res.is_error())
             {
                 return ERR_APPEND(first_result_res.get_error(), "failed smt run on boolean function");
@@ -977,7 +974,7 @@ namespace hal
 
             s = s.with_constraint(SMT::Constraint(bf_neq.clone()));
 
-            auto second_result_res = s.query(config);
+            auto second_result_res = solver_pool.query(s.get_constraints());
             if (second_result_res.is_error())
             {
                 return ERR_APPEND(second_result_res.get_error(), "failed smt run on boolean function");
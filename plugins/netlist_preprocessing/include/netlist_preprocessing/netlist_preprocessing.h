@@ -93,6 +93,22 @@ namespace hal
          */
         Result<u32> remove_redundant_logic_trees(Netlist* nl);
 
+        /**
+         * Removes nets that compute the same function of the inputs of the combinational logic as another net, regardless of the gate types and LUT configurations that implement them.
+         * In contrast to `remove_redundant_gates`, the gates driving two equivalent nets need neither be of the same type nor share their fan-in nets.
+         * All nets are simulated for random input assignments 64 at a time and nets with equal simulation results are checked for equivalence by an incremental SMT solver session.
+         * Counterexamples of refuted candidates are simulated as well to split the remaining candidates.
+         * If no SMT solver is available, only candidates whose fan-in cones have at most 16 inputs in total are checked, by simulating all their input assignments, and all other candidates are kept.
+         * The destinations of an equivalent net are connected to the net of the lowest logic depth, constant nets are connected to the GND or VCC net if the netlist has one.
+         * Gates left without successors are removed afterwards.
+         * Outputs of sequential gates are treated as inputs of the combinational logic, nets within combinational loops are left untouched.
+         * 
+         * @param[in] nl - The netlist to operate on.
+         * @param[in] num_simulation_rounds - The number of rounds of 64 random input assignments each that are simulated before the first check. Defaults to `4`.
+         * @return OK() and the number of removed nets on success, an error otherwise.
+         */
+        Result<u32> remove_functionally_equivalent_nets(Netlist* nl, u32 num_simulation_rounds = 4);
+
         /**
          * Removes gates for which all fan-out nets do not have a destination and are not global output nets.
          * 
@@ -138,6 +154,37 @@ namespace hal
          */
         Result<u32> propagate_constants(Netlist* nl);
 
+        /**
+         * Statistics of a single pass of the preprocessing pipeline.
+         */
+        struct PassStatistics
+        {
+            /**
+             * The number of gates the pass has been applied to.
+             */
+            u32 num_visited = 0;
+
+            /**
+             * The number of changes made by the pass, counted in the same way as by the respective standalone function.
+             */
+            u32 num_changes = 0;
+
+            /**
+             * The time spent in the pass in seconds.
+             */
+            double duration = 0.0;
+        };
+
+        /**
+         * Runs `remove_unconnected_gates`, `propagate_constants`, `remove_buffers`, and `remove_redundant_gates` until none of them makes any further changes and finally calls `remove_unconnected_nets`.
+         * All passes share a single worklist, so after the first round only the neighbors of modified gates are visited again instead of the entire netlist.
+         * Power and ground gates are never removed.
+         * 
+         * @param[in] nl - The netlist to operate on.
+         * @return OK() and the statistics of each pass by the name of the respective standalone function on success, an error otherwise.
+         */
+        Result<std::map<std::string, PassStatistics>> preprocess(Netlist* nl);
+
         /**
          * Removes two consecutive inverters and reconnects the input of the first inverter to the output of the second one.
          * If the first inverter has additional successors, only the second inverter is deleted.
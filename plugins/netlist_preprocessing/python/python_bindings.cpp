@@ -202,6 +202,38 @@ namespace hal
                 :rtype: int or ``None``
             )");
 
+        m.def(
+            "remove_functionally_equivalent_nets",
+            [](Netlist* nl, u32 num_simulation_rounds) -> std::optional<u32> {
+                auto res = netlist_preprocessing::remove_functionally_equivalent_nets(nl, num_simulation_rounds);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("nl"),
+            py::arg("num_simulation_rounds") = 4,
+            R"(
+                Removes nets that compute the same function of the inputs of the combinational logic as another net, regardless of the gate types and LUT configurations that implement them.
+                In contrast to ``remove_redundant_gates``, the gates driving two equivalent nets need neither be of the same type nor share their fan-in nets.
+                All nets are simulated for random input assignments 64 at a time and nets with equal simulation results are checked for equivalence by an incremental SMT solver session.
+                Counterexamples of refuted candidates are simulated as well to split the remaining candidates.
+                If no SMT solver is available, only candidates whose fan-in cones have at most 16 inputs in total are checked, by simulating all their input assignments, and all other candidates are kept.
+                The destinations of an equivalent net are connected to the net of the lowest logic depth, constant nets are connected to the GND or VCC net if the netlist has one.
+                Gates left without successors are removed afterwards.
+                Outputs of sequential gates are treated as inputs of the combinational logic, nets within combinational loops are left untouched.
+
+                :param hal_py.Netlist nl: The netlist to operate on.
+                :param int num_simulation_rounds: The number of rounds of 64 random input assignments each that are simulated before the first check. Defaults to ``4``.
+                :returns: The number of removed nets on success, ``None`` otherwise.
+                :rtype: int or ``None``
+            )");
+
         m.def(
             "remove_unconnected_gates",
             [](Netlist* nl) -> std::optional<u32> {
@@ -324,6 +356,53 @@ namespace hal
                 :rtype: int or ``None``
             )");
 
+        py::class_<netlist_preprocessing::PassStatistics> py_pass_statistics(m, "PassStatistics", R"(
+            Statistics of a single pass of the preprocessing pipeline.
+        )");
+
+        py_pass_statistics.def_readonly("num_visited", &netlist_preprocessing::PassStatistics::num_visited, R"(
+            The number of gates the pass has been applied to.
+
+            :type: int
+        )");
+
+        py_pass_statistics.def_readonly("num_changes", &netlist_preprocessing::PassStatistics::num_changes, R"(
+            The number of changes made by the pass, counted in the same way as by the respective standalone function.
+
+            :type: int
+        )");
+
+        py_pass_statistics.def_readonly("duration", &netlist_preprocessing::PassStatistics::duration, R"(
+            The time spent in the pass in seconds.
+
+            :type: float
+        )");
+
+        m.def(
+            "preprocess",
+            [](Netlist* nl) -> std::optional<std::map<std::string, netlist_preprocessing::PassStatistics>> {
+                auto res = netlist_preprocessing::preprocess(nl);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("nl"),
+            R"(
+                Runs ``remove_unconnected_gates``, ``propagate_constants``, ``remove_buffers``, and ``remove_redundant_gates`` until none of them makes any further changes and finally calls ``remove_unconnected_nets``.
+                All passes share a single worklist, so after the first round only the neighbors of modified gates are visited again instead of the entire netlist.
+                Power and ground gates are never removed.
+
+                :param hal_py.Netlist nl: The netlist to operate on.
+                :returns: The statistics of each pass by the name of the respective standalone function on success, ``None`` otherwise.
+                :rtype: dict[str,netlist_preprocessing.PassStatistics] or ``None``
+            )");
+
         m.def(
             "remove_consecutive_inverters",
             [](Netlist* nl) -> std::optional<u32> {
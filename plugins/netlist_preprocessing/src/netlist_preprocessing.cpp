@@ -1,6 +1,9 @@
 #include "netlist_preprocessing/netlist_preprocessing.h"
 
+#include "hal_core/netlist/boolean_function/compiled_function.h"
+#include "hal_core/netlist/boolean_function/equivalence_checker.h"
 #include "hal_core/netlist/boolean_function/solver.h"
+#include "hal_core/netlist/boolean_function/solver_session.h"
 #include "hal_core/netlist/decorators/boolean_function_decorator.h"
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
 #include "hal_core/netlist/decorators/netlist_modification_decorator.h"
@@ -16,14 +19,150 @@
 #include "resynthesis/resynthesis.h"
 #include "z3_utils/netlist_comparison.h"
 
+#include <chrono>
+#include <deque>
 #include <fstream>
+#include <limits>
 #include <queue>
 #include <regex>
+#include <unordered_set>
 
 namespace hal
 {
     namespace netlist_preprocessing
     {
+        namespace
+        {
+            /**
+             * The gates a pass still has to visit, in the order they were queued and each one at most once at a time.
+             * Passes queue the neighbors of the gates they modify instead of scanning the entire netlist again.
+             * Besides the queue, the worklist remembers all gates queued since the last call to `take_modified`, which the `preprocess` pipeline hands to the passes that do not visit gates one by one.
+             */
+            class GateWorklist
+            {
+            public:
+                void push(Gate* gate)
+                {
+                    if (m_queued.insert(gate).second)
+                    {
+                        m_queue.push_back(gate);
+                    }
+                    m_modified.insert(gate);
+                }
+
+                void push(const std::vector<Gate*>& gates)
+                {
+                    for (auto* gate : gates)
+                    {
+                        push(gate);
+                    }
+                }
+
+                /**
+                 * Returns the next gate to visit.
+                 *
+                 * @returns The gate, or a `nullptr` if there is none left.
+                 */
+                Gate* pop()
+                {
+                    while (!m_queue.empty())
+                    {
+                        Gate* gate = m_queue.front();
+                        m_queue.pop_front();
+                        if (m_queued.erase(gate) != 0)
+                        {
+                            return gate;
+                        }
+                    }
+                    return nullptr;
+                }
+
+                bool empty() const
+                {
+                    return m_queued.empty();
+                }
+
+                /**
+                 * Forgets a gate, must be called before the gate is deleted.
+                 *
+                 * @param[in] gate - The gate.
+                 */
+                void erase(Gate* gate)
+                {
+                    m_queued.erase(gate);
+                    m_modified.erase(gate);
+                }
+
+                std::unordered_set<Gate*> take_modified()
+                {
+                    std::unordered_set<Gate*> modified;
+                    modified.swap(m_modified);
+                    return modified;
+                }
+
+            private:
+                std::deque<Gate*> m_queue;
+                std::unordered_set<Gate*> m_queued;
+                std::unordered_set<Gate*> m_modified;
+            };
+
+            /**
+             * Deletes a gate and queues its predecessors, which may be left without successors.
+             *
+             * @param[in] nl - The netlist.
+             * @param[in] gate - The gate to delete.
+             * @param[in] worklist - The worklist, may be a `nullptr`.
+             * @param[inout] ff_replacements - The names of the flip-flops replaced by each gate, from which the entry of the deleted gate is removed. May be a `nullptr`.
+             * @returns `true` on success, `false` otherwise.
+             */
+            bool delete_gate_and_queue_predecessors(Netlist* nl, Gate* gate, GateWorklist* worklist, std::unordered_map<Gate*, std::vector<std::string>>* ff_replacements = nullptr)
+            {
+                const auto predecessors = (worklist != nullptr) ? gate->get_unique_predecessors() : std::vector<Gate*>();
+                if (worklist != nullptr)
+                {
+                    worklist->erase(gate);
+                }
+                if (!nl->delete_gate(gate))
+                {
+                    return false;
+                }
+                if (ff_replacements != nullptr)
+                {
+                    ff_replacements->erase(gate);
+                }
+                if (worklist == nullptr)
+                {
+                    return true;
+                }
+                for (auto* pred : predecessors)
+                {
+                    if (pred != gate)
+                    {
+                        worklist->push(pred);
+                    }
+                }
+                return true;
+            }
+
+            bool is_combinational_logic(const Gate* g)
+            {
+                const auto* type = g->get_type();
+                return type->has_property(GateTypeProperty::combinational) && !type->has_property(GateTypeProperty::ground) && !type->has_property(GateTypeProperty::power);
+            }
+
+            bool is_unconnected(const Gate* gate)
+            {
+                for (const auto& on : gate->get_fan_out_nets())
+                {
+                    if (!on->get_destinations().empty() || on->is_global_output_net())
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }    // namespace
+
         Result<u32> remove_unused_lut_inputs(Netlist* nl)
         {
             u32 num_eps = 0;
@@ -89,44 +228,46 @@ namespace hal
             return OK(num_eps);
         }
 
-        // TODO make this check every pin of a gate and check whether the generated boolean function (with replaced gnd and vcc nets) is just a variable.
-        //      Afterwards just connect input net to buffer destination. Do this for all pins and delete gate if it has no more successors and not global outputs
-        Result<u32> remove_buffers(Netlist* nl)
+        namespace
         {
-            u32 num_gates = 0;
-
-            std::queue<Gate*> gates_to_be_deleted;
-
-            for (const auto& gate : nl->get_gates())
+            /**
+             * Checks whether a gate is a buffer, i.e., a combinational gate whose output only depends on one of its inputs once constant inputs are taken into account, and if so connects its output net to that input.
+             * The gate is left without fan-out and still has to be deleted.
+             *
+             * @param[in] nl - The netlist.
+             * @param[in] gate - The gate.
+             * @returns OK() and `true` if the gate is a buffer that has been bypassed, `false` otherwise, an error if its Boolean function could not be computed.
+             */
+            Result<bool> bypass_buffer(Netlist* nl, Gate* gate)
             {
                 std::vector<Endpoint*> fan_out = gate->get_fan_out_endpoints();
 
                 GateType* gt = gate->get_type();
 
-                // continue if of invalid base type
+                // skip if of invalid base type
                 if (!gt->has_property(GateTypeProperty::combinational) || gt->has_property(GateTypeProperty::power) || gt->has_property(GateTypeProperty::ground))
                 {
-                    continue;
+                    return OK(false);
                 }
 
-                // continue if more than one fan-out net
+                // skip if more than one fan-out net
                 if (fan_out.size() != 1)
                 {
-                    continue;
+                    return OK(false);
                 }
 
-                // continue if more than one Boolean function
+                // skip if more than one Boolean function
                 std::unordered_map<std::string, BooleanFunction> functions = gate->get_boolean_functions();
                 if (functions.size() != 1)
                 {
-                    continue;
+                    return OK(false);
                 }
 
-                // continue if Boolean function name does not match output pin
+                // skip if Boolean function name does not match output pin
                 Endpoint* out_endpoint = *(fan_out.begin());
                 if (out_endpoint->get_pin()->get_name() != (functions.begin())->first)
                 {
-                    continue;
+                    return OK(false);
                 }
 
                 std::vector<Endpoint*> fan_in = gate->get_fan_in_endpoints();
@@ -186,7 +327,7 @@ namespace hal
 
                     if (!failed)
                     {
-                        gates_to_be_deleted.push(gate);
+                        return OK(true);
                     }
                 }
                 // TODO this functionality is not a buffer and is covered by propagate_constants
@@ -305,6 +446,30 @@ namespace hal
                 }
             }
             */
+
+                return OK(false);
+            }
+        }    // namespace
+
+        // TODO make this check every pin of a gate and check whether the generated boolean function (with replaced gnd and vcc nets) is just a variable.
+        //      Afterwards just connect input net to buffer destination. Do this for all pins and delete gate if it has no more successors and not global outputs
+        Result<u32> remove_buffers(Netlist* nl)
+        {
+            u32 num_gates = 0;
+
+            std::queue<Gate*> gates_to_be_deleted;
+
+            for (const auto& gate : nl->get_gates())
+            {
+                const auto bypass_res = bypass_buffer(nl, gate);
+                if (bypass_res.is_error())
+                {
+                    return ERR(bypass_res.get_error());
+                }
+                if (bypass_res.get())
+                {
+                    gates_to_be_deleted.push(gate);
+                }
             }
 
             log_debug("netlist_preprocessing", "removing {} buffer gates...", gates_to_be_deleted.size());
@@ -374,258 +539,282 @@ namespace hal
 
                 return;
             }
-        }    // namespace
 
-        Result<u32> remove_redundant_gates(Netlist* nl, const std::function<bool(const Gate*)>& filter)
-        {
-            auto config = hal::SMT::QueryConfig();
+            /**
+             * Merges each group of equivalent gates among the given gates into a single survivor, revisiting the gates whose fan-in changed until no more duplicates are found.
+             *
+             * @param[in] nl - The netlist.
+             * @param[in] target_gates - The combinational gates and flip-flops to look for duplicates among.
+             * @param[in] worklist - A worklist that receives the gates whose fan-in or fan-out changed, may be a `nullptr`.
+             * @param[inout] ff_replacements - The names of the flip-flops replaced by each gate as restored by `restore_ff_replacements`, which is updated for every merged gate.
+             * @returns OK() and the number of removed gates on success, an error otherwise.
+             */
+            Result<u32> merge_redundant_gates(Netlist* nl, std::vector<Gate*> target_gates, GateWorklist* worklist, std::unordered_map<Gate*, std::vector<std::string>>& ff_replacements)
+            {
+                auto config = hal::SMT::QueryConfig();
 
 #ifdef BITWUZLA_LIBRARY
-            auto s_type = hal::SMT::SolverType::Bitwuzla;
-            auto s_call = hal::SMT::SolverCall::Library;
-            config      = config.with_solver(s_type).with_call(s_call);
+                auto s_type = hal::SMT::SolverType::Bitwuzla;
+                auto s_call = hal::SMT::SolverCall::Library;
+                config      = config.with_solver(s_type).with_call(s_call);
 #endif
-            struct GateFingerprint
-            {
-                const GateType* type;
-                std::map<GatePin*, Net*> ordered_fan_in = {};
-                std::set<Net*> unordered_fan_in         = {};
-                u8 truth_table_hw                       = 0;
-                std::vector<std::string> init_data      = {};
+                // most candidate pairs are decided by truth tables or simulation, the rest reuse running solver processes
+                SMT::EquivalenceChecker checker(config);
 
-                bool operator<(const GateFingerprint& other) const
+                struct GateFingerprint
                 {
-                    return std::tie(type, ordered_fan_in, unordered_fan_in, truth_table_hw, init_data)
-                           < std::tie(other.type, other.ordered_fan_in, other.unordered_fan_in, other.truth_table_hw, other.init_data);
-                }
-            };
-
-            static std::vector<u8> hw_map = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+                    const GateType* type;
+                    std::map<GatePin*, Net*> ordered_fan_in = {};
+                    std::set<Net*> unordered_fan_in         = {};
+                    u8 truth_table_hw                       = 0;
+                    std::vector<std::string> init_data      = {};
 
-            u32 num_gates = 0;
-            bool progress;
+                    bool operator<(const GateFingerprint& other) const
+                    {
+                        return std::tie(type, ordered_fan_in, unordered_fan_in, truth_table_hw, init_data)
+                               < std::tie(other.type, other.ordered_fan_in, other.unordered_fan_in, other.truth_table_hw, other.init_data);
+                    }
+                };
 
-            std::vector<Gate*> target_gates;
-            if (filter)
-            {
-                target_gates = nl->get_gates([filter](const Gate* g) {
-                    const auto& type = g->get_type();
-                    return (type->has_property(GateTypeProperty::combinational) || type->has_property(GateTypeProperty::ff)) && filter(g);
-                });
-            }
-            else
-            {
-                target_gates = nl->get_gates([](const Gate* g) {
-                    const auto& type = g->get_type();
-                    return type->has_property(GateTypeProperty::combinational) || type->has_property(GateTypeProperty::ff);
-                });
-            }
+                static std::vector<u8> hw_map = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
 
-            auto ff_replacements = restore_ff_replacements(nl);
+                u32 num_gates = 0;
+                bool progress;
 
-            do
-            {
-                std::map<GateFingerprint, std::vector<Gate*>> fingerprinted_gates;
+                do
+                {
+                    std::map<GateFingerprint, std::vector<Gate*>> fingerprinted_gates;
 
-                progress = false;
+                    progress = false;
 
-                for (auto* gate : target_gates)
-                {
-                    GateFingerprint fingerprint;
-                    fingerprint.type = gate->get_type();
-                    if (fingerprint.type->has_property(GateTypeProperty::combinational))
+                    for (auto* gate : target_gates)
                     {
-                        const auto& fan_in_nets = gate->get_fan_in_nets();
-                        fingerprint.unordered_fan_in.insert(fan_in_nets.cbegin(), fan_in_nets.cend());
-                        if (fingerprint.type->has_property(GateTypeProperty::c_lut))
+                        GateFingerprint fingerprint;
+                        fingerprint.type = gate->get_type();
+                        if (fingerprint.type->has_property(GateTypeProperty::combinational))
                         {
-                            if (const auto res = gate->get_init_data(); res.is_ok())
+                            const auto& fan_in_nets = gate->get_fan_in_nets();
+                            fingerprint.unordered_fan_in.insert(fan_in_nets.cbegin(), fan_in_nets.cend());
+                            if (fingerprint.type->has_property(GateTypeProperty::c_lut))
                             {
-                                const auto& init_str = res.get().front();
-                                for (const auto c : init_str)
+                                if (const auto res = gate->get_init_data(); res.is_ok())
                                 {
-                                    u8 tmp = std::toupper(c) - 0x30;
-                                    if (tmp > 9)
+                                    const auto& init_str = res.get().front();
+                                    for (const auto c : init_str)
                                     {
-                                        tmp -= 0x7;
+                                        u8 tmp = std::toupper(c) - 0x30;
+                                        if (tmp > 9)
+                                        {
+                                            tmp -= 0x7;
+                                        }
+                                        fingerprint.truth_table_hw += hw_map.at(tmp);
                                     }
-                                    fingerprint.truth_table_hw += hw_map.at(tmp);
                                 }
                             }
                         }
-                    }
-                    else if (fingerprint.type->has_property(GateTypeProperty::ff))
-                    {
-                        for (const auto& ep : gate->get_fan_in_endpoints())
+                        else if (fingerprint.type->has_property(GateTypeProperty::ff))
                         {
-                            fingerprint.ordered_fan_in[ep->get_pin()] = ep->get_net();
-                        }
+                            for (const auto& ep : gate->get_fan_in_endpoints())
+                            {
+                                fingerprint.ordered_fan_in[ep->get_pin()] = ep->get_net();
+                            }
 
-                        // Two flip-flops of the same type driven by the same nets can still differ in the value they
-                        // start out at, which the fan-in does not show. The fingerprint decides on its own here, as
-                        // there is no equivalence check behind it as there is for combinational gates, so the initial
-                        // value has to be part of it rather than folded into a hash of it.
-                        if (const auto res = gate->get_init_data(); res.is_ok())
-                        {
-                            fingerprint.init_data = res.get();
+                            // Two flip-flops of the same type driven by the same nets can still differ in the value they
+                            // start out at, which the fan-in does not show. The fingerprint decides on its own here, as
+                            // there is no equivalence check behind it as there is for combinational gates, so the initial
+                            // value has to be part of it rather than folded into a hash of it.
+                            if (const auto res = gate->get_init_data(); res.is_ok())
+                            {
+                                fingerprint.init_data = res.get();
+                            }
                         }
-                    }
-
-                    fingerprinted_gates[fingerprint].push_back(gate);
-                }
 
-                std::vector<std::vector<Gate*>> duplicate_gates;
-                for (const auto& [fingerprint, gates] : fingerprinted_gates)
-                {
-                    if (gates.size() == 1)
-                    {
-                        continue;
+                        fingerprinted_gates[fingerprint].push_back(gate);
                     }
 
-                    if (fingerprint.type->has_property(GateTypeProperty::combinational))
+                    std::vector<std::vector<Gate*>> duplicate_gates;
+                    for (const auto& [fingerprint, gates] : fingerprinted_gates)
                     {
-                        std::set<const Gate*> visited;
-                        for (size_t i = 0; i < gates.size(); i++)
+                        if (gates.size() == 1)
                         {
-                            Gate* master_gate = gates.at(i);
+                            continue;
+                        }
 
-                            if (visited.find(master_gate) != visited.cend())
+                        if (fingerprint.type->has_property(GateTypeProperty::combinational))
+                        {
+                            std::set<const Gate*> visited;
+                            for (size_t i = 0; i < gates.size(); i++)
                             {
-                                continue;
-                            }
+                                Gate* master_gate = gates.at(i);
+
+                                if (visited.find(master_gate) != visited.cend())
+                                {
+                                    continue;
+                                }
 
-                            std::vector<Gate*> current_duplicates = {master_gate};
+                                std::vector<Gate*> current_duplicates = {master_gate};
 
-                            for (size_t j = i + 1; j < gates.size(); j++)
-                            {
-                                Gate* current_gate = gates.at(j);
-                                bool equal         = true;
-                                for (const auto* pin : fingerprint.type->get_output_pins())
+                                for (size_t j = i + 1; j < gates.size(); j++)
                                 {
-                                    const auto solver_res =
-                                        master_gate->get_resolved_boolean_function(pin)
-                                            .map<BooleanFunction>([pin, current_gate](BooleanFunction&& bf_master) {
-                                                return current_gate->get_resolved_boolean_function(pin).map<BooleanFunction>([bf_master = std::move(bf_master)](BooleanFunction&& bf_current) mutable {
-                                                    return BooleanFunction::Eq(std::move(bf_master), std::move(bf_current), 1);
-                                                });
-                                            })
-                                            .map<BooleanFunction>([](auto&& bf_eq) -> Result<BooleanFunction> { return BooleanFunction::Not(std::move(bf_eq), 1); })
-                                            .map<SMT::SolverResult>([&config](auto&& bf_not) -> Result<SMT::SolverResult> { return SMT::Solver({SMT::Constraint(std::move(bf_not))}).query(config); });
-
-                                    if (solver_res.is_error() || !solver_res.get().is_unsat())
+                                    Gate* current_gate = gates.at(j);
+                                    bool equal         = true;
+                                    for (const auto* pin : fingerprint.type->get_output_pins())
+                                    {
+                                        const auto verdict =
+                                            master_gate->get_resolved_boolean_function(pin).map<SMT::EquivalenceChecker::Verdict>([pin, current_gate, &checker](BooleanFunction&& bf_master) {
+                                                return current_gate->get_resolved_boolean_function(pin).map<SMT::EquivalenceChecker::Verdict>(
+                                                    [&checker, &bf_master](BooleanFunction&& bf_current) { return checker.check(bf_master, bf_current); });
+                                            });
+
+                                        if (verdict.is_error() || !verdict.get().is_equivalent())
+                                        {
+                                            equal = false;
+                                        }
+                                    }
+
+                                    if (equal)
                                     {
-                                        equal = false;
+                                        current_duplicates.push_back(current_gate);
+                                        visited.insert(current_gate);
                                     }
                                 }
 
-                                if (equal)
+                                if (current_duplicates.size() > 1)
                                 {
-                                    current_duplicates.push_back(current_gate);
-                                    visited.insert(current_gate);
+                                    duplicate_gates.push_back(current_duplicates);
                                 }
                             }
-
-                            if (current_duplicates.size() > 1)
-                            {
-                                duplicate_gates.push_back(current_duplicates);
-                            }
+                        }
+                        else if (fingerprint.type->has_property(GateTypeProperty::ff))
+                        {
+                            duplicate_gates.push_back(std::move(gates));
                         }
                     }
-                    else if (fingerprint.type->has_property(GateTypeProperty::ff))
-                    {
-                        duplicate_gates.push_back(std::move(gates));
-                    }
-                }
-
-                std::set<Gate*> affected_gates;
-                for (auto& current_duplicates : duplicate_gates)
-                {
-                    std::sort(current_duplicates.begin(), current_duplicates.end(), [](const auto& g1, const auto& g2) { return g1->get_name().length() < g2->get_name().length(); });
 
-                    auto* survivor_gate = current_duplicates.front();
-                    std::map<GatePin*, Net*> out_pins_to_nets;
-                    for (auto* ep : survivor_gate->get_fan_out_endpoints())
+                    std::set<Gate*> affected_gates;
+                    for (auto& current_duplicates : duplicate_gates)
                     {
-                        Net* out_net                    = ep->get_net();
-                        out_pins_to_nets[ep->get_pin()] = out_net;
-                        for (const auto* dst : out_net->get_destinations())
+                        std::sort(current_duplicates.begin(), current_duplicates.end(), [](const auto& g1, const auto& g2) { return g1->get_name().length() < g2->get_name().length(); });
+
+                        auto* survivor_gate = current_duplicates.front();
+                        std::map<GatePin*, Net*> out_pins_to_nets;
+                        for (auto* ep : survivor_gate->get_fan_out_endpoints())
                         {
-                            auto* dst_gate = dst->get_gate();
-                            auto* dst_type = dst_gate->get_type();
-                            if (dst_type->has_property(GateTypeProperty::combinational) || dst_type->has_property(GateTypeProperty::ff))
+                            Net* out_net                    = ep->get_net();
+                            out_pins_to_nets[ep->get_pin()] = out_net;
+                            for (const auto* dst : out_net->get_destinations())
                             {
-                                affected_gates.insert(dst_gate);
+                                auto* dst_gate = dst->get_gate();
+                                auto* dst_type = dst_gate->get_type();
+                                if (dst_type->has_property(GateTypeProperty::combinational) || dst_type->has_property(GateTypeProperty::ff))
+                                {
+                                    affected_gates.insert(dst_gate);
+                                }
                             }
                         }
-                    }
 
-                    for (u32 k = 1; k < current_duplicates.size(); k++)
-                    {
-                        auto* current_gate = current_duplicates.at(k);
-                        for (auto* ep : current_gate->get_fan_out_endpoints())
+                        for (u32 k = 1; k < current_duplicates.size(); k++)
                         {
-                            auto* ep_net = ep->get_net();
-                            auto* ep_pin = ep->get_pin();
-
-                            if (auto it = out_pins_to_nets.find(ep_pin); it != out_pins_to_nets.cend())
+                            auto* current_gate = current_duplicates.at(k);
+                            for (auto* ep : current_gate->get_fan_out_endpoints())
                             {
-                                // survivor already has net connected to this output -> add destination to survivor's net
-                                for (auto* dst : ep_net->get_destinations())
-                                {
-                                    auto* dst_gate = dst->get_gate();
-                                    auto* dst_pin  = dst->get_pin();
-                                    dst->get_net()->remove_destination(dst);
-                                    it->second->add_destination(dst_gate, dst_pin);
+                                auto* ep_net = ep->get_net();
+                                auto* ep_pin = ep->get_pin();
 
-                                    auto* dst_type = dst_gate->get_type();
-                                    if (dst_type->has_property(GateTypeProperty::combinational) || dst_type->has_property(GateTypeProperty::ff))
+                                if (auto it = out_pins_to_nets.find(ep_pin); it != out_pins_to_nets.cend())
+                                {
+                                    // survivor already has net connected to this output -> add destination to survivor's net
+                                    for (auto* dst : ep_net->get_destinations())
                                     {
-                                        affected_gates.insert(dst_gate);
+                                        auto* dst_gate = dst->get_gate();
+                                        auto* dst_pin  = dst->get_pin();
+                                        dst->get_net()->remove_destination(dst);
+                                        it->second->add_destination(dst_gate, dst_pin);
+
+                                        auto* dst_type = dst_gate->get_type();
+                                        if (dst_type->has_property(GateTypeProperty::combinational) || dst_type->has_property(GateTypeProperty::ff))
+                                        {
+                                            affected_gates.insert(dst_gate);
+                                        }
+                                    }
+                                    if (!nl->delete_net(ep_net))
+                                    {
+                                        log_warning("netlist_preprocessing", "could not delete net '{}' with ID {} from netlist with ID {}.", ep_net->get_name(), ep_net->get_id(), nl->get_id());
                                     }
                                 }
-                                if (!nl->delete_net(ep_net))
-                                {
-                                    log_warning("netlist_preprocessing", "could not delete net '{}' with ID {} from netlist with ID {}.", ep_net->get_name(), ep_net->get_id(), nl->get_id());
-                                }
-                            }
-                            else
-                            {
-                                // survivor does not feature net on this output pin -> connect this net to survivor
-                                ep_net->add_source(survivor_gate, ep_pin);
-                                out_pins_to_nets[ep_pin] = ep_net;
-                                for (auto* dst : ep_net->get_destinations())
+                                else
                                 {
-                                    auto* dst_gate = dst->get_gate();
-                                    auto* dst_type = dst_gate->get_type();
-                                    if (dst_type->has_property(GateTypeProperty::combinational) || dst_type->has_property(GateTypeProperty::ff))
+                                    // survivor does not feature net on this output pin -> connect this net to survivor
+                                    ep_net->add_source(survivor_gate, ep_pin);
+                                    out_pins_to_nets[ep_pin] = ep_net;
+                                    for (auto* dst : ep_net->get_destinations())
                                     {
-                                        affected_gates.insert(dst_gate);
+                                        auto* dst_gate = dst->get_gate();
+                                        auto* dst_type = dst_gate->get_type();
+                                        if (dst_type->has_property(GateTypeProperty::combinational) || dst_type->has_property(GateTypeProperty::ff))
+                                        {
+                                            affected_gates.insert(dst_gate);
+                                        }
                                     }
                                 }
                             }
-                        }
 
-                        annotate_ff_survivor(ff_replacements, survivor_gate, current_gate);
+                            annotate_ff_survivor(ff_replacements, survivor_gate, current_gate);
 
-                        affected_gates.erase(current_gate);
-                        if (!nl->delete_gate(current_gate))
-                        {
-                            log_warning("netlist_preprocessing", "could not delete gate '{}' with ID {} from netlist with ID {}.", current_gate->get_name(), current_gate->get_id(), nl->get_id());
-                        }
-                        else
-                        {
-                            progress = true;
-                            num_gates++;
+                            affected_gates.erase(current_gate);
+                            if (!delete_gate_and_queue_predecessors(nl, current_gate, worklist, &ff_replacements))
+                            {
+                                log_warning("netlist_preprocessing", "could not delete gate '{}' with ID {} from netlist with ID {}.", current_gate->get_name(), current_gate->get_id(), nl->get_id());
+                            }
+                            else
+                            {
+                                progress = true;
+                                num_gates++;
+                            }
                         }
                     }
-                }
-                target_gates = std::vector<Gate*>(affected_gates.cbegin(), affected_gates.cend());
-            } while (progress);
+                    target_gates = std::vector<Gate*>(affected_gates.cbegin(), affected_gates.cend());
+                    if (worklist != nullptr)
+                    {
+                        worklist->push(target_gates);
+                    }
+                } while (progress);
+
+                log_debug("netlist_preprocessing", "equivalence checks of redundant gates: {}", checker.get_statistics().to_string());
+                return OK(num_gates);
+            }
+        }    // namespace
+
+        Result<u32> remove_redundant_gates(Netlist* nl, const std::function<bool(const Gate*)>& filter)
+        {
+            std::vector<Gate*> target_gates;
+            if (filter)
+            {
+                target_gates = nl->get_gates([filter](const Gate* g) {
+                    const auto& type = g->get_type();
+                    return (type->has_property(GateTypeProperty::combinational) || type->has_property(GateTypeProperty::ff)) && filter(g);
+                });
+            }
+            else
+            {
+                target_gates = nl->get_gates([](const Gate* g) {
+                    const auto& type = g->get_type();
+                    return type->has_property(GateTypeProperty::combinational) || type->has_property(GateTypeProperty::ff);
+                });
+            }
+
+            auto ff_replacements = restore_ff_replacements(nl);
+
+            const auto merge_res = merge_redundant_gates(nl, std::move(target_gates), nullptr, ff_replacements);
+            if (merge_res.is_error())
+            {
+                return ERR_APPEND(merge_res.get_error(), "unable to remove redundant gates from netlist with ID " + std::to_string(nl->get_id()));
+            }
 
             update_ff_replacements(ff_replacements);
 
-            log_info("netlist_preprocessing", "removed {} redundant gates from netlist with ID {}.", num_gates, nl->get_id());
-            return OK(num_gates);
+            log_info("netlist_preprocessing", "removed {} redundant gates from netlist with ID {}.", merge_res.get(), nl->get_id());
+            return OK(merge_res.get());
         }
 
         Result<u32> remove_redundant_loops(Netlist* nl)
@@ -650,6 +839,8 @@ namespace hal
             auto s_call = hal::SMT::SolverCall::Library;
             config      = config.with_solver(s_type).with_call(s_call);
 #endif
+            // most candidate pairs are decided by truth tables or simulation, the rest reuse running solver processes
+            SMT::EquivalenceChecker checker(config);
 
             u32 num_gates = 0;
 
@@ -810,12 +1001,9 @@ namespace hal
                     for (size_t j = i + 1; j < loops.size(); j++)
                     {
                         const auto& current_loop = loops.at(j);
-                        const auto solver_res =
-                            BooleanFunction::Eq(std::get<1>(master_loop).clone(), std::get<1>(current_loop).clone(), 1)
-                                .map<BooleanFunction>([](auto&& bf_eq) -> Result<BooleanFunction> { return BooleanFunction::Not(std::move(bf_eq), 1); })
-                                .map<SMT::SolverResult>([&config](auto&& bf_not) -> Result<SMT::SolverResult> { return SMT::Solver({SMT::Constraint(std::move(bf_not))}).query(config); });
+                        const auto verdict = checker.check(std::get<1>(master_loop), std::get<1>(current_loop));
 
-                        if (solver_res.is_ok() && solver_res.get().is_unsat())
+                        if (verdict.is_ok() && verdict.get().is_equivalent())
                         {
                             current_duplicates.push_back(std::get<0>(current_loop));
                             visited.insert(j);
@@ -889,6 +1077,7 @@ namespace hal
             update_ff_replacements(ff_replacements);
 
             log_info("netlist_preprocessing", "removed {} redundant loops from netlist with ID {}.", num_gates, nl->get_id());
+            log_debug("netlist_preprocessing", "equivalence checks of redundant loops: {}", checker.get_statistics().to_string());
             return OK(num_gates);
         }
 
@@ -1030,51 +1219,717 @@ namespace hal
             return OK(clean_up_res.get() + counter);
         }
 
-        Result<u32> remove_unconnected_gates(Netlist* nl)
+        namespace
         {
-            u32 num_gates = 0;
-            std::vector<Gate*> to_delete;
-            do
+            u64 next_random(u64& state)
             {
-                to_delete.clear();
+                // splitmix64
+                u64 z = (state += 0x9E3779B97F4A7C15ull);
+                z     = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z     = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                return z ^ (z >> 31);
+            }
 
-                for (const auto& g : nl->get_gates())
-                {
-                    bool is_unconnected = true;
-                    for (const auto& on : g->get_fan_out_nets())
-                    {
-                        if (!on->get_destinations().empty() || on->is_global_output_net())
+            /**
+             * The combinational logic of a netlist prepared for bit-parallel simulation.
+             * Every net is either a constant, an input of the combinational logic, i.e., a global input or the output of a sequential gate, the output of a combinational gate that is simulated, or a cut.
+             * Cuts are the outputs of gates that are part of a combinational loop, whose Boolean function cannot be compiled, or nets with multiple sources. They are simulated like inputs but are never merged.
+             */
+            class CombinationalSimulation
+            {
+            public:
+                enum class Kind
+                {
+                    Constant,
+                    Input,
+                    GateOutput,
+                    Cut
+                };
+
+                struct NetInfo
+                {
+                    Net* net;
+                    Kind kind;
+                    u32 level = 0;
+                };
+
+                /**
+                 * Collects the nets and combinational gates of a netlist and orders the gates topologically.
+                 *
+                 * @param[in] nl - The netlist.
+                 */
+                explicit CombinationalSimulation(Netlist* nl)
+                {
+                    const auto nets = nl->get_nets();
+                    m_nets.reserve(nets.size());
+                    for (auto* net : nets)
+                    {
+                        m_net_indices[net] = m_nets.size();
+                        Kind kind = Kind::Cut;
+                        if (net->is_gnd_net() || net->is_vcc_net())
+                        {
+                            kind = Kind::Constant;
+                        }
+                        else if (net->is_global_input_net() || net->get_num_of_sources() == 0)
+                        {
+                            kind = Kind::Input;
+                        }
+                        else if (net->get_num_of_sources() == 1)
                         {
-                            is_unconnected = false;
+                            // outputs of sequential gates are inputs of the combinational logic, power and ground gates that are not marked as such are cut
+                            const auto* type = net->get_sources().front()->get_gate()->get_type();
+                            if (type->has_property(GateTypeProperty::power) || type->has_property(GateTypeProperty::ground))
+                            {
+                                kind = Kind::Cut;
+                            }
+                            else
+                            {
+                                kind = type->has_property(GateTypeProperty::combinational) ? Kind::GateOutput : Kind::Input;
+                            }
                         }
+                        m_nets.push_back({net, kind});
                     }
 
-                    if (is_unconnected)
+                    // compile the functions of all combinational gates, gates that fail to compile, e.g., due to unconnected inputs, only drive cuts
+                    for (auto* gate : nl->get_gates(is_combinational_logic))
                     {
-                        to_delete.push_back(g);
-                    }
-                }
+                        SimulatedGate sim_gate;
 
-                for (const auto& g : to_delete)
-                {
-                    if (!nl->delete_gate(g))
-                    {
-                        log_warning("netlist_preprocessing", "could not delete gate '{}' with ID {} from netlist with ID {}.", g->get_name(), g->get_id(), nl->get_id());
-                    }
-                    else
-                    {
-                        num_gates++;
-                    }
-                }
-            } while (!to_delete.empty());
+                        // the resolved Boolean functions refer to the fan-in nets, which are read from the slots in this order
+                        std::vector<std::string> slots;
+                        for (const auto* in_net : gate->get_fan_in_nets())
+                        {
+                            slots.push_back(BooleanFunctionNetDecorator(*in_net).get_boolean_variable_name());
+                            sim_gate.inputs.push_back(m_net_indices.at(in_net));
+                        }
 
-            log_info("netlist_preprocessing", "removed {} unconnected gates from netlist with ID {}.", num_gates, nl->get_id());
-            return OK(num_gates);
-        }
+                        bool compiled = true;
+                        for (auto* ep : gate->get_fan_out_endpoints())
+                        {
+                            const u32 net_index = m_net_indices.at(ep->get_net());
+                            if (m_nets.at(net_index).kind != Kind::GateOutput)
+                            {
+                                continue;
+                            }
 
-        Result<u32> remove_unconnected_nets(Netlist* nl)
-        {
-            u32 num_nets = 0;
+                            const auto function = gate->get_resolved_boolean_function(ep->get_pin()).map<CompiledBooleanFunction>(
+                                [&slots](BooleanFunction&& bf) { return CompiledBooleanFunction::compile(bf, slots); });
+                            if (function.is_error())
+                            {
+                                compiled = false;
+                                break;
+                            }
+
+                            sim_gate.outputs.push_back({net_index, m_functions.size()});
+                            m_functions.push_back(function.get());
+                        }
+
+                        if (!compiled)
+                        {
+                            for (auto* out_net : gate->get_fan_out_nets())
+                            {
+                                m_nets.at(m_net_indices.at(out_net)).kind = Kind::Cut;
+                            }
+                            continue;
+                        }
+
+                        m_gates.push_back(std::move(sim_gate));
+                    }
+
+                    // order the gates topologically, gates within combinational loops are never reached and only drive cuts
+                    m_driver.assign(m_nets.size(), INVALID_INDEX);
+                    for (u32 i = 0; i < m_gates.size(); i++)
+                    {
+                        for (const auto& [net_index, function_index] : m_gates.at(i).outputs)
+                        {
+                            m_driver.at(net_index) = i;
+                        }
+                    }
+
+                    std::vector<u32> num_pending(m_gates.size(), 0);
+                    std::vector<std::vector<u32>> successors(m_gates.size());
+                    for (u32 i = 0; i < m_gates.size(); i++)
+                    {
+                        std::vector<u32> predecessors;
+                        for (const u32 in : m_gates.at(i).inputs)
+                        {
+                            if (m_driver.at(in) != INVALID_INDEX)
+                            {
+                                predecessors.push_back(m_driver.at(in));
+                            }
+                        }
+                        std::sort(predecessors.begin(), predecessors.end());
+                        predecessors.erase(std::unique(predecessors.begin(), predecessors.end()), predecessors.end());
+                        num_pending.at(i) = predecessors.size();
+                        for (const u32 pred : predecessors)
+                        {
+                            successors.at(pred).push_back(i);
+                        }
+                    }
+
+                    std::vector<u32> ready;
+                    m_position.assign(m_gates.size(), INVALID_INDEX);
+                    for (u32 i = 0; i < m_gates.size(); i++)
+                    {
+                        if (num_pending.at(i) == 0)
+                        {
+                            ready.push_back(i);
+                        }
+                    }
+                    while (!ready.empty())
+                    {
+                        const u32 i = ready.back();
+                        ready.pop_back();
+                        m_position.at(i) = m_order.size();
+                        m_order.push_back(i);
+
+                        u32 level = 0;
+                        for (const u32 in : m_gates.at(i).inputs)
+                        {
+                            level = std::max(level, m_nets.at(in).level);
+                        }
+                        for (const auto& [net_index, function_index] : m_gates.at(i).outputs)
+                        {
+                            m_nets.at(net_index).level = level + 1;
+                        }
+
+                        for (const u32 suc : successors.at(i))
+                        {
+                            if (--num_pending.at(suc) == 0)
+                            {
+                                ready.push_back(suc);
+                            }
+                        }
+                    }
+
+                    if (m_order.size() != m_gates.size())
+                    {
+                        for (u32 i = 0; i < m_gates.size(); i++)
+                        {
+                            if (num_pending.at(i) != 0)
+                            {
+                                for (const auto& [net_index, function_index] : m_gates.at(i).outputs)
+                                {
+                                    m_nets.at(net_index).kind = Kind::Cut;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                const std::vector<NetInfo>& get_nets() const
+                {
+                    return m_nets;
+                }
+
+                const std::unordered_map<const Net*, u32>& get_net_indices() const
+                {
+                    return m_net_indices;
+                }
+
+                /**
+                 * Simulates 64 input assignments at once.
+                 *
+                 * @param[in] input_value - Returns the lanes of an input or a cut by the index of the net.
+                 * @returns The lanes of all nets by their index.
+                 */
+                std::vector<CompiledBooleanFunction::Lanes> simulate(const std::function<u64(u32)>& input_value) const
+                {
+                    std::vector<CompiledBooleanFunction::Lanes> values(m_nets.size());
+                    for (u32 i = 0; i < m_nets.size(); i++)
+                    {
+                        const auto& info = m_nets.at(i);
+                        if (info.kind == Kind::Constant)
+                        {
+                            values.at(i) = CompiledBooleanFunction::Lanes::broadcast(info.net->is_vcc_net() ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO);
+                        }
+                        else if (info.kind == Kind::Input || info.kind == Kind::Cut)
+                        {
+                            values.at(i) = {input_value(i), ~0ull};
+                        }
+                    }
+
+                    std::vector<CompiledBooleanFunction::Lanes> slots;
+                    for (const u32 g : m_order)
+                    {
+                        const auto& sim_gate = m_gates.at(g);
+                        slots.clear();
+                        for (const u32 in : sim_gate.inputs)
+                        {
+                            slots.push_back(values.at(in));
+                        }
+                        for (const auto& [net_index, function_index] : sim_gate.outputs)
+                        {
+                            if (m_nets.at(net_index).kind == Kind::GateOutput)
+                            {
+                                values.at(net_index) = m_functions.at(function_index).evaluate(slots.data());
+                            }
+                        }
+                    }
+
+                    return values;
+                }
+
+                /**
+                 * Decides whether two nets are equivalent by simulating all assignments of the inputs and cuts within their fan-in cones.
+                 *
+                 * @param[in] a - The index of the first net.
+                 * @param[in] b - The index of the second net.
+                 * @param[in] max_inputs - The largest number of inputs and cuts within both cones that is simulated.
+                 * @returns True if the nets are equivalent, false if they are not, and an empty optional if the cones have too many inputs or a value is not known.
+                 */
+                std::optional<bool> check_exhaustively(u32 a, u32 b, u32 max_inputs) const
+                {
+                    // the lanes of the first six inputs enumerate their assignments within every word, the remaining inputs are counted across the words
+                    static constexpr u64 lane_patterns[6] = {
+                        0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull, 0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+
+                    std::vector<u32> support;
+                    std::vector<u32> cone;
+                    std::unordered_set<u32> visited;
+                    std::vector<u32> stack = {a, b};
+                    while (!stack.empty())
+                    {
+                        const u32 i = stack.back();
+                        stack.pop_back();
+                        if (!visited.insert(i).second)
+                        {
+                            continue;
+                        }
+
+                        const auto kind = m_nets.at(i).kind;
+                        if (kind == Kind::GateOutput)
+                        {
+                            const u32 g = m_driver.at(i);
+                            cone.push_back(g);
+                            stack.insert(stack.end(), m_gates.at(g).inputs.begin(), m_gates.at(g).inputs.end());
+                        }
+                        else if (kind == Kind::Input || kind == Kind::Cut)
+                        {
+                            support.push_back(i);
+                            if (support.size() > max_inputs)
+                            {
+                                return std::nullopt;
+                            }
+                        }
+                    }
+
+                    std::sort(cone.begin(), cone.end(), [this](u32 x, u32 y) { return m_position.at(x) < m_position.at(y); });
+                    cone.erase(std::unique(cone.begin(), cone.end()), cone.end());
+
+                    std::unordered_map<u32, CompiledBooleanFunction::Lanes> values;
+                    const auto value_of = [this, &values](u32 i) {
+                        const auto* net = m_nets.at(i).net;
+                        if (m_nets.at(i).kind == Kind::Constant)
+                        {
+                            return CompiledBooleanFunction::Lanes::broadcast(net->is_vcc_net() ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO);
+                        }
+                        return values.at(i);
+                    };
+
+                    const u64 num_words = (support.size() > 6) ? (1ull << (support.size() - 6)) : 1;
+                    std::vector<CompiledBooleanFunction::Lanes> slots;
+                    for (u64 word = 0; word < num_words; word++)
+                    {
+                        values.clear();
+                        for (u32 j = 0; j < support.size(); j++)
+                        {
+                            const u64 lanes       = (j < 6) ? lane_patterns[j] : (((word >> (j - 6)) & 1) ? ~0ull : 0ull);
+                            values[support.at(j)] = {lanes, ~0ull};
+                        }
+
+                        for (const u32 g : cone)
+                        {
+                            const auto& sim_gate = m_gates.at(g);
+                            slots.clear();
+                            for (const u32 in : sim_gate.inputs)
+                            {
+                                slots.push_back(value_of(in));
+                            }
+                            for (const auto& [net_index, function_index] : sim_gate.outputs)
+                            {
+                                values[net_index] = m_functions.at(function_index).evaluate(slots.data());
+                            }
+                        }
+
+                        const auto value_a = value_of(a);
+                        const auto value_b = value_of(b);
+                        if ((value_a.known & value_b.known) != ~0ull)
+                        {
+                            return std::nullopt;
+                        }
+                        if (value_a.value != value_b.value)
+                        {
+                            return false;
+                        }
+                    }
+
+                    return true;
+                }
+
+            private:
+                static constexpr u32 INVALID_INDEX = std::numeric_limits<u32>::max();
+
+                struct SimulatedGate
+                {
+                    /// the fan-in nets in the order of the slots of the compiled functions
+                    std::vector<u32> inputs;
+                    /// the simulated output nets and the index of the compiled function of their pin
+                    std::vector<std::pair<u32, u32>> outputs;
+                };
+
+                std::vector<NetInfo> m_nets;
+                std::unordered_map<const Net*, u32> m_net_indices;
+                std::vector<CompiledBooleanFunction> m_functions;
+                std::vector<SimulatedGate> m_gates;
+                /// the index of the gate driving each simulated gate output
+                std::vector<u32> m_driver;
+                /// the indices of the gates in topological order
+                std::vector<u32> m_order;
+                /// the position of each gate within the topological order
+                std::vector<u32> m_position;
+            };
+        }    // namespace
+
+        Result<u32> remove_functionally_equivalent_nets(Netlist* nl, u32 num_simulation_rounds)
+        {
+            if (nl == nullptr)
+            {
+                return ERR("netlist is a nullptr");
+            }
+
+            using Kind = CombinationalSimulation::Kind;
+
+            const CombinationalSimulation simulation(nl);
+            const auto& nets = simulation.get_nets();
+
+            // the simulated values of all nets, one vector of 64 lanes per round
+            std::vector<std::vector<CompiledBooleanFunction::Lanes>> signatures;
+            u64 random_state = 0;
+            for (u32 round = 0; round < std::max(num_simulation_rounds, 1u); round++)
+            {
+                signatures.push_back(simulation.simulate([&random_state, round](u32) {
+                    const u64 word = next_random(random_state);
+                    // the first two lanes of the first round set all inputs to 0 and to 1, respectively
+                    return (round == 0) ? ((word & ~3ull) | 2ull) : word;
+                }));
+            }
+
+            // nets are merged into the net of the lowest rank within their class, which cannot depend on them
+            const auto rank = [&nets](u32 i) {
+                const auto& info = nets.at(i);
+                return std::make_tuple(info.level, info.kind, info.net->get_id());
+            };
+
+            // without a solver, only candidates whose fan-in cones are small enough to be simulated exhaustively are decided
+            std::optional<SMT::SolverSessionPool::Lease> lease;
+            if (auto lease_res = SMT::SolverSessionPool::get_shared(SMT::QueryConfig().with_model_generation()).acquire(); lease_res.is_ok())
+            {
+                lease.emplace(lease_res.get());
+
+                // the gate functions are asserted within a scope of their own, which is removed when the session is returned to the pool
+                if (const auto res = (*lease)->push(); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "unable to remove functionally equivalent nets from netlist with ID " + std::to_string(nl->get_id()) + ": failed to open solver scope");
+                }
+            }
+            else
+            {
+                log_warning("netlist_preprocessing",
+                            "no SMT solver available, only nets whose fan-in cones have at most {} inputs are checked for equivalence in netlist with ID {}:\n{}",
+                            SMT::EquivalenceChecker::MAX_TRUTH_TABLE_VARIABLES,
+                            nl->get_id(),
+                            lease_res.get_error().get());
+            }
+
+            // the gate functions are added to the session once for the fan-in cones of all checked nets and reused by every subsequent check
+            std::vector<bool> defined(nets.size(), false);
+            const auto define_cone = [&](u32 root) -> Result<std::monostate> {
+                std::vector<SMT::Constraint> constraints;
+                std::vector<u32> stack = {root};
+                while (!stack.empty())
+                {
+                    const u32 i = stack.back();
+                    stack.pop_back();
+                    if (defined.at(i))
+                    {
+                        continue;
+                    }
+                    defined.at(i) = true;
+
+                    const auto& info = nets.at(i);
+                    auto var         = BooleanFunctionNetDecorator(*info.net).get_boolean_variable();
+                    if (info.kind == Kind::Constant)
+                    {
+                        constraints.emplace_back(std::move(var), BooleanFunction::Const(info.net->is_vcc_net() ? 1 : 0, 1));
+                    }
+                    else if (info.kind == Kind::GateOutput)
+                    {
+                        const auto* src = info.net->get_sources().front();
+                        auto bf_res     = src->get_gate()->get_resolved_boolean_function(src->get_pin());
+                        if (bf_res.is_error())
+                        {
+                            return ERR(bf_res.get_error());
+                        }
+                        auto bf = bf_res.get();
+
+                        // variables that do not refer to a net would be shared by all gates of a type, the net is left unconstrained instead
+                        const auto variables = bf.get_variable_names();
+                        if (std::any_of(variables.begin(), variables.end(), [nl](const auto& v) { return BooleanFunctionNetDecorator::get_net_from(nl, v).is_error(); }))
+                        {
+                            continue;
+                        }
+
+                        for (const auto* in_net : src->get_gate()->get_fan_in_nets())
+                        {
+                            stack.push_back(simulation.get_net_indices().at(in_net));
+                        }
+                        constraints.emplace_back(std::move(var), std::move(bf));
+                    }
+                }
+                return (*lease)->add_constraints(constraints);
+            };
+
+            std::vector<bool> merged(nets.size(), false);
+            std::vector<std::pair<u32, u32>> merges;
+            std::set<std::pair<u32, u32>> distinct;
+            u32 num_proved = 0, num_refuted = 0, num_unknown = 0;
+
+            bool refined = true;
+            while (refined)
+            {
+                refined = false;
+
+                // nets whose signatures are fully known are grouped into classes of equal signatures
+                std::vector<u32> candidates;
+                for (u32 i = 0; i < nets.size(); i++)
+                {
+                    if (merged.at(i) || nets.at(i).kind == Kind::Cut)
+                    {
+                        continue;
+                    }
+                    if (std::all_of(signatures.begin(), signatures.end(), [i](const auto& words) { return words.at(i).known == ~0ull; }))
+                    {
+                        candidates.push_back(i);
+                    }
+                }
+
+                std::sort(candidates.begin(), candidates.end(), [&](u32 a, u32 b) {
+                    for (const auto& words : signatures)
+                    {
+                        if (words.at(a).value != words.at(b).value)
+                        {
+                            return words.at(a).value < words.at(b).value;
+                        }
+                    }
+                    return rank(a) < rank(b);
+                });
+
+                // counterexamples of refuted candidates are collected as lanes of another round of simulation
+                std::vector<std::unordered_map<u32, u64>> counterexamples;
+
+                for (u32 begin = 0, end = 0; begin < candidates.size() && !refined; begin = end)
+                {
+                    end = begin + 1;
+                    while (end < candidates.size()
+                           && std::all_of(signatures.begin(), signatures.end(), [&](const auto& words) { return words.at(candidates.at(begin)).value == words.at(candidates.at(end)).value; }))
+                    {
+                        end++;
+                    }
+
+                    const u32 representative = candidates.at(begin);
+                    for (u32 k = begin + 1; k < end; k++)
+                    {
+                        const u32 member = candidates.at(k);
+                        if (nets.at(member).kind != Kind::GateOutput || distinct.find({representative, member}) != distinct.end())
+                        {
+                            continue;
+                        }
+
+                        if (!lease.has_value())
+                        {
+                            const auto equal = simulation.check_exhaustively(representative, member, SMT::EquivalenceChecker::MAX_TRUTH_TABLE_VARIABLES);
+                            if (equal == true)
+                            {
+                                num_proved++;
+                                merged.at(member) = true;
+                                merges.push_back({representative, member});
+                                continue;
+                            }
+
+                            distinct.insert({representative, member});
+                            if (equal.has_value())
+                            {
+                                num_refuted++;
+                            }
+                            else
+                            {
+                                num_unknown++;
+                            }
+                            continue;
+                        }
+
+                        if (const auto res = define_cone(representative); res.is_error())
+                        {
+                            return ERR_APPEND(res.get_error(), "unable to remove functionally equivalent nets from netlist with ID " + std::to_string(nl->get_id()) + ": failed to add gate functions");
+                        }
+                        if (const auto res = define_cone(member); res.is_error())
+                        {
+                            return ERR_APPEND(res.get_error(), "unable to remove functionally equivalent nets from netlist with ID " + std::to_string(nl->get_id()) + ": failed to add gate functions");
+                        }
+
+                        auto differ = BooleanFunction::Xor(BooleanFunctionNetDecorator(*nets.at(representative).net).get_boolean_variable(),
+                                                           BooleanFunctionNetDecorator(*nets.at(member).net).get_boolean_variable(),
+                                                           1);
+                        const auto check = (*lease)->check({differ.get()});
+                        if (check.is_error())
+                        {
+                            return ERR_APPEND(check.get_error(), "unable to remove functionally equivalent nets from netlist with ID " + std::to_string(nl->get_id()) + ": failed to check equivalence");
+                        }
+
+                        const auto& result = check.get();
+                        if (result.is_unsat())
+                        {
+                            num_proved++;
+                            merged.at(member) = true;
+                            merges.push_back({representative, member});
+                            continue;
+                        }
+
+                        distinct.insert({representative, member});
+                        if (!result.is_sat() || !result.model.has_value())
+                        {
+                            num_unknown++;
+                            continue;
+                        }
+
+                        num_refuted++;
+                        std::unordered_map<u32, u64> assignment;
+                        for (const auto& [name, value] : result.model->model)
+                        {
+                            if (const auto net = BooleanFunctionNetDecorator::get_net_from(nl, name); net.is_ok())
+                            {
+                                if (const auto it = simulation.get_net_indices().find(net.get()); it != simulation.get_net_indices().end())
+                                {
+                                    assignment[it->second] = std::get<0>(value) & 1;
+                                }
+                            }
+                        }
+                        counterexamples.push_back(std::move(assignment));
+
+                        // a full round of counterexamples splits the remaining classes before any further check
+                        if (counterexamples.size() == 64)
+                        {
+                            refined = true;
+                            break;
+                        }
+                    }
+                }
+
+                if (refined)
+                {
+                    signatures.push_back(simulation.simulate([&random_state, &counterexamples](u32 i) {
+                        u64 word = next_random(random_state);
+                        for (u32 lane = 0; lane < counterexamples.size(); lane++)
+                        {
+                            if (const auto it = counterexamples.at(lane).find(i); it != counterexamples.at(lane).end())
+                            {
+                                word = (word & ~(1ull << lane)) | (it->second << lane);
+                            }
+                        }
+                        return word;
+                    }));
+                }
+            }
+
+            log_debug("netlist_preprocessing",
+                      "functional hashing took {} rounds of simulation: {} candidate pairs proved equivalent, {} refuted, {} undecided.",
+                      signatures.size(),
+                      num_proved,
+                      num_refuted,
+                      num_unknown);
+
+            // connect the destinations of every equivalent net to its representative and remove the gates that are left without successors
+            u32 num_nets = 0;
+            GateWorklist worklist;
+            for (const auto& [representative, member] : merges)
+            {
+                Net* master_net = nets.at(representative).net;
+                Net* slave_net  = nets.at(member).net;
+
+                auto* src_ep   = slave_net->get_sources().front();
+                auto* src_gate = src_ep->get_gate();
+                if (!slave_net->remove_source(src_ep))
+                {
+                    log_warning("netlist_preprocessing", "could not disconnect net '{}' with ID {} from its source in netlist with ID {}.", slave_net->get_name(), slave_net->get_id(), nl->get_id());
+                    continue;
+                }
+
+                if (const auto res = NetlistModificationDecorator(*nl).connect_nets(master_net, slave_net); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(),
+                                      "unable to remove functionally equivalent nets from netlist with ID " + std::to_string(nl->get_id()) + ": failed to connect net with ID "
+                                          + std::to_string(slave_net->get_id()) + " to net with ID " + std::to_string(master_net->get_id()));
+                }
+                worklist.push(src_gate);
+                num_nets++;
+            }
+
+            u32 num_gates = 0;
+            while (Gate* g = worklist.pop())
+            {
+                const auto* type = g->get_type();
+                if (type->has_property(GateTypeProperty::power) || type->has_property(GateTypeProperty::ground) || !is_unconnected(g))
+                {
+                    continue;
+                }
+
+                const auto out_nets = g->get_fan_out_nets();
+                if (delete_gate_and_queue_predecessors(nl, g, &worklist))
+                {
+                    num_gates++;
+                    for (auto* out_net : out_nets)
+                    {
+                        nl->delete_net(out_net);
+                    }
+                }
+            }
+
+            log_info("netlist_preprocessing", "merged {} functionally equivalent nets and removed {} gates from netlist with ID {}.", num_nets, num_gates, nl->get_id());
+            return OK(num_nets);
+        }
+
+        Result<u32> remove_unconnected_gates(Netlist* nl)
+        {
+            u32 num_gates = 0;
+
+            // deleting a gate can only leave its predecessors unconnected, so only those are visited again
+            GateWorklist worklist;
+            worklist.push(nl->get_gates());
+            while (Gate* g = worklist.pop())
+            {
+                if (!is_unconnected(g))
+                {
+                    continue;
+                }
+
+                if (!delete_gate_and_queue_predecessors(nl, g, &worklist))
+                {
+                    log_warning("netlist_preprocessing", "could not delete gate '{}' with ID {} from netlist with ID {}.", g->get_name(), g->get_id(), nl->get_id());
+                }
+                else
+                {
+                    num_gates++;
+                }
+            }
+
+            log_info("netlist_preprocessing", "removed {} unconnected gates from netlist with ID {}.", num_gates, nl->get_id());
+            return OK(num_gates);
+        }
+
+        Result<u32> remove_unconnected_nets(Netlist* nl)
+        {
+            u32 num_nets = 0;
 
             std::vector<Net*> to_delete;
 
@@ -1643,6 +2498,89 @@ namespace hal
             return OK(res_count);
         }
 
+        namespace
+        {
+            /**
+             * Connects the destinations of every output of a combinational gate that evaluates to a constant once power and ground nets are substituted to the GND or VCC net instead.
+             * The destinations that are reconnected are queued, the gate itself is left in place even if it no longer has any successors.
+             *
+             * @param[in] nl - The netlist.
+             * @param[in] g - The gate.
+             * @param[in] gnd_net - The GND net, may be a `nullptr`.
+             * @param[in] vcc_net - The VCC net, may be a `nullptr`.
+             * @param[in] worklist - The worklist.
+             * @returns OK() and the number of rerouted destinations on success, an error otherwise.
+             */
+            Result<u32> propagate_constants_at(Netlist* nl, Gate* g, Net* gnd_net, Net* vcc_net, GateWorklist& worklist)
+            {
+                u32 replaced_dst_count = 0;
+
+                for (const auto ep : g->get_fan_out_endpoints())
+                {
+                    auto bf_res = g->get_resolved_boolean_function(ep->get_pin(), false);
+                    if (bf_res.is_error())
+                    {
+                        return ERR_APPEND(bf_res.get_error(),
+                                          "unable to propagate constants: failed to generate boolean function at gate " + g->get_name() + " with ID " + std::to_string(g->get_id()) + " for pin "
+                                              + ep->get_pin()->get_name());
+                    }
+                    auto bf      = bf_res.get();
+                    auto sub_res = BooleanFunctionDecorator(bf).substitute_power_ground_nets(nl);
+                    if (sub_res.is_error())
+                    {
+                        return ERR_APPEND(sub_res.get_error(),
+                                          "unable to propagate constants: failed to substitue power and ground nets in boolean function of gate " + g->get_name() + " with ID "
+                                              + std::to_string(g->get_id()) + " for pin " + ep->get_pin()->get_name());
+                    }
+                    bf = sub_res.get();
+                    bf = bf.simplify_local();
+
+                    // if boolean function of output pin can be simplified to a constant connect all its successors to gnd/vcc instead
+                    if (bf.is_constant())
+                    {
+                        Net* new_source;
+                        if (bf.has_constant_value(0))
+                        {
+                            new_source = gnd_net;
+                        }
+                        else if (bf.has_constant_value(1))
+                        {
+                            new_source = vcc_net;
+                        }
+                        else
+                        {
+                            continue;
+                        }
+
+                        if (new_source == nullptr)
+                        {
+                            // log_error("netlist_preprocessing", "failed to replace bf {} with constant net because netlist is missing GND gate or VCC gate");
+                            return ERR("unable to propagate constants: netlist is missing gnd or vcc net!");
+                        }
+
+                        std::vector<std::pair<Gate*, GatePin*>> to_replace;
+                        for (auto dst : ep->get_net()->get_destinations())
+                        {
+                            to_replace.push_back({dst->get_gate(), dst->get_pin()});
+                        }
+
+                        for (const auto& [dst_g, dst_p] : to_replace)
+                        {
+                            ep->get_net()->remove_destination(dst_g, dst_p);
+                            new_source->add_destination(dst_g, dst_p);
+                            worklist.push(dst_g);
+
+                            replaced_dst_count++;
+                        }
+
+                        nl->delete_net(ep->get_net());
+                    }
+                }
+
+                return OK(replaced_dst_count);
+            }
+        }    // namespace
+
         Result<u32> propagate_constants(Netlist* nl)
         {
             if (nl == nullptr)
@@ -1655,104 +2593,201 @@ namespace hal
 
             u32 total_replaced_dst_count = 0;
 
+            // only gates whose fan-in has been rerouted to a constant or that lost a successor are visited again
+            GateWorklist worklist;
+            worklist.push(nl->get_gates(is_combinational_logic));
+            while (Gate* g = worklist.pop())
+            {
+                if (!is_combinational_logic(g))
+                {
+                    continue;
+                }
+
+                const auto res = propagate_constants_at(nl, g, gnd_net, vcc_net, worklist);
+                if (res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+                total_replaced_dst_count += res.get();
+
+                if (is_unconnected(g))
+                {
+                    delete_gate_and_queue_predecessors(nl, g, &worklist);
+                }
+            }
+
+            log_info("netlist_preprocessing", "replaced {} destinations with power/ground nets in total", total_replaced_dst_count);
+            return OK(total_replaced_dst_count);
+        }
+
+        Result<std::map<std::string, PassStatistics>> preprocess(Netlist* nl)
+        {
+            if (nl == nullptr)
+            {
+                return ERR("netlist is a nullptr");
+            }
+
+            const auto seconds_since = [](const std::chrono::steady_clock::time_point& begin) { return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count(); };
+
+            std::map<std::string, PassStatistics> statistics;
+            auto& unconnected_gates_stats = statistics["remove_unconnected_gates"];
+            auto& constants_stats         = statistics["propagate_constants"];
+            auto& buffers_stats           = statistics["remove_buffers"];
+            auto& redundant_gates_stats   = statistics["remove_redundant_gates"];
+            auto& unconnected_nets_stats  = statistics["remove_unconnected_nets"];
+
+            Net* gnd_net = nl->get_gnd_gates().empty() ? nullptr : nl->get_gnd_gates().front()->get_fan_out_nets().front();
+            Net* vcc_net = nl->get_vcc_gates().empty() ? nullptr : nl->get_vcc_gates().front()->get_fan_out_nets().front();
+
+            // the flip-flops replaced by each gate are kept in memory for all rounds and written back to the gates once at the end
+            auto ff_replacements = restore_ff_replacements(nl);
+
+            GateWorklist worklist;
+            worklist.push(nl->get_gates());
             while (true)
             {
-                u32 replaced_dst_count = 0;
-                std::vector<Gate*> to_delete;
-                for (const auto g : nl->get_gates([](const auto g) {
-                         return g->get_type()->has_property(GateTypeProperty::combinational) && !g->get_type()->has_property(GateTypeProperty::ground)
-                                && !g->get_type()->has_property(GateTypeProperty::power);
-                     }))
+                while (Gate* g = worklist.pop())
                 {
-                    bool has_global_output = false;
-                    for (const auto ep : g->get_fan_out_endpoints())
+                    // power and ground gates are kept, constants are propagated to their nets
+                    const auto* type = g->get_type();
+                    if (type->has_property(GateTypeProperty::power) || type->has_property(GateTypeProperty::ground))
                     {
-                        if (ep->get_net()->is_global_output_net())
+                        continue;
+                    }
+
+                    auto begin = std::chrono::steady_clock::now();
+                    unconnected_gates_stats.num_visited++;
+                    if (is_unconnected(g))
+                    {
+                        if (delete_gate_and_queue_predecessors(nl, g, &worklist, &ff_replacements))
                         {
-                            has_global_output = true;
+                            unconnected_gates_stats.num_changes++;
                         }
+                        unconnected_gates_stats.duration += seconds_since(begin);
+                        continue;
+                    }
+                    unconnected_gates_stats.duration += seconds_since(begin);
 
-                        auto bf_res = g->get_resolved_boolean_function(ep->get_pin(), false);
-                        if (bf_res.is_error())
+                    if (!is_combinational_logic(g))
+                    {
+                        continue;
+                    }
+
+                    begin = std::chrono::steady_clock::now();
+                    constants_stats.num_visited++;
+                    const auto constants_res = propagate_constants_at(nl, g, gnd_net, vcc_net, worklist);
+                    if (constants_res.is_error())
+                    {
+                        return ERR_APPEND(constants_res.get_error(), "unable to preprocess netlist with ID " + std::to_string(nl->get_id()) + ": failed to propagate constants");
+                    }
+                    constants_stats.num_changes += constants_res.get();
+                    constants_stats.duration += seconds_since(begin);
+
+                    if (constants_res.get() != 0)
+                    {
+                        // the gate may have lost all of its successors, visit it once more to remove it
+                        worklist.push(g);
+                        continue;
+                    }
+
+                    begin = std::chrono::steady_clock::now();
+                    buffers_stats.num_visited++;
+                    const auto successors = g->get_unique_successors();
+                    const auto bypass_res = bypass_buffer(nl, g);
+                    if (bypass_res.is_error())
+                    {
+                        return ERR_APPEND(bypass_res.get_error(), "unable to preprocess netlist with ID " + std::to_string(nl->get_id()) + ": failed to remove buffers");
+                    }
+                    if (bypass_res.get())
+                    {
+                        if (delete_gate_and_queue_predecessors(nl, g, &worklist, &ff_replacements))
                         {
-                            return ERR_APPEND(bf_res.get_error(),
-                                              "unable to propagate constants: failed to generate boolean function at gate " + g->get_name() + " with ID " + std::to_string(g->get_id()) + " for pin "
-                                                  + ep->get_pin()->get_name());
+                            buffers_stats.num_changes++;
                         }
-                        auto bf      = bf_res.get();
-                        auto sub_res = BooleanFunctionDecorator(bf).substitute_power_ground_nets(nl);
-                        if (sub_res.is_error())
+                        else
                         {
-                            return ERR_APPEND(bf_res.get_error(),
-                                              "unable to propagate constants: failed to substitue power and ground nets in boolean function of gate " + g->get_name() + " with ID "
-                                                  + std::to_string(g->get_id()) + " for pin " + ep->get_pin()->get_name());
+                            log_warning("netlist_preprocessing", "failed to remove buffer gate '{}' with ID {} from netlist with ID {}.", g->get_name(), g->get_id(), nl->get_id());
                         }
-                        bf = sub_res.get();
-                        bf = bf.simplify_local();
-
-                        // if boolean function of output pin can be simplified to a constant connect all its successors to gnd/vcc instead
-                        if (bf.is_constant())
+                        for (auto* suc : successors)
                         {
-                            Net* new_source;
-                            if (bf.has_constant_value(0))
+                            if (suc != g)
                             {
-                                new_source = gnd_net;
+                                worklist.push(suc);
                             }
-                            else if (bf.has_constant_value(1))
-                            {
-                                new_source = vcc_net;
-                            }
-                            else
-                            {
-                                continue;
-                            }
-
-                            if (new_source == nullptr)
-                            {
-                                // log_error("netlist_preprocessing", "failed to replace bf {} with constant net because netlist is missing GND gate or VCC gate");
-                                return ERR("unable to propagate constants: netlist is missing gnd or vcc net!");
-                            }
-
-                            std::vector<std::pair<Gate*, GatePin*>> to_replace;
-                            for (auto dst : ep->get_net()->get_destinations())
-                            {
-                                to_replace.push_back({dst->get_gate(), dst->get_pin()});
-                            }
-
-                            for (const auto& [dst_g, dst_p] : to_replace)
-                            {
-                                ep->get_net()->remove_destination(dst_g, dst_p);
-                                new_source->add_destination(dst_g, dst_p);
+                        }
+                    }
+                    buffers_stats.duration += seconds_since(begin);
+                }
 
-                                replaced_dst_count++;
-                            }
+                // duplicates share all of their fan-in nets, so the destinations of the least used fan-in net of a modified gate include all of its duplicates
+                const auto begin = std::chrono::steady_clock::now();
+                std::unordered_set<Gate*> candidates;
+                for (auto* g : worklist.take_modified())
+                {
+                    const Net* least_used_net = nullptr;
+                    for (const auto* in_net : g->get_fan_in_nets())
+                    {
+                        if (least_used_net == nullptr || in_net->get_num_of_destinations() < least_used_net->get_num_of_destinations())
+                        {
+                            least_used_net = in_net;
+                        }
+                    }
 
-                            nl->delete_net(ep->get_net());
+                    candidates.insert(g);
+                    if (least_used_net != nullptr)
+                    {
+                        for (const auto* dst : least_used_net->get_destinations())
+                        {
+                            candidates.insert(dst->get_gate());
                         }
                     }
+                }
 
-                    if (!has_global_output && g->get_successors().empty())
+                std::vector<Gate*> target_gates;
+                for (auto* g : candidates)
+                {
+                    const auto* type = g->get_type();
+                    if (type->has_property(GateTypeProperty::combinational) || type->has_property(GateTypeProperty::ff))
                     {
-                        to_delete.push_back(g);
+                        target_gates.push_back(g);
                     }
                 }
 
-                for (auto g : to_delete)
+                redundant_gates_stats.num_visited += target_gates.size();
+                if (!target_gates.empty())
                 {
-                    nl->delete_gate(g);
+                    const auto merge_res = merge_redundant_gates(nl, std::move(target_gates), &worklist, ff_replacements);
+                    if (merge_res.is_error())
+                    {
+                        return ERR_APPEND(merge_res.get_error(), "unable to preprocess netlist with ID " + std::to_string(nl->get_id()) + ": failed to remove redundant gates");
+                    }
+                    redundant_gates_stats.num_changes += merge_res.get();
                 }
+                redundant_gates_stats.duration += seconds_since(begin);
 
-                if (replaced_dst_count == 0)
+                if (worklist.empty())
                 {
                     break;
                 }
+            }
+
+            update_ff_replacements(ff_replacements);
 
-                log_debug("netlist_preprocessing", "replaced {} destinations this with power/ground nets this iteration", replaced_dst_count);
-                total_replaced_dst_count += replaced_dst_count;
+            const auto begin = std::chrono::steady_clock::now();
+            const auto nets_res = remove_unconnected_nets(nl);
+            if (nets_res.is_error())
+            {
+                return ERR_APPEND(nets_res.get_error(), "unable to preprocess netlist with ID " + std::to_string(nl->get_id()) + ": failed to remove unconnected nets");
             }
+            unconnected_nets_stats.num_changes = nets_res.get();
+            unconnected_nets_stats.duration    = seconds_since(begin);
 
-            log_info("netlist_preprocessing", "replaced {} destinations with power/ground nets in total", total_replaced_dst_count);
-            return OK(total_replaced_dst_count);
+            for (const auto& [pass, stats] : statistics)
+            {
+                log_info("netlist_preprocessing", "{}: visited {} gates and made {} changes in {:.3f}s.", pass, stats.num_visited, stats.num_changes, stats.duration);
+            }
+
+            return OK(statistics);
         }
 
         Result<u32> remove_consecutive_inverters(Netlist* nl)
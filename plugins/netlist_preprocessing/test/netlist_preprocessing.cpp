@@ -1,5 +1,6 @@
 #include "netlist_preprocessing/netlist_preprocessing.h"
 
+#include "hal_core/netlist/boolean_function/solver.h"
 #include "netlist_test_utils.h"
 #include "gate_library_test_utils.h"
 
@@ -367,4 +368,341 @@ namespace hal {
         }
         TEST_END
     }
+
+    /**
+     * Test the combined preprocessing pipeline, in which the changes of one pass enable further changes by the other passes.
+     *
+     * Functions: preprocess
+     */
+    TEST_F(NetlistPreprocessingTest, check_preprocess)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            Gate* gnd_gate = nl->create_gate(gl->get_gate_type_by_name("GND"), "gnd");
+            nl->mark_gnd_gate(gnd_gate);
+            Net* gnd_net = nl->create_net("gnd");
+            gnd_net->add_source(gnd_gate, "O");
+            Gate* vcc_gate = nl->create_gate(gl->get_gate_type_by_name("VCC"), "vcc");
+            nl->mark_vcc_gate(vcc_gate);
+            Net* vcc_net = nl->create_net("vcc");
+            vcc_net->add_source(vcc_gate, "O");
+
+            // g0 is a buffer, g1 is constant 0, which turns g2 into a buffer, which in turn makes g3 a duplicate of g4
+            Gate* g0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "g0");
+            Gate* g1 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "g1");
+            Gate* g2 = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "g2");
+            Gate* g3 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "g3");
+            Gate* g4 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "g4");
+            Gate* g5 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "g5");
+
+            Net* n0 = nl->create_net("n0");
+            n0->add_destination(g0, "I0");
+            n0->add_destination(g4, "I0");
+            n0->add_destination(g5, "I0");
+            n0->mark_global_input_net();
+
+            Net* n1 = nl->create_net("n1");
+            n1->add_destination(g1, "I0");
+            n1->add_destination(g5, "I1");
+            n1->mark_global_input_net();
+
+            Net* n2 = nl->create_net("n2");
+            n2->add_destination(g3, "I1");
+            n2->add_destination(g4, "I1");
+            n2->mark_global_input_net();
+
+            vcc_net->add_destination(g0, "I1");
+            gnd_net->add_destination(g1, "I1");
+
+            test_utils::connect(nl.get(), g0, "O", g2, "I0");
+            test_utils::connect(nl.get(), g1, "O", g2, "I1");
+            test_utils::connect(nl.get(), g2, "O", g3, "I0");
+
+            Net* n3 = nl->create_net("n3");
+            n3->add_source(g3, "O");
+            n3->mark_global_output_net();
+
+            Net* n4 = nl->create_net("n4");
+            n4->add_source(g4, "O");
+            n4->mark_global_output_net();
+
+            // g5 drives nothing
+            Net* n5 = nl->create_net("n5");
+            n5->add_source(g5, "O");
+
+            // replacements recorded by an earlier run are carried over to the survivor, those of deleted gates are dropped
+            g4->set_data("preprocessing_information", "replaced_gates", "string", "[\"r4\"]");
+            g5->set_data("preprocessing_information", "replaced_gates", "string", "[\"r5\"]");
+
+            auto res = netlist_preprocessing::preprocess(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            const auto statistics = res.get();
+
+            EXPECT_EQ(statistics.at("propagate_constants").num_changes, 1);
+            EXPECT_EQ(statistics.at("remove_buffers").num_changes, 2);
+            EXPECT_EQ(statistics.at("remove_redundant_gates").num_changes, 1);
+            EXPECT_EQ(statistics.at("remove_unconnected_gates").num_changes, 2);
+            EXPECT_EQ(statistics.at("remove_unconnected_nets").num_changes, 1);
+
+            EXPECT_TRUE(nl->is_gate_in_netlist(gnd_gate));
+            EXPECT_TRUE(nl->is_gate_in_netlist(vcc_gate));
+            EXPECT_FALSE(nl->is_net_in_netlist(n5));
+
+            auto and2_gates = nl->get_gates([](const auto* g){ return g->get_type()->get_name() == "AND2"; });
+            ASSERT_EQ(and2_gates.size(), 1);
+            ASSERT_EQ(nl->get_gates().size(), 3);
+
+            // bypassing the buffers merges their output nets into n0, which may leave n0 under a different net
+            auto fan_in = and2_gates.front()->get_fan_in_nets();
+            ASSERT_EQ(fan_in.size(), 2);
+            EXPECT_TRUE(fan_in.at(0)->is_global_input_net());
+            EXPECT_TRUE(fan_in.at(1)->is_global_input_net());
+            EXPECT_NE(std::find(fan_in.begin(), fan_in.end(), n2), fan_in.end());
+            EXPECT_EQ(std::find(fan_in.begin(), fan_in.end(), n1), fan_in.end());
+
+            const std::string replaced_name = (and2_gates.front()->get_name() == "g3") ? "g4" : "g3";
+            const auto& [_, replaced_gates] = and2_gates.front()->get_data("preprocessing_information", "replaced_gates");
+            EXPECT_EQ(replaced_gates, "[\"r4\",\"" + replaced_name + "\"]");
+        }
+        TEST_END
+    }
+    /**
+     * Test the removal of nets that are functionally equivalent but implemented by different gates.
+     *
+     * Functions: remove_functionally_equivalent_nets
+     */
+    TEST_F(NetlistPreprocessingTest, check_remove_functionally_equivalent_nets)
+    {
+        TEST_START
+        {
+            if (!SMT::Solver::has_local_solver_for(SMT::SolverType::Z3, SMT::SolverCall::Binary))
+            {
+                GTEST_SKIP() << "no local Z3 binary";
+            }
+
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            Gate* gnd_gate = nl->create_gate(gl->get_gate_type_by_name("GND"), "gnd");
+            nl->mark_gnd_gate(gnd_gate);
+            Net* gnd_net = nl->create_net("gnd");
+            gnd_net->add_source(gnd_gate, "O");
+
+            std::vector<Net*> inputs;
+            for (u32 i = 0; i < 16; i++)
+            {
+                Net* in = nl->create_net("in_" + std::to_string(i));
+                in->mark_global_input_net();
+                inputs.push_back(in);
+            }
+
+            Net* clk = nl->create_net("clk");
+            clk->mark_global_input_net();
+            const auto create_ff = [&nl, gl, clk](const std::string& name, Net* d) {
+                Gate* ff = nl->create_gate(gl->get_gate_type_by_name("DFF"), name);
+                clk->add_destination(ff, "CLK");
+                d->add_destination(ff, "D");
+                return ff;
+            };
+
+            // AND2 and its De Morgan equivalent built from inverters and an OR2
+            Gate* and2 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and2");
+            inputs.at(0)->add_destination(and2, "I0");
+            inputs.at(2)->add_destination(and2, "I1");
+            Net* and_net = nl->create_net("and");
+            and_net->add_source(and2, "O");
+            create_ff("ff_0", and_net);
+
+            Gate* inv_0 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv_0");
+            Gate* inv_1 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv_1");
+            Gate* or2   = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or2");
+            Gate* inv_2 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv_2");
+            inputs.at(0)->add_destination(inv_0, "I");
+            inputs.at(2)->add_destination(inv_1, "I");
+            test_utils::connect(nl.get(), inv_0, "O", or2, "I0");
+            test_utils::connect(nl.get(), inv_1, "O", or2, "I1");
+            test_utils::connect(nl.get(), or2, "O", inv_2, "I");
+            Net* nand_net = nl->create_net("not_nand");
+            nand_net->add_source(inv_2, "O");
+            Gate* ff_1 = create_ff("ff_1", nand_net);
+
+            // a constant 0 that is not derived from the GND net
+            Gate* xor2 = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor2");
+            inputs.at(2)->add_destination(xor2, "I0");
+            inputs.at(2)->add_destination(xor2, "I1");
+            Net* xor_net = nl->create_net("xor");
+            xor_net->add_source(xor2, "O");
+            Gate* ff_2 = create_ff("ff_2", xor_net);
+
+            // a function of 16 inputs that is 0 for all but one assignment, which random simulation is unlikely to hit and the solver has to refute
+            std::vector<Net*> and4_nets;
+            for (u32 i = 0; i < 4; i++)
+            {
+                Gate* and4 = nl->create_gate(gl->get_gate_type_by_name("AND4"), "and4_" + std::to_string(i));
+                for (u32 j = 0; j < 4; j++)
+                {
+                    Net* in = inputs.at(4 * i + j);
+                    if (j % 2 == 1)
+                    {
+                        Gate* inv = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv_" + std::to_string(4 * i + j) + "_n");
+                        in->add_destination(inv, "I");
+                        in = nl->create_net(in->get_name() + "_n");
+                        in->add_source(inv, "O");
+                    }
+                    in->add_destination(and4, "I" + std::to_string(j));
+                }
+                Net* out = nl->create_net(and4->get_name());
+                out->add_source(and4, "O");
+                and4_nets.push_back(out);
+            }
+            Gate* and4_all = nl->create_gate(gl->get_gate_type_by_name("AND4"), "and4_all");
+            for (u32 j = 0; j < 4; j++)
+            {
+                and4_nets.at(j)->add_destination(and4_all, "I" + std::to_string(j));
+            }
+            Net* rare_net = nl->create_net("rare");
+            rare_net->add_source(and4_all, "O");
+            Gate* ff_3 = create_ff("ff_3", rare_net);
+
+            auto res = netlist_preprocessing::remove_functionally_equivalent_nets(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_EQ(res.get(), 2);
+
+            EXPECT_EQ(ff_1->get_fan_in_net("D"), and_net);
+            EXPECT_EQ(ff_2->get_fan_in_net("D"), gnd_net);
+            EXPECT_EQ(ff_3->get_fan_in_net("D"), rare_net);
+            EXPECT_EQ(and_net->get_num_of_destinations(), 2);
+
+            EXPECT_FALSE(nl->is_gate_in_netlist(inv_0));
+            EXPECT_FALSE(nl->is_gate_in_netlist(inv_1));
+            EXPECT_FALSE(nl->is_gate_in_netlist(or2));
+            EXPECT_FALSE(nl->is_gate_in_netlist(inv_2));
+            EXPECT_FALSE(nl->is_gate_in_netlist(xor2));
+            EXPECT_TRUE(nl->is_gate_in_netlist(and4_all));
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that repeated removals of functionally equivalent nets only rely on the current functions of the nets, even though the pass reuses solver sessions.
+     * The fan-in cones of all candidates have at most 16 inputs, so the results do not depend on whether a solver is available.
+     *
+     * Functions: remove_functionally_equivalent_nets
+     */
+    TEST_F(NetlistPreprocessingTest, check_remove_functionally_equivalent_nets_repeatedly)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            std::vector<Net*> inputs;
+            for (u32 i = 0; i < 16; i++)
+            {
+                Net* in = nl->create_net("in_" + std::to_string(i));
+                in->mark_global_input_net();
+                inputs.push_back(in);
+            }
+
+            Net* clk = nl->create_net("clk");
+            clk->mark_global_input_net();
+            const auto create_ff = [&nl, gl, clk](const std::string& name, Net* d) {
+                Gate* ff = nl->create_gate(gl->get_gate_type_by_name("DFF"), name);
+                clk->add_destination(ff, "CLK");
+                d->add_destination(ff, "D");
+                return ff;
+            };
+            const auto create_gate = [&nl, gl](const std::string& type, const std::string& name, const std::vector<Net*>& fan_in) {
+                Gate* gate = nl->create_gate(gl->get_gate_type_by_name(type), name);
+                for (u32 i = 0; i < fan_in.size(); i++)
+                {
+                    fan_in.at(i)->add_destination(gate, (fan_in.size() == 1) ? "I" : "I" + std::to_string(i));
+                }
+                return gate;
+            };
+
+            // two AND2 gates computing the same function
+            Gate* and_0 = create_gate("AND2", "and_0", {inputs.at(0), inputs.at(1)});
+            Net* x_net  = nl->create_net("x");
+            x_net->add_source(and_0, "O");
+            create_ff("ff_0", x_net);
+
+            Gate* and_1    = create_gate("AND2", "and_1", {inputs.at(1), inputs.at(0)});
+            Net* x_dup_net = nl->create_net("x_dup");
+            x_dup_net->add_source(and_1, "O");
+            Gate* ff_1 = create_ff("ff_1", x_dup_net);
+
+            auto res = netlist_preprocessing::remove_functionally_equivalent_nets(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_EQ(res.get(), 1);
+            EXPECT_EQ(ff_1->get_fan_in_net("D"), x_net);
+            EXPECT_FALSE(nl->is_gate_in_netlist(and_1));
+
+            // net x now computes an OR2, which must not be mixed up with the AND2 it computed before
+            ASSERT_TRUE(nl->delete_gate(and_0));
+            Gate* or_0 = create_gate("OR2", "or_0", {inputs.at(0), inputs.at(1)});
+            x_net->add_source(or_0, "O");
+
+            Gate* or_1 = create_gate("OR2", "or_1", {inputs.at(1), inputs.at(0)});
+            Net* y_net = nl->create_net("y");
+            y_net->add_source(or_1, "O");
+            Gate* ff_2 = create_ff("ff_2", y_net);
+
+            // a constant 1 and a function of 16 inputs that is 1 for all but one assignment
+            Gate* inv    = create_gate("INV", "inv", {inputs.at(2)});
+            Net* inv_net = nl->create_net("inv");
+            inv_net->add_source(inv, "O");
+            Gate* or_2   = create_gate("OR2", "or_2", {inputs.at(2), inv_net});
+            Net* one_net = nl->create_net("one");
+            one_net->add_source(or_2, "O");
+            Gate* ff_3 = create_ff("ff_3", one_net);
+
+            std::vector<Net*> and4_nets;
+            for (u32 i = 0; i < 4; i++)
+            {
+                std::vector<Net*> fan_in;
+                for (u32 j = 0; j < 4; j++)
+                {
+                    Net* in = inputs.at(4 * i + j);
+                    if (j % 2 == 1)
+                    {
+                        Gate* in_inv = create_gate("INV", in->get_name() + "_inv", {in});
+                        in           = nl->create_net(in->get_name() + "_n");
+                        in->add_source(in_inv, "O");
+                    }
+                    fan_in.push_back(in);
+                }
+                Gate* and4 = create_gate("AND4", "and4_" + std::to_string(i), fan_in);
+                Net* out   = nl->create_net(and4->get_name());
+                out->add_source(and4, "O");
+                and4_nets.push_back(out);
+            }
+            Gate* and4_all = create_gate("AND4", "and4_all", and4_nets);
+            Net* rare_net  = nl->create_net("rare");
+            rare_net->add_source(and4_all, "O");
+            Gate* rare_inv    = create_gate("INV", "rare_inv", {rare_net});
+            Net* not_rare_net = nl->create_net("not_rare");
+            not_rare_net->add_source(rare_inv, "O");
+            Gate* ff_4 = create_ff("ff_4", not_rare_net);
+
+            res = netlist_preprocessing::remove_functionally_equivalent_nets(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_EQ(res.get(), 1);
+            EXPECT_EQ(ff_2->get_fan_in_net("D"), x_net);
+            EXPECT_EQ(ff_3->get_fan_in_net("D"), one_net);
+            EXPECT_EQ(ff_4->get_fan_in_net("D"), not_rare_net);
+            EXPECT_FALSE(nl->is_gate_in_netlist(or_1));
+            EXPECT_TRUE(nl->is_gate_in_netlist(rare_inv));
+        }
+        TEST_END
+    }
 } // namespace hal
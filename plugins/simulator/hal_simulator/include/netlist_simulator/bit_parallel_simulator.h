@@ -0,0 +1,255 @@
+// MIT License
+// 
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/netlist/boolean_function/compiled_function.h"
+#include "hal_core/netlist/gate_library/enums/async_set_reset_behavior.h"
+#include "netlist_simulator_controller/simulation_engine.h"
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    class Gate;
+    class Net;
+    class WaveData;
+
+    /**
+     * HAL's built-in levelized, cycle-based simulation engine that runs many independent stimuli at once.
+     * 
+     * Every signal holds one bit per lane in a machine word, so that a combinational gate is evaluated once per point in time for 64 lanes at a time.
+     * All lanes receive the stimuli passed in through the controller, and a lane only differs from the others where `set_lane_input` assigns it a value of its own.
+     * Flip-flops capture their next state at the rising edge of the clock connected to their clock pin and have to be clocked by one of the clocks of the simulation input.
+     * Random access memories and combinational loops are not supported, and `Z` is treated as `X`.
+     */
+    class BitParallelSimulator : public SimulationEngineEventDriven
+    {
+        friend class BitParallelSimulatorFactory;
+
+    public:
+        using Lanes = CompiledBooleanFunction::Lanes;
+
+        /**
+         * The number of lanes held by a single machine word.
+         */
+        static constexpr u32 LANES_PER_WORD = 64;
+
+        /**
+         * Set the number of lanes to simulate, which is rounded up to a multiple of `LANES_PER_WORD`.
+         * Can also be set through the engine property `lanes`.
+         * This function can only be called before the simulation has started.
+         * 
+         * @param[in] lanes - The number of lanes.
+         */
+        void set_lane_count(u32 lanes);
+
+        /**
+         * Get the number of simulated lanes.
+         * 
+         * @returns The number of lanes.
+         */
+        u32 get_lane_count() const;
+
+        /**
+         * Configure the flip-flops matching the (optional) user-defined filter condition with initialization data specified within the netlist.
+         * This function can only be called before the simulation has started.
+         * 
+         * @param[in] filter - The optional filter to be applied before initialization.
+         */
+        void initialize_sequential_gates(const std::function<bool(const Gate*)>& filter = nullptr);
+
+        /**
+         * Configure the flip-flops matching the (optional) user-defined filter condition with the specified value in all lanes.
+         * This function can only be called before the simulation has started.
+         * 
+         * @param[in] value - The value to initialize the selected gates with.
+         * @param[in] filter - The optional filter to be applied before initialization.
+         */
+        void initialize_sequential_gates(BooleanFunction::Value value, const std::function<bool(const Gate*)>& filter = nullptr);
+
+        /**
+         * Initialize the simulation, i.e., levelize the combinational gates and compile all functions.
+         * No additional gates, clocks, or lanes can be added after this point.
+         * 
+         * @returns `true` on success, `false` if the engine property `lanes` is not a number or the simulation input contains unsupported gates or a combinational loop.
+         */
+        bool initialize();
+
+        /**
+         * Set the value of an input net in all lanes, starting from the current point in time.
+         * 
+         * @param[in] net - The input net.
+         * @param[in] value - The value to set.
+         */
+        void set_input(const Net* net, BooleanFunction::Value value);
+
+        /**
+         * Set the value of an input net in a single lane, starting from the current point in time.
+         * The value persists until the net is assigned another value, either by this function or by a stimulus of the controller.
+         * 
+         * @param[in] net - The input net.
+         * @param[in] lane - The lane.
+         * @param[in] value - The value to set.
+         */
+        void set_lane_input(const Net* net, u32 lane, BooleanFunction::Value value);
+
+        /**
+         * Simulate for a specific period, advancing the internal state.
+         * Automatically initializes the simulation if `initialize` has not yet been called.
+         * 
+         * @param[in] picoseconds - The duration to simulate.
+         * @returns `true` on success, `false` otherwise.
+         */
+        bool simulate(u64 picoseconds);
+
+        /**
+         * Get the current value of a net in a single lane.
+         * 
+         * @param[in] net - The net.
+         * @param[in] lane - The lane.
+         * @returns The value.
+         */
+        BooleanFunction::Value get_value(const Net* net, u32 lane) const;
+
+        /**
+         * Get the simulated events of a net in a single lane.
+         * 
+         * @param[in] net - The net.
+         * @param[in] lane - The lane.
+         * @returns The events ordered by time.
+         */
+        std::vector<WaveEvent> get_lane_events(const Net* net, u32 lane) const;
+
+        /**
+         * Create the waveform of a net in a single lane.
+         * The caller takes ownership of the waveform.
+         * 
+         * @param[in] net - The net.
+         * @param[in] lane - The lane.
+         * @returns The waveform, or a `nullptr` if the net was not simulated.
+         */
+        WaveData* get_lane_wave_data(const Net* net, u32 lane) const;
+
+        /**
+         * Get the simulated events of a net in the lane selected by the engine property `result_lane`, which defaults to lane 0.
+         * This is the lane the controller reads its results from.
+         *
+         * @param[in] netId - The ID of the net.
+         * @return The events ordered by time, or an empty vector if the engine property `result_lane` is not a number.
+         */
+        std::vector<WaveEvent> get_simulation_events(u32 netId) const override;
+
+        bool inputEvent(const SimulationInputNetEvent& netEv) override;
+
+    private:
+        /// The signal index that unconnected pins read from, it always holds `X`.
+        static constexpr u32 UNCONNECTED = 0;
+
+        /**
+         * A combinational gate, i.e., the signals of its input pins in slot order and one compiled function per output signal.
+         */
+        struct CombinationalGate
+        {
+            std::vector<u32> inputs;
+            std::vector<u32> outputs;
+            std::vector<CompiledBooleanFunction> functions;
+        };
+
+        /**
+         * A flip-flop, i.e., its compiled functions, its clock, and the signals of its pins.
+         */
+        struct FlipFlop
+        {
+            const Gate* gate;
+            std::vector<u32> inputs;
+            std::vector<u32> state_outputs;
+            std::vector<u32> inverted_state_outputs;
+            CompiledBooleanFunction clock;
+            CompiledBooleanFunction next_state;
+            CompiledBooleanFunction preset;
+            CompiledBooleanFunction clear;
+            AsyncSetResetBehavior sr_behavior_out;
+            AsyncSetResetBehavior sr_behavior_out_inverted;
+        };
+
+        /**
+         * The recorded values of a signal, holding one entry of `m_words` words for every point in time at which any of its lanes changed.
+         */
+        struct Trace
+        {
+            std::vector<u64> times;
+            std::vector<Lanes> values;
+        };
+
+        bool m_is_initialized = false;
+        std::vector<std::tuple<bool, BooleanFunction::Value, const std::function<bool(const Gate*)>>> m_init_seq_gates;
+
+        u32 m_words        = 1;
+        u64 m_current_time = 0;
+
+        std::vector<const Net*> m_signal_nets;
+        std::unordered_map<const Net*, u32> m_signal_index;
+        std::unordered_map<u32, u32> m_signal_by_net_id;
+        std::vector<Lanes> m_values;
+        std::vector<Trace> m_traces;
+
+        std::vector<CombinationalGate> m_combinational_gates;
+        std::vector<FlipFlop> m_flip_flops;
+        std::vector<Lanes> m_ff_state;
+        std::vector<Lanes> m_ff_inverted_state;
+        std::vector<Lanes> m_ff_clock;
+        std::vector<Lanes> m_slots;
+
+        BitParallelSimulator(const std::string& nam);
+
+        u32 get_or_create_signal(const Net* net);
+        Lanes& at(u32 signal, u32 word);
+        const Lanes& at(u32 signal, u32 word) const;
+        const Lanes* gather(const std::vector<u32>& signals, u32 word);
+
+        void evaluate_combinational();
+        bool apply_async_set_reset();
+        bool clock_flip_flops();
+        void update_flip_flop_outputs(u32 ff);
+        bool step(u64 time);
+        void record(u64 time);
+    };
+
+    /**
+     * Creates instances of HAL's built-in bit-parallel simulation engine.
+     */
+    class BitParallelSimulatorFactory : public SimulationEngineFactory
+    {
+    public:
+        BitParallelSimulatorFactory() : SimulationEngineFactory("hal_simulator_bit_parallel")
+        {
+            ;
+        }
+        SimulationEngine* createEngine() const override;
+    };
+}    // namespace hal
@@ -0,0 +1,150 @@
+// MIT License
+// 
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "netlist_simulator_controller/wave_event.h"
+
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    class Net;
+
+    /**
+     * The event queue of HAL's built-in event-driven simulation engine, organized as a timing wheel.
+     * 
+     * Events within `WHEEL_SIZE` picoseconds of the current point in time are appended to the bucket of their point in time, which makes scheduling and retrieving them constant time.
+     * Events further ahead, e.g., the clock edges of a long simulation, are kept in an overflow heap and are moved to the wheel once their point in time comes into range.
+     * The buckets keep their memory across points in time, so that the simulation does not allocate once it reached a steady state.
+     * 
+     * Events are deduplicated per net: an event replaces one pending for the same net and point in time, and an event that does not change the value a net was last assigned is dropped.
+     */
+    class EventWheel
+    {
+    public:
+        /**
+         * The number of consecutive points in time held by the wheel.
+         */
+        static constexpr u64 WHEEL_SIZE = 4096;
+
+        /**
+         * Schedule an event.
+         * Events scheduled before the current point in time of the wheel are scheduled for the current point in time instead.
+         * 
+         * @param[in] net - The net affected by the event.
+         * @param[in] time - The point in time of the event.
+         * @param[in] value - The new value of the net.
+         */
+        void schedule(const Net* net, u64 time, BooleanFunction::Value value);
+
+        /**
+         * Check whether no events are pending.
+         * 
+         * @returns `true` if no events are pending, `false` otherwise.
+         */
+        bool empty() const;
+
+        /**
+         * Get the number of pending events.
+         * 
+         * @returns The number of pending events.
+         */
+        u64 size() const;
+
+        /**
+         * Get the earliest point in time that an event is pending for.
+         * Must not be called on an empty wheel.
+         * 
+         * @returns The point in time.
+         */
+        u64 get_next_time() const;
+
+        /**
+         * Remove all events pending for the given point in time and advance the wheel to it.
+         * Events scheduled for the same point in time afterwards are returned by the next call.
+         * 
+         * @param[in] time - The point in time, which must not precede any pending event.
+         * @param[out] events - The removed events in the order they were scheduled in.
+         */
+        void take(u64 time, std::vector<WaveEvent>& events);
+
+        /**
+         * Forget the value each net was last assigned, so that the next event of a net is never dropped.
+         * Required whenever the recorded values of the nets are replaced.
+         */
+        void forget_values();
+
+        /**
+         * Remove all pending events and reset the wheel to point in time 0.
+         */
+        void clear();
+
+    private:
+        static constexpr u64 WORD_BITS = 64;
+
+        /**
+         * The scheduling state of a single net.
+         */
+        struct NetState
+        {
+            BooleanFunction::Value last_value = BooleanFunction::Value::X;
+            bool has_last_value               = false;
+            u32 pending                       = 0;
+            bool has_marker                   = false;
+            u64 marker_time                   = 0;
+            u32 marker_index                  = 0;
+        };
+
+        /**
+         * An event in the overflow heap, ordered by time and then by the order of scheduling.
+         */
+        struct FarEvent
+        {
+            u64 time;
+            u64 id;
+            const Net* net;
+            BooleanFunction::Value value;
+
+            bool operator>(const FarEvent& other) const
+            {
+                return time != other.time ? time > other.time : id > other.id;
+            }
+        };
+
+        u64 m_base_time = 0;
+        u64 m_size      = 0;
+        u64 m_id_counter = 0;
+
+        std::vector<std::vector<WaveEvent>> m_buckets = std::vector<std::vector<WaveEvent>>(WHEEL_SIZE);
+        std::vector<u64> m_occupied                   = std::vector<u64>(WHEEL_SIZE / WORD_BITS, 0);
+        std::priority_queue<FarEvent, std::vector<FarEvent>, std::greater<FarEvent>> m_overflow;
+        std::unordered_map<const Net*, NetState> m_nets;
+
+        void insert(NetState& state, const Net* net, u64 time, u64 id, BooleanFunction::Value value);
+    };
+}    // namespace hal
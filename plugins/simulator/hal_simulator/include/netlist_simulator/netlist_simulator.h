@@ -25,14 +25,17 @@
 
 #pragma once
 
+#include "hal_core/netlist/boolean_function/compiled_function.h"
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/gate_library/enums/async_set_reset_behavior.h"
 #include "hal_core/netlist/gate_library/gate_type.h"
 #include "hal_core/netlist/net.h"
+#include "netlist_simulator/event_wheel.h"
 #include "netlist_simulator/simulation.h"
 #include "netlist_simulator_controller/simulation_engine.h"
 
 #include <map>
+#include <optional>
 #include <unordered_set>
 
 namespace hal
@@ -179,20 +182,36 @@ namespace hal
     private:
         friend class NetlistSimulatorPlugin;
 
+        /**
+         * A Boolean function of a simulated gate, compiled against the input pins of the gate whenever possible.
+         */
+        struct SimulationFunction
+        {
+            BooleanFunction function;
+            std::optional<CompiledBooleanFunction> compiled;
+        };
+
         /**
          * The simulation state of a single gate, i.e., its input pins and the nets connected to them.
+         * The input values are held in slots in the order of the input pins, the values by pin name are only maintained for gates that cannot be simulated on the slots alone.
          */
         struct SimulationGate
         {
             const Gate* m_gate;
             std::vector<GatePin*> m_input_pins;
             std::vector<const Net*> m_input_nets;
+            std::vector<BooleanFunction::Value> m_input_slots;
             std::unordered_map<std::string, BooleanFunction::Value> m_input_values;
+            bool m_uses_named_inputs = false;
 
             SimulationGate(const Gate* gate);
             virtual ~SimulationGate() = default;
 
-            virtual bool simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) = 0;
+            void set_input(u32 index, BooleanFunction::Value value);
+            SimulationFunction compile_function(BooleanFunction&& function);
+            BooleanFunction::Value evaluate(const SimulationFunction& function) const;
+
+            virtual bool simulate(const Simulation& simulation, const WaveEvent& event, EventWheel& new_events) = 0;
         };
 
         /**
@@ -202,11 +221,11 @@ namespace hal
         {
             std::vector<GatePin*> m_output_pins;
             std::vector<const Net*> m_output_nets;
-            std::unordered_map<const Net*, BooleanFunction> m_functions;
+            std::vector<SimulationFunction> m_functions;
 
             SimulationGateCombinational(const Gate* gate);
 
-            bool simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) override;
+            bool simulate(const Simulation& simulation, const WaveEvent& event, EventWheel& new_events) override;
         };
 
         /**
@@ -216,9 +235,9 @@ namespace hal
         {
             SimulationGateSequential(const Gate* gate);
 
-            virtual void initialize(std::map<const Net*, BooleanFunction::Value>& new_events, bool from_netlist, BooleanFunction::Value value)                    = 0;
-            virtual bool simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) = 0;
-            virtual void clock(const u64 current_time, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)                                  = 0;
+            virtual void initialize(std::map<const Net*, BooleanFunction::Value>& new_events, bool from_netlist, BooleanFunction::Value value) = 0;
+            virtual bool simulate(const Simulation& simulation, const WaveEvent& event, EventWheel& new_events)                                = 0;
+            virtual void clock(const u64 current_time, EventWheel& new_events)                                                                 = 0;
         };
 
         /**
@@ -226,10 +245,10 @@ namespace hal
          */
         struct SimulationGateFF : public SimulationGateSequential
         {
-            BooleanFunction m_clock_func;
-            BooleanFunction m_clear_func;
-            BooleanFunction m_preset_func;
-            BooleanFunction m_next_state_func;
+            SimulationFunction m_clock_func;
+            SimulationFunction m_clear_func;
+            SimulationFunction m_preset_func;
+            SimulationFunction m_next_state_func;
             std::vector<const Net*> m_state_output_nets;
             std::vector<const Net*> m_state_inverted_output_nets;
             std::vector<const Net*> m_clock_nets;
@@ -241,8 +260,8 @@ namespace hal
             SimulationGateFF(const Gate* gate);
 
             void initialize(std::map<const Net*, BooleanFunction::Value>& new_events, bool from_netlist, BooleanFunction::Value value) override;
-            bool simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) override;
-            void clock(const u64 current_time, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) override;
+            bool simulate(const Simulation& simulation, const WaveEvent& event, EventWheel& new_events) override;
+            void clock(const u64 current_time, EventWheel& new_events) override;
         };
 
         /**
@@ -273,20 +292,20 @@ namespace hal
             SimulationGateRAM(const Gate* gate);
 
             void initialize(std::map<const Net*, BooleanFunction::Value>& new_events, bool from_netlist, BooleanFunction::Value value) override;
-            bool simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) override;
-            void clock(const u64 current_time, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) override;
+            bool simulate(const Simulation& simulation, const WaveEvent& event, EventWheel& new_events) override;
+            void clock(const u64 current_time, EventWheel& new_events) override;
         };
 
         bool m_is_initialized = false;
         std::vector<std::tuple<bool, BooleanFunction::Value, const std::function<bool(const Gate*)>>> m_init_seq_gates;
 
         u64 m_current_time = 0;
-        std::vector<WaveEvent> m_event_queue;
+        EventWheel m_event_queue;
+        std::vector<WaveEvent> m_event_batch;
         Simulation m_simulation;
         u64 m_timeout_iterations = 10000000ul;
-        u64 m_id_counter         = 0;
 
-        std::unordered_map<const Net*, std::vector<std::pair<SimulationGate*, std::vector<const GatePin*>>>> m_successors;
+        std::unordered_map<const Net*, std::vector<std::pair<SimulationGate*, std::vector<u32>>>> m_successors;
         std::vector<std::unique_ptr<SimulationGate>> m_sim_gates;
         std::vector<SimulationGate*> m_sim_gates_raw;
 
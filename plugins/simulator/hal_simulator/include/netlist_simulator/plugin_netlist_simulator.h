@@ -33,11 +33,12 @@
 namespace hal
 {
     /**
-     * The plugin that provides HAL's built-in simulation engine.
+     * The plugin that provides HAL's built-in simulation engines.
      */
     class PLUGIN_API NetlistSimulatorPlugin : public BasePluginInterface
     {
         static std::string s_engine_name;
+        static std::string s_bit_parallel_engine_name;
 
     public:
         /**
@@ -1,5 +1,6 @@
 #include "hal_core/python_bindings/python_bindings.h"
 
+#include "netlist_simulator/bit_parallel_simulator.h"
 #include "netlist_simulator/netlist_simulator.h"
 #include "netlist_simulator/plugin_netlist_simulator.h"
 #include "pybind11/operators.h"
@@ -191,6 +192,93 @@ namespace hal
                 :rtype: bool
             )");
 
+        py::class_<BitParallelSimulator, RawPtrWrapper<BitParallelSimulator>, SimulationEngine>(m, "BitParallelSimulator", R"(
+                HAL's built-in levelized, cycle-based simulation engine that simulates many independent stimuli at once, one per lane.
+            )")
+            .def("set_lane_count", &BitParallelSimulator::set_lane_count, py::arg("lanes"), R"(
+                Set the number of lanes to simulate, which is rounded up to a multiple of 64.
+                Can also be set through the engine property 'lanes'.
+                This function can only be called before the simulation has started.
+
+                :param int lanes: The number of lanes.
+            )")
+
+            .def("get_lane_count", &BitParallelSimulator::get_lane_count, R"(
+                Get the number of simulated lanes.
+
+                :returns: The number of lanes.
+                :rtype: int
+            )")
+
+            .def("initialize_sequential_gates", py::overload_cast<const std::function<bool(const Gate*)>&>(&BitParallelSimulator::initialize_sequential_gates), py::arg("filter") = nullptr, R"(
+                Configure the flip-flops matching the (optional) user-defined filter condition with initialization data specified within the netlist.
+                This function can only be called before the simulation has started.
+
+                :param lambda filter: The optional filter to be applied before initialization.
+            )")
+
+            .def("initialize_sequential_gates",
+                 py::overload_cast<BooleanFunction::Value, const std::function<bool(const Gate*)>&>(&BitParallelSimulator::initialize_sequential_gates),
+                 py::arg("value"),
+                 py::arg("filter") = nullptr,
+                 R"(
+                Configure the flip-flops matching the (optional) user-defined filter condition with the specified value in all lanes.
+                This function can only be called before the simulation has started.
+
+                :param hal_py.BooleanFunction.Value value: The value to initialize the selected gates with.
+                :param lambda filter: The optional filter to be applied before initialization.
+            )")
+
+            .def("initialize", &BitParallelSimulator::initialize, R"(
+                Initialize the simulation, i.e., levelize the combinational gates and compile all functions.
+                No additional gates, clocks, or lanes can be added after this point.
+
+                :returns: ``True`` on success, ``False`` if the simulation input contains unsupported gates or a combinational loop.
+                :rtype: bool
+            )")
+
+            .def("set_input", &BitParallelSimulator::set_input, py::arg("net"), py::arg("value"), R"(
+                Set the value of an input net in all lanes, starting from the current point in time.
+
+                :param hal_py.Net net: The input net.
+                :param hal_py.BooleanFunction.Value value: The value to set.
+            )")
+
+            .def("set_lane_input", &BitParallelSimulator::set_lane_input, py::arg("net"), py::arg("lane"), py::arg("value"), R"(
+                Set the value of an input net in a single lane, starting from the current point in time.
+
+                :param hal_py.Net net: The input net.
+                :param int lane: The lane.
+                :param hal_py.BooleanFunction.Value value: The value to set.
+            )")
+
+            .def("simulate", &BitParallelSimulator::simulate, py::arg("picoseconds"), R"(
+                Simulate for a specific period, advancing the internal state.
+                Automatically initializes the simulation if 'initialize' has not yet been called.
+
+                :param int picoseconds: The duration to simulate.
+                :returns: ``True`` on success, ``False`` otherwise.
+                :rtype: bool
+            )")
+
+            .def("get_value", &BitParallelSimulator::get_value, py::arg("net"), py::arg("lane"), R"(
+                Get the current value of a net in a single lane.
+
+                :param hal_py.Net net: The net.
+                :param int lane: The lane.
+                :returns: The value.
+                :rtype: hal_py.BooleanFunction.Value
+            )")
+
+            .def("get_lane_events", &BitParallelSimulator::get_lane_events, py::arg("net"), py::arg("lane"), R"(
+                Get the simulated events of a net in a single lane.
+
+                :param hal_py.Net net: The net.
+                :param int lane: The lane.
+                :returns: The events ordered by time.
+                :rtype: list[netlist_simulator_controller.WaveEvent]
+            )");
+
         py::class_<Simulation>(m, "Simulation")
             .def(py::init<>())
 
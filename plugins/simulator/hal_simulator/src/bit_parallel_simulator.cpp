@@ -0,0 +1,800 @@
+#include "netlist_simulator/bit_parallel_simulator.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/utils.h"
+#include "netlist_simulator_controller/wave_data.h"
+
+#include <algorithm>
+#include <queue>
+
+namespace hal
+{
+    namespace
+    {
+        using Lanes = CompiledBooleanFunction::Lanes;
+
+        /**
+         * Replaces the lanes selected by the mask with the given values.
+         */
+        void assign_masked(Lanes& target, const Lanes& source, u64 mask)
+        {
+            target.value = (target.value & ~mask) | (source.value & mask);
+            target.known = (target.known & ~mask) | (source.known & mask);
+        }
+
+        Lanes invert(const Lanes& l)
+        {
+            return {l.known & ~l.value, l.known};
+        }
+
+        /**
+         * Applies the behavior of a flip-flop whose asynchronous set and reset are both active to the previous value of one of its outputs.
+         */
+        Lanes process_clear_preset_behavior(AsyncSetResetBehavior behavior, const Lanes& previous_output)
+        {
+            switch (behavior)
+            {
+                case AsyncSetResetBehavior::N:
+                    return previous_output;
+                case AsyncSetResetBehavior::L:
+                    return Lanes::broadcast(BooleanFunction::Value::ZERO);
+                case AsyncSetResetBehavior::H:
+                    return Lanes::broadcast(BooleanFunction::Value::ONE);
+                case AsyncSetResetBehavior::T:
+                    return invert(previous_output);
+                default:
+                    return Lanes::broadcast(BooleanFunction::Value::X);
+            }
+        }
+
+        /// The maximum number of times asynchronous set and reset may change a flip-flop before the values of a point in time have settled.
+        constexpr u32 MAX_SETTLE_ITERATIONS = 1000;
+    }    // namespace
+
+    BitParallelSimulator::BitParallelSimulator(const std::string& nam) : SimulationEngineEventDriven(nam)
+    {
+        ;
+    }
+
+    void BitParallelSimulator::set_lane_count(u32 lanes)
+    {
+        if (m_is_initialized)
+        {
+            log_error("hal_simulator", "cannot change the number of lanes after the simulation was started.");
+            return;
+        }
+        m_words = std::max<u32>(1, (lanes + LANES_PER_WORD - 1) / LANES_PER_WORD);
+    }
+
+    u32 BitParallelSimulator::get_lane_count() const
+    {
+        return m_words * LANES_PER_WORD;
+    }
+
+    void BitParallelSimulator::initialize_sequential_gates(const std::function<bool(const Gate*)>& filter)
+    {
+        if (m_is_initialized)
+        {
+            log_error("hal_simulator", "cannot initialize sequential gates after the simulation was started.");
+            return;
+        }
+        m_init_seq_gates.push_back(std::make_tuple(true, BooleanFunction::Value::X, filter));
+    }
+
+    void BitParallelSimulator::initialize_sequential_gates(BooleanFunction::Value value, const std::function<bool(const Gate*)>& filter)
+    {
+        if (m_is_initialized)
+        {
+            log_error("hal_simulator", "cannot initialize sequential gates after the simulation was started.");
+            return;
+        }
+        m_init_seq_gates.push_back(std::make_tuple(false, value, filter));
+    }
+
+    u32 BitParallelSimulator::get_or_create_signal(const Net* net)
+    {
+        if (net == nullptr)
+        {
+            return UNCONNECTED;
+        }
+        if (auto it = m_signal_index.find(net); it != m_signal_index.end())
+        {
+            return it->second;
+        }
+        const u32 signal = m_signal_nets.size();
+        m_signal_nets.push_back(net);
+        m_signal_index.emplace(net, signal);
+        m_signal_by_net_id.emplace(net->get_id(), signal);
+        return signal;
+    }
+
+    BitParallelSimulator::Lanes& BitParallelSimulator::at(u32 signal, u32 word)
+    {
+        return m_values[word * m_signal_nets.size() + signal];
+    }
+
+    const BitParallelSimulator::Lanes& BitParallelSimulator::at(u32 signal, u32 word) const
+    {
+        return m_values[word * m_signal_nets.size() + signal];
+    }
+
+    const BitParallelSimulator::Lanes* BitParallelSimulator::gather(const std::vector<u32>& signals, u32 word)
+    {
+        m_slots.resize(std::max(m_slots.size(), signals.size()));
+        for (u32 i = 0; i < signals.size(); i++)
+        {
+            m_slots[i] = at(signals[i], word);
+        }
+        return m_slots.data();
+    }
+
+    bool BitParallelSimulator::initialize()
+    {
+        if (m_is_initialized)
+        {
+            return true;
+        }
+
+        if (mSimulationInput == nullptr)
+        {
+            log_error("hal_simulator", "no simulation input has been provided.");
+            return false;
+        }
+
+        if (const std::string lanes = get_engine_property("lanes"); !lanes.empty())
+        {
+            const auto lanes_res = utils::wrapped_stoul(lanes);
+            if (lanes_res.is_error())
+            {
+                log_error("hal_simulator", "invalid number of lanes '{}':\n{}", lanes, lanes_res.get_error().get());
+                return false;
+            }
+            set_lane_count(lanes_res.get());
+        }
+
+        m_signal_nets.assign(1, nullptr);
+        m_signal_index.clear();
+        m_signal_by_net_id.clear();
+        m_combinational_gates.clear();
+        m_flip_flops.clear();
+
+        // gates that drive a signal within the same point in time, i.e., the combinational ones, in the order of the simulation input for now
+        std::vector<CombinationalGate> unordered_gates;
+
+        for (const Gate* gate : mSimulationInput->get_gates())
+        {
+            const GateType* gate_type = gate->get_type();
+
+            std::vector<u32> inputs;
+            std::vector<std::string> slots;
+            for (const GatePin* pin : gate_type->get_input_pins())
+            {
+                inputs.push_back(get_or_create_signal(gate->get_fan_in_net(pin)));
+                slots.push_back(pin->get_name());
+            }
+
+            if (gate->is_gnd_gate() || gate->is_vcc_gate())
+            {
+                // global constants are combinational gates without inputs, so that they are assigned with the first level
+                CombinationalGate constant;
+                const BooleanFunction value = BooleanFunction::Const(gate->is_vcc_gate() ? 1 : 0, 1);
+                for (const Net* net : gate->get_fan_out_nets())
+                {
+                    constant.outputs.push_back(get_or_create_signal(net));
+                    constant.functions.push_back(CompiledBooleanFunction::compile(value, {}).get());
+                }
+                unordered_gates.push_back(std::move(constant));
+            }
+            else if (gate_type->has_property(GateTypeProperty::ff))
+            {
+                const FFComponent* ff_component = gate_type->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); });
+                if (ff_component == nullptr)
+                {
+                    log_error("hal_simulator", "flip-flop '{}' with ID {} of type '{}' has no flip-flop component.", gate->get_name(), gate->get_id(), gate_type->get_name());
+                    return false;
+                }
+
+                FlipFlop ff;
+                ff.gate   = gate;
+                ff.inputs = inputs;
+
+                auto clock      = CompiledBooleanFunction::compile(ff_component->get_clock_function(), slots);
+                auto next_state = CompiledBooleanFunction::compile(ff_component->get_next_state_function(), slots);
+                auto preset     = CompiledBooleanFunction::compile(ff_component->get_async_set_function(), slots);
+                auto clear      = CompiledBooleanFunction::compile(ff_component->get_async_reset_function(), slots);
+                for (const auto* res : {&clock, &next_state, &preset, &clear})
+                {
+                    if (res->is_error())
+                    {
+                        log_error("hal_simulator",
+                                  "cannot simulate flip-flop '{}' with ID {} of type '{}' bit-parallel:\n{}",
+                                  gate->get_name(),
+                                  gate->get_id(),
+                                  gate_type->get_name(),
+                                  res->get_error().get());
+                        return false;
+                    }
+                }
+                ff.clock      = clock.get();
+                ff.next_state = next_state.get();
+                ff.preset     = preset.get();
+                ff.clear      = clear.get();
+
+                for (const GatePin* pin : gate_type->get_output_pins())
+                {
+                    const Net* net = gate->get_fan_out_net(pin);
+                    if (net == nullptr)
+                    {
+                        continue;
+                    }
+                    if (pin->get_type() == PinType::state)
+                    {
+                        ff.state_outputs.push_back(get_or_create_signal(net));
+                    }
+                    else if (pin->get_type() == PinType::neg_state)
+                    {
+                        ff.inverted_state_outputs.push_back(get_or_create_signal(net));
+                    }
+                }
+
+                const auto behavior         = ff_component->get_async_set_reset_behavior();
+                ff.sr_behavior_out          = behavior.first;
+                ff.sr_behavior_out_inverted = behavior.second;
+
+                m_flip_flops.push_back(std::move(ff));
+            }
+            else if (gate_type->has_property(GateTypeProperty::combinational))
+            {
+                CombinationalGate comb;
+                comb.inputs = inputs;
+
+                std::unordered_map<std::string, BooleanFunction> functions = gate->get_boolean_functions();
+                const std::vector<GatePin*> output_pins                    = gate_type->get_output_pins();
+                for (const GatePin* pin : output_pins)
+                {
+                    const Net* net = gate->get_fan_out_net(pin);
+                    if (net == nullptr)
+                    {
+                        continue;
+                    }
+
+                    // resolve recursion within output functions
+                    BooleanFunction func = functions.at(pin->get_name());
+                    while (true)
+                    {
+                        auto vars = func.get_variable_names();
+                        bool exit = true;
+                        for (const GatePin* other_pin : output_pins)
+                        {
+                            if (const std::string& other_pin_name = other_pin->get_name(); vars.find(other_pin_name) != vars.end())
+                            {
+                                func = func.substitute(other_pin_name, functions.at(other_pin_name)).get();
+                                exit = false;
+                            }
+                        }
+                        if (exit)
+                        {
+                            break;
+                        }
+                    }
+
+                    auto compiled = CompiledBooleanFunction::compile(func, slots);
+                    if (compiled.is_error())
+                    {
+                        log_error("hal_simulator",
+                                  "cannot simulate gate '{}' with ID {} of type '{}' bit-parallel:\n{}",
+                                  gate->get_name(),
+                                  gate->get_id(),
+                                  gate_type->get_name(),
+                                  compiled.get_error().get());
+                        return false;
+                    }
+                    comb.outputs.push_back(get_or_create_signal(net));
+                    comb.functions.push_back(compiled.get());
+                }
+                unordered_gates.push_back(std::move(comb));
+            }
+            else
+            {
+                log_error("hal_simulator", "no support for gate type {} of gate {} in bit-parallel simulation.", gate_type->get_name(), gate->get_name());
+                return false;
+            }
+        }
+
+        for (const Net* net : mSimulationInput->get_input_nets())
+        {
+            get_or_create_signal(net);
+        }
+        for (const SimulationInput::Clock& c : mSimulationInput->get_clocks())
+        {
+            get_or_create_signal(c.clock_net);
+        }
+
+        // levelize the combinational gates, a gate is evaluated once all gates driving one of its inputs have been evaluated
+        {
+            std::vector<i32> driver(m_signal_nets.size(), -1);
+            for (u32 i = 0; i < unordered_gates.size(); i++)
+            {
+                for (u32 signal : unordered_gates[i].outputs)
+                {
+                    driver[signal] = i;
+                }
+            }
+
+            std::vector<u32> pending(unordered_gates.size(), 0);
+            std::vector<std::vector<u32>> successors(unordered_gates.size());
+            for (u32 i = 0; i < unordered_gates.size(); i++)
+            {
+                for (u32 signal : unordered_gates[i].inputs)
+                {
+                    if (const i32 d = driver[signal]; d >= 0)
+                    {
+                        successors[d].push_back(i);
+                        pending[i]++;
+                    }
+                }
+            }
+
+            std::queue<u32> ready;
+            for (u32 i = 0; i < unordered_gates.size(); i++)
+            {
+                if (pending[i] == 0)
+                {
+                    ready.push(i);
+                }
+            }
+
+            m_combinational_gates.reserve(unordered_gates.size());
+            while (!ready.empty())
+            {
+                const u32 i = ready.front();
+                ready.pop();
+                for (u32 succ : successors[i])
+                {
+                    if (--pending[succ] == 0)
+                    {
+                        ready.push(succ);
+                    }
+                }
+                m_combinational_gates.push_back(std::move(unordered_gates[i]));
+            }
+
+            if (m_combinational_gates.size() != unordered_gates.size())
+            {
+                log_error("hal_simulator", "cannot simulate bit-parallel, the simulated gates contain a combinational loop.");
+                m_combinational_gates.clear();
+                m_flip_flops.clear();
+                return false;
+            }
+        }
+
+        m_values.assign(m_signal_nets.size() * m_words, Lanes());
+        m_traces.assign(m_signal_nets.size(), Trace());
+        m_ff_state.assign(m_flip_flops.size() * m_words, Lanes());
+        m_ff_inverted_state.assign(m_flip_flops.size() * m_words, Lanes());
+        m_ff_clock.assign(m_flip_flops.size() * m_words, Lanes());
+
+        // apply the initial values of the flip-flops
+        for (u32 i = 0; i < m_flip_flops.size(); i++)
+        {
+            const Gate* gate = m_flip_flops[i].gate;
+            for (const auto& [from_netlist, init_value, filter] : m_init_seq_gates)
+            {
+                if (filter && !filter(gate))
+                {
+                    continue;
+                }
+
+                BooleanFunction::Value value = init_value;
+                if (from_netlist)
+                {
+                    const InitComponent* init_component = gate->get_type()->get_component_as<InitComponent>([](const GateTypeComponent* c) { return InitComponent::is_class_of(c); });
+                    if (init_component == nullptr)
+                    {
+                        log_error("hal_simulator", "cannot find initialization data for flip-flop '{}' with ID {} of type '{}'.", gate->get_name(), gate->get_id(), gate->get_type()->get_name());
+                        continue;
+                    }
+                    const std::string& init_str = std::get<1>(gate->get_data(init_component->get_init_category(), init_component->get_init_identifiers().front()));
+                    if (init_str.empty())
+                    {
+                        continue;
+                    }
+                    value = (init_str == "1") ? BooleanFunction::Value::ONE : ((init_str == "0") ? BooleanFunction::Value::ZERO : BooleanFunction::Value::X);
+                }
+
+                for (u32 w = 0; w < m_words; w++)
+                {
+                    m_ff_state[i * m_words + w]          = Lanes::broadcast(value);
+                    m_ff_inverted_state[i * m_words + w] = invert(Lanes::broadcast(value));
+                }
+            }
+            update_flip_flop_outputs(i);
+        }
+
+        m_current_time   = 0;
+        m_is_initialized = true;
+        return true;
+    }
+
+    void BitParallelSimulator::set_input(const Net* net, BooleanFunction::Value value)
+    {
+        if (!m_is_initialized && !initialize())
+        {
+            return;
+        }
+
+        if (auto it = m_signal_index.find(net); it != m_signal_index.end())
+        {
+            for (u32 w = 0; w < m_words; w++)
+            {
+                at(it->second, w) = Lanes::broadcast(value);
+            }
+        }
+        else
+        {
+            log_error("hal_simulator", "net '{}' with ID {} is not part of the simulation.", net->get_name(), net->get_id());
+        }
+    }
+
+    void BitParallelSimulator::set_lane_input(const Net* net, u32 lane, BooleanFunction::Value value)
+    {
+        if (!m_is_initialized && !initialize())
+        {
+            return;
+        }
+
+        if (lane >= get_lane_count())
+        {
+            log_error("hal_simulator", "lane {} exceeds the number of simulated lanes {}.", lane, get_lane_count());
+            return;
+        }
+
+        if (auto it = m_signal_index.find(net); it != m_signal_index.end())
+        {
+            at(it->second, lane / LANES_PER_WORD).set(lane % LANES_PER_WORD, value);
+        }
+        else
+        {
+            log_error("hal_simulator", "net '{}' with ID {} is not part of the simulation.", net->get_name(), net->get_id());
+        }
+    }
+
+    void BitParallelSimulator::evaluate_combinational()
+    {
+        for (u32 w = 0; w < m_words; w++)
+        {
+            for (const CombinationalGate& gate : m_combinational_gates)
+            {
+                const Lanes* slots = gather(gate.inputs, w);
+                for (u32 i = 0; i < gate.outputs.size(); i++)
+                {
+                    at(gate.outputs[i], w) = gate.functions[i].evaluate(slots);
+                }
+            }
+        }
+    }
+
+    void BitParallelSimulator::update_flip_flop_outputs(u32 ff)
+    {
+        for (u32 w = 0; w < m_words; w++)
+        {
+            for (u32 signal : m_flip_flops[ff].state_outputs)
+            {
+                at(signal, w) = m_ff_state[ff * m_words + w];
+            }
+            for (u32 signal : m_flip_flops[ff].inverted_state_outputs)
+            {
+                at(signal, w) = m_ff_inverted_state[ff * m_words + w];
+            }
+        }
+    }
+
+    bool BitParallelSimulator::apply_async_set_reset()
+    {
+        bool changed = false;
+        for (u32 i = 0; i < m_flip_flops.size(); i++)
+        {
+            const FlipFlop& ff = m_flip_flops[i];
+            bool ff_changed    = false;
+            for (u32 w = 0; w < m_words; w++)
+            {
+                const Lanes* slots = gather(ff.inputs, w);
+                const u64 set      = ff.preset.evaluate(slots).value;
+                const u64 reset    = ff.clear.evaluate(slots).value;
+                if ((set | reset) == 0)
+                {
+                    continue;
+                }
+
+                Lanes& state          = m_ff_state[i * m_words + w];
+                Lanes& inverted_state = m_ff_inverted_state[i * m_words + w];
+                const Lanes old_state = state, old_inverted_state = inverted_state;
+
+                const u64 both = set & reset;
+                assign_masked(state, process_clear_preset_behavior(ff.sr_behavior_out, old_state), both);
+                assign_masked(inverted_state, process_clear_preset_behavior(ff.sr_behavior_out_inverted, old_inverted_state), both);
+                assign_masked(state, Lanes::broadcast(BooleanFunction::Value::ONE), set & ~reset);
+                assign_masked(inverted_state, Lanes::broadcast(BooleanFunction::Value::ZERO), set & ~reset);
+                assign_masked(state, Lanes::broadcast(BooleanFunction::Value::ZERO), reset & ~set);
+                assign_masked(inverted_state, Lanes::broadcast(BooleanFunction::Value::ONE), reset & ~set);
+
+                ff_changed |= (state != old_state) || (inverted_state != old_inverted_state);
+            }
+            if (ff_changed)
+            {
+                update_flip_flop_outputs(i);
+                changed = true;
+            }
+        }
+        return changed;
+    }
+
+    bool BitParallelSimulator::clock_flip_flops()
+    {
+        // a flip-flop is clocked in every lane in which its clock function became one, all flip-flops capture their next state before any of them changes its outputs
+        struct Capture
+        {
+            u32 ff;
+            u32 word;
+            u64 rising;
+            Lanes next_state;
+        };
+        std::vector<Capture> captured;
+
+        for (u32 i = 0; i < m_flip_flops.size(); i++)
+        {
+            const FlipFlop& ff = m_flip_flops[i];
+            for (u32 w = 0; w < m_words; w++)
+            {
+                const Lanes* slots = gather(ff.inputs, w);
+                const Lanes clock  = ff.clock.evaluate(slots);
+                Lanes& previous    = m_ff_clock[i * m_words + w];
+                const u64 rising   = clock.value & ~previous.value;
+                previous           = clock;
+                if (rising != 0)
+                {
+                    captured.push_back({i, w, rising, ff.next_state.evaluate(slots)});
+                }
+            }
+        }
+
+        // the outputs of a flip-flop are only updated once the captures of all its words have been applied
+        std::vector<u32> changed_ffs;
+        for (const Capture& c : captured)
+        {
+            Lanes& state          = m_ff_state[c.ff * m_words + c.word];
+            Lanes& inverted_state = m_ff_inverted_state[c.ff * m_words + c.word];
+            const Lanes old_state = state;
+            assign_masked(state, c.next_state, c.rising);
+            assign_masked(inverted_state, invert(c.next_state), c.rising);
+            if (state != old_state && (changed_ffs.empty() || changed_ffs.back() != c.ff))
+            {
+                changed_ffs.push_back(c.ff);
+            }
+        }
+
+        for (const u32 ff : changed_ffs)
+        {
+            update_flip_flop_outputs(ff);
+        }
+
+        return !changed_ffs.empty();
+    }
+
+    bool BitParallelSimulator::step(u64 time)
+    {
+        u32 iterations = 0;
+        do
+        {
+            evaluate_combinational();
+            if (++iterations > MAX_SETTLE_ITERATIONS)
+            {
+                log_error("hal_simulator", "values did not settle at {} ps, aborting simulation. Please check for a loop through an asynchronous set or reset.", time);
+                return false;
+            }
+        } while (apply_async_set_reset() || clock_flip_flops());
+
+        record(time);
+        return true;
+    }
+
+    void BitParallelSimulator::record(u64 time)
+    {
+        for (u32 signal = 1; signal < m_signal_nets.size(); signal++)
+        {
+            Trace& trace = m_traces[signal];
+
+            bool changed = trace.times.empty();
+            if (!changed)
+            {
+                const Lanes* last = trace.values.data() + trace.values.size() - m_words;
+                for (u32 w = 0; w < m_words && !changed; w++)
+                {
+                    changed = (last[w] != at(signal, w));
+                }
+            }
+            if (!changed)
+            {
+                continue;
+            }
+
+            // a point in time that is recorded twice only keeps its final values
+            if (!trace.times.empty() && trace.times.back() == time)
+            {
+                trace.times.pop_back();
+                trace.values.resize(trace.values.size() - m_words);
+            }
+            trace.times.push_back(time);
+            for (u32 w = 0; w < m_words; w++)
+            {
+                trace.values.push_back(at(signal, w));
+            }
+        }
+    }
+
+    bool BitParallelSimulator::simulate(u64 picoseconds)
+    {
+        if (!m_is_initialized && !initialize())
+        {
+            return false;
+        }
+
+        const u64 end_time = m_current_time + picoseconds;
+
+        // collect the edges of all clocks within [current time, end time), the value of a clock in
+        // [k * switch_time, (k + 1) * switch_time) is determined by the parity of k and its start value
+        std::vector<std::tuple<u64, u32, BooleanFunction::Value>> edges;
+        for (const SimulationInput::Clock& c : mSimulationInput->get_clocks())
+        {
+            if (c.switch_time == 0)
+            {
+                continue;
+            }
+            const u32 signal = m_signal_index.at(c.clock_net);
+            for (u64 k = (m_current_time + c.switch_time - 1) / c.switch_time; k * c.switch_time < end_time; k++)
+            {
+                const bool high = ((k & 1) == 1) == c.start_at_zero;
+                edges.emplace_back(k * c.switch_time, signal, high ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO);
+            }
+        }
+        std::sort(edges.begin(), edges.end(), [](const auto& a, const auto& b) { return std::get<0>(a) < std::get<0>(b); });
+
+        // the current point in time is always evaluated, as inputs might have been changed since the last call
+        auto edge_it = edges.begin();
+        u64 time     = m_current_time;
+        while (true)
+        {
+            for (; edge_it != edges.end() && std::get<0>(*edge_it) == time; ++edge_it)
+            {
+                for (u32 w = 0; w < m_words; w++)
+                {
+                    at(std::get<1>(*edge_it), w) = Lanes::broadcast(std::get<2>(*edge_it));
+                }
+            }
+
+            if (!step(time))
+            {
+                return false;
+            }
+
+            if (edge_it == edges.end())
+            {
+                break;
+            }
+            time = std::get<0>(*edge_it);
+        }
+
+        m_current_time = end_time;
+        return true;
+    }
+
+    bool BitParallelSimulator::inputEvent(const SimulationInputNetEvent& netEv)
+    {
+        if (!m_is_initialized && !initialize())
+        {
+            return false;
+        }
+
+        for (const auto& [net, value] : netEv)
+        {
+            if (auto it = m_signal_index.find(net); it != m_signal_index.end())
+            {
+                for (u32 w = 0; w < m_words; w++)
+                {
+                    at(it->second, w) = Lanes::broadcast(value);
+                }
+            }
+        }
+        return simulate(netEv.get_simulation_duration());
+    }
+
+    BooleanFunction::Value BitParallelSimulator::get_value(const Net* net, u32 lane) const
+    {
+        if (auto it = m_signal_index.find(net); it != m_signal_index.end() && lane < get_lane_count())
+        {
+            return at(it->second, lane / LANES_PER_WORD).get(lane % LANES_PER_WORD);
+        }
+        return BooleanFunction::Value::X;
+    }
+
+    std::vector<WaveEvent> BitParallelSimulator::get_lane_events(const Net* net, u32 lane) const
+    {
+        std::vector<WaveEvent> events;
+
+        const auto it = m_signal_index.find(net);
+        if (it == m_signal_index.end() || lane >= get_lane_count())
+        {
+            return events;
+        }
+
+        const Trace& trace = m_traces[it->second];
+        const u32 word     = lane / LANES_PER_WORD;
+        const u32 bit      = lane % LANES_PER_WORD;
+
+        // a net without events is unknown, so leading unknown values are not reported
+        BooleanFunction::Value previous = BooleanFunction::Value::X;
+        for (u32 i = 0; i < trace.times.size(); i++)
+        {
+            const BooleanFunction::Value value = trace.values[i * m_words + word].get(bit);
+            if (value == previous)
+            {
+                continue;
+            }
+            WaveEvent e;
+            e.affected_net = net;
+            e.new_value    = value;
+            e.time         = trace.times[i];
+            e.id           = events.size();
+            events.push_back(e);
+            previous = value;
+        }
+        return events;
+    }
+
+    WaveData* BitParallelSimulator::get_lane_wave_data(const Net* net, u32 lane) const
+    {
+        if (m_signal_index.find(net) == m_signal_index.end())
+        {
+            return nullptr;
+        }
+
+        WaveData* wd = new WaveData(net);
+        for (const WaveEvent& evt : get_lane_events(net, lane))
+        {
+            wd->insertBooleanValueWithoutSync(evt.time, evt.new_value);
+        }
+        return wd;
+    }
+
+    std::vector<WaveEvent> BitParallelSimulator::get_simulation_events(u32 netId) const
+    {
+        const auto it = m_signal_by_net_id.find(netId);
+        if (it == m_signal_by_net_id.end())
+        {
+            return {};
+        }
+
+        u32 lane = 0;
+        if (const auto prop = mProperties.find("result_lane"); prop != mProperties.end() && !prop->second.empty())
+        {
+            const auto lane_res = utils::wrapped_stoul(prop->second);
+            if (lane_res.is_error())
+            {
+                log_error("hal_simulator", "invalid result lane '{}':\n{}", prop->second, lane_res.get_error().get());
+                return {};
+            }
+            lane = lane_res.get();
+        }
+        return get_lane_events(m_signal_nets[it->second], lane);
+    }
+
+    SimulationEngine* BitParallelSimulatorFactory::createEngine() const
+    {
+        return new BitParallelSimulator(mName);
+    }
+}    // namespace hal
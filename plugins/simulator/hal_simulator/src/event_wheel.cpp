@@ -0,0 +1,161 @@
+#include "netlist_simulator/event_wheel.h"
+
+#include <algorithm>
+
+namespace hal
+{
+    void EventWheel::schedule(const Net* net, u64 time, BooleanFunction::Value value)
+    {
+        if (time < m_base_time)
+        {
+            time = m_base_time;
+        }
+
+        NetState& state = m_nets[net];
+
+        // an event that does not change the value of the net is only relevant if it overrides another pending event
+        if (state.pending == 0 && state.has_last_value && state.last_value == value)
+        {
+            return;
+        }
+
+        const u64 id = m_id_counter++;
+        if (time >= m_base_time + WHEEL_SIZE)
+        {
+            m_overflow.push({time, id, net, value});
+            state.pending++;
+            m_size++;
+            return;
+        }
+
+        insert(state, net, time, id, value);
+    }
+
+    void EventWheel::insert(NetState& state, const Net* net, u64 time, u64 id, BooleanFunction::Value value)
+    {
+        const u64 slot                  = time % WHEEL_SIZE;
+        std::vector<WaveEvent>& bucket = m_buckets[slot];
+
+        // a later event for the same net and point in time overrides the pending one
+        if (state.has_marker && state.marker_time == time)
+        {
+            bucket[state.marker_index].new_value = value;
+            return;
+        }
+
+        if (bucket.empty())
+        {
+            m_occupied[slot / WORD_BITS] |= (u64)1 << (slot % WORD_BITS);
+        }
+
+        WaveEvent e;
+        e.affected_net = net;
+        e.new_value    = value;
+        e.time         = time;
+        e.id           = id;
+
+        state.has_marker   = true;
+        state.marker_time  = time;
+        state.marker_index = bucket.size();
+        state.pending++;
+        m_size++;
+
+        bucket.push_back(e);
+    }
+
+    bool EventWheel::empty() const
+    {
+        return m_size == 0;
+    }
+
+    u64 EventWheel::size() const
+    {
+        return m_size;
+    }
+
+    u64 EventWheel::get_next_time() const
+    {
+        if (m_size == m_overflow.size())
+        {
+            return m_overflow.top().time;
+        }
+
+        // find the first occupied bucket at or after the current point in time, wrapping around the end of the wheel
+        const u64 start = m_base_time % WHEEL_SIZE;
+        const u64 words = m_occupied.size();
+        u64 word        = start / WORD_BITS;
+        u64 bits        = m_occupied[word] & (~(u64)0 << (start % WORD_BITS));
+        for (u64 i = 0; bits == 0 && i < words; i++)
+        {
+            word = (word + 1) % words;
+            bits = m_occupied[word];
+        }
+
+        const u64 slot = word * WORD_BITS + __builtin_ctzll(bits);
+        return m_base_time + ((slot + WHEEL_SIZE - start) % WHEEL_SIZE);
+    }
+
+    void EventWheel::take(u64 time, std::vector<WaveEvent>& events)
+    {
+        events.clear();
+        if (time < m_base_time)
+        {
+            return;
+        }
+
+        // advance the wheel and move the events that came into range out of the overflow heap
+        if (time > m_base_time)
+        {
+            m_base_time = time;
+            while (!m_overflow.empty() && m_overflow.top().time < m_base_time + WHEEL_SIZE)
+            {
+                const FarEvent e = m_overflow.top();
+                m_overflow.pop();
+
+                NetState& state = m_nets[e.net];
+                state.pending--;
+                m_size--;
+                insert(state, e.net, e.time, e.id, e.value);
+            }
+        }
+
+        const u64 slot = time % WHEEL_SIZE;
+        std::swap(events, m_buckets[slot]);
+        m_occupied[slot / WORD_BITS] &= ~((u64)1 << (slot % WORD_BITS));
+        m_size -= events.size();
+
+        for (const WaveEvent& e : events)
+        {
+            NetState& state = m_nets[e.affected_net];
+            state.pending--;
+            if (state.marker_time == time)
+            {
+                state.has_marker = false;
+            }
+            state.last_value     = e.new_value;
+            state.has_last_value = true;
+        }
+    }
+
+    void EventWheel::forget_values()
+    {
+        for (auto& [net, state] : m_nets)
+        {
+            state.has_last_value = false;
+        }
+    }
+
+    void EventWheel::clear()
+    {
+        for (std::vector<WaveEvent>& bucket : m_buckets)
+        {
+            bucket.clear();
+        }
+        std::fill(m_occupied.begin(), m_occupied.end(), 0);
+        m_overflow   = {};
+        m_nets.clear();
+        m_base_time  = 0;
+        m_size       = 0;
+        m_id_counter = 0;
+    }
+}    // namespace hal
@@ -40,11 +40,7 @@ namespace hal
             }
         }
 
-        WaveEvent e;
-        e.affected_net = net;
-        e.time         = m_current_time;
-        e.new_value    = value;
-        m_event_queue.push_back(e);
+        m_event_queue.schedule(net, m_current_time, value);
     }
 
     void NetlistSimulator::initialize_sequential_gates(const std::function<bool(const Gate*)>& filter)
@@ -92,19 +88,11 @@ namespace hal
                     switch (ep->get_pin()->get_type())
                     {
                         case PinType::state: {
-                            WaveEvent e;
-                            e.affected_net = ep->get_net();
-                            e.new_value    = value;
-                            e.time         = m_current_time;
-                            m_event_queue.push_back(e);
+                            m_event_queue.schedule(ep->get_net(), m_current_time, value);
                             break;
                         }
                         case PinType::neg_state: {
-                            WaveEvent e;
-                            e.affected_net = ep->get_net();
-                            e.new_value    = inv_value;
-                            e.time         = m_current_time;
-                            m_event_queue.push_back(e);
+                            m_event_queue.schedule(ep->get_net(), m_current_time, inv_value);
                             break;
                         }
                         default:
@@ -161,19 +149,11 @@ namespace hal
                         switch (ep->get_pin()->get_type())
                         {
                             case PinType::state: {
-                                WaveEvent e;
-                                e.affected_net = ep->get_net();
-                                e.new_value    = value;
-                                e.time         = m_current_time;
-                                m_event_queue.push_back(e);
+                                m_event_queue.schedule(ep->get_net(), m_current_time, value);
                                 break;
                             }
                             case PinType::neg_state: {
-                                WaveEvent e;
-                                e.affected_net = ep->get_net();
-                                e.new_value    = inv_value;
-                                e.time         = m_current_time;
-                                m_event_queue.push_back(e);
+                                m_event_queue.schedule(ep->get_net(), m_current_time, inv_value);
                                 break;
                             }
                             default:
@@ -201,7 +181,6 @@ namespace hal
     {
         mSimulationInput->clear();
         m_current_time = 0;
-        m_id_counter   = 0;
         m_simulation   = Simulation();
         m_event_queue.clear();
         m_is_initialized = false;
@@ -210,6 +189,7 @@ namespace hal
     void NetlistSimulator::set_simulation_state(const Simulation& state)
     {
         m_simulation = state;
+        m_event_queue.forget_values();
     }
 
     const Simulation& NetlistSimulator::get_simulation_state() const
@@ -340,7 +320,17 @@ namespace hal
                     continue;
                 }
                 auto sim_gate = sim_gates_map.at(gate);
-                m_successors[net].emplace_back(sim_gate, pins);
+
+                // refer to the pins by their input slot, so that propagating an event does not need to go through their names
+                std::vector<u32> slots;
+                for (const GatePin* pin : pins)
+                {
+                    if (auto pin_it = std::find(sim_gate->m_input_pins.begin(), sim_gate->m_input_pins.end(), pin); pin_it != sim_gate->m_input_pins.end())
+                    {
+                        slots.push_back(std::distance(sim_gate->m_input_pins.begin(), pin_it));
+                    }
+                }
+                m_successors[net].emplace_back(sim_gate, std::move(slots));
             }
         }
 
@@ -366,11 +356,7 @@ namespace hal
         // set initial values
         for (const auto& [net, value] : init_events)
         {
-            WaveEvent e;
-            e.affected_net = net;
-            e.new_value    = value;
-            e.time         = m_current_time;
-            m_event_queue.push_back(e);
+            m_event_queue.schedule(net, m_current_time, value);
         }
 
         // set initialization flag only if this point is reached
@@ -395,11 +381,7 @@ namespace hal
             // insert the required amount of clock signal switch events
             while (time < picoseconds)
             {
-                WaveEvent e;
-                e.affected_net = c.clock_net;
-                e.new_value    = v;
-                e.time         = base_time + time;
-                m_event_queue.push_back(e);
+                m_event_queue.schedule(c.clock_net, base_time + time, v);
 
                 v = simulation_utils::toggle(v);
                 time += c.switch_time;
@@ -422,23 +404,19 @@ namespace hal
 
         while (!m_event_queue.empty() || !clocked_gates.empty())
         {
-            std::map<std::pair<const Net*, u64>, BooleanFunction::Value> new_events;
-
-            // sort events by time
-            std::sort(m_event_queue.begin(), m_event_queue.end());
-
-            // queue empty or all events of the current point in time processed?
-            if (m_event_queue.empty() || m_current_time != m_event_queue[0].time)
+            // all events of the current point in time processed?
+            if (m_event_queue.empty() || m_current_time != m_event_queue.get_next_time())
             {
                 // are there FFs that were clocked? process them now!
                 if (!clocked_gates.empty() && !clocked_gates_processed)
                 {
                     for (SimulationGateSequential* clocked_gate : clocked_gates)
                     {
-                        clocked_gate->clock(m_current_time, new_events);
+                        clocked_gate->clock(m_current_time, m_event_queue);
                     }
                     clocked_gates.clear();
                     clocked_gates_processed = true;
+                    continue;
                 }
                 else if (m_event_queue.empty())
                 {
@@ -447,7 +425,7 @@ namespace hal
                 }
                 else    // no FFs but queue is not empty -> advance point in time
                 {
-                    m_current_time                    = m_event_queue[0].time;
+                    m_current_time                    = m_event_queue.get_next_time();
                     total_iterations_for_one_timeslot = 0;
                     clocked_gates_processed           = false;
                 }
@@ -460,12 +438,10 @@ namespace hal
                 break;
             }
 
-            // process all events of the current point in time
-            u32 processed = 0;
-            for (; processed < m_event_queue.size() && m_event_queue[processed].time <= m_current_time; ++processed)
+            // process all events of the current point in time, events caused by them are scheduled into the (now empty) slot of the wheel and processed in the next iteration
+            m_event_queue.take(m_current_time, m_event_batch);
+            for (const WaveEvent& event : m_event_batch)
             {
-                auto& event = m_event_queue[processed];
-
                 // is there already a value recorded for the net?
                 if (auto it = m_simulation.m_events.find(event.affected_net); it != m_simulation.m_events.end())
                 {
@@ -485,7 +461,7 @@ namespace hal
                     }
                     else    // new event
                     {
-                        m_simulation.m_events[event.affected_net].push_back(event);
+                        it->second.push_back(event);
                     }
                 }
                 else    // no value recorded -> new event
@@ -497,13 +473,13 @@ namespace hal
                 // record all FFs that have to be clocked
                 if (auto suc_it = m_successors.find(event.affected_net); suc_it != m_successors.end())
                 {
-                    for (auto& [gate, pins] : suc_it->second)
+                    for (auto& [gate, slots] : suc_it->second)
                     {
-                        for (auto& pin : pins)
+                        for (u32 slot : slots)
                         {
-                            gate->m_input_values[pin->get_name()] = event.new_value;
+                            gate->set_input(slot, event.new_value);
                         }
-                        if (!gate->simulate(m_simulation, event, new_events))
+                        if (!gate->simulate(m_simulation, event, m_event_queue))
                         {
                             clocked_gates.push_back(static_cast<SimulationGateSequential*>(gate));
                         }
@@ -512,27 +488,12 @@ namespace hal
             }
 
             // check for iteration limit
-            total_iterations_for_one_timeslot += processed;
+            total_iterations_for_one_timeslot += m_event_batch.size();
             if (m_timeout_iterations > 0 && total_iterations_for_one_timeslot > m_timeout_iterations)
             {
                 log_error("hal_simulator", "reached iteration timeout of {} without advancing in time, aborting simulation. Please check for a combinational loop.", m_timeout_iterations);
                 return;
             }
-
-            // remove processed events
-            m_event_queue.erase(m_event_queue.begin(), m_event_queue.begin() + processed);
-
-            // add new events
-            m_event_queue.reserve(m_event_queue.size() + new_events.size());
-            for (const auto& event_it : new_events)
-            {
-                WaveEvent e;
-                e.affected_net = event_it.first.first;
-                e.time         = event_it.first.second;
-                e.new_value    = event_it.second;
-                e.id           = m_id_counter++;
-                m_event_queue.push_back(e);
-            }
         }
 
         // adjust point in time
@@ -1,9 +1,12 @@
 #include "netlist_simulator/plugin_netlist_simulator.h"
+
+#include "netlist_simulator/bit_parallel_simulator.h"
 #include "netlist_simulator_controller/simulation_engine.h"
 
 namespace hal
 {
     std::string NetlistSimulatorPlugin::s_engine_name;
+    std::string NetlistSimulatorPlugin::s_bit_parallel_engine_name;
 
     extern std::unique_ptr<BasePluginInterface> create_plugin_instance()
     {
@@ -35,11 +38,13 @@ namespace hal
     void NetlistSimulatorPlugin::on_load()
     {
         // constructor will register with controller
-        s_engine_name = (new NetlistSimulatorFactory)->name();
+        s_engine_name              = (new NetlistSimulatorFactory)->name();
+        s_bit_parallel_engine_name = (new BitParallelSimulatorFactory)->name();
     }
 
     void NetlistSimulatorPlugin::on_unload()
     {
         SimulationEngineFactories::instance()->deleteFactory(s_engine_name);
+        SimulationEngineFactories::instance()->deleteFactory(s_bit_parallel_engine_name);
     }
 }
@@ -1,3 +1,4 @@
+#include "hal_core/utilities/log.h"
 #include "netlist_simulator/netlist_simulator.h"
 
 namespace hal
@@ -12,5 +13,48 @@ namespace hal
             m_input_pins.push_back(pin);
             m_input_nets.push_back(gate->get_fan_in_net(pin));
         }
+        m_input_slots.resize(m_input_pins.size(), BooleanFunction::Value::X);
+    }
+
+    void NetlistSimulator::SimulationGate::set_input(u32 index, BooleanFunction::Value value)
+    {
+        m_input_slots[index] = value;
+        if (m_uses_named_inputs)
+        {
+            m_input_values[m_input_pins[index]->get_name()] = value;
+        }
+    }
+
+    NetlistSimulator::SimulationFunction NetlistSimulator::SimulationGate::compile_function(BooleanFunction&& function)
+    {
+        std::vector<std::string> slots;
+        slots.reserve(m_input_pins.size());
+        for (const GatePin* pin : m_input_pins)
+        {
+            slots.push_back(pin->get_name());
+        }
+
+        SimulationFunction res;
+        if (auto compiled = CompiledBooleanFunction::compile(function, slots); compiled.is_ok())
+        {
+            res.compiled = compiled.get();
+        }
+        else
+        {
+            // functions that cannot be compiled are evaluated by pin name, which requires the gate to keep those values up to date
+            log_debug("hal_simulator", "falling back to evaluation by name for a function of gate '{}' with ID {}:\n{}", m_gate->get_name(), m_gate->get_id(), compiled.get_error().get());
+            m_uses_named_inputs = true;
+        }
+        res.function = std::move(function);
+        return res;
+    }
+
+    BooleanFunction::Value NetlistSimulator::SimulationGate::evaluate(const SimulationFunction& function) const
+    {
+        if (function.compiled.has_value())
+        {
+            return function.compiled->evaluate(m_input_slots.data());
+        }
+        return function.function.evaluate(m_input_values).get();
     }
 }    // namespace hal
\ No newline at end of file
@@ -32,22 +32,22 @@ namespace hal
                     break;
                 }
             }
-            m_functions.emplace(out_net, func);
+            m_functions.push_back(compile_function(std::move(func)));
         }
     }
 
-    bool NetlistSimulator::SimulationGateCombinational::simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)
+    bool NetlistSimulator::SimulationGateCombinational::simulate(const Simulation& simulation, const WaveEvent& event, EventWheel& new_events)
     {
         UNUSED(simulation);
 
         // compute delay, currently just a placeholder
         u64 delay = 0;
 
-        for (auto out_net : m_output_nets)
+        for (u32 i = 0; i < m_output_nets.size(); i++)
         {
-            BooleanFunction::Value result = m_functions[out_net].evaluate(m_input_values).get();
+            BooleanFunction::Value result = evaluate(m_functions[i]);
 
-            new_events[std::make_pair(out_net, event.time + delay)] = result;
+            new_events.schedule(m_output_nets[i], event.time + delay, result);
         }
 
         return true;
@@ -10,10 +10,10 @@ namespace hal
         const GateType* gate_type       = gate->get_type();
         const FFComponent* ff_component = gate_type->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); });
         assert(ff_component != nullptr);
-        m_clock_func      = ff_component->get_clock_function();
-        m_next_state_func = ff_component->get_next_state_function();
-        m_preset_func     = ff_component->get_async_set_function();
-        m_clear_func      = ff_component->get_async_reset_function();
+        m_clock_func      = compile_function(ff_component->get_clock_function());
+        m_next_state_func = compile_function(ff_component->get_next_state_function());
+        m_preset_func     = compile_function(ff_component->get_async_set_function());
+        m_clear_func      = compile_function(ff_component->get_async_reset_function());
         for (const GatePin* pin : gate_type->get_pins())
         {
             switch (pin->get_type())
@@ -95,13 +95,13 @@ namespace hal
         }
     }
 
-    bool NetlistSimulator::SimulationGateFF::simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)
+    bool NetlistSimulator::SimulationGateFF::simulate(const Simulation& simulation, const WaveEvent& event, EventWheel& new_events)
     {
         // compute delay, currently just a placeholder
         u64 delay = 0;
 
-        auto async_set   = m_preset_func.evaluate(m_input_values).get();
-        auto async_reset = m_clear_func.evaluate(m_input_values).get();
+        auto async_set   = evaluate(m_preset_func);
+        auto async_reset = evaluate(m_clear_func);
 
         // check whether an asynchronous set or reset ist triggered
         if (async_set == BooleanFunction::ONE || async_reset == BooleanFunction::ONE)
@@ -149,11 +149,11 @@ namespace hal
             // generate events
             for (auto out_net : m_state_output_nets)
             {
-                new_events[std::make_pair(out_net, event.time + delay)] = result;
+                new_events.schedule(out_net, event.time + delay, result);
             }
             for (auto out_net : m_state_inverted_output_nets)
             {
-                new_events[std::make_pair(out_net, event.time + delay)] = inv_result;
+                new_events.schedule(out_net, event.time + delay, inv_result);
             }
 
             return true;
@@ -161,29 +161,29 @@ namespace hal
         else if (std::find(m_clock_nets.begin(), m_clock_nets.end(), event.affected_net) != m_clock_nets.end())
         {
             // return true if the event was completely handled -> true if the gate is NOT clocked at this point
-            return (m_clock_func.evaluate(m_input_values).get() != BooleanFunction::ONE);
+            return (evaluate(m_clock_func) != BooleanFunction::ONE);
         }
 
         return true;
     }
 
-    void NetlistSimulator::SimulationGateFF::clock(const u64 current_time, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)
+    void NetlistSimulator::SimulationGateFF::clock(const u64 current_time, EventWheel& new_events)
     {
         // compute delay, currently just a placeholder
         u64 delay = 0;
 
         // compute output
-        BooleanFunction::Value result     = m_next_state_func.evaluate(m_input_values).get();
+        BooleanFunction::Value result     = evaluate(m_next_state_func);
         BooleanFunction::Value inv_result = simulation_utils::toggle(result);
 
         // generate events
         for (const Net* out_net : m_state_output_nets)
         {
-            new_events[std::make_pair(out_net, current_time + delay)] = result;
+            new_events.schedule(out_net, current_time + delay, result);
         }
         for (const Net* out_net : m_state_inverted_output_nets)
         {
-            new_events[std::make_pair(out_net, current_time + delay)] = inv_result;
+            new_events.schedule(out_net, current_time + delay, inv_result);
         }
     }
 }    // namespace hal
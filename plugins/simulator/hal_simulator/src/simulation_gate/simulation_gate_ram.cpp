@@ -48,6 +48,9 @@ namespace hal
         const RAMComponent* ram_component = gate_type->get_component_as<RAMComponent>([](const GateTypeComponent* c) { return RAMComponent::is_class_of(c); });
         assert(ram_component != nullptr);
 
+        // the ports address their data and address buses by pin name
+        m_uses_named_inputs = true;
+
         m_bit_size = ram_component->get_bit_size();
 
         for (const GateTypeComponent* component : ram_component->get_components([](const GateTypeComponent* c) { return RAMPortComponent::is_class_of(c); }))
@@ -168,7 +171,7 @@ namespace hal
         }
     }
 
-    bool NetlistSimulator::SimulationGateRAM::simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)
+    bool NetlistSimulator::SimulationGateRAM::simulate(const Simulation& simulation, const WaveEvent& event, EventWheel& new_events)
     {
         UNUSED(simulation);
         UNUSED(new_events);
@@ -202,7 +205,7 @@ namespace hal
         return true;
     }
 
-    void NetlistSimulator::SimulationGateRAM::clock(const u64 current_time, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)
+    void NetlistSimulator::SimulationGateRAM::clock(const u64 current_time, EventWheel& new_events)
     {
         // compute delay, currently just a placeholder
         u64 delay = 0;
@@ -232,7 +235,7 @@ namespace hal
             for (u32 i = 0; i < data_size; i++)
             {
                 const Net* out_net                                        = m_gate->get_fan_out_net(port.data_pins.at(i));
-                new_events[std::make_pair(out_net, current_time + delay)] = data_values.at(i);
+                new_events.schedule(out_net, current_time + delay, data_values.at(i));
             }
         }
 
@@ -0,0 +1,196 @@
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "netlist_simulator/event_wheel.h"
+#include "netlist_test_utils.h"
+#include "test_utils/include/test_def.h"
+
+#include <vector>
+
+namespace hal
+{
+    class EventWheelTest : public ::testing::Test
+    {
+    protected:
+        std::unique_ptr<Netlist> m_netlist;
+        Net* m_net_a;
+        Net* m_net_b;
+        Net* m_net_c;
+
+        virtual void SetUp()
+        {
+            m_netlist = test_utils::create_empty_netlist();
+            m_net_a   = m_netlist->create_net("a");
+            m_net_b   = m_netlist->create_net("b");
+            m_net_c   = m_netlist->create_net("c");
+        }
+
+        virtual void TearDown()
+        {
+        }
+    };
+
+    /**
+     * Testing that events are taken in the order of their points in time.
+     *
+     * Functions: schedule, take, get_next_time, size, empty
+     */
+    TEST_F(EventWheelTest, check_event_ordering)
+    {
+        EventWheel wheel;
+        std::vector<WaveEvent> events;
+        EXPECT_TRUE(wheel.empty());
+
+        wheel.schedule(m_net_a, 30, BooleanFunction::Value::ONE);
+        wheel.schedule(m_net_b, 10, BooleanFunction::Value::ONE);
+        wheel.schedule(m_net_c, 20, BooleanFunction::Value::ONE);
+        EXPECT_EQ(wheel.size(), 3);
+
+        std::vector<std::pair<u64, const Net*>> taken;
+        while (!wheel.empty())
+        {
+            const u64 time = wheel.get_next_time();
+            wheel.take(time, events);
+            for (const auto& e : events)
+            {
+                EXPECT_EQ(e.time, time);
+                taken.push_back({e.time, e.affected_net});
+            }
+        }
+
+        const std::vector<std::pair<u64, const Net*>> expected = {{10, m_net_b}, {20, m_net_c}, {30, m_net_a}};
+        EXPECT_EQ(taken, expected);
+        EXPECT_EQ(wheel.size(), 0);
+
+        // events scheduled before the current point in time are scheduled for the current point in time instead
+        wheel.schedule(m_net_a, 5, BooleanFunction::Value::ZERO);
+        EXPECT_EQ(wheel.get_next_time(), 30);
+        wheel.take(30, events);
+        ASSERT_EQ(events.size(), 1);
+        EXPECT_EQ(events[0].time, 30);
+        EXPECT_EQ(events[0].new_value, BooleanFunction::Value::ZERO);
+    }
+
+    /**
+     * Testing several events at the same point in time, which are taken in the order they were scheduled in.
+     * A later event for the same net replaces the pending one and an event that does not change the value of a net is dropped.
+     *
+     * Functions: schedule, take, size
+     */
+    TEST_F(EventWheelTest, check_simultaneous_events)
+    {
+        EventWheel wheel;
+        std::vector<WaveEvent> events;
+
+        wheel.schedule(m_net_c, 7, BooleanFunction::Value::ONE);
+        wheel.schedule(m_net_a, 7, BooleanFunction::Value::ONE);
+        wheel.schedule(m_net_b, 7, BooleanFunction::Value::ZERO);
+        wheel.schedule(m_net_a, 7, BooleanFunction::Value::ZERO);
+        EXPECT_EQ(wheel.size(), 3);
+
+        ASSERT_EQ(wheel.get_next_time(), 7);
+        wheel.take(7, events);
+        ASSERT_EQ(events.size(), 3);
+        EXPECT_EQ(events[0].affected_net, m_net_c);
+        EXPECT_EQ(events[0].new_value, BooleanFunction::Value::ONE);
+        EXPECT_EQ(events[1].affected_net, m_net_a);
+        EXPECT_EQ(events[1].new_value, BooleanFunction::Value::ZERO);
+        EXPECT_EQ(events[2].affected_net, m_net_b);
+        EXPECT_EQ(events[2].new_value, BooleanFunction::Value::ZERO);
+        EXPECT_TRUE(wheel.empty());
+
+        // events scheduled for the point in time that was just taken are returned by the next call
+        wheel.schedule(m_net_b, 7, BooleanFunction::Value::ONE);
+        ASSERT_EQ(wheel.get_next_time(), 7);
+        wheel.take(7, events);
+        ASSERT_EQ(events.size(), 1);
+        EXPECT_EQ(events[0].affected_net, m_net_b);
+
+        // the value last assigned to a net is not scheduled again, unless the wheel forgets it
+        wheel.schedule(m_net_b, 8, BooleanFunction::Value::ONE);
+        EXPECT_TRUE(wheel.empty());
+        wheel.forget_values();
+        wheel.schedule(m_net_b, 8, BooleanFunction::Value::ONE);
+        EXPECT_EQ(wheel.size(), 1);
+    }
+
+    /**
+     * Testing events that are further ahead than the size of the wheel, i.e., that wrap around the end of the wheel or are kept in the overflow heap.
+     *
+     * Functions: schedule, take, get_next_time, size, clear
+     */
+    TEST_F(EventWheelTest, check_events_beyond_wheel_size)
+    {
+        const u64 size = EventWheel::WHEEL_SIZE;
+        std::vector<WaveEvent> events;
+
+        {
+            // events within the wheel that wrap around its end
+            EventWheel wheel;
+            wheel.schedule(m_net_a, size - 1, BooleanFunction::Value::ONE);
+            ASSERT_EQ(wheel.get_next_time(), size - 1);
+            wheel.take(size - 1, events);
+            ASSERT_EQ(events.size(), 1);
+
+            wheel.schedule(m_net_b, size + 3, BooleanFunction::Value::ONE);
+            wheel.schedule(m_net_c, size, BooleanFunction::Value::ONE);
+            wheel.schedule(m_net_a, 2 * size - 2, BooleanFunction::Value::ZERO);
+
+            const std::vector<u64> expected = {size, size + 3, 2 * size - 2};
+            for (const u64 time : expected)
+            {
+                ASSERT_EQ(wheel.get_next_time(), time);
+                wheel.take(time, events);
+                ASSERT_EQ(events.size(), 1);
+                EXPECT_EQ(events[0].time, time);
+            }
+            EXPECT_TRUE(wheel.empty());
+        }
+        {
+            // events beyond the wheel, which are kept in the overflow heap until they come into range
+            EventWheel wheel;
+            wheel.schedule(m_net_a, 3 * size + 5, BooleanFunction::Value::ONE);
+            wheel.schedule(m_net_b, 10 * size, BooleanFunction::Value::ONE);
+            wheel.schedule(m_net_c, size, BooleanFunction::Value::ONE);
+            wheel.schedule(m_net_a, 3 * size + 5, BooleanFunction::Value::ZERO);
+            wheel.schedule(m_net_c, 1, BooleanFunction::Value::ZERO);
+            EXPECT_EQ(wheel.size(), 5);
+
+            ASSERT_EQ(wheel.get_next_time(), 1);
+            wheel.take(1, events);
+            ASSERT_EQ(events.size(), 1);
+            EXPECT_EQ(events[0].affected_net, m_net_c);
+
+            ASSERT_EQ(wheel.get_next_time(), size);
+            wheel.take(size, events);
+            ASSERT_EQ(events.size(), 1);
+            EXPECT_EQ(events[0].affected_net, m_net_c);
+
+            // both events for the same net and point in time are merged once they enter the wheel
+            ASSERT_EQ(wheel.get_next_time(), 3 * size + 5);
+            wheel.take(3 * size + 5, events);
+            ASSERT_EQ(events.size(), 1);
+            EXPECT_EQ(events[0].affected_net, m_net_a);
+            EXPECT_EQ(events[0].new_value, BooleanFunction::Value::ZERO);
+
+            // an event within the wheel precedes one that is still in the overflow heap
+            wheel.schedule(m_net_a, 3 * size + 6, BooleanFunction::Value::ONE);
+            ASSERT_EQ(wheel.get_next_time(), 3 * size + 6);
+            wheel.take(3 * size + 6, events);
+            ASSERT_EQ(events.size(), 1);
+
+            ASSERT_EQ(wheel.get_next_time(), 10 * size);
+            wheel.take(10 * size, events);
+            ASSERT_EQ(events.size(), 1);
+            EXPECT_EQ(events[0].affected_net, m_net_b);
+            EXPECT_TRUE(wheel.empty());
+
+            // clearing the wheel removes pending events in the wheel and in the overflow heap
+            wheel.schedule(m_net_a, 10 * size + 1, BooleanFunction::Value::ZERO);
+            wheel.schedule(m_net_b, 20 * size, BooleanFunction::Value::ZERO);
+            wheel.clear();
+            EXPECT_TRUE(wheel.empty());
+            wheel.schedule(m_net_c, 2, BooleanFunction::Value::ONE);
+            EXPECT_EQ(wheel.get_next_time(), 2);
+        }
+    }
+}    // namespace hal
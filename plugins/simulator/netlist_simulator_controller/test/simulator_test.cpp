@@ -7,6 +7,7 @@
 #include "hal_core/netlist/persistent/netlist_serializer.h"
 #include "hal_core/plugin_system/plugin_manager.h"
 #include "hal_core/utilities/log.h"
+#include "netlist_simulator/bit_parallel_simulator.h"
 #include "netlist_simulator_controller/netlist_simulator_controller.h"
 #include "netlist_simulator_controller/plugin_netlist_simulator_controller.h"
 #include "netlist_simulator_controller/simulation_engine.h"
@@ -349,6 +350,63 @@ namespace hal
             return no_errors;
         }
 
+        /**
+         * Create a netlist of the example gate library with two flip-flops that are clocked by net 'clk' and cleared by net 'rst'.
+         * Flip-flop 'ff_0' captures 'a ^ q_1', flip-flop 'ff_1' captures 'q_0', and net 'out' computes 'q_0 & b'.
+         */
+        std::unique_ptr<Netlist> create_sequential_netlist()
+        {
+            const GateLibrary* lib = gate_library_manager::get_gate_library("example_library.hgl");
+            if (lib == nullptr)
+            {
+                return nullptr;
+            }
+
+            std::unique_ptr<Netlist> nl = netlist_factory::create_netlist(lib);
+
+            Gate* vcc  = nl->create_gate(lib->get_gate_type_by_name("VCC"), "vcc");
+            Gate* ff_0 = nl->create_gate(lib->get_gate_type_by_name("FFR"), "ff_0");
+            Gate* ff_1 = nl->create_gate(lib->get_gate_type_by_name("FFR"), "ff_1");
+            Gate* xor2 = nl->create_gate(lib->get_gate_type_by_name("XOR"), "xor");
+            Gate* and2 = nl->create_gate(lib->get_gate_type_by_name("AND2"), "and");
+            nl->mark_vcc_gate(vcc);
+
+            for (const std::string& name : {"clk", "rst", "a", "b"})
+            {
+                nl->create_net(name)->mark_global_input_net();
+            }
+            const auto get_net = [&nl](const std::string& name) { return *(nl->get_nets([&name](const Net* net) { return net->get_name() == name; }).begin()); };
+
+            Net* one = nl->create_net("'1'");
+            one->add_source(vcc, "O");
+            for (Gate* ff : {ff_0, ff_1})
+            {
+                get_net("clk")->add_destination(ff, "C");
+                get_net("rst")->add_destination(ff, "R");
+                one->add_destination(ff, "CE");
+            }
+
+            Net* x = nl->create_net("x");
+            get_net("a")->add_destination(xor2, "I0");
+            x->add_source(xor2, "O");
+            x->add_destination(ff_0, "D");
+
+            Net* q_0 = nl->create_net("q_0");
+            q_0->add_source(ff_0, "Q");
+            q_0->add_destination(ff_1, "D");
+            q_0->add_destination(and2, "I0");
+
+            Net* q_1 = nl->create_net("q_1");
+            q_1->add_source(ff_1, "Q");
+            q_1->add_destination(xor2, "I1");
+
+            Net* out = nl->create_net("out");
+            get_net("b")->add_destination(and2, "I1");
+            out->add_source(and2, "O");
+            out->mark_global_output_net();
+
+            return nl;
+        }
     };    // namespace hal
 
     TEST_F(SimulatorTest, half_adder)
@@ -1373,4 +1431,133 @@ namespace hal
         EXPECT_TRUE(equal);
         TEST_END
     }
+
+    TEST_F(SimulatorTest, bit_parallel_lanes)
+    {
+        TEST_START
+        auto plugin = plugin_manager::get_plugin_instance<NetlistSimulatorControllerPlugin>("netlist_simulator_controller");
+
+        std::unique_ptr<Netlist> nl = create_sequential_netlist();
+        ASSERT_NE(nl, nullptr);
+        const auto get_net = [&nl](const std::string& name) { return *(nl->get_nets([&name](const Net* net) { return net->get_name() == name; }).begin()); };
+
+        auto sim_ctrl   = plugin->create_simulator_controller("bit_parallel_lanes");
+        auto sim_engine = sim_ctrl->create_simulation_engine("hal_simulator_bit_parallel");
+        auto engine     = dynamic_cast<BitParallelSimulator*>(sim_engine);
+        ASSERT_NE(engine, nullptr);
+
+        SimulationInput sim_input;
+        sim_input.add_gates(nl->get_gates());
+        sim_input.add_clock({get_net("clk"), 5000, true});
+
+        // the lanes are rounded up to three words, so that flip-flops capture their next state in several words at the same edge
+        engine->set_lane_count(130);
+        EXPECT_EQ(engine->get_lane_count(), 3 * BitParallelSimulator::LANES_PER_WORD);
+        ASSERT_TRUE(sim_engine->setSimulationInput(&sim_input));
+        ASSERT_TRUE(engine->initialize());
+
+        const u32 num_lanes = engine->get_lane_count();
+        const auto a_value  = [](u32 lane) { return (lane % 3 == 0) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO; };
+        const auto expect_state = [&](const std::function<BooleanFunction::Value(u32)>& q_0, const std::function<BooleanFunction::Value(u32)>& q_1) {
+            for (u32 lane = 0; lane < num_lanes; lane++)
+            {
+                EXPECT_EQ(engine->get_value(get_net("q_0"), lane), q_0(lane)) << "lane " << lane;
+                EXPECT_EQ(engine->get_value(get_net("q_1"), lane), q_1(lane)) << "lane " << lane;
+                EXPECT_EQ(engine->get_value(get_net("out"), lane), q_0(lane)) << "lane " << lane;
+            }
+        };
+        const auto zero = [](u32) { return BooleanFunction::Value::ZERO; };
+
+        // clear both flip-flops in all lanes
+        engine->set_input(get_net("rst"), BooleanFunction::Value::ONE);
+        engine->set_input(get_net("a"), BooleanFunction::Value::ZERO);
+        engine->set_input(get_net("b"), BooleanFunction::Value::ONE);
+        ASSERT_TRUE(engine->simulate(10000));
+        expect_state(zero, zero);
+
+        // every third lane gets a one at input 'a', which is shifted through both flip-flops and cancels itself out through the XOR
+        engine->set_input(get_net("rst"), BooleanFunction::Value::ZERO);
+        for (u32 lane = 0; lane < num_lanes; lane++)
+        {
+            engine->set_lane_input(get_net("a"), lane, a_value(lane));
+        }
+        ASSERT_TRUE(engine->simulate(10000));
+        expect_state(a_value, zero);
+
+        ASSERT_TRUE(engine->simulate(10000));
+        expect_state(a_value, a_value);
+
+        ASSERT_TRUE(engine->simulate(10000));
+        expect_state(zero, a_value);
+
+        // the controller reads the lane selected by the engine property 'result_lane'
+        const Net* out = get_net("out");
+        engine->set_engine_property("result_lane", "129");
+        const auto lane_events = engine->get_lane_events(out, 129);
+        const auto events      = engine->get_simulation_events(out->get_id());
+        EXPECT_FALSE(events.empty());
+        EXPECT_TRUE(events == lane_events);
+
+        engine->set_engine_property("result_lane", "last");
+        EXPECT_TRUE(engine->get_simulation_events(out->get_id()).empty());
+
+        // an invalid number of lanes fails the initialization instead of throwing
+        auto invalid_ctrl       = plugin->create_simulator_controller("bit_parallel_invalid_lanes");
+        auto invalid_sim_engine = invalid_ctrl->create_simulation_engine("hal_simulator_bit_parallel");
+        auto invalid_engine     = dynamic_cast<BitParallelSimulator*>(invalid_sim_engine);
+        ASSERT_NE(invalid_engine, nullptr);
+        invalid_engine->set_engine_property("lanes", "many");
+        ASSERT_TRUE(invalid_sim_engine->setSimulationInput(&sim_input));
+        EXPECT_FALSE(invalid_engine->initialize());
+        TEST_END
+    }
+
+    TEST_F(SimulatorTest, bit_parallel_matches_event_driven)
+    {
+        TEST_START
+        auto plugin = plugin_manager::get_plugin_instance<NetlistSimulatorControllerPlugin>("netlist_simulator_controller");
+
+        std::unique_ptr<Netlist> nl = create_sequential_netlist();
+        ASSERT_NE(nl, nullptr);
+        const auto get_net = [&nl](const std::string& name) { return *(nl->get_nets([&name](const Net* net) { return net->get_name() == name; }).begin()); };
+
+        std::vector<std::unique_ptr<NetlistSimulatorController>> sim_ctrls;
+        for (const std::string& engine_name : {"hal_simulator", "hal_simulator_bit_parallel"})
+        {
+            auto sim_ctrl = plugin->create_simulator_controller(engine_name + "_sequential");
+            auto engine   = sim_ctrl->create_simulation_engine(engine_name);
+            ASSERT_NE(engine, nullptr);
+
+            sim_ctrl->add_gates(nl->get_gates());
+            sim_ctrl->add_clock_period(get_net("clk"), 10000);
+
+            sim_ctrl->set_input(get_net("rst"), BooleanFunction::Value::ONE);
+            sim_ctrl->set_input(get_net("a"), BooleanFunction::Value::ZERO);
+            sim_ctrl->set_input(get_net("b"), BooleanFunction::Value::ONE);
+            sim_ctrl->simulate(20000);
+
+            sim_ctrl->set_input(get_net("rst"), BooleanFunction::Value::ZERO);
+            sim_ctrl->set_input(get_net("a"), BooleanFunction::Value::ONE);
+            sim_ctrl->simulate(30000);
+
+            sim_ctrl->set_input(get_net("a"), BooleanFunction::Value::ZERO);
+            sim_ctrl->simulate(40000);
+
+            sim_ctrl->set_input(get_net("b"), BooleanFunction::Value::ZERO);
+            sim_ctrl->simulate(10000);
+
+            sim_ctrl->run_simulation();
+            while (engine->get_state() == SimulationEngine::State::Running)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            ASSERT_TRUE(engine->get_state() == SimulationEngine::State::Done) << engine_name << " failed";
+            EXPECT_TRUE(sim_ctrl->get_results());
+
+            sim_ctrls.push_back(std::move(sim_ctrl));
+        }
+
+        EXPECT_TRUE(cmp_sim_data(sim_ctrls.at(0).get(), sim_ctrls.at(1).get()));
+        TEST_END
+    }
 }    // namespace hal
@@ -30,11 +30,12 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser.h"
+#include "hal_core/utilities/memory_mapped_file.h"
 #include "hal_core/utilities/special_strings.h"
 #include "hal_core/utilities/token_stream.h"
 
 #include <optional>
-#include <sstream>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -185,7 +186,26 @@ namespace hal
             std::map<std::string, VerilogInstance*> m_instances_by_name;
         };
 
-        std::stringstream m_fs;
+        /**
+         * The state of the tokenizer, which tokenizes the memory-mapped input file one module at a time.
+         */
+        struct TokenizerState
+        {
+            std::string_view m_data;
+            u64 m_position    = 0;
+            u32 m_line_number = 0;
+            char m_prev_char  = 0;
+            bool m_in_string  = false;
+            bool m_escaped    = false;
+            bool m_in_comment = false;
+
+            // tokens read beyond the end of the last module and the positions of further module ends among them
+            std::vector<Token<std::string>> m_tokens;
+            std::vector<u64> m_module_ends;
+        };
+
+        MemoryMappedFile m_file;
+        TokenizerState m_tokenizer;
         std::filesystem::path m_path;
 
         // temporary netlist
@@ -196,7 +216,7 @@ namespace hal
         std::unordered_map<std::string, VerilogModule*> m_modules_by_name;
         std::string m_last_module;
 
-        // token stream of entire input file
+        // token stream of the module(s) that are currently parsed
         TokenStream<std::string> m_token_stream;
 
         // some caching
@@ -221,8 +241,10 @@ namespace hal
         const std::string instance_name_seperator = "/";
 
         // parse HDL into intermediate format
-        void tokenize();
+        bool tokenize_next_module();
         Result<std::monostate> parse_tokens();
+        Result<std::monostate> parse_module_batch(std::vector<TokenStream<std::string>>& batch);
+        Result<std::monostate> parse_module_tokens();
         Result<std::monostate> parse_module(std::vector<VerilogDataEntry>& attributes);
         void parse_port_list(VerilogModule* module);
         Result<std::monostate> parse_port_declaration_list(VerilogModule* module);
@@ -234,6 +256,8 @@ namespace hal
         Result<std::monostate> parse_instance(VerilogModule* module, std::vector<VerilogDataEntry>& attributes);
         Result<std::monostate> parse_port_assign(VerilogInstance* instance);
         Result<std::vector<VerilogDataEntry>> parse_parameter_assign();
+        Result<std::monostate> expand_module(VerilogModule* verilog_module) const;
+        Result<std::monostate> expand_module_port_assignments(VerilogModule* verilog_module) const;
 
         // construct netlist from intermediate format
         Result<std::monostate> construct_netlist(VerilogModule* top_module);
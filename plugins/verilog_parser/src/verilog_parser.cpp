@@ -6,17 +6,59 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/utilities/enums.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/thread_pool.h"
 #include "hal_core/utilities/utils.h"
 
-#include <fstream>
+#include <functional>
 #include <iomanip>
 #include <queue>
+#include <sstream>
 
 namespace hal
 {
     namespace
     {
+        /**
+         * Executes a task for every index in [0, count) on the global thread pool.
+         * Exceptions thrown by a task are rethrown in the calling thread unless a task with a lower index failed before.
+         *
+         * @param[in] count - The number of tasks.
+         * @param[in] task - The task to execute for each index.
+         * @returns The results of all tasks ordered by index.
+         */
+        std::vector<Result<std::monostate>> run_in_parallel(const u32 count, const std::function<Result<std::monostate>(u32)>& task)
+        {
+            std::vector<Result<std::monostate>> results(count, OK({}));
+            std::vector<std::exception_ptr> exceptions(count);
 
+            const auto run_task = [&task, &results, &exceptions](const u32 index) {
+                try
+                {
+                    results[index] = task(index);
+                }
+                catch (...)
+                {
+                    exceptions[index] = std::current_exception();
+                    results[index]    = ERR("task " + std::to_string(index) + " was aborted by an exception");
+                }
+            };
+
+            parallel_for(0, count, run_task);
+
+            for (u32 i = 0; i < count; i++)
+            {
+                if (exceptions[i])
+                {
+                    std::rethrow_exception(exceptions[i]);
+                }
+                if (results[i].is_error())
+                {
+                    break;
+                }
+            }
+
+            return results;
+        }
     }    // namespace
 
     Result<std::monostate> VerilogParser::parse(const std::filesystem::path& file_path)
@@ -25,21 +67,15 @@ namespace hal
         m_modules.clear();
         m_modules_by_name.clear();
 
+        // map the file into memory instead of reading it into a buffer, it is tokenized one module at a time
+        if (auto res = m_file.open(file_path); res.is_error())
         {
-            std::ifstream ifs;
-            ifs.open(file_path.string(), std::ifstream::in);
-            if (!ifs.is_open())
-            {
-                return ERR("could not parse Verilog file '" + m_path.string() + "' : unable to open file");
-            }
-            m_fs << ifs.rdbuf();
-            ifs.close();
+            return ERR_APPEND(res.get_error(), "could not parse Verilog file '" + m_path.string() + "' : unable to open file");
         }
+        m_tokenizer        = TokenizerState();
+        m_tokenizer.m_data = m_file.get_data();
 
-        // tokenize file
-        tokenize();
-
-        // parse tokens into intermediate format
+        // tokenize and parse tokens into intermediate format
         try
         {
             if (auto res = parse_tokens(); res.is_error())
@@ -59,176 +95,35 @@ namespace hal
             }
         }
 
+        // all tokens are copied into the intermediate format, so the file is no longer needed
+        m_token_stream = TokenStream<std::string>();
+        m_tokenizer    = TokenizerState();
+        m_file.close();
+
         if (m_modules.empty())
         {
             return ERR("could not parse Verilog file '" + m_path.string() + "': does not contain any modules");
         }
 
         // expand module port identifiers, signals, and assignments
-        for (auto& [module_name, verilog_module] : m_modules_by_name)
+        // modules are expanded independently of each other, errors are reported for the first failing module in file order
+        auto expansion_results = run_in_parallel(m_modules.size(), [this](const u32 index) { return expand_module(m_modules.at(index).get()); });
+        for (const auto& res : expansion_results)
         {
-            // expand port identifiers
-            for (const auto& port : verilog_module->m_ports)
-            {
-                if (port->m_expression == port->m_identifier)
-                {
-                    if (!port->m_ranges.empty())
-                    {
-                        port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
-                    }
-                    else
-                    {
-                        port->m_expanded_identifiers = {port->m_identifier};
-                    }
-                }
-                else
-                {
-                    if (!port->m_ranges.empty())
-                    {
-                        port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
-                        auto expanded_expression     = expand_ranges(port->m_expression, port->m_ranges);
-
-                        std::transform(port->m_expanded_identifiers.begin(),
-                                       port->m_expanded_identifiers.end(),
-                                       expanded_expression.begin(),
-                                       std::inserter(verilog_module->m_expanded_port_identifiers_to_expressions, verilog_module->m_expanded_port_identifiers_to_expressions.end()),
-                                       std::make_pair<const std::string&, const std::string&>);
-                    }
-                    else
-                    {
-                        port->m_expanded_identifiers                                                   = {port->m_identifier};
-                        verilog_module->m_expanded_port_identifiers_to_expressions[port->m_identifier] = port->m_expression;
-                    }
-                }
-            }
-
-            // expand signals
-            for (auto& signal : verilog_module->m_signals)
+            if (res.is_error())
             {
-                if (!signal->m_ranges.empty())
-                {
-                    signal->m_expanded_names = expand_ranges(signal->m_name, signal->m_ranges);
-                }
-                else
-                {
-                    signal->m_expanded_names = std::vector<std::string>({signal->m_name});
-                }
-            }
-
-            // expand assignments
-            for (auto& assignment : verilog_module->m_assignments)
-            {
-                const std::vector<std::string> left_signals  = expand_assignment_expression(verilog_module, assignment.m_variable);
-                const std::vector<std::string> right_signals = expand_assignment_expression(verilog_module, assignment.m_assignment);
-                if (left_signals.empty() || right_signals.empty())
-                {
-                    return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand assignments within module '" + verilog_module->m_name + "'");
-                }
-
-                u32 left_size  = left_signals.size();
-                u32 right_size = right_signals.size();
-                if (left_size <= right_size)
-                {
-                    // cut off redundant bits
-                    for (u32 i = 0; i < left_size; i++)
-                    {
-                        verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
-                    }
-                }
-                else
-                {
-                    for (u32 i = 0; i < right_size; i++)
-                    {
-                        verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
-                    }
-
-                    // implicit "0"
-                    for (u32 i = 0; i < left_size - right_size; i++)
-                    {
-                        verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i + right_size), "'0'"));
-                    }
-                }
+                return res;
             }
         }
 
         // expand module port assignments
-        for (auto& [module_name, verilog_module] : m_modules_by_name)
+        // this only reads the already expanded ports of instantiated modules, hence modules can again be processed independently
+        expansion_results = run_in_parallel(m_modules.size(), [this](const u32 index) { return expand_module_port_assignments(m_modules.at(index).get()); });
+        for (const auto& res : expansion_results)
         {
-            for (auto& instance : verilog_module->m_instances)
+            if (res.is_error())
             {
-                if (auto module_it = m_modules_by_name.find(instance->m_type); module_it != m_modules_by_name.end())
-                {
-                    instance->m_is_module = true;
-                    if (!instance->m_port_assignments.empty())
-                    {
-                        // all port assignments by name
-                        if (instance->m_port_assignments.front().m_port_name.has_value())
-                        {
-                            for (const auto& port_assignment : instance->m_port_assignments)
-                            {
-                                const std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
-                                if (!right_port.empty())
-                                {
-                                    VerilogPort* port;
-                                    if (const auto port_it = module_it->second->m_ports_by_identifier.find(port_assignment.m_port_name.value());
-                                        port_it == module_it->second->m_ports_by_identifier.end())
-                                    {
-                                        return ERR("could not parse Verilog file '" + m_path.string() + "': unable to assign signal to port '" + port_assignment.m_port_name.value()
-                                                   + "' as it is not a port of module '" + module_it->first + "'");
-                                    }
-                                    else
-                                    {
-                                        port = port_it->second;
-                                    }
-                                    const std::vector<std::string>& left_port = port->m_expanded_identifiers;
-                                    if (left_port.empty())
-                                    {
-                                        return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand port assignment");
-                                    }
-
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
-
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
-                                }
-                            }
-                        }
-                        // all port assignments by order
-                        else
-                        {
-                            std::vector<std::string> ports;
-                            for (const auto& port : m_modules_by_name.at(instance->m_type)->m_ports)
-                            {
-                                ports.insert(ports.end(), port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
-                            }
-
-                            auto port_it = ports.begin();
-
-                            for (const auto& port_assignment : instance->m_port_assignments)
-                            {
-                                std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
-                                if (!right_port.empty())
-                                {
-                                    std::vector<std::string> left_port;
-
-                                    for (u32 i = 0; i < right_port.size() && port_it != ports.end(); i++)
-                                    {
-                                        left_port.push_back(*port_it++);
-                                    }
-
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
-
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+                return res;
             }
         }
 
@@ -357,23 +252,45 @@ namespace hal
     // ###########          Parse HDL into Intermediate Format          ##########
     // ###########################################################################
 
-    void VerilogParser::tokenize()
+    bool VerilogParser::tokenize_next_module()
     {
         const std::string delimiters = "`,()[]{}\\#*: ;=./";
         std::string current_token;
-        u32 line_number = 0;
+        bool current_token_escaped = false;
+
+        auto& data          = m_tokenizer.m_data;
+        auto& position      = m_tokenizer.m_position;
+        auto& line_number   = m_tokenizer.m_line_number;
+        auto& prev_char     = m_tokenizer.m_prev_char;
+        auto& in_string     = m_tokenizer.m_in_string;
+        auto& escaped       = m_tokenizer.m_escaped;
+        auto& in_comment    = m_tokenizer.m_in_comment;
+        auto& parsed_tokens = m_tokenizer.m_tokens;
+        auto& module_ends   = m_tokenizer.m_module_ends;
 
-        std::string line;
-        char prev_char  = 0;
-        bool in_string  = false;
-        bool escaped    = false;
-        bool in_comment = false;
+        // remembers the end of a module unless the keyword is part of an escaped identifier
+        auto push_current_token = [&]() {
+            if (!current_token_escaped && current_token == "endmodule")
+            {
+                module_ends.push_back(parsed_tokens.size());
+            }
+            parsed_tokens.emplace_back(line_number, current_token);
+            current_token.clear();
+            current_token_escaped = false;
+        };
 
-        std::vector<Token<std::string>> parsed_tokens;
-        while (std::getline(m_fs, line))
+        // tokenize line by line until the end of a module has been read
+        while (module_ends.empty() && position < data.size())
         {
+            auto line_end = data.find('\n', position);
+            if (line_end == std::string_view::npos)
+            {
+                line_end = data.size();
+            }
+            const std::string_view line = data.substr(position, line_end - position);
+            position                    = line_end + 1;
+
             line_number++;
-            // this->remove_comments(line, multi_line_comment);
 
             for (char c : line)
             {
@@ -408,6 +325,7 @@ namespace hal
                 if (!in_comment && ((!std::isspace(c) && delimiters.find(c) == std::string::npos) || escaped || in_string))
                 {
                     current_token += c;
+                    current_token_escaped |= escaped;
                 }
                 else
                 {
@@ -419,12 +337,13 @@ namespace hal
                         {
                             parsed_tokens.pop_back();
                             parsed_tokens.back() += "." + current_token;
+                            current_token.clear();
+                            current_token_escaped = false;
                         }
                         else
                         {
-                            parsed_tokens.emplace_back(line_number, current_token);
+                            push_current_token();
                         }
-                        current_token.clear();
                     }
 
                     if (!parsed_tokens.empty())
@@ -467,15 +386,111 @@ namespace hal
             }
             if (!current_token.empty())
             {
-                parsed_tokens.emplace_back(line_number, current_token);
-                current_token.clear();
+                push_current_token();
+            }
+        }
+
+        if (parsed_tokens.empty())
+        {
+            return false;
+        }
+
+        // hand all tokens up to the end of the module over to the parser and keep the remaining ones of the line for the next module
+        std::vector<Token<std::string>> module_tokens;
+        if (module_ends.empty() || module_ends.front() + 1 == parsed_tokens.size())
+        {
+            module_tokens = std::move(parsed_tokens);
+            parsed_tokens.clear();
+            module_ends.clear();
+        }
+        else
+        {
+            const u64 split = module_ends.front() + 1;
+            module_tokens.assign(std::make_move_iterator(parsed_tokens.begin()), std::make_move_iterator(parsed_tokens.begin() + split));
+            parsed_tokens.erase(parsed_tokens.begin(), parsed_tokens.begin() + split);
+            module_ends.erase(module_ends.begin());
+            for (auto& module_end : module_ends)
+            {
+                module_end -= split;
             }
         }
 
-        m_token_stream = TokenStream(parsed_tokens, {"(", "["}, {")", "]"});
+        m_token_stream = TokenStream(std::move(module_tokens), {"(", "["}, {")", "]"});
+        return true;
     }
 
     Result<std::monostate> VerilogParser::parse_tokens()
+    {
+        // modules are tokenized one after another and then parsed in batches on multiple threads, the number of tokens per batch is limited to bound the memory consumption
+        const u64 max_batch_tokens = 1 << 22;
+
+        std::vector<TokenStream<std::string>> batch;
+        u64 batch_tokens = 0;
+        bool tokens_left = true;
+        while (tokens_left)
+        {
+            tokens_left = tokenize_next_module();
+            if (tokens_left)
+            {
+                batch_tokens += m_token_stream.size();
+                batch.push_back(std::move(m_token_stream));
+            }
+
+            if (!batch.empty() && (!tokens_left || batch_tokens >= max_batch_tokens))
+            {
+                if (auto res = parse_module_batch(batch); res.is_error())
+                {
+                    return res;
+                }
+                batch.clear();
+                batch_tokens = 0;
+            }
+        }
+
+        return OK({});
+    }
+
+    Result<std::monostate> VerilogParser::parse_module_batch(std::vector<TokenStream<std::string>>& batch)
+    {
+        // every token stream is parsed by a parser of its own, so that no state is shared between threads
+        std::vector<VerilogParser> batch_parsers(batch.size());
+        auto batch_results = run_in_parallel(batch.size(), [this, &batch, &batch_parsers](const u32 index) {
+            VerilogParser& batch_parser = batch_parsers.at(index);
+            batch_parser.m_path         = m_path;
+            batch_parser.m_token_stream = std::move(batch.at(index));
+            return batch_parser.parse_module_tokens();
+        });
+
+        // merge the parsed modules in file order to get the same result as parsing them sequentially
+        for (u32 i = 0; i < batch.size(); i++)
+        {
+            if (batch_results.at(i).is_error())
+            {
+                return batch_results.at(i);
+            }
+
+            for (auto& verilog_module : batch_parsers.at(i).m_modules)
+            {
+                const std::string& module_name = verilog_module->m_name;
+                if (const auto it = m_modules_by_name.find(module_name); it != m_modules_by_name.end())
+                {
+                    return ERR_APPEND(Error(__FILE__,
+                                            __LINE__,
+                                            "could not parse module '" + module_name + "' (line " + std::to_string(verilog_module->m_line_number)
+                                                + "): a module with the same name already exists (line " + std::to_string(it->second->m_line_number) + ")"),
+                                      "could not parse tokens: unable to parse module (line " + std::to_string(verilog_module->m_line_number) + ")");
+                }
+
+                m_modules_by_name[module_name] = verilog_module.get();
+                m_last_module                  = module_name;
+                m_modules.push_back(std::move(verilog_module));
+            }
+        }
+
+        return OK({});
+    }
+
+    Result<std::monostate> VerilogParser::parse_module_tokens()
     {
         std::vector<VerilogDataEntry> attributes;
         u32 line_number;
@@ -1100,6 +1115,176 @@ namespace hal
     // ###########      Assemble Netlist from Intermediate Format       ##########
     // ###########################################################################
 
+    Result<std::monostate> VerilogParser::expand_module(VerilogModule* verilog_module) const
+    {
+        // expand port identifiers
+        for (const auto& port : verilog_module->m_ports)
+        {
+            if (port->m_expression == port->m_identifier)
+            {
+                if (!port->m_ranges.empty())
+                {
+                    port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
+                }
+                else
+                {
+                    port->m_expanded_identifiers = {port->m_identifier};
+                }
+            }
+            else
+            {
+                if (!port->m_ranges.empty())
+                {
+                    port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
+                    auto expanded_expression     = expand_ranges(port->m_expression, port->m_ranges);
+
+                    std::transform(port->m_expanded_identifiers.begin(),
+                                   port->m_expanded_identifiers.end(),
+                                   expanded_expression.begin(),
+                                   std::inserter(verilog_module->m_expanded_port_identifiers_to_expressions, verilog_module->m_expanded_port_identifiers_to_expressions.end()),
+                                   std::make_pair<const std::string&, const std::string&>);
+                }
+                else
+                {
+                    port->m_expanded_identifiers                                                   = {port->m_identifier};
+                    verilog_module->m_expanded_port_identifiers_to_expressions[port->m_identifier] = port->m_expression;
+                }
+            }
+        }
+
+        // expand signals
+        for (auto& signal : verilog_module->m_signals)
+        {
+            if (!signal->m_ranges.empty())
+            {
+                signal->m_expanded_names = expand_ranges(signal->m_name, signal->m_ranges);
+            }
+            else
+            {
+                signal->m_expanded_names = std::vector<std::string>({signal->m_name});
+            }
+        }
+
+        // expand assignments
+        for (auto& assignment : verilog_module->m_assignments)
+        {
+            const std::vector<std::string> left_signals  = expand_assignment_expression(verilog_module, assignment.m_variable);
+            const std::vector<std::string> right_signals = expand_assignment_expression(verilog_module, assignment.m_assignment);
+            if (left_signals.empty() || right_signals.empty())
+            {
+                return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand assignments within module '" + verilog_module->m_name + "'");
+            }
+
+            u32 left_size  = left_signals.size();
+            u32 right_size = right_signals.size();
+            if (left_size <= right_size)
+            {
+                // cut off redundant bits
+                for (u32 i = 0; i < left_size; i++)
+                {
+                    verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
+                }
+            }
+            else
+            {
+                for (u32 i = 0; i < right_size; i++)
+                {
+                    verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
+                }
+
+                // implicit "0"
+                for (u32 i = 0; i < left_size - right_size; i++)
+                {
+                    verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i + right_size), "'0'"));
+                }
+            }
+        }
+
+        return OK({});
+    }
+
+    Result<std::monostate> VerilogParser::expand_module_port_assignments(VerilogModule* verilog_module) const
+    {
+        for (auto& instance : verilog_module->m_instances)
+        {
+            if (auto module_it = m_modules_by_name.find(instance->m_type); module_it != m_modules_by_name.end())
+            {
+                instance->m_is_module = true;
+                if (!instance->m_port_assignments.empty())
+                {
+                    // all port assignments by name
+                    if (instance->m_port_assignments.front().m_port_name.has_value())
+                    {
+                        for (const auto& port_assignment : instance->m_port_assignments)
+                        {
+                            const std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+                            if (!right_port.empty())
+                            {
+                                VerilogPort* port;
+                                if (const auto port_it = module_it->second->m_ports_by_identifier.find(port_assignment.m_port_name.value());
+                                    port_it == module_it->second->m_ports_by_identifier.end())
+                                {
+                                    return ERR("could not parse Verilog file '" + m_path.string() + "': unable to assign signal to port '" + port_assignment.m_port_name.value()
+                                               + "' as it is not a port of module '" + module_it->first + "'");
+                                }
+                                else
+                                {
+                                    port = port_it->second;
+                                }
+                                const std::vector<std::string>& left_port = port->m_expanded_identifiers;
+                                if (left_port.empty())
+                                {
+                                    return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand port assignment");
+                                }
+
+                                u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+
+                                for (u32 i = 0; i < max_size; i++)
+                                {
+                                    instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
+                                }
+                            }
+                        }
+                    }
+                    // all port assignments by order
+                    else
+                    {
+                        std::vector<std::string> ports;
+                        for (const auto& port : m_modules_by_name.at(instance->m_type)->m_ports)
+                        {
+                            ports.insert(ports.end(), port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
+                        }
+
+                        auto port_it = ports.begin();
+
+                        for (const auto& port_assignment : instance->m_port_assignments)
+                        {
+                            std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+                            if (!right_port.empty())
+                            {
+                                std::vector<std::string> left_port;
+
+                                for (u32 i = 0; i < right_port.size() && port_it != ports.end(); i++)
+                                {
+                                    left_port.push_back(*port_it++);
+                                }
+
+                                u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+
+                                for (u32 i = 0; i < max_size; i++)
+                                {
+                                    instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return OK({});
+    }
+
     Result<std::monostate> VerilogParser::construct_netlist(VerilogModule* top_module)
     {
         m_netlist->set_design_name(top_module->m_name);
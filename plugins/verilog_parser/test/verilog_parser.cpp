@@ -5,6 +5,7 @@
 
 #include <bitset>
 #include <filesystem>
+#include <sstream>
 
 namespace hal {
 
@@ -1986,6 +1987,115 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing the correct splitting of the input into modules, which are tokenized one at a time, if several modules
+     * share a line and the keyword 'endmodule' appears within comments.
+     *
+     * Functions: parse
+     */
+    TEST_F(VerilogParserTest, check_modules_on_one_line)
+    {
+        TEST_START
+        {
+            std::string netlist_input("module MODULE_CHILD (child_in, child_out); input child_in; output child_out; wire net_0_child; "
+                                      "BUF gate_0_child (.I (child_in), .O (net_0_child)); BUF gate_1_child (.I (net_0_child), .O (child_out)); "
+                                      "endmodule /* endmodule */ module MODULE_TOP (net_global_in, net_global_out); // endmodule\n"
+                                      "input net_global_in; output net_global_out; wire net_0; "
+                                      "MODULE_CHILD child_mod (.child_in (net_global_in), .child_out (net_0)); BUF gate_0 (.I (net_0), .O (net_global_out)); endmodule");
+            const GateLibrary* gate_lib = test_utils::get_gate_library();
+            auto verilog_file = test_utils::create_sandbox_file("netlist.v", netlist_input);
+            VerilogParser verilog_parser;
+            auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+            ASSERT_TRUE(nl_res.is_ok());
+            std::unique_ptr<Netlist> nl = nl_res.get();
+            ASSERT_NE(nl, nullptr);
+
+            EXPECT_EQ(nl->get_gates().size(), 3);
+            EXPECT_EQ(nl->get_modules().size(), 2);
+            ASSERT_EQ(nl->get_nets(test_utils::net_name_filter("net_0_child")).size(), 1);
+            Net* net_0_child = *nl->get_nets(test_utils::net_name_filter("net_0_child")).begin();
+
+            Gate* gate_0_child = *nl->get_gates(test_utils::gate_filter("BUF", "gate_0_child")).begin();
+            ASSERT_NE(gate_0_child, nullptr);
+            Gate* gate_1_child = *nl->get_gates(test_utils::gate_filter("BUF", "gate_1_child")).begin();
+            ASSERT_NE(gate_1_child, nullptr);
+            EXPECT_EQ(gate_0_child->get_fan_out_net("O"), net_0_child);
+            EXPECT_EQ(gate_1_child->get_fan_in_net("I"), net_0_child);
+            EXPECT_EQ(gate_0_child->get_module(), gate_1_child->get_module());
+            EXPECT_NE(gate_0_child->get_module(), nl->get_top_module());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the parsing of a netlist consisting of many modules, which are parsed concurrently. The resulting netlist
+     * must not depend on the order in which modules are parsed, and module names must be unique across the whole file.
+     *
+     * Functions: parse
+     */
+    TEST_F(VerilogParserTest, check_many_modules)
+    {
+        TEST_START
+        {
+            const u32 num_modules = 200;
+            std::stringstream netlist_input;
+            netlist_input << "module MODULE_0 (mod_in, mod_out); input mod_in; output mod_out; BUF gate_0 (.I (mod_in), .O (mod_out)); endmodule\n";
+            for (u32 i = 1; i < num_modules; i++)
+            {
+                netlist_input << "module MODULE_" << i << " (mod_in, mod_out); input mod_in; output mod_out; wire net_0;\n"
+                              << "MODULE_" << (i - 1) << " child_mod (.mod_in (mod_in), .mod_out (net_0));\n"
+                              << "BUF gate_0 (.I (net_0), .O (mod_out));\n"
+                              << "endmodule\n";
+            }
+            const GateLibrary* gate_lib = test_utils::get_gate_library();
+            auto verilog_file           = test_utils::create_sandbox_file("netlist.v", netlist_input.str());
+
+            std::vector<std::pair<u32, std::string>> reference;
+            for (u32 run = 0; run < 2; run++)
+            {
+                VerilogParser verilog_parser;
+                auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+                ASSERT_TRUE(nl_res.is_ok());
+                std::unique_ptr<Netlist> nl = nl_res.get();
+                ASSERT_NE(nl, nullptr);
+
+                EXPECT_EQ(nl->get_gates().size(), num_modules);
+                EXPECT_EQ(nl->get_modules().size(), num_modules);
+                EXPECT_EQ(nl->get_top_module()->get_type(), "MODULE_" + std::to_string(num_modules - 1));
+
+                std::vector<std::pair<u32, std::string>> gates;
+                for (const Gate* gate : nl->get_gates())
+                {
+                    gates.push_back({gate->get_id(), gate->get_name()});
+                }
+                std::sort(gates.begin(), gates.end());
+                if (run == 0)
+                {
+                    reference = gates;
+                }
+                else
+                {
+                    EXPECT_EQ(gates, reference);
+                }
+            }
+        }
+        {
+            // duplicate module names in different parts of the file
+            std::stringstream netlist_input;
+            for (u32 i = 0; i < 50; i++)
+            {
+                netlist_input << "module MODULE_" << i << " (mod_in, mod_out); input mod_in; output mod_out; BUF gate_0 (.I (mod_in), .O (mod_out)); endmodule\n";
+            }
+            netlist_input << "module MODULE_3 (mod_in, mod_out); input mod_in; output mod_out; BUF gate_0 (.I (mod_in), .O (mod_out)); endmodule\n";
+
+            const GateLibrary* gate_lib = test_utils::get_gate_library();
+            auto verilog_file           = test_utils::create_sandbox_file("netlist.v", netlist_input.str());
+            VerilogParser verilog_parser;
+            EXPECT_TRUE(verilog_parser.parse_and_instantiate(verilog_file, gate_lib).is_error());
+        }
+        TEST_END
+    }
+
     /**
      * Testing the correct handling of direct assignment (e.g. 'assign net_slave = net_master;'), where two
      * (wire-)identifiers address the same Net. The Net (wire) at the left side of the expression is mapped to the Net
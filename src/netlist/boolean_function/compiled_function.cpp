@@ -0,0 +1,366 @@
+#include "hal_core/netlist/boolean_function/compiled_function.h"
+
+namespace hal
+{
+    namespace
+    {
+        using Value = BooleanFunction::Value;
+
+        /// Three-valued AND, OR, and XOR indexed by `(p0 + 2) * 4 + (p1 + 2)`, i.e., in the order Z, X, ZERO, ONE.
+        constexpr Value AND_TABLE[16] = {
+            Value::X, Value::X, Value::ZERO, Value::X,       // Z
+            Value::X, Value::X, Value::ZERO, Value::X,       // X
+            Value::ZERO, Value::ZERO, Value::ZERO, Value::ZERO,    // ZERO
+            Value::X, Value::X, Value::ZERO, Value::ONE,     // ONE
+        };
+        constexpr Value OR_TABLE[16] = {
+            Value::X, Value::X, Value::X, Value::ONE,    // Z
+            Value::X, Value::X, Value::X, Value::ONE,    // X
+            Value::X, Value::X, Value::ZERO, Value::ONE,    // ZERO
+            Value::ONE, Value::ONE, Value::ONE, Value::ONE,    // ONE
+        };
+        constexpr Value XOR_TABLE[16] = {
+            Value::X, Value::X, Value::X, Value::X,       // Z
+            Value::X, Value::X, Value::X, Value::X,       // X
+            Value::X, Value::X, Value::ZERO, Value::ONE,    // ZERO
+            Value::X, Value::X, Value::ONE, Value::ZERO,    // ONE
+        };
+        /// Three-valued NOT indexed by `p0 + 2`, an unknown value stays what it was.
+        constexpr Value NOT_TABLE[4] = {Value::Z, Value::X, Value::ONE, Value::ZERO};
+
+        inline u32 table_index(Value p0, Value p1)
+        {
+            return static_cast<u32>(p0 + 2) * 4 + static_cast<u32>(p1 + 2);
+        }
+    }    // namespace
+
+    BooleanFunction::Value CompiledBooleanFunction::Lanes::get(u32 lane) const
+    {
+        const u64 bit = u64(1) << lane;
+        if ((known & bit) == 0)
+        {
+            return BooleanFunction::Value::X;
+        }
+        return (value & bit) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO;
+    }
+
+    void CompiledBooleanFunction::Lanes::set(u32 lane, BooleanFunction::Value v)
+    {
+        const u64 bit = u64(1) << lane;
+        value &= ~bit;
+        known &= ~bit;
+        if (v == BooleanFunction::Value::ONE)
+        {
+            value |= bit;
+            known |= bit;
+        }
+        else if (v == BooleanFunction::Value::ZERO)
+        {
+            known |= bit;
+        }
+    }
+
+    CompiledBooleanFunction::Lanes CompiledBooleanFunction::Lanes::broadcast(BooleanFunction::Value v)
+    {
+        switch (v)
+        {
+            case BooleanFunction::Value::ONE:
+                return {~u64(0), ~u64(0)};
+            case BooleanFunction::Value::ZERO:
+                return {0, ~u64(0)};
+            default:
+                return {0, 0};
+        }
+    }
+
+    CompiledBooleanFunction::Operand CompiledBooleanFunction::make_operand(u32 kind, u32 index)
+    {
+        return (kind << OPERAND_KIND_SHIFT) | index;
+    }
+
+    CompiledBooleanFunction::Operand CompiledBooleanFunction::make_constant(BooleanFunction::Value value)
+    {
+        return make_operand(OPERAND_CONSTANT, static_cast<u32>(value + 2));
+    }
+
+    bool CompiledBooleanFunction::is_constant(Operand operand)
+    {
+        return (operand >> OPERAND_KIND_SHIFT) == OPERAND_CONSTANT;
+    }
+
+    BooleanFunction::Value CompiledBooleanFunction::get_constant(Operand operand)
+    {
+        return static_cast<BooleanFunction::Value>(static_cast<i32>(operand & OPERAND_INDEX_MASK) - 2);
+    }
+
+    BooleanFunction::Value CompiledBooleanFunction::apply(u16 type, BooleanFunction::Value p0, BooleanFunction::Value p1, BooleanFunction::Value p2)
+    {
+        switch (type)
+        {
+            case BooleanFunction::NodeType::And:
+                return AND_TABLE[table_index(p0, p1)];
+            case BooleanFunction::NodeType::Or:
+                return OR_TABLE[table_index(p0, p1)];
+            case BooleanFunction::NodeType::Xor:
+                return XOR_TABLE[table_index(p0, p1)];
+            case BooleanFunction::NodeType::Not:
+                return NOT_TABLE[p0 + 2];
+            case BooleanFunction::NodeType::Ite:
+                return (p0 == BooleanFunction::Value::ONE) ? p1 : ((p0 == BooleanFunction::Value::ZERO) ? p2 : BooleanFunction::Value::X);
+            default:
+                return BooleanFunction::Value::X;
+        }
+    }
+
+    Result<CompiledBooleanFunction> CompiledBooleanFunction::compile(const BooleanFunction& function, const std::vector<std::string>& slots)
+    {
+        CompiledBooleanFunction compiled;
+        compiled.m_slot_count = slots.size();
+
+        // an empty function evaluates to X, just like BooleanFunction::evaluate() does
+        if (function.is_empty())
+        {
+            return OK(compiled);
+        }
+
+        if (function.size() != 1)
+        {
+            return ERR("could not compile Boolean function '" + function.to_string() + "': only single-bit Boolean functions can be compiled");
+        }
+
+        if (slots.size() > OPERAND_INDEX_MASK)
+        {
+            return ERR("could not compile Boolean function '" + function.to_string() + "': too many slots");
+        }
+
+        std::unordered_map<std::string, u32> slot_index;
+        for (u32 i = 0; i < slots.size(); i++)
+        {
+            slot_index.emplace(slots.at(i), i);
+        }
+
+        const auto& nodes = function.get_nodes();
+        std::vector<Operand> stack;
+        stack.reserve(nodes.size());
+
+        for (const auto& node : nodes)
+        {
+            if (node.size != 1)
+            {
+                return ERR("could not compile Boolean function '" + function.to_string() + "': node '" + node.to_string() + "' is not single-bit");
+            }
+
+            switch (node.type)
+            {
+                case BooleanFunction::NodeType::Constant:
+                    stack.push_back(make_constant(node.constant.front()));
+                    continue;
+                case BooleanFunction::NodeType::Variable:
+                    if (const auto it = slot_index.find(node.variable); it != slot_index.end())
+                    {
+                        stack.push_back(make_operand(OPERAND_SLOT, it->second));
+                        continue;
+                    }
+                    return ERR("could not compile Boolean function '" + function.to_string() + "': no slot for variable '" + node.variable + "'");
+                case BooleanFunction::NodeType::And:
+                case BooleanFunction::NodeType::Or:
+                case BooleanFunction::NodeType::Not:
+                case BooleanFunction::NodeType::Xor:
+                case BooleanFunction::NodeType::Ite:
+                    break;
+                default:
+                    return ERR("could not compile Boolean function '" + function.to_string() + "': node type of '" + node.to_string() + "' is not supported");
+            }
+
+            const u16 arity = node.get_arity();
+            if (stack.size() < arity)
+            {
+                return ERR("could not compile Boolean function '" + function.to_string() + "': malformed node list");
+            }
+
+            Instruction instruction{node.type, make_constant(BooleanFunction::Value::X), make_constant(BooleanFunction::Value::X), make_constant(BooleanFunction::Value::X)};
+            Operand* parameters[3] = {&instruction.p0, &instruction.p1, &instruction.p2};
+            for (u16 i = 0; i < arity; i++)
+            {
+                *parameters[i] = stack[stack.size() - arity + i];
+            }
+            stack.resize(stack.size() - arity);
+
+            // fold operations on constants right away, so that tied-off inputs do not cost anything during evaluation
+            if (is_constant(instruction.p0) && is_constant(instruction.p1) && is_constant(instruction.p2))
+            {
+                stack.push_back(make_constant(apply(instruction.type, get_constant(instruction.p0), get_constant(instruction.p1), get_constant(instruction.p2))));
+                continue;
+            }
+
+            stack.push_back(make_operand(OPERAND_REGISTER, compiled.m_program.size()));
+            compiled.m_program.push_back(instruction);
+        }
+
+        if (stack.size() != 1)
+        {
+            return ERR("could not compile Boolean function '" + function.to_string() + "': malformed node list");
+        }
+
+        compiled.m_result = stack.back();
+        return OK(compiled);
+    }
+
+    void CompiledBooleanFunction::run(const BooleanFunction::Value* slots, BooleanFunction::Value* registers) const
+    {
+        const auto fetch = [slots, registers](Operand operand) {
+            switch (operand >> OPERAND_KIND_SHIFT)
+            {
+                case OPERAND_SLOT:
+                    return slots[operand & OPERAND_INDEX_MASK];
+                case OPERAND_REGISTER:
+                    return registers[operand & OPERAND_INDEX_MASK];
+                default:
+                    return get_constant(operand);
+            }
+        };
+
+        for (u32 i = 0; i < m_program.size(); i++)
+        {
+            const Instruction& instruction = m_program[i];
+            switch (instruction.type)
+            {
+                case BooleanFunction::NodeType::And:
+                    registers[i] = AND_TABLE[table_index(fetch(instruction.p0), fetch(instruction.p1))];
+                    break;
+                case BooleanFunction::NodeType::Or:
+                    registers[i] = OR_TABLE[table_index(fetch(instruction.p0), fetch(instruction.p1))];
+                    break;
+                case BooleanFunction::NodeType::Xor:
+                    registers[i] = XOR_TABLE[table_index(fetch(instruction.p0), fetch(instruction.p1))];
+                    break;
+                case BooleanFunction::NodeType::Not:
+                    registers[i] = NOT_TABLE[fetch(instruction.p0) + 2];
+                    break;
+                default:
+                    registers[i] = apply(instruction.type, fetch(instruction.p0), fetch(instruction.p1), fetch(instruction.p2));
+                    break;
+            }
+        }
+    }
+
+    void CompiledBooleanFunction::run(const Lanes* slots, Lanes* registers) const
+    {
+        const auto fetch = [slots, registers](Operand operand) {
+            switch (operand >> OPERAND_KIND_SHIFT)
+            {
+                case OPERAND_SLOT:
+                    return slots[operand & OPERAND_INDEX_MASK];
+                case OPERAND_REGISTER:
+                    return registers[operand & OPERAND_INDEX_MASK];
+                default:
+                    return Lanes::broadcast(get_constant(operand));
+            }
+        };
+
+        // a lane is known to be one if its value bit is set, as the value bits of unknown lanes are always kept clear
+        for (u32 i = 0; i < m_program.size(); i++)
+        {
+            const Instruction& instruction = m_program[i];
+            const Lanes p0                 = fetch(instruction.p0);
+            Lanes& res                     = registers[i];
+            switch (instruction.type)
+            {
+                case BooleanFunction::NodeType::And: {
+                    const Lanes p1  = fetch(instruction.p1);
+                    const u64 zeros = (p0.known & ~p0.value) | (p1.known & ~p1.value);
+                    res.value       = p0.value & p1.value;
+                    res.known       = zeros | res.value;
+                    break;
+                }
+                case BooleanFunction::NodeType::Or: {
+                    const Lanes p1 = fetch(instruction.p1);
+                    res.value      = p0.value | p1.value;
+                    res.known      = res.value | (p0.known & p1.known);
+                    break;
+                }
+                case BooleanFunction::NodeType::Xor: {
+                    const Lanes p1 = fetch(instruction.p1);
+                    res.known      = p0.known & p1.known;
+                    res.value      = (p0.value ^ p1.value) & res.known;
+                    break;
+                }
+                case BooleanFunction::NodeType::Not: {
+                    res.known = p0.known;
+                    res.value = p0.known & ~p0.value;
+                    break;
+                }
+                case BooleanFunction::NodeType::Ite: {
+                    const Lanes p1   = fetch(instruction.p1);
+                    const Lanes p2   = fetch(instruction.p2);
+                    const u64 select = p0.value;
+                    const u64 other  = p0.known & ~p0.value;
+                    res.value        = (select & p1.value) | (other & p2.value);
+                    res.known        = (select & p1.known) | (other & p2.known);
+                    break;
+                }
+                default:
+                    res = Lanes();
+                    break;
+            }
+        }
+    }
+
+    CompiledBooleanFunction::Lanes CompiledBooleanFunction::evaluate(const Lanes* slots) const
+    {
+        switch (m_result >> OPERAND_KIND_SHIFT)
+        {
+            case OPERAND_SLOT:
+                return slots[m_result & OPERAND_INDEX_MASK];
+            case OPERAND_CONSTANT:
+                return Lanes::broadcast(get_constant(m_result));
+            default:
+                break;
+        }
+
+        if (m_program.size() <= STACK_REGISTERS)
+        {
+            Lanes registers[STACK_REGISTERS];
+            run(slots, registers);
+            return registers[m_result & OPERAND_INDEX_MASK];
+        }
+
+        std::vector<Lanes> registers(m_program.size());
+        run(slots, registers.data());
+        return registers[m_result & OPERAND_INDEX_MASK];
+    }
+
+    BooleanFunction::Value CompiledBooleanFunction::evaluate(const BooleanFunction::Value* slots) const
+    {
+        switch (m_result >> OPERAND_KIND_SHIFT)
+        {
+            case OPERAND_SLOT:
+                return slots[m_result & OPERAND_INDEX_MASK];
+            case OPERAND_CONSTANT:
+                return get_constant(m_result);
+            default:
+                break;
+        }
+
+        if (m_program.size() <= STACK_REGISTERS)
+        {
+            BooleanFunction::Value registers[STACK_REGISTERS];
+            run(slots, registers);
+            return registers[m_result & OPERAND_INDEX_MASK];
+        }
+
+        std::vector<BooleanFunction::Value> registers(m_program.size());
+        run(slots, registers.data());
+        return registers[m_result & OPERAND_INDEX_MASK];
+    }
+
+    u32 CompiledBooleanFunction::get_slot_count() const
+    {
+        return m_slot_count;
+    }
+
+    u32 CompiledBooleanFunction::get_instruction_count() const
+    {
+        return m_program.size();
+    }
+}    // namespace hal
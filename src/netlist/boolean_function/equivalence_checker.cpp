@@ -0,0 +1,629 @@
+#include "hal_core/netlist/boolean_function/equivalence_checker.h"
+
+#include "hal_core/netlist/boolean_function/solver_session.h"
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <unordered_map>
+
+namespace hal
+{
+    namespace SMT
+    {
+        namespace
+        {
+            /// The number of words of 64 lanes each that are simulated in one pass over the node list.
+            constexpr u32 BLOCK_WORDS = 64;
+
+            /// The input patterns of the six least significant input bits of a truth table, which repeat in every word.
+            constexpr u64 TRUTH_TABLE_PATTERNS[6] = {
+                0xAAAAAAAAAAAAAAAAull,
+                0xCCCCCCCCCCCCCCCCull,
+                0xF0F0F0F0F0F0F0F0ull,
+                0xFF00FF00FF00FF00ull,
+                0xFFFF0000FFFF0000ull,
+                0xFFFFFFFF00000000ull,
+            };
+
+            /**
+             * The values of a bit-vector for a block of input assignments, or the value of an index operand.
+             * Every bit takes up `num_words` consecutive words of 64 lanes each, starting at the least significant bit.
+             */
+            struct Lanes
+            {
+                std::vector<u64> words;
+                u16 index = 0;
+            };
+
+            u64 next_random(u64& state)
+            {
+                // splitmix64
+                u64 z = (state += 0x9E3779B97F4A7C15ull);
+                z     = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z     = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                return z ^ (z >> 31);
+            }
+
+            /**
+             * Checks whether a Boolean function can be simulated on two-valued inputs, i.e., whether it does not divide and does not contain `X` or `Z` constants.
+             *
+             * @param[in] function - The Boolean function.
+             * @returns `true` if the function can be simulated, `false` otherwise.
+             */
+            bool is_simulatable(const BooleanFunction& function)
+            {
+                for (const auto& node : function.get_nodes())
+                {
+                    switch (node.type)
+                    {
+                        case BooleanFunction::NodeType::Constant:
+                            if (std::any_of(node.constant.begin(), node.constant.end(), [](auto v) { return v != BooleanFunction::Value::ZERO && v != BooleanFunction::Value::ONE; }))
+                            {
+                                return false;
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Index:
+                        case BooleanFunction::NodeType::Variable:
+                        case BooleanFunction::NodeType::And:
+                        case BooleanFunction::NodeType::Or:
+                        case BooleanFunction::NodeType::Not:
+                        case BooleanFunction::NodeType::Xor:
+                        case BooleanFunction::NodeType::Add:
+                        case BooleanFunction::NodeType::Sub:
+                        case BooleanFunction::NodeType::Mul:
+                        case BooleanFunction::NodeType::Concat:
+                        case BooleanFunction::NodeType::Slice:
+                        case BooleanFunction::NodeType::Zext:
+                        case BooleanFunction::NodeType::Sext:
+                        case BooleanFunction::NodeType::Shl:
+                        case BooleanFunction::NodeType::Lshr:
+                        case BooleanFunction::NodeType::Ashr:
+                        case BooleanFunction::NodeType::Rol:
+                        case BooleanFunction::NodeType::Ror:
+                        case BooleanFunction::NodeType::Eq:
+                        case BooleanFunction::NodeType::Sle:
+                        case BooleanFunction::NodeType::Slt:
+                        case BooleanFunction::NodeType::Ule:
+                        case BooleanFunction::NodeType::Ult:
+                        case BooleanFunction::NodeType::Ite:
+                            break;
+                        default:
+                            return false;
+                    }
+                }
+                return true;
+            }
+
+            /**
+             * Adds two bit-vectors of equal size lane by lane through a ripple carry chain.
+             *
+             * @param[in] p0 - The first summand.
+             * @param[in] p1 - The second summand.
+             * @param[in] invert_p1 - Set `true` to add the inverse of the second summand instead, which together with a carry in subtracts it.
+             * @param[in] carry_in - The carry into the least significant bit.
+             * @param[out] sum - The sum, may be `nullptr` if only the carry out is of interest.
+             * @param[in] num_words - The number of words per bit.
+             * @returns The carry out of the most significant bit.
+             */
+            std::vector<u64> add(const std::vector<u64>& p0, const std::vector<u64>& p1, bool invert_p1, bool carry_in, std::vector<u64>* sum, u32 num_words)
+            {
+                const u32 size   = p0.size() / num_words;
+                const u64 invert = invert_p1 ? ~0ull : 0;
+                std::vector<u64> carry(num_words, carry_in ? ~0ull : 0);
+                for (u32 i = 0; i < size; i++)
+                {
+                    for (u32 w = 0; w < num_words; w++)
+                    {
+                        const u64 a = p0[i * num_words + w];
+                        const u64 b = p1[i * num_words + w] ^ invert;
+                        const u64 c = carry[w];
+                        if (sum != nullptr)
+                        {
+                            (*sum)[i * num_words + w] = a ^ b ^ c;
+                        }
+                        carry[w] = (a & b) | (c & (a ^ b));
+                    }
+                }
+                return carry;
+            }
+
+            /**
+             * Computes whether the first bit-vector is smaller than the second one lane by lane.
+             *
+             * @param[in] p0 - The first bit-vector.
+             * @param[in] p1 - The second bit-vector.
+             * @param[in] is_signed - Set `true` to compare as two's complement values.
+             * @param[in] num_words - The number of words per bit.
+             * @returns The lanes in which the first bit-vector is smaller.
+             */
+            std::vector<u64> less_than(std::vector<u64> p0, std::vector<u64> p1, bool is_signed, u32 num_words)
+            {
+                if (is_signed)
+                {
+                    // flipping the sign bits maps the signed order onto the unsigned one
+                    for (u32 w = p0.size() - num_words; w < p0.size(); w++)
+                    {
+                        p0[w] = ~p0[w];
+                        p1[w] = ~p1[w];
+                    }
+                }
+
+                // p0 - p1 borrows, i.e., does not carry out, exactly if p0 < p1
+                auto result = add(p0, p1, true, true, nullptr, num_words);
+                for (auto& w : result)
+                {
+                    w = ~w;
+                }
+                return result;
+            }
+
+            /**
+             * Simulates a Boolean function for a block of input assignments.
+             *
+             * @param[in] function - The Boolean function, must pass `is_simulatable`.
+             * @param[in] inputs - The values of the variables of the function.
+             * @param[in] num_words - The number of words per bit.
+             * @returns The values of the function on success, an error otherwise.
+             */
+            Result<std::vector<u64>> simulate(const BooleanFunction& function, const std::unordered_map<std::string, std::vector<u64>>& inputs, u32 num_words)
+            {
+                std::vector<Lanes> stack;
+
+                for (const auto& node : function.get_nodes())
+                {
+                    const u32 n = num_words;
+
+                    if (node.type == BooleanFunction::NodeType::Index)
+                    {
+                        stack.push_back({{}, node.index});
+                        continue;
+                    }
+                    if (node.type == BooleanFunction::NodeType::Constant)
+                    {
+                        Lanes constant;
+                        constant.words.resize(node.size * n);
+                        for (u32 i = 0; i < node.size; i++)
+                        {
+                            std::fill_n(constant.words.begin() + i * n, n, node.constant.at(i) == BooleanFunction::Value::ONE ? ~0ull : 0);
+                        }
+                        stack.push_back(std::move(constant));
+                        continue;
+                    }
+                    if (node.type == BooleanFunction::NodeType::Variable)
+                    {
+                        const auto it = inputs.find(node.variable);
+                        if (it == inputs.end() || it->second.size() != node.size * n)
+                        {
+                            return ERR("could not simulate Boolean function '" + function.to_string() + "': no values for variable '" + node.variable + "'");
+                        }
+                        stack.push_back({it->second, 0});
+                        continue;
+                    }
+
+                    const u16 arity = node.get_arity();
+                    if (stack.size() < arity)
+                    {
+                        return ERR("could not simulate Boolean function '" + function.to_string() + "': malformed node list");
+                    }
+                    std::vector<Lanes> p(std::make_move_iterator(stack.end() - arity), std::make_move_iterator(stack.end()));
+                    stack.resize(stack.size() - arity);
+
+                    const u32 size = node.size;
+                    std::vector<u64> r(size * n, 0);
+                    const auto copy_bit = [&r, n](u32 dst, const std::vector<u64>& src, u32 src_bit) { std::copy_n(src.begin() + src_bit * n, n, r.begin() + dst * n); };
+
+                    switch (node.type)
+                    {
+                        case BooleanFunction::NodeType::And:
+                            for (u32 i = 0; i < r.size(); i++)
+                            {
+                                r[i] = p[0].words[i] & p[1].words[i];
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Or:
+                            for (u32 i = 0; i < r.size(); i++)
+                            {
+                                r[i] = p[0].words[i] | p[1].words[i];
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Xor:
+                            for (u32 i = 0; i < r.size(); i++)
+                            {
+                                r[i] = p[0].words[i] ^ p[1].words[i];
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Not:
+                            for (u32 i = 0; i < r.size(); i++)
+                            {
+                                r[i] = ~p[0].words[i];
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Add:
+                            add(p[0].words, p[1].words, false, false, &r, n);
+                            break;
+                        case BooleanFunction::NodeType::Sub:
+                            add(p[0].words, p[1].words, true, true, &r, n);
+                            break;
+                        case BooleanFunction::NodeType::Mul:
+                            // shift-and-add, every bit of the second factor adds a shifted copy of the first one
+                            for (u32 j = 0; j < size; j++)
+                            {
+                                for (u32 w = 0; w < n; w++)
+                                {
+                                    const u64 b = p[1].words[j * n + w];
+                                    u64 carry   = 0;
+                                    for (u32 i = j; i < size; i++)
+                                    {
+                                        const u64 a = p[0].words[(i - j) * n + w] & b;
+                                        const u64 s = r[i * n + w];
+                                        r[i * n + w] = s ^ a ^ carry;
+                                        carry        = (s & a) | (carry & (s ^ a));
+                                    }
+                                }
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Concat:
+                            // the second operand makes up the least significant bits
+                            std::copy(p[1].words.begin(), p[1].words.end(), r.begin());
+                            std::copy(p[0].words.begin(), p[0].words.end(), r.begin() + p[1].words.size());
+                            break;
+                        case BooleanFunction::NodeType::Slice:
+                            for (u32 i = 0; i < size; i++)
+                            {
+                                copy_bit(i, p[0].words, p[1].index + i);
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Zext:
+                        case BooleanFunction::NodeType::Sext: {
+                            const u32 src_size = p[0].words.size() / n;
+                            for (u32 i = 0; i < size; i++)
+                            {
+                                if (i < src_size)
+                                {
+                                    copy_bit(i, p[0].words, i);
+                                }
+                                else if (node.type == BooleanFunction::NodeType::Sext)
+                                {
+                                    copy_bit(i, p[0].words, src_size - 1);
+                                }
+                            }
+                            break;
+                        }
+                        case BooleanFunction::NodeType::Shl:
+                            for (u32 i = p[1].index; i < size; i++)
+                            {
+                                copy_bit(i, p[0].words, i - p[1].index);
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Lshr:
+                        case BooleanFunction::NodeType::Ashr:
+                            for (u32 i = 0; i < size; i++)
+                            {
+                                if (i + p[1].index < size)
+                                {
+                                    copy_bit(i, p[0].words, i + p[1].index);
+                                }
+                                else if (node.type == BooleanFunction::NodeType::Ashr)
+                                {
+                                    copy_bit(i, p[0].words, size - 1);
+                                }
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Rol:
+                            for (u32 i = 0; i < size; i++)
+                            {
+                                copy_bit((i + p[1].index) % size, p[0].words, i);
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Ror:
+                            for (u32 i = 0; i < size; i++)
+                            {
+                                copy_bit((i + size - p[1].index % size) % size, p[0].words, i);
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Eq: {
+                            std::fill(r.begin(), r.end(), ~0ull);
+                            for (u32 i = 0; i < p[0].words.size(); i++)
+                            {
+                                r[i % n] &= ~(p[0].words[i] ^ p[1].words[i]);
+                            }
+                            break;
+                        }
+                        case BooleanFunction::NodeType::Ult:
+                            r = less_than(std::move(p[0].words), std::move(p[1].words), false, n);
+                            break;
+                        case BooleanFunction::NodeType::Slt:
+                            r = less_than(std::move(p[0].words), std::move(p[1].words), true, n);
+                            break;
+                        case BooleanFunction::NodeType::Ule:
+                        case BooleanFunction::NodeType::Sle:
+                            // p0 <= p1 exactly if not p1 < p0
+                            r = less_than(std::move(p[1].words), std::move(p[0].words), node.type == BooleanFunction::NodeType::Sle, n);
+                            for (auto& w : r)
+                            {
+                                w = ~w;
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Ite:
+                            for (u32 i = 0; i < r.size(); i++)
+                            {
+                                const u64 c = p[0].words[i % n];
+                                r[i]        = (c & p[1].words[i]) | (~c & p[2].words[i]);
+                            }
+                            break;
+                        default:
+                            return ERR("could not simulate Boolean function '" + function.to_string() + "': node type of '" + node.to_string() + "' is not supported");
+                    }
+
+                    stack.push_back({std::move(r), 0});
+                }
+
+                if (stack.size() != 1)
+                {
+                    return ERR("could not simulate Boolean function '" + function.to_string() + "': malformed node list");
+                }
+                return OK(std::move(stack.back().words));
+            }
+
+            /**
+             * Simulates two Boolean functions and looks for an input assignment they disagree on.
+             *
+             * @param[in] lhs - The first Boolean function.
+             * @param[in] rhs - The second Boolean function.
+             * @param[in] inputs - The values of the variables of both functions.
+             * @param[in] num_words - The number of words per bit.
+             * @param[in] lane_mask - The lanes of every word that hold an input assignment.
+             * @returns The word and lane of the first assignment the functions disagree on, if any, on success, an error otherwise.
+             */
+            Result<std::optional<std::pair<u32, u32>>> find_difference(const BooleanFunction& lhs,
+                                                                       const BooleanFunction& rhs,
+                                                                       const std::unordered_map<std::string, std::vector<u64>>& inputs,
+                                                                       u32 num_words,
+                                                                       u64 lane_mask)
+            {
+                const auto lhs_res = simulate(lhs, inputs, num_words);
+                if (lhs_res.is_error())
+                {
+                    return ERR(lhs_res.get_error());
+                }
+                const auto rhs_res = simulate(rhs, inputs, num_words);
+                if (rhs_res.is_error())
+                {
+                    return ERR(rhs_res.get_error());
+                }
+                const auto& lhs_words = lhs_res.get();
+                const auto& rhs_words = rhs_res.get();
+
+                for (u32 w = 0; w < num_words; w++)
+                {
+                    u64 difference = 0;
+                    for (u32 i = w; i < lhs_words.size(); i += num_words)
+                    {
+                        difference |= lhs_words[i] ^ rhs_words[i];
+                    }
+                    difference &= lane_mask;
+                    if (difference != 0)
+                    {
+                        return OK(std::make_optional(std::make_pair(w, static_cast<u32>(__builtin_ctzll(difference)))));
+                    }
+                }
+                return OK(std::nullopt);
+            }
+
+            /// Reads the input assignment of a single lane back into a model.
+            Model extract_model(const std::map<std::string, u16>& variables, const std::unordered_map<std::string, std::vector<u64>>& inputs, u32 num_words, u32 word, u32 lane)
+            {
+                std::map<std::string, std::tuple<u64, u16>> model;
+                for (const auto& [name, size] : variables)
+                {
+                    const auto& words = inputs.at(name);
+                    u64 value         = 0;
+                    for (u32 i = 0; i < size && i < 64; i++)
+                    {
+                        value |= ((words[i * num_words + word] >> lane) & 1) << i;
+                    }
+                    model.emplace(name, std::make_tuple(value, size));
+                }
+                return Model(model);
+            }
+        }    // namespace
+
+        bool EquivalenceChecker::Verdict::is_equivalent() const
+        {
+            return result.is_unsat();
+        }
+
+        u64 EquivalenceChecker::Statistics::get_num_checks() const
+        {
+            return get_num_filtered() + solver_equivalent + solver_different + solver_unknown;
+        }
+
+        u64 EquivalenceChecker::Statistics::get_num_filtered() const
+        {
+            return truth_table_equivalent + truth_table_different + simulation_different;
+        }
+
+        std::string EquivalenceChecker::Statistics::to_string() const
+        {
+            return std::to_string(get_num_checks()) + " checks, truth table: " + std::to_string(truth_table_equivalent) + " equivalent / " + std::to_string(truth_table_different)
+                   + " different, simulation: " + std::to_string(simulation_different) + " different, solver: " + std::to_string(solver_equivalent) + " equivalent / "
+                   + std::to_string(solver_different) + " different / " + std::to_string(solver_unknown) + " unknown";
+        }
+
+        EquivalenceChecker::EquivalenceChecker(const QueryConfig& config, u32 num_simulation_rounds, u64 seed)
+            : m_config(config), m_solver_pool(SolverSessionPool::get_shared(config)), m_num_simulation_rounds(num_simulation_rounds), m_seed(seed)
+        {
+        }
+
+        const QueryConfig& EquivalenceChecker::get_config() const
+        {
+            return m_config;
+        }
+
+        Result<EquivalenceChecker::Verdict> EquivalenceChecker::check(const BooleanFunction& lhs, const BooleanFunction& rhs)
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return ERR("could not check equivalence of Boolean functions '" + lhs.to_string() + "' and '" + rhs.to_string() + "': functions are of different size");
+            }
+
+            if (is_simulatable(lhs) && is_simulatable(rhs))
+            {
+                std::map<std::string, u16> variables;
+                u32 num_input_bits = 0;
+                for (const auto* function : {&lhs, &rhs})
+                {
+                    for (const auto& node : function->get_nodes())
+                    {
+                        if (!node.is_variable())
+                        {
+                            continue;
+                        }
+                        if (const auto [it, inserted] = variables.emplace(node.variable, node.size); inserted)
+                        {
+                            num_input_bits += node.size;
+                        }
+                        else if (it->second != node.size)
+                        {
+                            return ERR("could not check equivalence of Boolean functions '" + lhs.to_string() + "' and '" + rhs.to_string() + "': variable '" + node.variable
+                                       + "' is used with different sizes");
+                        }
+                    }
+                }
+
+                std::unordered_map<std::string, std::vector<u64>> inputs;
+                const auto generate_block = [&variables, &inputs](u32 num_words, const auto& generate_word) {
+                    u32 bit = 0;
+                    for (const auto& [name, size] : variables)
+                    {
+                        auto& words = inputs[name];
+                        words.resize(size * num_words);
+                        for (u32 i = 0; i < size; i++, bit++)
+                        {
+                            for (u32 w = 0; w < num_words; w++)
+                            {
+                                words[i * num_words + w] = generate_word(bit, w);
+                            }
+                        }
+                    }
+                };
+
+                if (num_input_bits <= MAX_TRUTH_TABLE_VARIABLES)
+                {
+                    const u64 num_rows  = 1ull << num_input_bits;
+                    const u32 num_words = (num_rows + 63) / 64;
+                    const u64 lane_mask = num_rows >= 64 ? ~0ull : (1ull << num_rows) - 1;
+
+                    for (u32 first_word = 0; first_word < num_words; first_word += BLOCK_WORDS)
+                    {
+                        const u32 block_words = std::min(BLOCK_WORDS, num_words - first_word);
+
+                        // the six least significant input bits repeat within every word, the others are constant across a word
+                        generate_block(block_words, [first_word](u32 bit, u32 w) -> u64 {
+                            if (bit < 6)
+                            {
+                                return TRUTH_TABLE_PATTERNS[bit];
+                            }
+                            return (((first_word + w) >> (bit - 6)) & 1) ? ~0ull : 0ull;
+                        });
+
+                        const auto difference = find_difference(lhs, rhs, inputs, block_words, lane_mask);
+                        if (difference.is_error())
+                        {
+                            return ERR_APPEND(difference.get_error(), "could not check equivalence of Boolean functions '" + lhs.to_string() + "' and '" + rhs.to_string() + "'");
+                        }
+                        if (const auto& lane = difference.get(); lane.has_value())
+                        {
+                            m_counters[TRUTH_TABLE_DIFFERENT]++;
+                            std::optional<Model> model;
+                            if (m_config.generate_model)
+                            {
+                                model = extract_model(variables, inputs, block_words, lane->first, lane->second);
+                            }
+                            return OK({SolverResult::Sat(model), Stage::TruthTable});
+                        }
+                    }
+
+                    m_counters[TRUTH_TABLE_EQUIVALENT]++;
+                    return OK({SolverResult::UnSat(), Stage::TruthTable});
+                }
+
+                u64 random_state = m_seed;
+                for (u32 first_word = 0; first_word < m_num_simulation_rounds; first_word += BLOCK_WORDS)
+                {
+                    const u32 block_words = std::min(BLOCK_WORDS, m_num_simulation_rounds - first_word);
+
+                    // the first two assignments set all inputs to zero and to one respectively, the others are random
+                    generate_block(block_words, [first_word, &random_state](u32, u32 w) -> u64 {
+                        const u64 word = next_random(random_state);
+                        return (first_word + w == 0) ? ((word & ~3ull) | 2ull) : word;
+                    });
+
+                    const auto difference = find_difference(lhs, rhs, inputs, block_words, ~0ull);
+                    if (difference.is_error())
+                    {
+                        return ERR_APPEND(difference.get_error(), "could not check equivalence of Boolean functions '" + lhs.to_string() + "' and '" + rhs.to_string() + "'");
+                    }
+                    if (const auto& lane = difference.get(); lane.has_value())
+                    {
+                        m_counters[SIMULATION_DIFFERENT]++;
+                        std::optional<Model> model;
+                        if (m_config.generate_model)
+                        {
+                            model = extract_model(variables, inputs, block_words, lane->first, lane->second);
+                        }
+                        return OK({SolverResult::Sat(model), Stage::Simulation});
+                    }
+                }
+            }
+
+            auto bf_neq = BooleanFunction::Eq(lhs.clone(), rhs.clone(), 1).map<BooleanFunction>([](auto&& bf_eq) -> Result<BooleanFunction> { return BooleanFunction::Not(std::move(bf_eq), 1); });
+            if (bf_neq.is_error())
+            {
+                return ERR_APPEND(bf_neq.get_error(), "could not check equivalence of Boolean functions '" + lhs.to_string() + "' and '" + rhs.to_string() + "': unable to build miter");
+            }
+
+            const auto solver_res = m_solver_pool.query({Constraint(bf_neq.get())});
+            if (solver_res.is_error())
+            {
+                return ERR_APPEND(solver_res.get_error(), "could not check equivalence of Boolean functions '" + lhs.to_string() + "' and '" + rhs.to_string() + "': solver query failed");
+            }
+
+            const auto& result = solver_res.get();
+            if (result.is_unsat())
+            {
+                m_counters[SOLVER_EQUIVALENT]++;
+            }
+            else if (result.is_sat())
+            {
+                m_counters[SOLVER_DIFFERENT]++;
+            }
+            else
+            {
+                m_counters[SOLVER_UNKNOWN]++;
+            }
+            return OK({result, Stage::Solver});
+        }
+
+        EquivalenceChecker::Statistics EquivalenceChecker::get_statistics() const
+        {
+            Statistics statistics;
+            statistics.truth_table_equivalent = m_counters[TRUTH_TABLE_EQUIVALENT];
+            statistics.truth_table_different  = m_counters[TRUTH_TABLE_DIFFERENT];
+            statistics.simulation_different   = m_counters[SIMULATION_DIFFERENT];
+            statistics.solver_equivalent      = m_counters[SOLVER_EQUIVALENT];
+            statistics.solver_different       = m_counters[SOLVER_DIFFERENT];
+            statistics.solver_unknown         = m_counters[SOLVER_UNKNOWN];
+            return statistics;
+        }
+
+        void EquivalenceChecker::reset_statistics()
+        {
+            for (auto& counter : m_counters)
+            {
+                counter = 0;
+            }
+        }
+    }    // namespace SMT
+}    // namespace hal
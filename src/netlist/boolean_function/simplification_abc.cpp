@@ -3,6 +3,8 @@
 #include <boost/fusion/include/at_c.hpp>
 #include <boost/fusion/sequence/intrinsic/at_c.hpp>
 #include <boost/spirit/home/x3.hpp>
+#include <future>
+#include <map>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -455,6 +457,84 @@ namespace hal
             }
         };
 
+        /// `SimplificationCache` stores the results of previous ABC simplifications.
+        ///
+        /// # Developer Note
+        /// ABC keeps its state in a single process-wide frame, so simplifications
+        /// cannot run concurrently within ABC itself. Gate-level functions however
+        /// are highly repetitive (every instance of a gate type shares the same
+        /// function up to the names of its inputs), so parallel callers mostly
+        /// request simplifications that were already computed. The cache is keyed
+        /// by canonicalized functions (see `canonicalize`) and hands out results
+        /// without touching ABC. A result that is still being computed by another
+        /// thread is waited for instead of being computed a second time.
+        class SimplificationCache final
+        {
+        public:
+            /// Maximum number of cached simplifications before the cache is reset.
+            static constexpr u32 MAX_ENTRIES = 1 << 16;
+
+            /**
+             * Looks up the simplification of a canonicalized Boolean function and
+             * computes it if no other thread has done so before.
+             *
+             * @param[in] function - Canonicalized Boolean function.
+             * @param[in] compute - Computes the simplification of the function.
+             * @returns The simplified Boolean function on success, an error otherwise.
+             */
+            template<typename F>
+            Result<BooleanFunction> get_or_compute(const BooleanFunction& function, F compute)
+            {
+                std::promise<Result<BooleanFunction>> promise;
+                std::shared_future<Result<BooleanFunction>> future;
+                bool is_owner = false;
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (const auto it = m_entries.find(function); it != m_entries.end())
+                    {
+                        future = it->second;
+                    }
+                    else
+                    {
+                        if (m_entries.size() >= MAX_ENTRIES)
+                        {
+                            m_entries.clear();
+                        }
+                        future = promise.get_future().share();
+                        m_entries.emplace(function.clone(), future);
+                        is_owner = true;
+                    }
+                }
+
+                if (is_owner)
+                {
+                    promise.set_value(compute());
+                }
+                return future.get();
+            }
+
+            /**
+             * Removes all cached simplifications.
+             * Callers that are waiting for a result that is still being computed receive it nevertheless.
+             */
+            void clear()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_entries.clear();
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::map<BooleanFunction, std::shared_future<Result<BooleanFunction>>> m_entries;
+        };
+
+        SimplificationCache& get_simplification_cache()
+        {
+            static SimplificationCache cache;
+            return cache;
+        }
+
         /// Copied from "src/base/abc/abc.h", see above for link to ABC's repository
         Abc_Obj_t* Abc_ObjFanin(Abc_Obj_t* pObj, int i)
         {
@@ -462,9 +542,12 @@ namespace hal
         }
 
         /// Copied from "src/base/io/ioWriteVerilog.c", see above for link to ABC's repository
+        ///
+        /// # Change Note
+        /// The buffer is thread-local instead of static.
         char* Io_WriteVerilogGetName(char* pName)
         {
-            static char Buffer[500];
+            thread_local char Buffer[500];
             int i, Length = strlen(pName);
             if (pName[0] < '0' || pName[0] > '9')
             {
@@ -580,12 +663,65 @@ namespace hal
         }
 
         /**
-         * Translates a `BooleanFunction` to the ABC network representation.
+         * Renames the input variables of a Boolean function to canonical names
+         * "v0", "v1", ... (zero-padded to equal length) such that the order of the
+         * inputs is preserved. As ABC only considers the structure of a function
+         * and the order of its inputs, functions that differ only in their input
+         * names share the same canonical form and simplification result.
+         *
+         * @param[in] function - Boolean function.
+         * @returns The canonicalized function and the mapping from canonical to original variable names.
+         */
+        std::pair<BooleanFunction, std::map<std::string, std::string>> canonicalize(const BooleanFunction& function)
+        {
+            const auto variables = function.get_variable_names();
+            const auto width     = std::to_string(variables.size() - 1).size();
+
+            std::map<std::string, std::string> to_canonical, to_original;
+            for (const auto& variable : variables)
+            {
+                auto index     = std::to_string(to_canonical.size());
+                auto canonical = "v" + std::string(width - index.size(), '0') + index;
+
+                to_canonical[variable] = canonical;
+                to_original[canonical] = variable;
+            }
+
+            return {function.substitute(to_canonical), std::move(to_original)};
+        }
+
+        /**
+         * Slices a Boolean function into its single-bit output functions.
+         *
+         * @param[in] function - Boolean function.
+         * @returns Ok() and one Boolean function per output bit on success, Err() otherwise.
+         */
+        Result<std::vector<BooleanFunction>> slice_outputs(const BooleanFunction& function)
+        {
+            std::vector<BooleanFunction> slices;
+            slices.reserve(function.size());
+            for (auto i = 0u; i < function.size(); i++)
+            {
+                auto status = slice_at(function, i);
+                if (status.is_error())
+                {
+                    return ERR_APPEND(status.get_error(),
+                                      "could not translate Boolean function to ABC notation: unable to slice Boolean function'" + function.to_string() + "' at index " + std::to_string(i));
+                }
+                slices.push_back(status.get());
+            }
+            return OK(std::move(slices));
+        }
+
+        /**
+         * Translates the single-bit output functions of a `BooleanFunction` to the
+         * ABC network representation.
          * 
          * @param[in] function - Boolean function to translate.
+         * @param[in] slices - Single-bit output functions of the Boolean function, see `slice_outputs`.
          * @returns Ok() and ABC network on success, Err() otherwise.
          */
-        Result<Abc_Ntk_t*> translate_to_abc(const BooleanFunction& function)
+        Result<Abc_Ntk_t*> translate_to_abc(const BooleanFunction& function, const std::vector<BooleanFunction>& slices)
         {
             /**
              * Local translation helper to translate a given node and its operands.
@@ -647,16 +783,9 @@ namespace hal
             const auto output_variables = get_output_variables(function);
             for (auto i = 0u; i < output_variables.size(); i++)
             {
-                auto status = slice_at(function, i);
-                if (status.is_error())
-                {
-                    return ERR_APPEND(status.get_error(),
-                                      "could not translate Boolean function to ABC notation: unable to slice Boolean function'" + function.to_string() + "' at index " + std::to_string(i));
-                }
-
                 // (3) translation from Boolean function nodes to ABC network objects
                 std::vector<Abc_Obj_t*> stack;
-                for (const auto& node : status.get().get_nodes())
+                for (const auto& node : slices[i].get_nodes())
                 {
                     std::vector<Abc_Obj_t*> operands;
                     std::move(stack.end() - static_cast<i64>(node.get_arity()), stack.end(), std::back_inserter(operands));
@@ -1004,31 +1133,59 @@ namespace hal
             return OK(function.clone());
         }
 
-        // (2) since the simplification and translations require access to the
-        //     ABC global frame, we have to ensure an exclusive access in case
-        //     Boolean function simplifications are executed in parallel
-        static std::mutex mutex;
-        mutex.lock();
+        // (2) the result of ABC only depends on the structure of the function and
+        //     the order of its inputs, hence functions that only differ in their
+        //     input names (e.g., all instances of a gate type) share one result
+        auto [canonical, original_names] = canonicalize(function);
 
-        auto status = translate_to_abc(function).map<std::monostate>([](const auto& network) { return simplify(network); });
+        auto simplified = get_simplification_cache().get_or_compute(canonical, [&canonical = canonical]() -> Result<BooleanFunction> {
+            // (3) slicing the function into its output bits does not involve ABC
+            auto slices = slice_outputs(canonical);
+            if (slices.is_error())
+            {
+                return ERR(slices.get_error());
+            }
 
-        if (status.is_error())
-        {
-            return ERR_APPEND(status.get_error(), "could not simplyfy Boolean function using ABC: unable to translate & simplify Boolean function '" + function.to_string() + "'");
-        }
+            // (4) since the simplification and translations require access to the
+            //     ABC global frame, we have to ensure an exclusive access in case
+            //     Boolean function simplifications are executed in parallel
+            Result<std::string> verilog = ERR("could not simplify Boolean function using ABC: no result");
+            {
+                static std::mutex mutex;
+                std::lock_guard<std::mutex> lock(mutex);
 
-        // (3) translate the ABC graph back into a Boolean function
-        auto translated_function = translate_from_abc().map<BooleanFunction>([&function](const auto& verilog) { return translate_from_verilog(verilog, function); });
+                auto status = translate_to_abc(canonical, slices.get()).map<std::monostate>([](const auto& network) { return simplify(network); });
+                if (status.is_error())
+                {
+                    return ERR(status.get_error());
+                }
 
-        mutex.unlock();
+                verilog = translate_from_abc();
+            }
 
-        if (translated_function.is_ok())
-        {
-            return translated_function;
-        }
-        else
+            // (5) translate the ABC graph back into a Boolean function, which no
+            //     longer requires the ABC global frame and hence runs in parallel
+            auto translated_function = verilog.map<BooleanFunction>([&canonical](const auto& v) { return translate_from_verilog(v, canonical); });
+            if (translated_function.is_ok())
+            {
+                return translated_function;
+            }
+            else
+            {
+                return OK(canonical.clone());
+            }
+        });
+
+        if (simplified.is_error())
         {
-            return OK(function.clone());
+            return ERR_APPEND(simplified.get_error(), "could not simplyfy Boolean function using ABC: unable to translate & simplify Boolean function '" + function.to_string() + "'");
         }
+
+        return OK(simplified.get().substitute(original_names));
+    }
+
+    void Simplification::clear_abc_cache()
+    {
+        get_simplification_cache().clear();
     }
 }    // namespace hal
@@ -0,0 +1,522 @@
+#include "hal_core/netlist/boolean_function/solver_session.h"
+
+#include "hal_core/netlist/boolean_function/solver.h"
+#include "hal_core/netlist/boolean_function/translator.h"
+#include "subprocess/process.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <set>
+#include <thread>
+#include <tuple>
+
+namespace hal
+{
+    namespace SMT
+    {
+        namespace
+        {
+            /// The output the solver prints once it has processed all commands of a batch.
+            const std::string end_marker = "hal_session_done";
+
+            /// Locates the binary of a solver type, following `Solver::has_local_solver_for`.
+            Result<std::string> query_binary_path(SolverType solver)
+            {
+                static const std::map<SolverType, std::string> binary_names = {
+                    {SolverType::Z3, "z3"},
+                    {SolverType::Boolector, "boolector"},
+                };
+
+                const auto name_it = binary_names.find(solver);
+                if (name_it == binary_names.end())
+                {
+                    return ERR("could not query binary path: sessions are not supported for solver " + enum_to_string(solver));
+                }
+
+                for (const auto& directory : {"/usr/bin/", "/usr/local/bin/", "/opt/homebrew/bin/"})
+                {
+                    if (const std::string path = directory + name_it->second; std::filesystem::exists(path))
+                    {
+                        return OK(path);
+                    }
+                }
+
+                return ERR("could not query binary path: no binary found for " + enum_to_string(solver) + " solver");
+            }
+
+            std::string trim(const std::string& line)
+            {
+                const auto begin = line.find_first_not_of(" \t\r\n\"");
+                if (begin == std::string::npos)
+                {
+                    return "";
+                }
+                const auto end = line.find_last_not_of(" \t\r\n\"");
+                return line.substr(begin, end - begin + 1);
+            }
+        }    // namespace
+
+        bool SolverSession::is_supported(const QueryConfig& config)
+        {
+            return config.local && config.call == SolverCall::Binary && query_binary_path(config.solver).is_ok();
+        }
+
+        Result<std::unique_ptr<SolverSession>> SolverSession::start(const QueryConfig& config)
+        {
+            if (!config.local || config.call != SolverCall::Binary)
+            {
+                return ERR("could not start solver session: sessions are only supported for local solver binaries");
+            }
+
+            const auto binary_path = query_binary_path(config.solver);
+            if (binary_path.is_error())
+            {
+                return ERR_APPEND(binary_path.get_error(), "could not start solver session: unable to locate binary");
+            }
+
+            std::vector<std::string> arguments;
+            if (config.solver == SolverType::Z3)
+            {
+                // read commands from stdin one after another, the timeout applies to every single check
+                arguments = {binary_path.get(), "-in", "-smt2", "-t:" + std::to_string(config.timeout_in_seconds * 1000)};
+            }
+            else
+            {
+                arguments = {binary_path.get(), "--incremental", "--smt2", "--output-format=smt2", std::string("--model-gen=") + ((config.generate_model) ? "1" : "0")};
+            }
+
+            auto session = std::unique_ptr<SolverSession>(new SolverSession(config));
+            try
+            {
+                session->m_process = std::make_unique<subprocess::Popen>(arguments, subprocess::output{subprocess::PIPE}, subprocess::input{subprocess::PIPE});
+            }
+            catch (const std::exception& e)
+            {
+                return ERR("could not start solver session: unable to start '" + binary_path.get() + "': " + e.what());
+            }
+            session->m_alive = true;
+
+            std::string prologue;
+            if (config.generate_model)
+            {
+                prologue += "(set-option :produce-models true)\n";
+            }
+            prologue += "(set-logic QF_ABV)\n";
+            if (auto res = session->run(prologue); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not start solver session: solver did not accept the prologue");
+            }
+
+            return OK(std::move(session));
+        }
+
+        SolverSession::SolverSession(const QueryConfig& config) : m_config(config), m_scopes(1)
+        {
+        }
+
+        SolverSession::~SolverSession()
+        {
+            if (m_process == nullptr)
+            {
+                return;
+            }
+
+            if (m_alive && m_process->poll() == -1)
+            {
+                m_process->send("(exit)\n");
+                std::fflush(m_process->input());
+            }
+            m_process->close_input();
+            m_process->close_output();
+            m_process->kill();
+            m_process->wait();
+        }
+
+        const QueryConfig& SolverSession::get_config() const
+        {
+            return m_config;
+        }
+
+        bool SolverSession::is_alive() const
+        {
+            return m_alive && m_process->poll() == -1;
+        }
+
+        u32 SolverSession::get_num_scopes() const
+        {
+            return m_scopes.size() - 1;
+        }
+
+        Result<std::monostate> SolverSession::push()
+        {
+            if (auto res = run("(push 1)\n"); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not open scope of solver session");
+            }
+            m_scopes.emplace_back();
+            return OK({});
+        }
+
+        Result<std::monostate> SolverSession::pop()
+        {
+            if (m_scopes.size() == 1)
+            {
+                return ERR("could not close scope of solver session: no scope is open");
+            }
+
+            if (auto res = run("(pop 1)\n"); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not close scope of solver session");
+            }
+
+            // the solver forgets the declarations of the closed scope as well
+            for (const auto& variable : m_scopes.back().variables)
+            {
+                m_variables.erase(variable);
+            }
+            for (const auto& assumption : m_scopes.back().assumptions)
+            {
+                m_assumptions.erase(assumption);
+            }
+            m_scopes.pop_back();
+            return OK({});
+        }
+
+        Result<std::monostate> SolverSession::add_constraints(const std::vector<Constraint>& constraints)
+        {
+            std::string declarations;
+            std::string assertions;
+            for (const auto& constraint : constraints)
+            {
+                if (constraint.is_assignment())
+                {
+                    const auto* assignment = constraint.get_assignment().get();
+                    auto lhs               = Translator::translate_to_smt2(assignment->first);
+                    auto rhs               = Translator::translate_to_smt2(assignment->second);
+                    if (lhs.is_error())
+                    {
+                        return ERR_APPEND(lhs.get_error(), "could not add constraint to solver session: unable to translate '" + constraint.to_string() + "'");
+                    }
+                    if (rhs.is_error())
+                    {
+                        return ERR_APPEND(rhs.get_error(), "could not add constraint to solver session: unable to translate '" + constraint.to_string() + "'");
+                    }
+                    declare_variables(assignment->first, declarations);
+                    declare_variables(assignment->second, declarations);
+                    assertions += "(assert (= " + lhs.get() + " " + rhs.get() + "))\n";
+                }
+                else
+                {
+                    const auto* function = constraint.get_function().get();
+                    auto smt2            = Translator::translate_to_smt2(*function);
+                    if (smt2.is_error())
+                    {
+                        return ERR_APPEND(smt2.get_error(), "could not add constraint to solver session: unable to translate '" + constraint.to_string() + "'");
+                    }
+                    declare_variables(*function, declarations);
+                    assertions += "(assert (= #b1 " + smt2.get() + "))\n";
+                }
+            }
+
+            if (auto res = run(declarations + assertions); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not add constraints to solver session");
+            }
+            return OK({});
+        }
+
+        Result<SolverResult> SolverSession::check(const std::vector<BooleanFunction>& assumptions)
+        {
+            // check-sat-assuming only takes literals, so every assumption is stood in for by a literal that implies it
+            std::string declarations;
+            std::string literals;
+            for (const auto& assumption : assumptions)
+            {
+                auto smt2 = Translator::translate_to_smt2(assumption);
+                if (smt2.is_error())
+                {
+                    return ERR_APPEND(smt2.get_error(), "could not check solver session: unable to translate assumption '" + assumption.to_string() + "'");
+                }
+                const std::string term = smt2.get();
+
+                auto it = m_assumptions.find(term);
+                if (it == m_assumptions.end())
+                {
+                    const std::string literal = "hal_assumption_" + std::to_string(m_next_literal++);
+                    declare_variables(assumption, declarations);
+                    declarations += "(declare-fun " + literal + " () Bool)\n";
+                    declarations += "(assert (=> " + literal + " (= #b1 " + term + ")))\n";
+                    m_scopes.back().assumptions.push_back(term);
+                    it = m_assumptions.emplace(term, literal).first;
+                }
+                literals += " " + it->second;
+            }
+
+            const std::string check = (assumptions.empty()) ? "(check-sat)\n" : "(check-sat-assuming (" + literals.substr(1) + "))\n";
+            const auto output       = run(declarations + check);
+            if (output.is_error())
+            {
+                return ERR_APPEND(output.get_error(), "could not check solver session");
+            }
+
+            const std::string result = trim(output.get());
+            if (result == "unsat")
+            {
+                return OK(SolverResult::UnSat());
+            }
+            if (result == "unknown")
+            {
+                return OK(SolverResult::Unknown());
+            }
+            if (result != "sat")
+            {
+                return ERR("could not check solver session: invalid result '" + result + "'");
+            }
+
+            if (!m_config.generate_model)
+            {
+                return OK(SolverResult::Sat());
+            }
+
+            const auto model_str = run("(get-model)\n");
+            if (model_str.is_error())
+            {
+                return ERR_APPEND(model_str.get_error(), "could not check solver session: unable to get model");
+            }
+            // the model also defines the assumption literals, which are no bit-vectors and are left out
+            std::set<std::string> variables;
+            for (const auto& [variable, size] : m_variables)
+            {
+                variables.insert(variable);
+            }
+            auto model = Model::parse(model_str.get(), m_config.solver, variables);
+            if (model.is_error())
+            {
+                return ERR_APPEND(model.get_error(), "could not check solver session: unable to parse model");
+            }
+            return OK(SolverResult::Sat(model.get()));
+        }
+
+        Result<SolverResult> SolverSession::query(const std::vector<Constraint>& constraints)
+        {
+            if (auto res = push(); res.is_error())
+            {
+                return ERR(res.get_error());
+            }
+
+            auto result = add_constraints(constraints).map<SolverResult>([this](const auto&) { return check(); });
+
+            if (auto res = pop(); res.is_error())
+            {
+                return ERR(res.get_error());
+            }
+            return result;
+        }
+
+        Result<std::string> SolverSession::run(const std::string& commands)
+        {
+            if (!is_alive())
+            {
+                m_alive = false;
+                return ERR("could not run solver commands: solver process is not running");
+            }
+
+            const std::string input = commands + "(echo \"" + end_marker + "\")\n";
+            if (m_process->send(input.c_str(), input.size()) != (int)input.size() || std::fflush(m_process->input()) != 0)
+            {
+                m_alive = false;
+                return ERR("could not run solver commands: unable to write to solver process");
+            }
+
+            std::string output;
+            std::string line;
+            char buffer[4096];
+            while (std::fgets(buffer, sizeof(buffer), m_process->output()) != nullptr)
+            {
+                line += buffer;
+                if (line.back() != '\n')
+                {
+                    // line longer than the buffer
+                    continue;
+                }
+
+                if (trim(line) == end_marker)
+                {
+                    if (output.find("(error") != std::string::npos)
+                    {
+                        return ERR("could not run solver commands: solver reported " + trim(output));
+                    }
+                    return OK(output);
+                }
+                output += line;
+                line.clear();
+            }
+
+            m_alive = false;
+            return ERR("could not run solver commands: solver process terminated unexpectedly");
+        }
+
+        void SolverSession::declare_variables(const BooleanFunction& function, std::string& commands)
+        {
+            for (const auto& node : function.get_nodes())
+            {
+                if (node.is_variable() && m_variables.emplace(node.variable, node.size).second)
+                {
+                    m_scopes.back().variables.push_back(node.variable);
+                    commands += "(declare-fun " + node.variable + " () (_ BitVec " + std::to_string(node.size) + "))\n";
+                }
+            }
+        }
+
+        SolverSessionPool::Lease::Lease(SolverSessionPool* pool, std::unique_ptr<SolverSession> session) : m_pool(pool), m_session(std::move(session))
+        {
+        }
+
+        SolverSessionPool::Lease& SolverSessionPool::Lease::operator=(Lease&& other)
+        {
+            if (this != &other)
+            {
+                release();
+                m_pool    = other.m_pool;
+                m_session = std::move(other.m_session);
+            }
+            return *this;
+        }
+
+        SolverSessionPool::Lease::~Lease()
+        {
+            release();
+        }
+
+        SolverSession* SolverSessionPool::Lease::operator->() const
+        {
+            return m_session.get();
+        }
+
+        SolverSession& SolverSessionPool::Lease::operator*() const
+        {
+            return *m_session;
+        }
+
+        void SolverSessionPool::Lease::release()
+        {
+            if (m_session != nullptr)
+            {
+                m_pool->release(std::move(m_session));
+            }
+        }
+
+        SolverSessionPool::SolverSessionPool(const QueryConfig& config, u32 max_sessions)
+            : m_config(config), m_max_sessions((max_sessions != 0) ? max_sessions : std::max(1u, std::thread::hardware_concurrency()))
+        {
+        }
+
+        SolverSessionPool& SolverSessionPool::get_shared(const QueryConfig& config)
+        {
+            static std::mutex pools_mutex;
+            static std::map<std::tuple<SolverType, SolverCall, bool, bool, u64>, std::unique_ptr<SolverSessionPool>> pools;
+
+            std::lock_guard lock(pools_mutex);
+            auto& pool = pools[{config.solver, config.call, config.local, config.generate_model, config.timeout_in_seconds}];
+            if (pool == nullptr)
+            {
+                pool = std::make_unique<SolverSessionPool>(config);
+            }
+            return *pool;
+        }
+
+        const QueryConfig& SolverSessionPool::get_config() const
+        {
+            return m_config;
+        }
+
+        u32 SolverSessionPool::get_num_sessions() const
+        {
+            std::lock_guard lock(m_mutex);
+            return m_num_sessions;
+        }
+
+        Result<SolverSessionPool::Lease> SolverSessionPool::acquire()
+        {
+            std::unique_ptr<SolverSession> session;
+            {
+                std::unique_lock lock(m_mutex);
+                m_released.wait(lock, [this]() { return !m_idle_sessions.empty() || m_num_sessions < m_max_sessions; });
+                if (!m_idle_sessions.empty())
+                {
+                    session = std::move(m_idle_sessions.back());
+                    m_idle_sessions.pop_back();
+                }
+                else
+                {
+                    m_num_sessions++;
+                }
+            }
+
+            if (session == nullptr)
+            {
+                // the process is started outside of the lock, its slot is already reserved
+                auto start_res = SolverSession::start(m_config);
+                if (start_res.is_error())
+                {
+                    {
+                        std::lock_guard lock(m_mutex);
+                        m_num_sessions--;
+                    }
+                    m_released.notify_one();
+                    return ERR_APPEND(start_res.get_error(), "could not acquire solver session");
+                }
+                session = start_res.get();
+            }
+
+            // everything the lessee adds lives in a scope of its own, which is closed again once the session is returned
+            Lease lease(this, std::move(session));
+            if (const auto res = lease->push(); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not acquire solver session");
+            }
+            return OK(std::move(lease));
+        }
+
+        Result<SolverResult> SolverSessionPool::query(const std::vector<Constraint>& constraints)
+        {
+            if (!SolverSession::is_supported(m_config))
+            {
+                return Solver(constraints).query(m_config);
+            }
+
+            auto lease = acquire();
+            if (lease.is_error())
+            {
+                return ERR_APPEND(lease.get_error(), "could not query solver session pool");
+            }
+            return lease.get()->query(constraints);
+        }
+
+        void SolverSessionPool::release(std::unique_ptr<SolverSession> session)
+        {
+            while (session->is_alive() && session->get_num_scopes() > 0)
+            {
+                if (session->pop().is_error())
+                {
+                    break;
+                }
+            }
+
+            {
+                std::lock_guard lock(m_mutex);
+                if (session->is_alive() && session->get_num_scopes() == 0)
+                {
+                    m_idle_sessions.push_back(std::move(session));
+                }
+                else
+                {
+                    m_num_sessions--;
+                }
+            }
+            m_released.notify_one();
+
+            // a dropped session terminates its process outside of the lock
+        }
+    }    // namespace SMT
+}    // namespace hal
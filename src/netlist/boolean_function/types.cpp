@@ -1,7 +1,7 @@
 #include "hal_core/netlist/boolean_function/types.h"
 
 #include <boost/spirit/home/x3.hpp>
-#include <mutex>
+#include <functional>
 #include <numeric>
 #include <sstream>
 
@@ -27,20 +27,27 @@ namespace hal
                 std::string current_value;
             };
 
-            // Parser context to handle
-            ParserContext parser_context;
+            /// Tag to look up the 'ParserContext' of the current parser run, which
+            /// is attached to the grammar via `x3::with` so that concurrent parser
+            /// runs do not share any state.
+            struct ParserContextTag;
+
+            // Short-hand to access the parser context attached to a parser run.
+            const auto get_parser_context = [](const auto& ctx) -> ParserContext& { return x3::get<ParserContextTag>(ctx).get(); };
 
             // Action to store a translated name in the parser context.
-            const auto NameAction = [](const auto& ctx) { parser_context.current_name = _attr(ctx); };
+            const auto NameAction = [](const auto& ctx) { get_parser_context(ctx).current_name = _attr(ctx); };
             // Action to store a translated size in the parser context.
-            const auto SortAction = [](const auto& ctx) { parser_context.current_size = boost::fusion::at_c<0>(_attr(ctx)); };
+            const auto SortAction = [](const auto& ctx) { get_parser_context(ctx).current_size = boost::fusion::at_c<0>(_attr(ctx)); };
             // Action to store a translated binary value in the parser context.
-            const auto BinaryValueAction = [](const auto& ctx) { parser_context.current_value = "0b" + _attr(ctx); };
+            const auto BinaryValueAction = [](const auto& ctx) { get_parser_context(ctx).current_value = "0b" + _attr(ctx); };
             // Action to store a translated hexadecimal value in the parser context.
-            const auto HexValueAction = [](const auto& ctx) { parser_context.current_value = "0x" + _attr(ctx); };
+            const auto HexValueAction = [](const auto& ctx) { get_parser_context(ctx).current_value = "0x" + _attr(ctx); };
 
             // Action to store a translated signal assignment in the parser context.
-            const auto SignalAssigmentAction = [](const auto& /* ctx */) {
+            const auto SignalAssigmentAction = [](const auto& ctx) {
+                auto& parser_context = get_parser_context(ctx);
+
                 const auto value = (parser_context.current_value.at(1) == 'b') ? strtoull(parser_context.current_value.substr(2, parser_context.current_value.length() - 2).c_str(), nullptr, 2)
                                                                                : strtoull(parser_context.current_value.c_str(), nullptr, 0);
 
@@ -219,31 +226,22 @@ namespace hal
 
         Result<Model> Model::parse(const std::string& s, const SolverType& type)
         {
-            // TODO:
-            // check how to attach a local parser context variable to the x3 parser
-            // in order to prevent the necessity of a mutex and thus speed-up
-            // parallel processing.
-
-            // to transform the current parser implementation into a thread-safe
-            // implementation, we use a static mutex variable that is locked-upon
-            // entry in order to prevent any overwrite of the parser_context data
-            static std::mutex mutex;
-
-            // (1) reset current context in a thread-safe way
-            std::lock_guard<std::mutex> lock(mutex);
-            ModelParser::parser_context = ModelParser::ParserContext();
+            // (1) every parser run gets its own context which is attached to the
+            //     grammar, hence models can be parsed in parallel without locking
+            ModelParser::ParserContext context;
 
             // (2) parse model using the SMT-LIB grammars for the different solver
             auto iter = s.begin();
             auto ok   = [&]() -> bool {
+                namespace x3 = boost::spirit::x3;
                 switch (type)
                 {
                     case SolverType::Z3:
-                        return boost::spirit::x3::phrase_parse(iter, s.end(), ModelParser::Z3_MODEL_GRAMMAR, boost::spirit::x3::space);
+                        return x3::phrase_parse(iter, s.end(), x3::with<ModelParser::ParserContextTag>(std::ref(context))[ModelParser::Z3_MODEL_GRAMMAR], x3::space);
                     case SolverType::Boolector:
-                        return boost::spirit::x3::phrase_parse(iter, s.end(), ModelParser::BOOLECTOR_MODEL_GRAMMAR, boost::spirit::x3::space);
+                        return x3::phrase_parse(iter, s.end(), x3::with<ModelParser::ParserContextTag>(std::ref(context))[ModelParser::BOOLECTOR_MODEL_GRAMMAR], x3::space);
                     case SolverType::Bitwuzla:
-                        return boost::spirit::x3::phrase_parse(iter, s.end(), ModelParser::Z3_MODEL_GRAMMAR, boost::spirit::x3::space);
+                        return x3::phrase_parse(iter, s.end(), x3::with<ModelParser::ParserContextTag>(std::ref(context))[ModelParser::Z3_MODEL_GRAMMAR], x3::space);
 
                     default:
                         return false;
@@ -252,12 +250,82 @@ namespace hal
 
             if (ok && (iter == s.end()))
             {
-                return OK(Model(ModelParser::parser_context.model));
+                return OK(Model(std::move(context.model)));
             }
 
             return ERR("could not parse SMT-Lib model");
         }
 
+        Result<Model> Model::parse(const std::string& s, const SolverType& type, const std::set<std::string>& variables)
+        {
+            namespace x3 = boost::spirit::x3;
+
+            if (type != SolverType::Z3 && type != SolverType::Boolector && type != SolverType::Bitwuzla)
+            {
+                return ERR("could not parse SMT-Lib model: unsupported solver type");
+            }
+
+            ModelParser::ParserContext context;
+
+            // all supported solvers print a model as a flat list of definitions of
+            // the form "(define-fun A () (_ BitVec 1) #b0)", hence we skip from one
+            // definition to the next and only parse the requested ones
+            static const std::string keyword = "(define-fun";
+
+            auto remaining = variables.size();
+            for (auto start = s.find(keyword); (start != std::string::npos) && (remaining != 0); start = s.find(keyword, start + 1))
+            {
+                // (1) read the name of the defined variable
+                auto name_begin = s.find_first_not_of(" \t\r\n", start + keyword.size());
+                if (name_begin == std::string::npos)
+                {
+                    return ERR("could not parse SMT-Lib model: unexpected end of model after '" + keyword + "'");
+                }
+                auto name_end = s.find_first_of(" \t\r\n()", name_begin);
+                if (name_end == std::string::npos)
+                {
+                    return ERR("could not parse SMT-Lib model: unexpected end of model after variable name");
+                }
+                if (variables.find(s.substr(name_begin, name_end - name_begin)) == variables.end())
+                {
+                    continue;
+                }
+
+                // (2) find the end of the definition, values are constants and hence
+                //     the definition only contains the parentheses of sort and value
+                auto depth = 0u;
+                auto end   = start;
+                for (; end < s.size(); end++)
+                {
+                    if (s[end] == '(')
+                    {
+                        depth++;
+                    }
+                    else if (s[end] == ')' && --depth == 0)
+                    {
+                        break;
+                    }
+                }
+                if (end == s.size())
+                {
+                    return ERR("could not parse SMT-Lib model: unterminated definition starting at offset " + std::to_string(start));
+                }
+
+                // (3) parse the requested definition
+                auto iter = s.begin() + start;
+                auto last = s.begin() + end + 1;
+                if (!x3::phrase_parse(iter, last, x3::with<ModelParser::ParserContextTag>(std::ref(context))[ModelParser::SignalAssignmentRule], x3::space) || (iter != last))
+                {
+                    return ERR("could not parse SMT-Lib model: invalid definition '" + s.substr(start, end + 1 - start) + "'");
+                }
+
+                remaining--;
+                start = end;
+            }
+
+            return OK(Model(std::move(context.model)));
+        }
+
         Result<BooleanFunction> Model::evaluate(const BooleanFunction& bf) const
         {
             std::vector<BooleanFunction::Node> new_nodes;
@@ -1,12 +1,34 @@
 #include "hal_core/netlist/data_container.h"
 
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/string_pool.h"
+
+#include <algorithm>
+#include <functional>
 
 namespace hal
 {
+    namespace
+    {
+        bool is_before(const std::string* category_0, const std::string* key_0, const std::string* category_1, const std::string* key_1)
+        {
+            if (category_0 != category_1)
+            {
+                return std::less<const std::string*>()(category_0, category_1);
+            }
+            return std::less<const std::string*>()(key_0, key_1);
+        }
+    }    // namespace
+
+    bool DataContainer::Entry::operator==(const Entry& other) const
+    {
+        return category == other.category && key == other.key && type == other.type && value == other.value;
+    }
+
     bool DataContainer::operator==(const DataContainer& other) const
     {
-        return m_data == other.get_data_map();
+        // all containers share the same pooled strings and hence order their entries in the same way
+        return m_data == other.m_data;
     }
 
     bool DataContainer::operator!=(const DataContainer& other) const
@@ -22,7 +44,21 @@ namespace hal
             return false;
         }
 
-        m_data[std::make_tuple(category, key)] = std::make_tuple(value_data_type, value);
+        StringPool& pool              = StringPool::get_global();
+        const std::string* category_p = pool.intern(category);
+        const std::string* key_p      = pool.intern(key);
+        const std::string* type_p     = pool.intern(value_data_type);
+
+        auto it = m_data.begin() + (lower_bound_entry(category_p, key_p) - m_data.cbegin());
+        if (it != m_data.end() && it->category == category_p && it->key == key_p)
+        {
+            it->type  = type_p;
+            it->value = value;
+        }
+        else
+        {
+            m_data.insert(it, Entry{category_p, key_p, type_p, value});
+        }
 
         //notify_updated();
 
@@ -46,14 +82,14 @@ namespace hal
             return false;
         }
 
-        auto it = m_data.find(std::make_tuple(category, key));
+        auto it = find_entry(StringPool::get_global().find(category), StringPool::get_global().find(key));
         if (it == m_data.end())
         {
             log_debug("netlist", "no key ('{}', '{}') found.", category, key);
             return true;
         }
 
-        auto deleted_value = std::get<1>(it->second);
+        auto deleted_value = it->value;
         m_data.erase(it);
 
         //notify_updated();
@@ -69,29 +105,60 @@ namespace hal
         return true;
     }
 
-    const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& DataContainer::get_data_map() const
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> DataContainer::get_data_map() const
     {
-        return m_data;
+        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> map;
+        for (const Entry& entry : m_data)
+        {
+            map.emplace(std::make_tuple(*entry.category, *entry.key), std::make_tuple(*entry.type, entry.value));
+        }
+        return map;
     }
 
     void DataContainer::set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map)
     {
-        m_data = map;
+        StringPool& pool = StringPool::get_global();
+
+        m_data.clear();
+        m_data.reserve(map.size());
+        for (const auto& [category_key, type_value] : map)
+        {
+            m_data.push_back(Entry{pool.intern(std::get<0>(category_key)), pool.intern(std::get<1>(category_key)), pool.intern(std::get<0>(type_value)), std::get<1>(type_value)});
+        }
+        std::sort(m_data.begin(), m_data.end(), [](const Entry& a, const Entry& b) { return is_before(a.category, a.key, b.category, b.key); });
     }
 
-    bool DataContainer::has_data(const std::string& category, const std::string& key) const
+    std::vector<DataContainer::Entry>::const_iterator DataContainer::lower_bound_entry(const std::string* category, const std::string* key) const
     {
-        if (category.empty() || key.empty())
+        return std::lower_bound(m_data.begin(), m_data.end(), std::make_pair(category, key), [](const Entry& entry, const std::pair<const std::string*, const std::string*>& id) {
+            return is_before(entry.category, entry.key, id.first, id.second);
+        });
+    }
+
+    std::vector<DataContainer::Entry>::const_iterator DataContainer::find_entry(const std::string* category, const std::string* key) const
+    {
+        // strings that are not pooled cannot be part of any entry
+        if (category == nullptr || key == nullptr)
         {
-            return false;
+            return m_data.end();
         }
 
-        if (auto it = m_data.find(std::make_tuple(category, key)); it == m_data.end())
+        auto it = lower_bound_entry(category, key);
+        if (it != m_data.end() && it->category == category && it->key == key)
+        {
+            return it;
+        }
+        return m_data.end();
+    }
+
+    bool DataContainer::has_data(const std::string& category, const std::string& key) const
+    {
+        if (category.empty() || key.empty())
         {
             return false;
         }
 
-        return true;
+        return find_entry(StringPool::get_global().find(category), StringPool::get_global().find(key)) != m_data.end();
     }
 
     std::tuple<std::string, std::string> DataContainer::get_data(const std::string& category, const std::string& key) const
@@ -102,13 +169,13 @@ namespace hal
             return std::make_tuple("", "");
         }
 
-        auto it = m_data.find(std::make_tuple(category, key));
+        auto it = find_entry(StringPool::get_global().find(category), StringPool::get_global().find(key));
         if (it == m_data.end())
         {
             log_debug("netlist", "no value stored for key ('{}', '{}').", category, key);
             return std::make_tuple("", "");
         }
-        return it->second;
+        return std::make_tuple(*it->type, it->value);
     }
 
 }    // namespace hal
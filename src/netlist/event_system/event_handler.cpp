@@ -65,6 +65,23 @@ namespace hal
                                                                                            {GroupingEvent::event::module_assigned, "module_assigned"},
                                                                                            {GroupingEvent::event::module_removed, "module_removed"}};
 
+    template<>
+    std::map<BulkEvent::event, std::string> EnumStrings<BulkEvent::event>::data = {{BulkEvent::event::bulk_begin, "bulk_begin"}, {BulkEvent::event::bulk_end, "bulk_end"}};
+
+    bool BulkChanges::empty() const
+    {
+        return netlist_events.empty() && module_events.empty() && gate_events.empty() && net_events.empty() && grouping_events.empty();
+    }
+
+    void BulkChanges::clear()
+    {
+        netlist_events.clear();
+        module_events.clear();
+        gate_events.clear();
+        net_events.clear();
+        grouping_events.clear();
+    }
+
     EventHandler::EventHandler() : netlist_event_enabled(true), module_event_enabled(true), gate_event_enabled(true), net_event_enabled(true), grouping_event_enabled(true)
     {
     }
@@ -84,6 +101,10 @@ namespace hal
         {
             m_netlist_callback(c, netlist, associated_data);
             event_log::handle_netlist_event(c, netlist, associated_data);
+            if (is_recording_bulk())
+            {
+                m_bulk_changes.netlist_events[c].insert(associated_data);
+            }
         }
     }
 
@@ -93,6 +114,10 @@ namespace hal
         {
             m_gate_callback(c, gate, associated_data);
             event_log::handle_gate_event(c, gate, associated_data);
+            if (is_recording_bulk())
+            {
+                m_bulk_changes.gate_events[c].insert(gate->get_id());
+            }
         }
     }
 
@@ -102,6 +127,10 @@ namespace hal
         {
             m_net_callback(c, net, associated_data);
             event_log::handle_net_event(c, net, associated_data);
+            if (is_recording_bulk())
+            {
+                m_bulk_changes.net_events[c].insert({net->get_id(), associated_data});
+            }
         }
     }
 
@@ -112,6 +141,10 @@ namespace hal
         {
             m_module_callback(c, module, associated_data);
             event_log::handle_module_event(c, module, associated_data);
+            if (is_recording_bulk())
+            {
+                m_bulk_changes.module_events[c].insert({module->get_id(), associated_data});
+            }
         }
     }
 
@@ -121,7 +154,57 @@ namespace hal
         {
             m_grouping_callback(c, grouping, associated_data);
             event_log::handle_grouping_event(c, grouping, associated_data);
+            if (is_recording_bulk())
+            {
+                m_bulk_changes.grouping_events[c].insert({grouping->get_id(), associated_data});
+            }
+        }
+    }
+
+    bool EventHandler::is_recording_bulk() const
+    {
+        // changes are only recorded if anyone is interested in them
+        return m_bulk_depth > 0 && m_bulk_callback.size() > 0;
+    }
+
+    void EventHandler::begin_bulk()
+    {
+        if (m_bulk_depth++ == 0)
+        {
+            m_bulk_changes.clear();
+            m_bulk_callback(BulkEvent::event::bulk_begin, m_bulk_changes);
+        }
+    }
+
+    void EventHandler::end_bulk()
+    {
+        if (m_bulk_depth == 0)
+        {
+            return;
         }
+
+        if (--m_bulk_depth == 0)
+        {
+            // callbacks may start a new bulk, hence the recorded changes are moved out first
+            BulkChanges changes = std::move(m_bulk_changes);
+            m_bulk_changes.clear();
+            m_bulk_callback(BulkEvent::event::bulk_end, changes);
+        }
+    }
+
+    bool EventHandler::is_bulk_active() const
+    {
+        return m_bulk_depth > 0;
+    }
+
+    EventBulkScope::EventBulkScope(EventHandler* event_handler) : m_event_handler(event_handler)
+    {
+        m_event_handler->begin_bulk();
+    }
+
+    EventBulkScope::~EventBulkScope()
+    {
+        m_event_handler->end_bulk();
     }
 
     void EventHandler::register_callback(const std::string& name, std::function<void(GateEvent::event e, Gate*, u32 associated_data)> function)
@@ -149,6 +232,11 @@ namespace hal
         m_netlist_callback.add_callback(name, function);
     }
 
+    void EventHandler::register_callback(const std::string& name, std::function<void(BulkEvent::event e, const BulkChanges& changes)> function)
+    {
+        m_bulk_callback.add_callback(name, function);
+    }
+
     void EventHandler::unregister_callback(const std::string& name)
     {
         m_netlist_callback.remove_callback(name);
@@ -156,5 +244,6 @@ namespace hal
         m_gate_callback.remove_callback(name);
         m_net_callback.remove_callback(name);
         m_grouping_callback.remove_callback(name);
+        m_bulk_callback.remove_callback(name);
     }
 }    // namespace hal
@@ -67,7 +67,7 @@ namespace hal
             return false;
         }
 
-        if (m_functions != other.get_boolean_functions(true))
+        if (get_boolean_functions(true) != other.get_boolean_functions(true))
         {
             log_debug("gate", "the gates with IDs {} and {} are not equal due to an unequal Boolean functions.", m_id, other.get_id());
             return false;
@@ -228,9 +228,12 @@ namespace hal
             }
         }
 
-        if (auto it = m_functions.find(internal_name); it != m_functions.end())
+        if (m_functions != nullptr)
         {
-            return it->second;
+            if (auto it = m_functions->find(internal_name); it != m_functions->end())
+            {
+                return it->second;
+            }
         }
 
         auto map = m_type->get_boolean_functions();
@@ -268,9 +271,12 @@ namespace hal
             res = m_type->get_boolean_functions();
         }
 
-        for (const auto& it : m_functions)
+        if (m_functions != nullptr)
         {
-            res[it.first] = it.second;
+            for (const auto& it : *m_functions)
+            {
+                res[it.first] = it.second;
+            }
         }
 
         if (!only_custom_functions && m_type->has_component_of_type(GateTypeComponent::ComponentType::lut))
@@ -553,7 +559,11 @@ namespace hal
             }
         }
 
-        m_functions[name] = func;
+        if (m_functions == nullptr)
+        {
+            m_functions = std::make_unique<std::unordered_map<std::string, BooleanFunction>>();
+        }
+        (*m_functions)[name] = func;
         m_event_handler->notify(GateEvent::event::boolean_function_changed, this);
         return true;
     }
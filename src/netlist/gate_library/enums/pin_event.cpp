@@ -27,18 +27,23 @@ namespace hal {
 
     std::unordered_map<Module*,PinChangedEvent::EventStack*> PinChangedEvent::s_event_stack;
     u64 PinChangedEvent::s_order = 0;
-    int PinChangedEvent::s_bulk_depth = 0;
+    std::unordered_map<const Netlist*,int> PinChangedEvent::s_bulk_depth;
 
     PinChangedEvent::PinChangedEvent(Module* m, PinEvent pev, u32 id)
         : m_module(m), m_event(pev), m_id(id), m_order(++s_order)
     {;}
 
+    bool PinChangedEvent::is_bulk_active(const Module* m)
+    {
+        return s_bulk_depth.find(m->get_netlist()) != s_bulk_depth.end();
+    }
+
     void PinChangedEvent::send()
     {
         auto it = s_event_stack.find(m_module);
         if (it == s_event_stack.end())
         {
-            if (s_bulk_depth <= 0)
+            if (!is_bulk_active(m_module))
             {
                 // not stacked, send event immediately
                 m_module->get_event_handler()->notify(ModuleEvent::event::pin_changed, m_module, associated_data());
@@ -96,7 +101,7 @@ namespace hal {
         if (it == PinChangedEvent::s_event_stack.end())
         {
             auto* stack      = new PinChangedEvent::EventStack;
-            stack->m_sticky  = (PinChangedEvent::s_bulk_depth > 0);
+            stack->m_sticky  = PinChangedEvent::is_bulk_active(m);
             PinChangedEvent::s_event_stack[m] = stack;
         }
         else
@@ -129,19 +134,33 @@ namespace hal {
         it->second->send_events(m_module);
     }
 
-    PinChangedBulkScope::PinChangedBulkScope()
+    PinChangedBulkScope::PinChangedBulkScope(const Netlist* nl)
+        : m_netlist(nl)
     {
-        ++PinChangedEvent::s_bulk_depth;
+        assert(nl != nullptr);
+        ++PinChangedEvent::s_bulk_depth[nl];
     }
 
     PinChangedBulkScope::~PinChangedBulkScope()
     {
-        if (--PinChangedEvent::s_bulk_depth > 0)
+        auto depth_it = PinChangedEvent::s_bulk_depth.find(m_netlist);
+        assert(depth_it != PinChangedEvent::s_bulk_depth.end());
+        if (--depth_it->second > 0)
             return;
+        PinChangedEvent::s_bulk_depth.erase(depth_it);
 
-        // hand the stacks over before sending, listeners are free to change pins from within their handler
+        // hand the stacks of the netlist over before sending, listeners are free to change pins from within their handler
         std::unordered_map<Module*,PinChangedEvent::EventStack*> stacks;
-        stacks.swap(PinChangedEvent::s_event_stack);
+        for (auto it = PinChangedEvent::s_event_stack.begin(); it != PinChangedEvent::s_event_stack.end();)
+        {
+            if (it->first->get_netlist() == m_netlist)
+            {
+                stacks.insert(*it);
+                it = PinChangedEvent::s_event_stack.erase(it);
+            }
+            else
+                ++it;
+        }
 
         for (auto& [module, stack] : stacks)
         {
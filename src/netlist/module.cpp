@@ -17,9 +17,6 @@ namespace hal
         m_parent           = parent;
         m_name             = name;
 
-        m_next_pin_id       = 1;
-        m_next_pin_group_id = 1;
-
         m_event_handler = event_handler;
     }
 
@@ -193,20 +190,20 @@ namespace hal
             return false;
         }
 
-        auto children = get_submodules(nullptr, true);
-        if (std::find(children.begin(), children.end(), new_parent) != children.end())
+        if (is_parent_module_of(new_parent, true))
         {
             new_parent->set_parent_module(m_parent);
         }
 
         m_parent->m_submodules_map.erase(m_id);
         m_parent->m_submodules.erase(std::find(m_parent->m_submodules.begin(), m_parent->m_submodules.end(), this));
+        m_internal_manager->invalidate_module_hierarchy();
 
         if (m_internal_manager->m_net_checks_enabled)
         {
             for (Net* net : get_nets(nullptr, true))
             {
-                if (auto res = m_parent->check_net(net, true); res.is_error())
+                if (auto res = m_internal_manager->module_update_net(m_parent, net); res.is_error())
                 {
                     log_error("module", "{}", res.get_error().get());
                 }
@@ -219,12 +216,13 @@ namespace hal
 
         m_parent->m_submodules_map[m_id] = this;
         m_parent->m_submodules.push_back(this);
+        m_internal_manager->invalidate_module_hierarchy();
 
         if (m_internal_manager->m_net_checks_enabled)
         {
             for (Net* net : get_nets(nullptr, true))
             {
-                if (auto res = m_parent->check_net(net, true); res.is_error())
+                if (auto res = m_internal_manager->module_update_net(m_parent, net); res.is_error())
                 {
                     log_error("module", "{}", res.get_error().get());
                 }
@@ -239,23 +237,18 @@ namespace hal
 
     bool Module::is_parent_module_of(const Module* module, bool recursive) const
     {
-        if (module == nullptr)
+        if (module == nullptr || module->m_internal_manager != m_internal_manager)
         {
             return false;
         }
-        for (auto sm : m_submodules)
+        if (!recursive)
         {
-            if (sm == module)
-            {
-                return true;
-            }
-            else if (recursive && sm->is_parent_module_of(module, true))
-            {
-                return true;
-            }
+            const auto it = m_submodules_map.find(module->m_id);
+            return it != m_submodules_map.end() && it->second == module;
         }
 
-        return false;
+        m_internal_manager->update_module_hierarchy();
+        return m_hierarchy_enter < module->m_hierarchy_enter && module->m_hierarchy_enter <= m_hierarchy_exit;
     }
 
     std::vector<Module*> Module::get_submodules(const std::function<bool(Module*)>& filter, bool recursive) const
@@ -294,16 +287,7 @@ namespace hal
         {
             return false;
         }
-        if (m_parent == module)
-        {
-            return true;
-        }
-        else if (recursive && m_parent->is_submodule_of(module, true))
-        {
-            return true;
-        }
-
-        return false;
+        return module->is_parent_module_of(this, recursive);
     }
 
     bool Module::contains_module(const Module* other, bool recursive) const
@@ -355,18 +339,12 @@ namespace hal
         {
             return false;
         }
-        bool success = std::find(m_gates.begin(), m_gates.end(), gate) != m_gates.end();
-        if (!success && recursive)
+        Module* mod = gate->get_module();
+        if (mod == this)
         {
-            for (auto sm : m_submodules)
-            {
-                if (sm->contains_gate(gate, true))
-                {
-                    return true;
-                }
-            }
+            return true;
         }
-        return success;
+        return recursive && is_parent_module_of(mod, true);
     }
 
     Gate* Module::get_gate_by_id(const u32 gate_id, bool recursive) const
@@ -762,28 +740,12 @@ namespace hal
 
     u32 Module::get_unique_pin_id()
     {
-        if (!m_free_pin_ids.empty())
-        {
-            return *(m_free_pin_ids.begin());
-        }
-        while (m_used_pin_ids.find(m_next_pin_id) != m_used_pin_ids.end())
-        {
-            m_next_pin_id++;
-        }
-        return m_next_pin_id;
+        return m_pin_ids.get_unique_id();
     }
 
     u32 Module::get_unique_pin_group_id()
     {
-        if (!m_free_pin_group_ids.empty())
-        {
-            return *(m_free_pin_group_ids.begin());
-        }
-        while (m_used_pin_group_ids.find(m_next_pin_group_id) != m_used_pin_group_ids.end())
-        {
-            m_next_pin_group_id++;
-        }
-        return m_next_pin_group_id;
+        return m_pin_group_ids.get_unique_id();
     }
 
     Result<ModulePin*> Module::create_pin(const u32 id, const std::string& name, Net* net, PinType type, bool create_group, bool force_name)
@@ -1756,7 +1718,7 @@ namespace hal
         {
             return ERR("could not create pin '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_ids.find(id) != m_used_pin_ids.end())
+        if (m_pin_ids.is_used(id))
         {
             return ERR("could not create pin '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -1793,11 +1755,7 @@ namespace hal
         m_pin_nets_map[net]   = pin;
 
         // mark pin ID as used
-        if (auto free_id_it = m_free_pin_ids.find(id); free_id_it != m_free_pin_ids.end())
-        {
-            m_free_pin_ids.erase(free_id_it);
-        }
-        m_used_pin_ids.insert(id);
+        m_pin_ids.mark_used(id);
 
         return OK(pin);
     }
@@ -1825,8 +1783,7 @@ namespace hal
         m_pins.erase(std::find_if(m_pins.begin(), m_pins.end(), [pin](const auto& p) { return p.get() == pin; }));
 
         // free pin ID
-        m_free_pin_ids.insert(del_id);
-        m_used_pin_ids.erase(del_id);
+        m_pin_ids.release(del_id);
 
         return true;
     }
@@ -1838,7 +1795,7 @@ namespace hal
         {
             return ERR("could not create pin group '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_group_ids.find(id) != m_used_pin_group_ids.end())
+        if (m_pin_group_ids.is_used(id))
         {
             return ERR("could not create pin group '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -1868,11 +1825,7 @@ namespace hal
         m_pin_group_names_map[name] = pin_group;
 
         // mark pin group ID as used
-        if (auto free_id_it = m_free_pin_group_ids.find(id); free_id_it != m_free_pin_group_ids.end())
-        {
-            m_free_pin_group_ids.erase(free_id_it);
-        }
-        m_used_pin_group_ids.insert(id);
+        m_pin_group_ids.mark_used(id);
 
         return OK(pin_group);
     }
@@ -1901,8 +1854,7 @@ namespace hal
         m_pin_groups.erase(std::find_if(m_pin_groups.begin(), m_pin_groups.end(), [pin_group](const auto& pg) { return pg.get() == pin_group; }));
 
         // free pin group ID
-        m_free_pin_group_ids.insert(del_id);
-        m_used_pin_group_ids.erase(del_id);
+        m_pin_group_ids.release(del_id);
 
         return true;
     }
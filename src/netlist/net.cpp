@@ -44,7 +44,7 @@ namespace hal
         }
 
         const std::vector<Endpoint*>& sources_n2 = other.get_sources();
-        for (const Endpoint* ep_n1 : m_sources_raw)
+        for (const Endpoint* ep_n1 : m_sources)
         {
             if (std::find_if(sources_n2.begin(), sources_n2.end(), [ep_n1](const Endpoint* ep_n2) { return *ep_n1->get_pin() == *ep_n2->get_pin() && *ep_n1->get_gate() == *ep_n2->get_gate(); })
                 == sources_n2.end())
@@ -55,7 +55,7 @@ namespace hal
         }
 
         const std::vector<Endpoint*>& destinations_n2 = other.get_destinations();
-        for (const Endpoint* ep_n1 : m_destinations_raw)
+        for (const Endpoint* ep_n1 : m_destinations)
         {
             if (std::find_if(
                     destinations_n2.begin(), destinations_n2.end(), [ep_n1](const Endpoint* ep_n2) { return *ep_n1->get_pin() == *ep_n2->get_pin() && *ep_n1->get_gate() == *ep_n2->get_gate(); })
@@ -159,7 +159,7 @@ namespace hal
             return false;
         }
 
-        if (auto it = std::find_if(m_sources_raw.begin(), m_sources_raw.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && ep->get_pin() == pin; }); it != m_sources_raw.end())
+        if (auto it = std::find_if(m_sources.begin(), m_sources.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && ep->get_pin() == pin; }); it != m_sources.end())
         {
             return m_internal_manager->net_remove_source(this, *it);
         }
@@ -204,7 +204,7 @@ namespace hal
             return false;
         }
 
-        return std::find_if(m_sources_raw.begin(), m_sources_raw.end(), [gate](const auto* ep) { return ep->get_gate() == gate; }) != m_sources_raw.end();
+        return std::find_if(m_sources.begin(), m_sources.end(), [gate](const auto* ep) { return ep->get_gate() == gate; }) != m_sources.end();
     }
 
     bool Net::is_a_source(const Gate* gate, const GatePin* pin) const
@@ -221,7 +221,7 @@ namespace hal
             return false;
         }
 
-        return std::find_if(m_sources_raw.begin(), m_sources_raw.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && ep->get_pin() == pin; }) != m_sources_raw.end();
+        return std::find_if(m_sources.begin(), m_sources.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && ep->get_pin() == pin; }) != m_sources.end();
     }
 
     bool Net::is_a_source(const Gate* gate, const std::string& pin_name) const
@@ -252,18 +252,18 @@ namespace hal
             return false;
         }
 
-        return std::find(m_sources_raw.begin(), m_sources_raw.end(), ep) != m_sources_raw.end();
+        return std::find(m_sources.begin(), m_sources.end(), ep) != m_sources.end();
     }
 
     u32 Net::get_num_of_sources(const std::function<bool(Endpoint* ep)>& filter) const
     {
         if (!filter)
         {
-            return (u32)m_sources_raw.size();
+            return (u32)m_sources.size();
         }
 
         u32 num = 0;
-        for (auto dst : m_sources_raw)
+        for (auto dst : m_sources)
         {
             if (filter(dst))
             {
@@ -277,11 +277,11 @@ namespace hal
     {
         if (!filter)
         {
-            return m_sources_raw;
+            return m_sources;
         }
 
         std::vector<Endpoint*> srcs;
-        for (auto src : m_sources_raw)
+        for (auto src : m_sources)
         {
             if (!filter(src))
             {
@@ -332,8 +332,8 @@ namespace hal
             return false;
         }
 
-        if (auto it = std::find_if(m_destinations_raw.begin(), m_destinations_raw.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && ep->get_pin() == pin; });
-            it != m_destinations_raw.end())
+        if (auto it = std::find_if(m_destinations.begin(), m_destinations.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && ep->get_pin() == pin; });
+            it != m_destinations.end())
         {
             return m_internal_manager->net_remove_destination(this, *it);
         }
@@ -378,7 +378,7 @@ namespace hal
             return false;
         }
 
-        return std::find_if(m_destinations_raw.begin(), m_destinations_raw.end(), [gate](const auto* ep) { return ep->get_gate() == gate; }) != m_destinations_raw.end();
+        return std::find_if(m_destinations.begin(), m_destinations.end(), [gate](const auto* ep) { return ep->get_gate() == gate; }) != m_destinations.end();
     }
 
     bool Net::is_a_destination(const Gate* gate, const GatePin* pin) const
@@ -395,7 +395,7 @@ namespace hal
             return false;
         }
 
-        return std::find_if(m_destinations_raw.begin(), m_destinations_raw.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && ep->get_pin() == pin; }) != m_destinations_raw.end();
+        return std::find_if(m_destinations.begin(), m_destinations.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && ep->get_pin() == pin; }) != m_destinations.end();
     }
 
     bool Net::is_a_destination(const Gate* gate, const std::string& pin_name) const
@@ -426,18 +426,18 @@ namespace hal
             return false;
         }
 
-        return std::find(m_destinations_raw.begin(), m_destinations_raw.end(), ep) != m_destinations_raw.end();
+        return std::find(m_destinations.begin(), m_destinations.end(), ep) != m_destinations.end();
     }
 
     u32 Net::get_num_of_destinations(const std::function<bool(Endpoint* ep)>& filter) const
     {
         if (!filter)
         {
-            return (u32)m_destinations_raw.size();
+            return (u32)m_destinations.size();
         }
 
         u32 num = 0;
-        for (auto dst : m_destinations_raw)
+        for (auto dst : m_destinations)
         {
             if (filter(dst))
             {
@@ -451,11 +451,11 @@ namespace hal
     {
         if (!filter)
         {
-            return m_destinations_raw;
+            return m_destinations;
         }
 
         std::vector<Endpoint*> dsts;
-        for (auto dst : m_destinations_raw)
+        for (auto dst : m_destinations)
         {
             if (!filter(dst))
             {
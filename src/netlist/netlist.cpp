@@ -17,16 +17,21 @@ namespace hal
         m_event_handler    = std::make_unique<EventHandler>();
         m_manager          = new NetlistInternalManager(this, m_event_handler.get());
         m_netlist_id       = 1;
-        m_next_gate_id     = 1;
-        m_next_net_id      = 1;
-        m_next_module_id   = 1;
-        m_next_grouping_id = 1;
         m_top_module       = nullptr;    // this triggers the internal manager to allow creation of a module without parent
         m_top_module       = create_module("top_module", nullptr);
     }
 
     Netlist::~Netlist()
     {
+        if (m_manager->m_transaction_depth > 0)
+        {
+            log_warning("netlist", "netlist with ID {} is destroyed during a transaction, committing the transaction.", m_netlist_id);
+            m_manager->m_transaction_depth = 1;
+            if (const auto res = m_manager->commit_transaction(); res.is_error())
+            {
+                log_error("netlist", "{}", res.get_error().get());
+            }
+        }
         delete m_manager;
     }
 
@@ -161,15 +166,7 @@ namespace hal
 
     u32 Netlist::get_unique_gate_id()
     {
-        if (!m_free_gate_ids.empty())
-        {
-            return *(m_free_gate_ids.begin());
-        }
-        while (m_used_gate_ids.find(m_next_gate_id) != m_used_gate_ids.end())
-        {
-            m_next_gate_id++;
-        }
-        return m_next_gate_id;
+        return m_gate_ids.get_unique_id();
     }
 
     Gate* Netlist::create_gate(const u32 id, GateType* gt, const std::string& name, i32 x, i32 y)
@@ -321,15 +318,7 @@ namespace hal
 
     u32 Netlist::get_unique_net_id()
     {
-        if (!m_free_net_ids.empty())
-        {
-            return *(m_free_net_ids.begin());
-        }
-        while (m_used_net_ids.find(m_next_net_id) != m_used_net_ids.end())
-        {
-            m_next_net_id++;
-        }
-        return m_next_net_id;
+        return m_net_ids.get_unique_id();
     }
 
     Net* Netlist::create_net(const u32 id, const std::string& name)
@@ -567,6 +556,21 @@ namespace hal
         m_manager->m_net_checks_enabled = enable_checks;
     }
 
+    void Netlist::begin_transaction()
+    {
+        m_manager->begin_transaction();
+    }
+
+    Result<std::monostate> Netlist::commit_transaction()
+    {
+        return m_manager->commit_transaction();
+    }
+
+    bool Netlist::is_transaction_active() const
+    {
+        return m_manager->m_transaction_depth > 0;
+    }
+
     /*
      * ################################################################
      *      module functions
@@ -575,15 +579,7 @@ namespace hal
 
     u32 Netlist::get_unique_module_id()
     {
-        if (!m_free_module_ids.empty())
-        {
-            return *(m_free_module_ids.begin());
-        }
-        while (m_used_module_ids.find(m_next_module_id) != m_used_module_ids.end())
-        {
-            m_next_module_id++;
-        }
-        return m_next_module_id;
+        return m_module_ids.get_unique_id();
     }
 
     Module* Netlist::create_module(const u32 id, const std::string& name, Module* parent, const std::vector<Gate*>& gates)
@@ -659,15 +655,7 @@ namespace hal
 
     u32 Netlist::get_unique_grouping_id()
     {
-        if (!m_free_grouping_ids.empty())
-        {
-            return *(m_free_grouping_ids.begin());
-        }
-        while (m_used_grouping_ids.find(m_next_grouping_id) != m_used_grouping_ids.end())
-        {
-            m_next_grouping_id++;
-        }
-        return m_next_grouping_id;
+        return m_grouping_ids.get_unique_id();
     }
 
     Grouping* Netlist::create_grouping(const u32 id, const std::string& name)
@@ -732,122 +720,122 @@ namespace hal
 
     u32 Netlist::get_next_gate_id() const
     {
-        return m_next_gate_id;
+        return m_gate_ids.get_next_id();
     }
 
     void Netlist::set_next_gate_id(const u32 id)
     {
-        m_next_gate_id = id;
+        m_gate_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_gate_ids() const
     {
-        return m_used_gate_ids;
+        return m_gate_ids.get_used_ids();
     }
 
     void Netlist::set_used_gate_ids(const std::set<u32> ids)
     {
-        m_used_gate_ids = ids;
+        m_gate_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_gate_ids() const
     {
-        return m_free_gate_ids;
+        return m_gate_ids.get_free_ids();
     }
 
     void Netlist::set_free_gate_ids(const std::set<u32> ids)
     {
-        m_free_gate_ids = ids;
+        m_gate_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_net_id() const
     {
-        return m_next_net_id;
+        return m_net_ids.get_next_id();
     }
 
     void Netlist::set_next_net_id(const u32 id)
     {
-        m_next_net_id = id;
+        m_net_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_net_ids() const
     {
-        return m_used_net_ids;
+        return m_net_ids.get_used_ids();
     }
 
     void Netlist::set_used_net_ids(const std::set<u32> ids)
     {
-        m_used_net_ids = ids;
+        m_net_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_net_ids() const
     {
-        return m_free_net_ids;
+        return m_net_ids.get_free_ids();
     }
 
     void Netlist::set_free_net_ids(const std::set<u32> ids)
     {
-        m_free_net_ids = ids;
+        m_net_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_module_id() const
     {
-        return m_next_module_id;
+        return m_module_ids.get_next_id();
     }
 
     void Netlist::set_next_module_id(const u32 id)
     {
-        m_next_module_id = id;
+        m_module_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_module_ids() const
     {
-        return m_used_module_ids;
+        return m_module_ids.get_used_ids();
     }
 
     void Netlist::set_used_module_ids(const std::set<u32> ids)
     {
-        m_used_module_ids = ids;
+        m_module_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_module_ids() const
     {
-        return m_free_module_ids;
+        return m_module_ids.get_free_ids();
     }
 
     void Netlist::set_free_module_ids(const std::set<u32> ids)
     {
-        m_free_module_ids = ids;
+        m_module_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_grouping_id() const
     {
-        return m_next_grouping_id;
+        return m_grouping_ids.get_next_id();
     }
 
     void Netlist::set_next_grouping_id(const u32 id)
     {
-        m_next_grouping_id = id;
+        m_grouping_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_grouping_ids() const
     {
-        return m_used_grouping_ids;
+        return m_grouping_ids.get_used_ids();
     }
 
     void Netlist::set_used_grouping_ids(const std::set<u32> ids)
     {
-        m_used_grouping_ids = ids;
+        m_grouping_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_grouping_ids() const
     {
-        return m_free_grouping_ids;
+        return m_grouping_ids.get_free_ids();
     }
 
     void Netlist::set_free_grouping_ids(const std::set<u32> ids)
     {
-        m_free_grouping_ids = ids;
+        m_grouping_ids.set_free_ids(ids);
     }
 
     /*
@@ -909,4 +897,26 @@ namespace hal
         return true;
     }
 
+    NetlistTransaction::NetlistTransaction(Netlist* netlist) : m_netlist(netlist)
+    {
+        m_netlist->begin_transaction();
+    }
+
+    NetlistTransaction::~NetlistTransaction()
+    {
+        if (const auto res = commit(); res.is_error())
+        {
+            log_error("netlist", "{}", res.get_error().get());
+        }
+    }
+
+    Result<std::monostate> NetlistTransaction::commit()
+    {
+        if (m_committed)
+        {
+            return OK({});
+        }
+        m_committed = true;
+        return m_netlist->commit_transaction();
+    }
 }    // namespace hal
@@ -3,6 +3,7 @@
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser_manager.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
 #include "hal_core/netlist/project_manager.h"
 #include "hal_core/utilities/log.h"
@@ -68,6 +69,10 @@ namespace hal
             {
                 return netlist_serializer::deserialize_from_file(netlist_file, lib);
             }
+            else if (netlist_file.extension() == netlist_binary_serializer::FILE_EXTENSION)
+            {
+                return netlist_binary_serializer::deserialize_from_file(netlist_file, lib);
+            }
             else
             {
                 if (!lib)
@@ -97,6 +102,10 @@ namespace hal
             {
                 return netlist_serializer::deserialize_from_file(netlist_file, gate_library);
             }
+            else if (netlist_file.extension() == netlist_binary_serializer::FILE_EXTENSION)
+            {
+                return netlist_binary_serializer::deserialize_from_file(netlist_file, gate_library);
+            }
             else
             {
                 return netlist_parser_manager::parse(netlist_file, gate_library);
@@ -126,6 +135,12 @@ namespace hal
         {
             std::filesystem::path netlist_file = args.is_option_set("--import-netlist") ? std::filesystem::path(args.get_parameter("--import-netlist")) : pdir.get_default_filename();
 
+            // projects saved in the binary format do not contain a .hal file
+            if (!args.is_option_set("--import-netlist") && !std::filesystem::exists(netlist_file))
+            {
+                netlist_file = pdir.get_default_filename(netlist_binary_serializer::FILE_EXTENSION);
+            }
+
             if (access(netlist_file.c_str(), F_OK | R_OK) == -1)
             {
                 log_critical("netlist", "cannot access file '{}'.", netlist_file.string());
@@ -138,6 +153,10 @@ namespace hal
             {
                 return netlist_serializer::deserialize_from_file(netlist_file);
             }
+            else if (extension == netlist_binary_serializer::FILE_EXTENSION)
+            {
+                return netlist_binary_serializer::deserialize_from_file(netlist_file);
+            }
 
             return netlist_parser_manager::parse(netlist_file, args);
         }
@@ -11,6 +11,10 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
+#include <new>
+#include <unordered_set>
+
 namespace hal
 {
     NetlistInternalManager::NetlistInternalManager(Netlist* nl, EventHandler* eh)
@@ -108,7 +112,7 @@ namespace hal
             // ignore top module, since this is already created by the constructor
             if (module->m_id == 1)
             {
-                c_netlist->m_top_module->m_data = module->get_data_map();
+                c_netlist->m_top_module->m_data = module->m_data;
                 c_netlist->m_top_module->m_type = module->m_type;
                 continue;
             }
@@ -214,21 +218,10 @@ namespace hal
         c_netlist->m_file_name   = nl->m_file_name;
 
         // update ids last, after all the creation
-        c_netlist->m_next_gate_id  = nl->m_next_gate_id;
-        c_netlist->m_used_gate_ids = nl->m_used_gate_ids;
-        c_netlist->m_free_gate_ids = nl->m_free_gate_ids;
-
-        c_netlist->m_next_net_id  = nl->m_next_net_id;
-        c_netlist->m_used_net_ids = nl->m_used_net_ids;
-        c_netlist->m_free_net_ids = nl->m_free_net_ids;
-
-        c_netlist->m_next_module_id  = nl->m_next_module_id;
-        c_netlist->m_used_module_ids = nl->m_used_module_ids;
-        c_netlist->m_free_module_ids = nl->m_free_module_ids;
-
-        c_netlist->m_next_grouping_id  = nl->m_next_grouping_id;
-        c_netlist->m_used_grouping_ids = nl->m_used_grouping_ids;
-        c_netlist->m_free_grouping_ids = nl->m_free_grouping_ids;
+        c_netlist->m_gate_ids     = nl->m_gate_ids;
+        c_netlist->m_net_ids      = nl->m_net_ids;
+        c_netlist->m_module_ids   = nl->m_module_ids;
+        c_netlist->m_grouping_ids = nl->m_grouping_ids;
 
         // copy module port names
         for (Module* module : nl->m_modules)
@@ -283,7 +276,7 @@ namespace hal
             log_error("gate", "ID 0 represents an invalid gate ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_gate_ids.find(id) != m_netlist->m_used_gate_ids.end())
+        if (m_netlist->m_gate_ids.is_used(id))
         {
             log_error("gate", "gate ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -306,13 +299,7 @@ namespace hal
 
         auto new_gate = std::unique_ptr<Gate>(new Gate(this, m_event_handler, id, gt, name, x, y));
 
-        auto free_id_it = m_netlist->m_free_gate_ids.find(id);
-        if (free_id_it != m_netlist->m_free_gate_ids.end())
-        {
-            m_netlist->m_free_gate_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_gate_ids.insert(id);
+        m_netlist->m_gate_ids.mark_used(id);
 
         // add gate to top module
         new_gate->m_module = m_netlist->m_top_module;
@@ -340,7 +327,9 @@ namespace hal
             return false;
         }
 
-        for (auto ep : gate->get_fan_out_endpoints())
+        // copy the endpoints, removing them from their nets destroys them and changes the vectors of the gate
+        auto out_eps = gate->m_out_endpoints;
+        for (auto ep : out_eps)
         {
             if (!net_remove_source(ep->get_net(), ep))
             {
@@ -348,7 +337,8 @@ namespace hal
             }
         }
 
-        for (auto ep : gate->get_fan_in_endpoints())
+        auto in_eps = gate->m_in_endpoints;
+        for (auto ep : in_eps)
         {
             if (!net_remove_destination(ep->get_net(), ep))
             {
@@ -377,8 +367,7 @@ namespace hal
         utils::unordered_vector_erase(m_netlist->m_gates, gate);
 
         // free ids
-        m_netlist->m_free_gate_ids.insert(gate->get_id());
-        m_netlist->m_used_gate_ids.erase(gate->get_id());
+        m_netlist->m_gate_ids.release(gate->get_id());
 
         m_event_handler->notify(ModuleEvent::event::gate_removed, gate->m_module, gate->get_id());
         m_event_handler->notify(GateEvent::event::removed, gate);
@@ -402,7 +391,7 @@ namespace hal
             log_error("net", "ID 0 represents an invalid net ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_net_ids.find(id) != m_netlist->m_used_net_ids.end())
+        if (m_netlist->m_net_ids.is_used(id))
         {
             log_error("net", "net ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -415,13 +404,7 @@ namespace hal
 
         auto new_net = std::unique_ptr<Net>(new Net(this, m_event_handler, id, name));
 
-        auto free_id_it = m_netlist->m_free_net_ids.find(id);
-        if (free_id_it != m_netlist->m_free_net_ids.end())
-        {
-            m_netlist->m_free_net_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_net_ids.insert(id);
+        m_netlist->m_net_ids.mark_used(id);
 
         // add net to netlist
         auto raw                  = new_net.get();
@@ -442,7 +425,7 @@ namespace hal
             return false;
         }
 
-        auto dsts = net->m_destinations_raw;
+        auto dsts = net->m_destinations;
         for (auto dst : dsts)
         {
             if (!this->net_remove_destination(net, dst))
@@ -451,7 +434,7 @@ namespace hal
             }
         }
 
-        auto srcs = net->m_sources_raw;
+        auto srcs = net->m_sources;
         for (auto src : srcs)
         {
             if (!this->net_remove_source(net, src))
@@ -470,6 +453,13 @@ namespace hal
         m_netlist->unmark_global_input_net(net);
         m_netlist->unmark_global_output_net(net);
 
+        // checks deferred by a transaction must be done while the net still exists
+        if (const auto res = flush_net_checks(net); res.is_error())
+        {
+            log_error("net", "{}", res.get_error().get());
+            return false;
+        }
+
         // remove net from netlist
         auto it  = m_netlist->m_nets_map.find(net->get_id());
         auto ptr = std::move(it->second);
@@ -477,8 +467,7 @@ namespace hal
         m_netlist->m_nets_set.erase(net);
         utils::unordered_vector_erase(m_netlist->m_nets, net);
 
-        m_netlist->m_free_net_ids.insert(net->get_id());
-        m_netlist->m_used_net_ids.erase(net->get_id());
+        m_netlist->m_net_ids.release(net->get_id());
 
         m_event_handler->notify(NetEvent::event::removed, net);
 
@@ -530,17 +519,15 @@ namespace hal
             return nullptr;
         }
 
-        auto new_endpoint     = std::unique_ptr<Endpoint>(new Endpoint(gate, pin, net, false));
-        auto new_endpoint_raw = new_endpoint.get();
-        net->m_sources.push_back(std::move(new_endpoint));
-        net->m_sources_raw.push_back(new_endpoint_raw);
-        gate->m_out_endpoints.push_back(new_endpoint_raw);
+        Endpoint* new_endpoint = new (m_endpoint_pool.allocate()) Endpoint(gate, pin, net, false);
+        net->m_sources.push_back(new_endpoint);
+        gate->m_out_endpoints.push_back(new_endpoint);
         gate->m_out_nets.push_back(net);
 
         // update internal nets and port nets
         if (m_net_checks_enabled)
         {
-            if (const auto res = gate->get_module()->check_net(net, true); res.is_error())
+            if (const auto res = module_update_net(gate->get_module(), net); res.is_error())
             {
                 log_error("net", "{}", res.get_error().get());
                 return nullptr;
@@ -548,7 +535,7 @@ namespace hal
 
             for (Endpoint* ep : net->get_destinations())
             {
-                if (const auto res = ep->get_gate()->get_module()->check_net(net, true); res.is_error())
+                if (const auto res = module_update_net(ep->get_gate()->get_module(), net); res.is_error())
                 {
                     log_error("net", "{}", res.get_error().get());
                     return nullptr;
@@ -558,7 +545,7 @@ namespace hal
 
         m_event_handler->notify(NetEvent::event::src_added, net, gate->get_id());
 
-        return new_endpoint_raw;
+        return new_endpoint;
     }
 
     bool NetlistInternalManager::net_remove_source(Net* net, Endpoint* ep)
@@ -573,14 +560,13 @@ namespace hal
         bool removed = false;
         for (u32 i = 0; i < net->m_sources.size(); ++i)
         {
-            if (net->m_sources_raw[i] == ep)
+            if (net->m_sources[i] == ep)
             {
                 utils::unordered_vector_erase(gate->m_out_endpoints, ep);
                 utils::unordered_vector_erase(gate->m_out_nets, net);
-                net->m_sources[i] = std::move(net->m_sources.back());
+                net->m_sources[i] = net->m_sources.back();
                 net->m_sources.pop_back();
-                net->m_sources_raw[i] = net->m_sources_raw.back();
-                net->m_sources_raw.pop_back();
+                m_endpoint_pool.destroy(ep);
                 m_event_handler->notify(NetEvent::event::src_removed, net, gate->get_id());
                 removed = true;
                 break;
@@ -603,7 +589,7 @@ namespace hal
             // update internal nets and port nets
             if (m_net_checks_enabled)
             {
-                if (const auto res = gate->get_module()->check_net(net, true); res.is_error())
+                if (const auto res = module_update_net(gate->get_module(), net); res.is_error())
                 {
                     log_error("net", "{}", res.get_error().get());
                     return false;
@@ -611,7 +597,7 @@ namespace hal
 
                 for (Endpoint* dst : net->get_destinations())
                 {
-                    if (const auto res = dst->get_gate()->get_module()->check_net(net, true); res.is_error())
+                    if (const auto res = module_update_net(dst->get_gate()->get_module(), net); res.is_error())
                     {
                         log_error("net", "{}", res.get_error().get());
                         return false;
@@ -668,17 +654,15 @@ namespace hal
             return nullptr;
         }
 
-        std::unique_ptr<Endpoint> new_endpoint = std::unique_ptr<Endpoint>(new Endpoint(gate, pin, net, true));
-        Endpoint* new_endpoint_raw             = new_endpoint.get();
-        net->m_destinations.push_back(std::move(new_endpoint));
-        net->m_destinations_raw.push_back(new_endpoint_raw);
-        gate->m_in_endpoints.push_back(new_endpoint_raw);
+        Endpoint* new_endpoint = new (m_endpoint_pool.allocate()) Endpoint(gate, pin, net, true);
+        net->m_destinations.push_back(new_endpoint);
+        gate->m_in_endpoints.push_back(new_endpoint);
         gate->m_in_nets.push_back(net);
 
         // update internal nets and port nets
         if (m_net_checks_enabled)
         {
-            if (const auto res = gate->get_module()->check_net(net, true); res.is_error())
+            if (const auto res = module_update_net(gate->get_module(), net); res.is_error())
             {
                 log_error("net", "{}", res.get_error().get());
                 return nullptr;
@@ -686,7 +670,7 @@ namespace hal
 
             for (Endpoint* ep : net->get_sources())
             {
-                if (const auto res = ep->get_gate()->get_module()->check_net(net, true); res.is_error())
+                if (const auto res = module_update_net(ep->get_gate()->get_module(), net); res.is_error())
                 {
                     log_error("net", "{}", res.get_error().get());
                     return nullptr;
@@ -696,7 +680,7 @@ namespace hal
 
         m_event_handler->notify(NetEvent::event::dst_added, net, gate->get_id());
 
-        return new_endpoint_raw;
+        return new_endpoint;
     }
 
     bool NetlistInternalManager::net_remove_destination(Net* net, Endpoint* ep)
@@ -710,14 +694,13 @@ namespace hal
         bool removed = false;
         for (u32 i = 0; i < net->m_destinations.size(); ++i)
         {
-            if (net->m_destinations_raw[i] == ep)
+            if (net->m_destinations[i] == ep)
             {
                 utils::unordered_vector_erase(gate->m_in_endpoints, ep);
                 utils::unordered_vector_erase(gate->m_in_nets, net);
-                net->m_destinations[i] = std::move(net->m_destinations.back());
+                net->m_destinations[i] = net->m_destinations.back();
                 net->m_destinations.pop_back();
-                net->m_destinations_raw[i] = net->m_destinations_raw.back();
-                net->m_destinations_raw.pop_back();
+                m_endpoint_pool.destroy(ep);
                 m_event_handler->notify(NetEvent::event::dst_removed, net, gate->get_id());
                 removed = true;
                 break;
@@ -739,7 +722,7 @@ namespace hal
         {    // update internal nets and port nets
             if (m_net_checks_enabled)
             {
-                if (const auto res = gate->get_module()->check_net(net, true); res.is_error())
+                if (const auto res = module_update_net(gate->get_module(), net); res.is_error())
                 {
                     log_error("net", "{}", res.get_error().get());
                     return false;
@@ -747,7 +730,7 @@ namespace hal
 
                 for (Endpoint* src : net->get_sources())
                 {
-                    if (const auto res = src->get_gate()->get_module()->check_net(net, true); res.is_error())
+                    if (const auto res = module_update_net(src->get_gate()->get_module(), net); res.is_error())
                     {
                         log_error("net", "{}", res.get_error().get());
                         return false;
@@ -770,7 +753,7 @@ namespace hal
             log_error("module", "ID 0 represents an invalid module ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_module_ids.find(id) != m_netlist->m_used_module_ids.end())
+        if (m_netlist->m_module_ids.is_used(id))
         {
             log_error("module", "module ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -793,13 +776,7 @@ namespace hal
 
         auto m = std::unique_ptr<Module>(new Module(this, m_event_handler, id, parent, name));
 
-        auto free_id_it = m_netlist->m_free_module_ids.find(id);
-        if (free_id_it != m_netlist->m_free_module_ids.end())
-        {
-            m_netlist->m_free_module_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_module_ids.insert(id);
+        m_netlist->m_module_ids.mark_used(id);
 
         auto raw                     = m.get();
         m_netlist->m_modules_map[id] = std::move(m);
@@ -811,6 +788,7 @@ namespace hal
             parent->m_submodules_map[id] = raw;
             parent->m_submodules.push_back(raw);
         }
+        invalidate_module_hierarchy();
 
         m_event_handler->notify(ModuleEvent::event::created, raw);
 
@@ -855,6 +833,7 @@ namespace hal
             m_event_handler->notify(ModuleEvent::event::submodule_removed, sm->get_parent_module(), sm->get_id());
 
             sm->m_parent = to_remove->m_parent;
+            invalidate_module_hierarchy();
 
             m_event_handler->notify(ModuleEvent::event::parent_changed, sm, 0);
             m_event_handler->notify(ModuleEvent::event::submodule_added, to_remove->m_parent, sm->get_id());
@@ -863,6 +842,7 @@ namespace hal
         // remove module from parent
         to_remove->m_parent->m_submodules_map.erase(to_remove->get_id());
         utils::unordered_vector_erase(to_remove->m_parent->m_submodules, to_remove);
+        invalidate_module_hierarchy();
         m_event_handler->notify(ModuleEvent::event::submodule_removed, to_remove->m_parent, to_remove->get_id());
 
         auto it  = m_netlist->m_modules_map.find(to_remove->get_id());
@@ -871,8 +851,7 @@ namespace hal
         m_netlist->m_modules_set.erase(to_remove);
         utils::unordered_vector_erase(m_netlist->m_modules, to_remove);
 
-        m_netlist->m_free_module_ids.insert(to_remove->get_id());
-        m_netlist->m_used_module_ids.erase(to_remove->get_id());
+        m_netlist->m_module_ids.release(to_remove->get_id());
 
         // no pin event must survive the module it refers to
         PinChangedEvent::discard(to_remove);
@@ -934,6 +913,14 @@ namespace hal
         {
             m_event_handler->notify(ModuleEvent::event::gates_remove_begin, prev_mod, num_gates);
         }
+
+        // remove the gates from their previous modules in one pass per module, searching every gate separately is quadratic in the number of gates
+        const std::unordered_set<const Gate*> moved_gates(gates.begin(), gates.end());
+        for (const auto& [prev_mod, num_gates] : prev_modules)
+        {
+            std::vector<Gate*>& prev_gates = prev_mod->m_gates;
+            prev_gates.erase(std::remove_if(prev_gates.begin(), prev_gates.end(), [&moved_gates](const Gate* g) { return moved_gates.find(g) != moved_gates.end(); }), prev_gates.end());
+        }
         prev_modules.clear();
 
         // re-assign gates
@@ -946,8 +933,6 @@ namespace hal
             assert(it != prev_mod->m_gates_map.end());
             prev_mod->m_gates_map.erase(it);
 
-            utils::unordered_vector_erase(prev_mod->m_gates, g);
-
             // move gate to new module
             module->m_gates_map[g->get_id()] = g;
             module->m_gates.push_back(g);
@@ -978,13 +963,13 @@ namespace hal
         {
             // a bulk assignment changes the pins of the affected modules wholesale, so the individual pin events
             // are collapsed into a single PinEvent::PinsReload per module instead of several events per pin
-            PinChangedBulkScope pin_scope;
+            PinChangedBulkScope pin_scope(m_netlist);
 
             for (const auto& [affected_module, nets] : nets_to_check)
             {
                 for (Net* net : nets)
                 {
-                    if (const auto res = affected_module->check_net(net, true); res.is_error())
+                    if (const auto res = module_update_net(affected_module, net); res.is_error())
                     {
                         log_error("module", "{}", res.get_error().get());
                         return false;
@@ -1004,13 +989,95 @@ namespace hal
 
     bool NetlistInternalManager::module_check_net(Module* module, Net* net, bool recursive)
     {
-        if (const auto res = module->check_net(net, recursive); res.is_error())
+        if (const auto res = recursive ? module_update_net(module, net) : module->check_net(net, false); res.is_error())
         {
             return false;
         }
         return true;
     }
 
+    Result<std::monostate> NetlistInternalManager::module_update_net(Module* module, Net* net)
+    {
+        if (m_transaction_depth == 0)
+        {
+            return module->check_net(net, true);
+        }
+
+        // within a transaction, the net is checked once for every affected module when the transaction is committed
+        std::vector<Module*>& modules = m_transaction_net_checks[net];
+        for (Module* mod = module; mod != nullptr; mod = mod->m_parent)
+        {
+            if (std::find(modules.begin(), modules.end(), mod) == modules.end())
+            {
+                modules.push_back(mod);
+            }
+        }
+        return OK({});
+    }
+
+    void NetlistInternalManager::invalidate_module_hierarchy()
+    {
+        m_module_hierarchy_valid.store(false, std::memory_order_release);
+    }
+
+    void NetlistInternalManager::update_module_hierarchy() const
+    {
+        if (m_module_hierarchy_valid.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_module_hierarchy_mutex);
+        if (m_module_hierarchy_valid.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // number the modules in depth-first order, so that the descendants of a module occupy the interval (enter, exit]
+        // modules that are (temporarily) detached from their parent keep the number 0 unless they are traversed as roots themselves
+        for (const Module* module : m_netlist->m_modules)
+        {
+            module->m_hierarchy_enter = 0;
+            module->m_hierarchy_exit  = 0;
+        }
+
+        u32 counter = 0;
+        std::vector<std::pair<const Module*, u32>> stack;
+        auto traverse = [&counter, &stack](const Module* root) {
+            root->m_hierarchy_enter = ++counter;
+            stack.emplace_back(root, 0);
+            while (!stack.empty())
+            {
+                auto& [module, next_child] = stack.back();
+                if (next_child < module->m_submodules.size())
+                {
+                    const Module* child      = module->m_submodules[next_child++];
+                    child->m_hierarchy_enter = ++counter;
+                    stack.emplace_back(child, 0);
+                }
+                else
+                {
+                    module->m_hierarchy_exit = counter;
+                    stack.pop_back();
+                }
+            }
+        };
+
+        if (m_netlist->m_top_module != nullptr)
+        {
+            traverse(m_netlist->m_top_module);
+        }
+        for (const Module* module : m_netlist->m_modules)
+        {
+            if (module->m_hierarchy_enter == 0 && (module->m_parent == nullptr || module->m_parent->m_hierarchy_enter != 0))
+            {
+                traverse(module);
+            }
+        }
+
+        m_module_hierarchy_valid.store(true, std::memory_order_release);
+    }
+
     //######################################################################
     //###                      groupings                                 ###
     //######################################################################
@@ -1022,7 +1089,7 @@ namespace hal
             log_error("grouping", "ID 0 represents an invalid grouping ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_grouping_ids.find(id) != m_netlist->m_used_grouping_ids.end())
+        if (m_netlist->m_grouping_ids.is_used(id))
         {
             log_error("grouping", "grouping ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -1035,13 +1102,7 @@ namespace hal
 
         auto new_grouping = std::unique_ptr<Grouping>(new Grouping(this, m_event_handler, id, name));
 
-        auto free_id_it = m_netlist->m_free_grouping_ids.find(id);
-        if (free_id_it != m_netlist->m_free_grouping_ids.end())
-        {
-            m_netlist->m_free_grouping_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_grouping_ids.insert(id);
+        m_netlist->m_grouping_ids.mark_used(id);
 
         auto raw = new_grouping.get();
 
@@ -1084,8 +1145,7 @@ namespace hal
         utils::unordered_vector_erase(m_netlist->m_groupings, grouping);
 
         // free ids
-        m_netlist->m_free_grouping_ids.insert(grouping->get_id());
-        m_netlist->m_used_grouping_ids.erase(grouping->get_id());
+        m_netlist->m_grouping_ids.release(grouping->get_id());
 
         // notify
         m_event_handler->notify(GroupingEvent::event::removed, grouping);
@@ -1307,6 +1367,96 @@ namespace hal
     //###                           caches                               ###
     //######################################################################
 
+    //######################################################################
+    //###                      transactions                              ###
+    //######################################################################
+
+    bool NetlistInternalManager::check_net_for_modules(Net* net, const std::vector<Module*>& modules)
+    {
+        // the modules are complemented by their current parent modules, since the hierarchy may have changed after a module had been affected
+        std::unordered_set<Module*> checked;
+        bool success = true;
+        for (Module* affected : modules)
+        {
+            // skip modules that have been deleted in the meantime
+            if (!m_netlist->is_module_in_netlist(affected))
+            {
+                continue;
+            }
+
+            for (Module* mod = affected; mod != nullptr && checked.insert(mod).second; mod = mod->m_parent)
+            {
+                if (const auto res = mod->check_net(net, false); res.is_error())
+                {
+                    log_error("netlist", "{}", res.get_error().get());
+                    success = false;
+                }
+            }
+        }
+        return success;
+    }
+
+    void NetlistInternalManager::begin_transaction()
+    {
+        if (m_transaction_depth++ == 0)
+        {
+            // all events of the transaction are additionally handed to the bulk listeners at once
+            m_event_handler->begin_bulk();
+
+            // pin events are collected for the whole transaction and replaced by a single reload event per module
+            m_transaction_pin_scope = std::make_unique<PinChangedBulkScope>(m_netlist);
+        }
+    }
+
+    Result<std::monostate> NetlistInternalManager::commit_transaction()
+    {
+        if (m_transaction_depth == 0)
+        {
+            return ERR("no transaction has been started for netlist with ID " + std::to_string(m_netlist->m_netlist_id));
+        }
+        if (--m_transaction_depth > 0)
+        {
+            return OK({});
+        }
+
+        // listeners of the pin events are free to start another transaction, so the pending checks are taken over first
+        std::unordered_map<Net*, std::vector<Module*>> net_checks;
+        net_checks.swap(m_transaction_net_checks);
+
+        bool success = true;
+        for (const auto& [net, modules] : net_checks)
+        {
+            success &= check_net_for_modules(net, modules);
+        }
+
+        m_transaction_pin_scope.reset();
+        m_event_handler->end_bulk();
+
+        if (!success)
+        {
+            return ERR("could not update the module nets of netlist with ID " + std::to_string(m_netlist->m_netlist_id) + " when committing the transaction");
+        }
+        return OK({});
+    }
+
+    Result<std::monostate> NetlistInternalManager::flush_net_checks(Net* net)
+    {
+        const auto it = m_transaction_net_checks.find(net);
+        if (it == m_transaction_net_checks.end())
+        {
+            return OK({});
+        }
+
+        const std::vector<Module*> modules = std::move(it->second);
+        m_transaction_net_checks.erase(it);
+
+        if (!check_net_for_modules(net, modules))
+        {
+            return ERR("could not update the module nets for net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + " in netlist with ID " + std::to_string(m_netlist->m_netlist_id));
+        }
+        return OK({});
+    }
+
     void NetlistInternalManager::clear_caches()
     {
         m_lut_function_cache.clear();
@@ -140,7 +140,7 @@ namespace hal
                 extension = "." + extension;
             }
 
-            if (extension == ".hal") return true;
+            if (extension == ".hal" || extension == ".halb") return true;
 
             return (m_extension_to_parser.find(extension) != m_extension_to_parser.end());
         }
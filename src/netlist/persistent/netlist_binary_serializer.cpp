@@ -0,0 +1,885 @@
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
+
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/project_manager.h"
+#include "hal_core/utilities/log.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <queue>
+
+#ifndef DURATION
+#define DURATION(begin_time) ((double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000)
+#endif
+
+namespace hal
+{
+    namespace netlist_binary_serializer
+    {
+        namespace
+        {
+            const char MAGIC[8]       = {'H', 'A', 'L', 'B', 'I', 'N', '\0', '\0'};
+            const u32 BYTE_ORDER_MARK = 0x01020304;
+            const u64 ALIGNMENT       = 8;
+            const u32 FLAG_FIRST      = 1 << 0;
+            const u32 FLAG_SECOND     = 1 << 1;
+            const u32 FLAG_THIRD      = 1 << 2;
+
+            // the sections of a binary netlist file, each section is a table of fixed-size records except for the string data
+            enum Section : u32
+            {
+                STRING_OFFSETS = 0,
+                STRING_DATA,
+                GATES,
+                NETS,
+                ENDPOINTS,
+                MODULES,
+                MODULE_GATES,
+                PIN_GROUPS,
+                PINS,
+                DATA_ENTRIES,
+                FUNCTIONS,
+                NUM_SECTIONS
+            };
+
+            struct FileHeader
+            {
+                char magic[8];
+                u32 version;
+                u32 byte_order;
+                u32 netlist_id;
+                u32 gate_library;
+                u32 input_file;
+                u32 design_name;
+                u32 device_name;
+                u32 reserved;
+                u64 section_offsets[NUM_SECTIONS];
+                u64 section_sizes[NUM_SECTIONS];
+            };
+
+            // flags: has location, global VCC gate, global GND gate
+            struct GateRecord
+            {
+                u32 id;
+                u32 name;
+                u32 type;
+                u32 flags;
+                i32 location_x;
+                i32 location_y;
+                u32 data_begin;
+                u32 data_count;
+                u32 function_begin;
+                u32 function_count;
+            };
+
+            // flags: global input net, global output net
+            struct NetRecord
+            {
+                u32 id;
+                u32 name;
+                u32 flags;
+                u32 source_begin;
+                u32 source_count;
+                u32 destination_begin;
+                u32 destination_count;
+                u32 data_begin;
+                u32 data_count;
+            };
+
+            struct EndpointRecord
+            {
+                u32 gate_id;
+                u32 pin_id;
+            };
+
+            // stored in breadth-first order starting at the top module, so that parents precede their submodules
+            struct ModuleRecord
+            {
+                u32 id;
+                u32 parent_id;
+                u32 name;
+                u32 type;
+                u32 gate_begin;
+                u32 gate_count;
+                u32 pin_group_begin;
+                u32 pin_group_count;
+                u32 data_begin;
+                u32 data_count;
+            };
+
+            // flags: ascending, ordered
+            struct PinGroupRecord
+            {
+                u32 id;
+                u32 name;
+                u32 direction;
+                u32 type;
+                u32 flags;
+                i32 start_index;
+                u32 pin_begin;
+                u32 pin_count;
+            };
+
+            struct PinRecord
+            {
+                u32 id;
+                u32 name;
+                u32 type;
+                u32 net_id;
+            };
+
+            struct DataRecord
+            {
+                u32 category;
+                u32 key;
+                u32 data_type;
+                u32 value;
+            };
+
+            struct FunctionRecord
+            {
+                u32 name;
+                u32 function;
+            };
+
+            const u64 RECORD_SIZES[NUM_SECTIONS] = {sizeof(u64),
+                                                    sizeof(char),
+                                                    sizeof(GateRecord),
+                                                    sizeof(NetRecord),
+                                                    sizeof(EndpointRecord),
+                                                    sizeof(ModuleRecord),
+                                                    sizeof(u32),
+                                                    sizeof(PinGroupRecord),
+                                                    sizeof(PinRecord),
+                                                    sizeof(DataRecord),
+                                                    sizeof(FunctionRecord)};
+
+            /**
+             * Collects the tables of a binary netlist file in memory before writing them to disk.
+             */
+            class TableWriter
+            {
+            public:
+                u32 add_string(const std::string& str)
+                {
+                    if (const auto it = m_string_ids.find(str); it != m_string_ids.end())
+                    {
+                        return it->second;
+                    }
+
+                    const u32 string_id = m_string_ids.size();
+                    m_string_ids.emplace(str, string_id);
+                    append(STRING_OFFSETS, m_sections[STRING_DATA].size());
+                    m_sections[STRING_DATA].append(str);
+                    return string_id;
+                }
+
+                template<typename T>
+                void append(const u32 section, const T& record)
+                {
+                    m_sections[section].append(reinterpret_cast<const char*>(&record), sizeof(T));
+                }
+
+                u32 get_count(const u32 section) const
+                {
+                    return m_sections[section].size() / RECORD_SIZES[section];
+                }
+
+                u32 add_data(const DataContainer* container)
+                {
+                    for (const auto& [category_key, type_value] : container->get_data_map())
+                    {
+                        append(DATA_ENTRIES,
+                               DataRecord{add_string(std::get<0>(category_key)), add_string(std::get<1>(category_key)), add_string(std::get<0>(type_value)), add_string(std::get<1>(type_value))});
+                    }
+                    return container->get_data_map().size();
+                }
+
+                bool write(std::ofstream& out, FileHeader& header)
+                {
+                    // terminate the string offsets with the total size of the string data
+                    append(STRING_OFFSETS, (u64)m_sections[STRING_DATA].size());
+
+                    u64 offset = sizeof(FileHeader);
+                    for (u32 i = 0; i < NUM_SECTIONS; i++)
+                    {
+                        offset                     = (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+                        header.section_offsets[i] = offset;
+                        header.section_sizes[i]   = m_sections[i].size();
+                        offset += m_sections[i].size();
+                    }
+
+                    out.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+                    u64 position = sizeof(FileHeader);
+                    for (u32 i = 0; i < NUM_SECTIONS; i++)
+                    {
+                        const std::string padding(header.section_offsets[i] - position, '\0');
+                        out.write(padding.data(), padding.size());
+                        out.write(m_sections[i].data(), m_sections[i].size());
+                        position = header.section_offsets[i] + header.section_sizes[i];
+                    }
+                    return out.good();
+                }
+
+            private:
+                std::string m_sections[NUM_SECTIONS];
+                std::unordered_map<std::string, u32> m_string_ids;
+            };
+
+            struct PinGroupInformation
+            {
+                struct PinInformation
+                {
+                    u32 id;
+                    Net* net;
+                    std::string name;
+                    PinType type;
+                };
+
+                u32 id;
+                std::string name;
+                PinDirection direction;
+                PinType type;
+                std::vector<PinInformation> pins;
+                bool ascending;
+                i32 start_index;
+                bool ordered;
+            };
+
+            bool in_range(const u32 begin, const u32 count, const u32 size)
+            {
+                return (u64)begin + count <= size;
+            }
+
+            GateLibrary* load_gate_library(const std::string& gate_library_path)
+            {
+                std::filesystem::path glib_path(gate_library_path);
+                if (glib_path.is_relative())
+                {
+                    ProjectManager* pm = ProjectManager::instance();
+                    if (pm)
+                        glib_path = pm->get_project_directory() / glib_path;
+                }
+
+                if (GateLibrary* gate_lib = gate_library_manager::get_gate_library(glib_path.string()); gate_lib != nullptr)
+                {
+                    return gate_lib;
+                }
+
+                // not found : try the other possible gate library extension
+                glib_path.replace_extension((glib_path.extension() == ".hgl") ? ".lib" : ".hgl");
+                GateLibrary* gate_lib = gate_library_manager::get_gate_library(glib_path.string());
+                if (gate_lib != nullptr)
+                {
+                    log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", gate_library_path, glib_path.string());
+                }
+                return gate_lib;
+            }
+        }    // namespace
+
+        Result<std::unique_ptr<NetlistImage>> NetlistImage::open(const std::filesystem::path& halb_file)
+        {
+            auto image = std::unique_ptr<NetlistImage>(new NetlistImage());
+            if (auto res = image->m_file.open(halb_file); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not open binary netlist file '" + halb_file.string() + "': unable to map file into memory");
+            }
+
+            const std::string_view data = image->m_file.get_data();
+            if (data.size() < sizeof(FileHeader))
+            {
+                return ERR("could not open binary netlist file '" + halb_file.string() + "': file is too small to contain a header");
+            }
+
+            const FileHeader* header = reinterpret_cast<const FileHeader*>(data.data());
+            if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0)
+            {
+                return ERR("could not open binary netlist file '" + halb_file.string() + "': file is not a binary netlist file");
+            }
+            if (header->byte_order != BYTE_ORDER_MARK)
+            {
+                return ERR("could not open binary netlist file '" + halb_file.string() + "': file was written on a machine with different byte order");
+            }
+            if (header->version > BINARY_FORMAT_VERSION)
+            {
+                return ERR("could not open binary netlist file '" + halb_file.string() + "': file was written with the newer format version " + std::to_string(header->version));
+            }
+
+            for (u32 i = 0; i < NUM_SECTIONS; i++)
+            {
+                const u64 offset = header->section_offsets[i];
+                const u64 size   = header->section_sizes[i];
+                if (offset % ALIGNMENT != 0 || offset > data.size() || size > data.size() - offset || size % RECORD_SIZES[i] != 0)
+                {
+                    return ERR("could not open binary netlist file '" + halb_file.string() + "': section " + std::to_string(i) + " is corrupted");
+                }
+                image->m_sections.push_back(data.substr(offset, size));
+            }
+
+            // validate the string table once, so that strings can later be accessed without checks
+            const auto [string_offsets, num_offsets] = image->get_table<u64>(STRING_OFFSETS);
+            if (num_offsets == 0 || string_offsets[num_offsets - 1] != image->m_sections[STRING_DATA].size())
+            {
+                return ERR("could not open binary netlist file '" + halb_file.string() + "': string table is corrupted");
+            }
+            for (u32 i = 1; i < num_offsets; i++)
+            {
+                if (string_offsets[i - 1] > string_offsets[i])
+                {
+                    return ERR("could not open binary netlist file '" + halb_file.string() + "': string table is corrupted");
+                }
+            }
+            image->m_string_offsets = string_offsets;
+            image->m_num_strings    = num_offsets - 1;
+
+            return OK(std::move(image));
+        }
+
+        template<typename T>
+        std::pair<const T*, u32> NetlistImage::get_table(const u32 section) const
+        {
+            return {reinterpret_cast<const T*>(m_sections.at(section).data()), m_sections.at(section).size() / sizeof(T)};
+        }
+
+        std::string_view NetlistImage::get_string(const u32 string_id) const
+        {
+            if (string_id >= m_num_strings)
+            {
+                return std::string_view();
+            }
+            return m_sections.at(STRING_DATA).substr(m_string_offsets[string_id], m_string_offsets[string_id + 1] - m_string_offsets[string_id]);
+        }
+
+        u32 NetlistImage::get_format_version() const
+        {
+            return reinterpret_cast<const FileHeader*>(m_file.get_data().data())->version;
+        }
+
+        u32 NetlistImage::get_netlist_id() const
+        {
+            return reinterpret_cast<const FileHeader*>(m_file.get_data().data())->netlist_id;
+        }
+
+        std::string_view NetlistImage::get_gate_library_path() const
+        {
+            return get_string(reinterpret_cast<const FileHeader*>(m_file.get_data().data())->gate_library);
+        }
+
+        std::string_view NetlistImage::get_input_filename() const
+        {
+            return get_string(reinterpret_cast<const FileHeader*>(m_file.get_data().data())->input_file);
+        }
+
+        std::string_view NetlistImage::get_design_name() const
+        {
+            return get_string(reinterpret_cast<const FileHeader*>(m_file.get_data().data())->design_name);
+        }
+
+        std::string_view NetlistImage::get_device_name() const
+        {
+            return get_string(reinterpret_cast<const FileHeader*>(m_file.get_data().data())->device_name);
+        }
+
+        u32 NetlistImage::get_gate_count() const
+        {
+            return get_table<GateRecord>(GATES).second;
+        }
+
+        u32 NetlistImage::get_net_count() const
+        {
+            return get_table<NetRecord>(NETS).second;
+        }
+
+        u32 NetlistImage::get_module_count() const
+        {
+            return get_table<ModuleRecord>(MODULES).second;
+        }
+
+        Result<std::unique_ptr<Netlist>> NetlistImage::materialize(const GateLibrary* gate_lib) const
+        {
+            const auto [gates, num_gates]                 = get_table<GateRecord>(GATES);
+            const auto [nets, num_nets]                   = get_table<NetRecord>(NETS);
+            const auto [endpoints, num_endpoints]         = get_table<EndpointRecord>(ENDPOINTS);
+            const auto [modules, num_modules]             = get_table<ModuleRecord>(MODULES);
+            const auto [module_gates, num_module_gates]   = get_table<u32>(MODULE_GATES);
+            const auto [pin_groups, num_pin_groups]       = get_table<PinGroupRecord>(PIN_GROUPS);
+            const auto [pins, num_pins]                   = get_table<PinRecord>(PINS);
+            const auto [data_entries, num_data_entries]   = get_table<DataRecord>(DATA_ENTRIES);
+            const auto [functions, num_functions]         = get_table<FunctionRecord>(FUNCTIONS);
+
+            const auto deserialize_data = [this, data_entries = data_entries, num_data_entries = num_data_entries](DataContainer* container, const u32 begin, const u32 count) {
+                if (!in_range(begin, count, num_data_entries))
+                {
+                    return false;
+                }
+                for (u32 i = begin; i < begin + count; i++)
+                {
+                    const DataRecord& entry = data_entries[i];
+                    container->set_data(std::string(get_string(entry.category)),
+                                        std::string(get_string(entry.key)),
+                                        std::string(get_string(entry.data_type)),
+                                        std::string(get_string(entry.value)));
+                }
+                return true;
+            };
+
+            if (!gate_lib)
+            {
+                // no preferred gate library explicitly given
+                const std::string gate_library_path(get_gate_library_path());
+                gate_lib = load_gate_library(gate_library_path);
+                if (gate_lib == nullptr)
+                {
+                    return ERR("could not materialize netlist: failed to load gate library '" + gate_library_path + "'");
+                }
+            }
+
+            auto nl = std::make_unique<Netlist>(gate_lib);
+
+            // disable automatically checking module nets
+            nl->enable_automatic_net_checks(false);
+
+            nl->set_id(get_netlist_id());
+            nl->set_input_filename(std::string(get_input_filename()));
+            nl->set_design_name(std::string(get_design_name()));
+            nl->set_device_name(std::string(get_device_name()));
+
+            // gate types are looked up once per distinct type name
+            const auto gate_types = gate_lib->get_gate_types();
+            std::unordered_map<u32, GateType*> gate_type_by_string_id;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                const GateRecord& record = gates[i];
+                const std::string gate_name(get_string(record.name));
+
+                GateType* gate_type;
+                if (const auto it = gate_type_by_string_id.find(record.type); it != gate_type_by_string_id.end())
+                {
+                    gate_type = it->second;
+                }
+                else if (const auto type_it = gate_types.find(std::string(get_string(record.type))); type_it != gate_types.end())
+                {
+                    gate_type                            = type_it->second;
+                    gate_type_by_string_id[record.type] = gate_type;
+                }
+                else
+                {
+                    return ERR("could not materialize netlist: failed to find gate type '" + std::string(get_string(record.type)) + "' of gate '" + gate_name + "' with ID "
+                               + std::to_string(record.id) + " in gate library '" + gate_lib->get_name() + "'");
+                }
+
+                const bool has_location = (record.flags & FLAG_FIRST) != 0;
+                Gate* gate              = nl->create_gate(record.id, gate_type, gate_name, has_location ? record.location_x : -1, has_location ? record.location_y : -1);
+                if (gate == nullptr)
+                {
+                    return ERR("could not materialize netlist: failed to create gate '" + gate_name + "' with ID " + std::to_string(record.id));
+                }
+
+                if (!deserialize_data(gate, record.data_begin, record.data_count) || !in_range(record.function_begin, record.function_count, num_functions))
+                {
+                    return ERR("could not materialize netlist: data of gate '" + gate_name + "' with ID " + std::to_string(record.id) + " is corrupted");
+                }
+
+                for (u32 j = record.function_begin; j < record.function_begin + record.function_count; j++)
+                {
+                    auto function = BooleanFunction::from_string(std::string(get_string(functions[j].function)));
+                    if (function.is_error())
+                    {
+                        return ERR_APPEND(function.get_error(),
+                                          "could not materialize netlist: failed to parse Boolean function of gate '" + gate_name + "' with ID " + std::to_string(record.id));
+                    }
+                    gate->add_boolean_function(std::string(get_string(functions[j].name)), function.get());
+                }
+
+                if ((record.flags & FLAG_SECOND) != 0 && !nl->mark_vcc_gate(gate))
+                {
+                    return ERR("could not materialize netlist: failed to mark gate '" + gate_name + "' with ID " + std::to_string(record.id) + " as VCC gate");
+                }
+                if ((record.flags & FLAG_THIRD) != 0 && !nl->mark_gnd_gate(gate))
+                {
+                    return ERR("could not materialize netlist: failed to mark gate '" + gate_name + "' with ID " + std::to_string(record.id) + " as GND gate");
+                }
+            }
+
+            for (u32 i = 0; i < num_nets; i++)
+            {
+                const NetRecord& record = nets[i];
+                const std::string net_name(get_string(record.name));
+
+                Net* net = nl->create_net(record.id, net_name);
+                if (net == nullptr)
+                {
+                    return ERR("could not materialize netlist: failed to create net '" + net_name + "' with ID " + std::to_string(record.id));
+                }
+
+                if (!in_range(record.source_begin, record.source_count, num_endpoints) || !in_range(record.destination_begin, record.destination_count, num_endpoints)
+                    || !deserialize_data(net, record.data_begin, record.data_count))
+                {
+                    return ERR("could not materialize netlist: data of net '" + net_name + "' with ID " + std::to_string(record.id) + " is corrupted");
+                }
+
+                for (u32 j = 0; j < record.source_count + record.destination_count; j++)
+                {
+                    const bool is_source            = j < record.source_count;
+                    const EndpointRecord& endpoint = is_source ? endpoints[record.source_begin + j] : endpoints[record.destination_begin + j - record.source_count];
+
+                    Gate* gate = nl->get_gate_by_id(endpoint.gate_id);
+                    if (gate == nullptr)
+                    {
+                        return ERR("could not materialize netlist: failed to connect net '" + net_name + "' with ID " + std::to_string(record.id) + " to gate with ID "
+                                   + std::to_string(endpoint.gate_id) + " as the gate does not exist");
+                    }
+                    GatePin* pin = gate->get_type()->get_pin_by_id(endpoint.pin_id);
+                    if (pin == nullptr)
+                    {
+                        return ERR("could not materialize netlist: failed to connect net '" + net_name + "' with ID " + std::to_string(record.id) + " to gate '" + gate->get_name()
+                                   + "' with ID " + std::to_string(gate->get_id()) + " as the pin with ID " + std::to_string(endpoint.pin_id) + " does not exist");
+                    }
+
+                    if ((is_source && net->add_source(gate, pin) == nullptr) || (!is_source && net->add_destination(gate, pin) == nullptr))
+                    {
+                        return ERR("could not materialize netlist: failed to connect net '" + net_name + "' with ID " + std::to_string(record.id) + " to pin '" + pin->get_name()
+                                   + "' of gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()));
+                    }
+                }
+
+                if ((record.flags & FLAG_FIRST) != 0 && !nl->mark_global_input_net(net))
+                {
+                    return ERR("could not materialize netlist: failed to mark net '" + net_name + "' with ID " + std::to_string(record.id) + " as global input net");
+                }
+                if ((record.flags & FLAG_SECOND) != 0 && !nl->mark_global_output_net(net))
+                {
+                    return ERR("could not materialize netlist: failed to mark net '" + net_name + "' with ID " + std::to_string(record.id) + " as global output net");
+                }
+            }
+
+            // pins need to be cached until all modules have been created and their nets have been updated
+            std::vector<std::pair<Module*, std::vector<PinGroupInformation>>> pin_group_cache;
+            for (u32 i = 0; i < num_modules; i++)
+            {
+                const ModuleRecord& record = modules[i];
+                const std::string module_name(get_string(record.name));
+
+                Module* module;
+                if (record.parent_id == 0)
+                {
+                    // top module must not be created but might be renamed
+                    module = nl->get_top_module();
+                    if (module_name != module->get_name())
+                    {
+                        module->set_name(module_name);
+                    }
+                }
+                else
+                {
+                    Module* parent = nl->get_module_by_id(record.parent_id);
+                    if (parent == nullptr)
+                    {
+                        return ERR("could not materialize netlist: failed to create module '" + module_name + "' with ID " + std::to_string(record.id) + " as its parent module with ID "
+                                   + std::to_string(record.parent_id) + " does not exist");
+                    }
+
+                    module = nl->create_module(record.id, module_name, parent);
+                    if (module == nullptr)
+                    {
+                        return ERR("could not materialize netlist: failed to create module '" + module_name + "' with ID " + std::to_string(record.id));
+                    }
+                }
+                module->set_type(std::string(get_string(record.type)));
+
+                if (!in_range(record.gate_begin, record.gate_count, num_module_gates) || !in_range(record.pin_group_begin, record.pin_group_count, num_pin_groups)
+                    || !deserialize_data(module, record.data_begin, record.data_count))
+                {
+                    return ERR("could not materialize netlist: data of module '" + module_name + "' with ID " + std::to_string(record.id) + " is corrupted");
+                }
+
+                if (!module->is_top_module() && record.gate_count > 0)
+                {
+                    std::vector<Gate*> module_gate_ptrs;
+                    module_gate_ptrs.reserve(record.gate_count);
+                    for (u32 j = record.gate_begin; j < record.gate_begin + record.gate_count; j++)
+                    {
+                        Gate* gate = nl->get_gate_by_id(module_gates[j]);
+                        if (gate == nullptr)
+                        {
+                            return ERR("could not materialize netlist: failed to assign gate with ID " + std::to_string(module_gates[j]) + " to module '" + module_name + "' with ID "
+                                       + std::to_string(record.id) + " as the gate does not exist");
+                        }
+                        module_gate_ptrs.push_back(gate);
+                    }
+                    module->assign_gates(module_gate_ptrs);
+                }
+
+                std::vector<PinGroupInformation> module_pin_groups;
+                for (u32 j = record.pin_group_begin; j < record.pin_group_begin + record.pin_group_count; j++)
+                {
+                    const PinGroupRecord& group_record = pin_groups[j];
+                    if (!in_range(group_record.pin_begin, group_record.pin_count, num_pins))
+                    {
+                        return ERR("could not materialize netlist: pin groups of module '" + module_name + "' with ID " + std::to_string(record.id) + " are corrupted");
+                    }
+
+                    PinGroupInformation pin_group;
+                    pin_group.id          = group_record.id;
+                    pin_group.name        = get_string(group_record.name);
+                    pin_group.direction   = enum_from_string<PinDirection>(std::string(get_string(group_record.direction)), PinDirection::none);
+                    pin_group.type        = enum_from_string<PinType>(std::string(get_string(group_record.type)), PinType::none);
+                    pin_group.ascending   = (group_record.flags & FLAG_FIRST) != 0;
+                    pin_group.ordered     = (group_record.flags & FLAG_SECOND) != 0;
+                    pin_group.start_index = group_record.start_index;
+                    for (u32 k = group_record.pin_begin; k < group_record.pin_begin + group_record.pin_count; k++)
+                    {
+                        const PinRecord& pin_record = pins[k];
+                        pin_group.pins.push_back(
+                            {pin_record.id, nl->get_net_by_id(pin_record.net_id), std::string(get_string(pin_record.name)), enum_from_string<PinType>(std::string(get_string(pin_record.type)), PinType::none)});
+                    }
+                    module_pin_groups.push_back(std::move(pin_group));
+                }
+                pin_group_cache.push_back({module, std::move(module_pin_groups)});
+            }
+
+            // update module nets, internal nets, input nets, and output nets
+            for (Module* mod : nl->get_modules())
+            {
+                mod->update_nets();
+            }
+
+            // create module pins (nets must have been updated beforehand)
+            for (const auto& [module, module_pin_groups] : pin_group_cache)
+            {
+                for (const PinGroupInformation& pg : module_pin_groups)
+                {
+                    std::vector<ModulePin*> module_pins;
+                    for (const PinGroupInformation::PinInformation& p : pg.pins)
+                    {
+                        const u32 pid = (p.id > 0) ? p.id : module->get_unique_pin_id();
+                        if (auto res = module->create_pin(pid, p.name, p.net, p.type, false); res.is_error())
+                        {
+                            return ERR_APPEND(res.get_error(),
+                                              "could not materialize netlist: failed to create pin '" + p.name + "' of module '" + module->get_name() + "' with ID " + std::to_string(module->get_id()));
+                        }
+                        else
+                        {
+                            module_pins.push_back(res.get());
+                        }
+                    }
+                    const u32 pgid = (pg.id > 0) ? pg.id : module->get_unique_pin_group_id();
+                    if (auto res = module->create_pin_group(pgid, pg.name, module_pins, pg.direction, pg.type, pg.ascending, pg.start_index, pg.ordered); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(),
+                                          "could not materialize netlist: failed to create pin group '" + pg.name + "' of module '" + module->get_name() + "' with ID "
+                                              + std::to_string(module->get_id()));
+                    }
+                }
+            }
+
+            // re-enable automatically checking module nets
+            nl->enable_automatic_net_checks(true);
+
+            return OK(std::move(nl));
+        }
+
+        bool serialize_to_file(const Netlist* nl, const std::filesystem::path& halb_file)
+        {
+            if (nl == nullptr)
+            {
+                return false;
+            }
+
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            std::filesystem::path serialize_to_dir = halb_file.parent_path();
+            if (serialize_to_dir.empty())
+                return false;
+
+            if (serialize_to_dir.is_relative())
+                serialize_to_dir = ProjectManager::instance()->get_project_directory() / serialize_to_dir;
+
+            // create directory if it got erased in the meantime
+            if (!std::filesystem::exists(serialize_to_dir))
+            {
+                std::error_code err;
+                if (!std::filesystem::create_directories(serialize_to_dir, err))
+                {
+                    log_error("netlist_persistent", "Could not create directory '{}', error was '{}'.", serialize_to_dir.string(), err.message());
+                    return false;
+                }
+            }
+
+            std::ofstream halb_file_stream(halb_file.string(), std::ios::binary);
+            if (halb_file_stream.fail())
+            {
+                log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", halb_file.string());
+                return false;
+            }
+
+            TableWriter writer;
+
+            FileHeader header;
+            std::memset(&header, 0, sizeof(FileHeader));
+            std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+            header.version      = BINARY_FORMAT_VERSION;
+            header.byte_order   = BYTE_ORDER_MARK;
+            header.netlist_id   = nl->get_id();
+            header.gate_library = writer.add_string(nl->get_gate_library()->get_path().string());
+            header.input_file   = writer.add_string(nl->get_input_filename().string());
+            header.design_name  = writer.add_string(nl->get_design_name());
+            header.device_name  = writer.add_string(nl->get_device_name());
+
+            std::vector<Gate*> sorted_gates = nl->get_gates();
+            std::sort(sorted_gates.begin(), sorted_gates.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+            for (const Gate* gate : sorted_gates)
+            {
+                GateRecord record;
+                record.id    = gate->get_id();
+                record.name  = writer.add_string(gate->get_name());
+                record.type  = writer.add_string(gate->get_type()->get_name());
+                record.flags = (gate->has_location() ? FLAG_FIRST : 0) | (nl->is_vcc_gate(gate) ? FLAG_SECOND : 0) | (nl->is_gnd_gate(gate) ? FLAG_THIRD : 0);
+                record.location_x = gate->get_location_x();
+                record.location_y = gate->get_location_y();
+
+                record.data_begin = writer.get_count(DATA_ENTRIES);
+                record.data_count = writer.add_data(gate);
+
+                // sort the custom functions by name to get a reproducible file
+                std::map<std::string, BooleanFunction> custom_functions;
+                for (auto& [name, function] : gate->get_boolean_functions(true))
+                {
+                    custom_functions.emplace(name, std::move(function));
+                }
+                record.function_begin = writer.get_count(FUNCTIONS);
+                record.function_count = custom_functions.size();
+                for (const auto& [name, function] : custom_functions)
+                {
+                    writer.append(FUNCTIONS, FunctionRecord{writer.add_string(name), writer.add_string(function.to_string())});
+                }
+
+                writer.append(GATES, record);
+            }
+
+            std::vector<Net*> sorted_nets = nl->get_nets();
+            std::sort(sorted_nets.begin(), sorted_nets.end(), [](Net* lhs, Net* rhs) { return lhs->get_id() < rhs->get_id(); });
+            for (const Net* net : sorted_nets)
+            {
+                NetRecord record;
+                record.id    = net->get_id();
+                record.name  = writer.add_string(net->get_name());
+                record.flags = (nl->is_global_input_net(net) ? FLAG_FIRST : 0) | (nl->is_global_output_net(net) ? FLAG_SECOND : 0);
+
+                for (const bool sources : {true, false})
+                {
+                    std::vector<Endpoint*> sorted_endpoints = sources ? net->get_sources() : net->get_destinations();
+                    std::sort(sorted_endpoints.begin(), sorted_endpoints.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
+                    (sources ? record.source_begin : record.destination_begin) = writer.get_count(ENDPOINTS);
+                    (sources ? record.source_count : record.destination_count) = sorted_endpoints.size();
+                    for (const Endpoint* ep : sorted_endpoints)
+                    {
+                        writer.append(ENDPOINTS, EndpointRecord{ep->get_gate()->get_id(), ep->get_pin()->get_id()});
+                    }
+                }
+
+                record.data_begin = writer.get_count(DATA_ENTRIES);
+                record.data_count = writer.add_data(net);
+
+                writer.append(NETS, record);
+            }
+
+            // module ids are not sorted to preserve hierarchy
+            std::queue<const Module*> q;
+            q.push(nl->get_top_module());
+            while (!q.empty())
+            {
+                const Module* module = q.front();
+                q.pop();
+
+                ModuleRecord record;
+                record.id        = module->get_id();
+                record.parent_id = (module->get_parent_module() == nullptr) ? 0 : module->get_parent_module()->get_id();
+                record.name      = writer.add_string(module->get_name());
+                record.type      = writer.add_string(module->get_type());
+
+                std::vector<Gate*> sorted_module_gates = module->get_gates(nullptr, false);
+                std::sort(sorted_module_gates.begin(), sorted_module_gates.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                record.gate_begin = writer.get_count(MODULE_GATES);
+                record.gate_count = sorted_module_gates.size();
+                for (const Gate* gate : sorted_module_gates)
+                {
+                    writer.append(MODULE_GATES, gate->get_id());
+                }
+
+                record.pin_group_begin = writer.get_count(PIN_GROUPS);
+                record.pin_group_count = 0;
+                for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+                {
+                    PinGroupRecord group_record;
+                    group_record.id          = pin_group->get_id();
+                    group_record.name        = writer.add_string(pin_group->get_name());
+                    group_record.direction   = writer.add_string(enum_to_string(pin_group->get_direction()));
+                    group_record.type        = writer.add_string(enum_to_string(pin_group->get_type()));
+                    group_record.flags       = (pin_group->is_ascending() ? FLAG_FIRST : 0) | (pin_group->is_ordered() ? FLAG_SECOND : 0);
+                    group_record.start_index = pin_group->get_start_index();
+                    group_record.pin_begin   = writer.get_count(PINS);
+                    group_record.pin_count   = 0;
+                    for (const ModulePin* pin : pin_group->get_pins())
+                    {
+                        writer.append(PINS, PinRecord{pin->get_id(), writer.add_string(pin->get_name()), writer.add_string(enum_to_string(pin->get_type())), pin->get_net()->get_id()});
+                        group_record.pin_count++;
+                    }
+                    writer.append(PIN_GROUPS, group_record);
+                    record.pin_group_count++;
+                }
+
+                record.data_begin = writer.get_count(DATA_ENTRIES);
+                record.data_count = writer.add_data(module);
+
+                writer.append(MODULES, record);
+
+                for (const Module* sm : module->get_submodules())
+                {
+                    q.push(sm);
+                }
+            }
+
+            if (!writer.write(halb_file_stream, header))
+            {
+                log_error("netlist_persistent", "could not write binary netlist file {}.", halb_file.string());
+                return false;
+            }
+            halb_file_stream.close();
+
+            log_info("netlist_persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
+
+            return true;
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& halb_file, const GateLibrary* gate_lib)
+        {
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            auto image_res = NetlistImage::open(halb_file);
+            if (image_res.is_error())
+            {
+                log_error("netlist_persistent", "{}", image_res.get_error().get());
+                return nullptr;
+            }
+
+            auto netlist_res = image_res.get()->materialize(gate_lib);
+            if (netlist_res.is_error())
+            {
+                log_error("netlist_persistent", "could not deserialize netlist from '{}':\n{}", halb_file.string(), netlist_res.get_error().get());
+                return nullptr;
+            }
+
+            log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", halb_file.string(), DURATION(begin_time));
+            return netlist_res.get();
+        }
+    }    // namespace netlist_binary_serializer
+}    // namespace hal
+
+#undef DURATION
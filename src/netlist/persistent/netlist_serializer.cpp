@@ -9,6 +9,7 @@
 #include "hal_core/netlist/project_manager.h"
 #include "hal_core/utilities/log.h"
 #include "rapidjson/filereadstream.h"
+#include "rapidjson/reader.h"
 #include "rapidjson/stringbuffer.h"
 
 #define PRETTY_JSON_OUTPUT false
@@ -21,6 +22,7 @@
 #include <chrono>
 #include <fstream>
 #include <queue>
+#include <set>
 #include <sstream>
 
 #ifndef DURATION
@@ -723,6 +725,43 @@ namespace hal
                 document.AddMember("netlist", root, document.GetAllocator());
             }
 
+            GateLibrary* load_gate_library(const std::string& gate_library_path)
+            {
+                std::filesystem::path glib_path(gate_library_path);
+
+                if (glib_path.is_relative())
+                {
+                    ProjectManager* pm = ProjectManager::instance();
+                    if (pm)
+                        glib_path = pm->get_project_directory() / glib_path;
+                }
+                GateLibrary* gatelib = gate_library_manager::get_gate_library(glib_path.string());
+
+                if (gatelib == nullptr)
+                {
+                    // not found : try the other possible gate library extension
+                    if (glib_path.extension() == ".hgl")
+                    {
+                        glib_path.replace_extension(".lib");
+                    }
+                    else
+                    {
+                        glib_path.replace_extension(".hgl");
+                    }
+
+                    gatelib = gate_library_manager::get_gate_library(glib_path.string());
+                    if (gatelib == nullptr)
+                    {
+                        log_critical("netlist_persistent", "could not deserialize netlist: failed to load gate library '" + gate_library_path + "'");
+                    }
+                    else
+                    {
+                        log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", gate_library_path, glib_path.string());
+                    }
+                }
+                return gatelib;
+            }
+
             std::unique_ptr<Netlist> deserialize(const rapidjson::Document& document, GateLibrary* gatelib)
             {
                 if (!document.HasMember("netlist"))
@@ -741,38 +780,10 @@ namespace hal
                         return nullptr;
                     }
 
-                    std::filesystem::path glib_path(root["gate_library"].GetString());
-
-                    if (glib_path.is_relative())
-                    {
-                        ProjectManager* pm = ProjectManager::instance();
-                        if (pm)
-                            glib_path = pm->get_project_directory() / glib_path;
-                    }
-                    gatelib = gate_library_manager::get_gate_library(glib_path.string());
-
+                    gatelib = load_gate_library(root["gate_library"].GetString());
                     if (gatelib == nullptr)
                     {
-                        // not found : try the other possible gate library extension
-                        if (glib_path.extension() == ".hgl")
-                        {
-                            glib_path.replace_extension(".lib");
-                        }
-                        else
-                        {
-                            glib_path.replace_extension(".hgl");
-                        }
-
-                        gatelib = gate_library_manager::get_gate_library(glib_path.string());
-                        if (gatelib == nullptr)
-                        {
-                            log_critical("netlist_persistent", "could not deserialize netlist: failed to load gate library '" + std::string(root["gate_library"].GetString()) + "'");
-                            return nullptr;
-                        }
-                        else
-                        {
-                            log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", root["gate_library"].GetString(), glib_path.string());
-                        }
+                        return nullptr;
                     }
                 }
 
@@ -928,6 +939,19 @@ namespace hal
                 return nl;
             }
 
+            void set_format_version(const int format_version)
+            {
+                encoded_format_version = format_version;
+                if (encoded_format_version < SERIALIZATION_FORMAT_VERSION)
+                {
+                    log_warning("netlist_persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
+                }
+                else if (encoded_format_version > SERIALIZATION_FORMAT_VERSION)
+                {
+                    log_warning("netlist_persistent", "the netlist was serialized with a newer version of the serializer, deserialization may contain errors.");
+                }
+            }
+
             std::unique_ptr<Netlist> deserialize_document(rapidjson::Document& document, GateLibrary* gatelib, std::string source,
                                                           std::chrono::time_point<std::chrono::high_resolution_clock>& begin_time)
             {
@@ -939,15 +963,7 @@ namespace hal
 
                 if (document.HasMember("serialization_format_version"))
                 {
-                    encoded_format_version = document["serialization_format_version"].GetUint();
-                    if (encoded_format_version < SERIALIZATION_FORMAT_VERSION)
-                    {
-                        log_warning("netlist_persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
-                    }
-                    else if (encoded_format_version > SERIALIZATION_FORMAT_VERSION)
-                    {
-                        log_warning("netlist_persistent", "the netlist was serialized with a newer version of the serializer, deserialization may contain errors.");
-                    }
+                    set_format_version(document["serialization_format_version"].GetUint());
                 }
                 else
                 {
@@ -965,6 +981,586 @@ namespace hal
                 return netlist;
             }
 
+            /**
+             * Builds a single JSON value from the events of a SAX reader.
+             * The memory of the value is kept in a pool that is released once the value has been processed.
+             */
+            class ValueBuilder
+            {
+            public:
+                rapidjson::Document::AllocatorType& get_allocator()
+                {
+                    return m_allocator;
+                }
+
+                rapidjson::Value& get_value()
+                {
+                    return m_value;
+                }
+
+                bool is_building() const
+                {
+                    return !m_containers.empty();
+                }
+
+                void clear()
+                {
+                    m_value.SetNull();
+                    m_allocator.Clear();
+                }
+
+                // returns true once the value is complete
+                bool add(rapidjson::Value& value)
+                {
+                    if (m_containers.empty())
+                    {
+                        m_value = value;
+                        return true;
+                    }
+
+                    if (rapidjson::Value& container = m_containers.back(); container.IsObject())
+                    {
+                        container.AddMember(m_keys.back(), value, m_allocator);
+                    }
+                    else
+                    {
+                        container.PushBack(value, m_allocator);
+                    }
+                    return false;
+                }
+
+                void start_container(const rapidjson::Type type)
+                {
+                    m_containers.emplace_back(type);
+                    m_keys.emplace_back();
+                }
+
+                void set_key(const char* str, const rapidjson::SizeType length)
+                {
+                    m_keys.back().SetString(str, length, m_allocator);
+                }
+
+                // returns true once the value is complete
+                bool end_container()
+                {
+                    rapidjson::Value value(std::move(m_containers.back()));
+                    m_containers.pop_back();
+                    m_keys.pop_back();
+                    return add(value);
+                }
+
+            private:
+                rapidjson::Document::AllocatorType m_allocator;
+                std::vector<rapidjson::Value> m_containers;
+                std::vector<rapidjson::Value> m_keys;
+                rapidjson::Value m_value;
+            };
+
+            /**
+             * SAX handler that creates gates, nets, and modules while the file is being read.
+             * Every entry of the 'gates', 'nets', and 'modules' arrays is built as a small JSON value, handed to the same functions that deserialize it from a document, and dropped right away.
+             * Netlists are serialized in the order their members depend on each other, if a member arrives before the members it depends on, the handler stops and the document has to be read as a whole.
+             */
+            class NetlistStreamHandler
+            {
+            public:
+                NetlistStreamHandler(GateLibrary* gatelib) : m_gatelib(gatelib)
+                {
+                }
+
+                bool Null()
+                {
+                    rapidjson::Value value;
+                    return on_value(value);
+                }
+
+                bool Bool(bool b)
+                {
+                    rapidjson::Value value(b);
+                    return on_value(value);
+                }
+
+                bool Int(int i)
+                {
+                    rapidjson::Value value(i);
+                    return on_value(value);
+                }
+
+                bool Uint(unsigned u)
+                {
+                    rapidjson::Value value(u);
+                    return on_value(value);
+                }
+
+                bool Int64(int64_t i)
+                {
+                    rapidjson::Value value(i);
+                    return on_value(value);
+                }
+
+                bool Uint64(uint64_t u)
+                {
+                    rapidjson::Value value(u);
+                    return on_value(value);
+                }
+
+                bool Double(double d)
+                {
+                    rapidjson::Value value(d);
+                    return on_value(value);
+                }
+
+                bool RawNumber(const char* str, rapidjson::SizeType length, bool copy)
+                {
+                    return String(str, length, copy);
+                }
+
+                bool String(const char* str, rapidjson::SizeType length, bool)
+                {
+                    rapidjson::Value value(str, length, m_builder.get_allocator());
+                    return on_value(value);
+                }
+
+                bool StartObject()
+                {
+                    if (!m_builder.is_building())
+                    {
+                        if (m_state == State::document)
+                        {
+                            m_state = State::root;
+                            return true;
+                        }
+                        else if (m_state == State::root && m_key == "netlist")
+                        {
+                            return start_netlist();
+                        }
+                    }
+                    m_builder.start_container(rapidjson::kObjectType);
+                    return true;
+                }
+
+                bool Key(const char* str, rapidjson::SizeType length, bool)
+                {
+                    if (m_builder.is_building())
+                    {
+                        m_builder.set_key(str, length);
+                    }
+                    else
+                    {
+                        m_key.assign(str, length);
+                    }
+                    return true;
+                }
+
+                bool EndObject(rapidjson::SizeType)
+                {
+                    if (m_builder.is_building())
+                    {
+                        return end_container();
+                    }
+
+                    if (m_state == State::netlist)
+                    {
+                        m_state = State::root;
+                        return finish_netlist();
+                    }
+                    m_state = State::document;
+                    return true;
+                }
+
+                bool StartArray()
+                {
+                    if (!m_builder.is_building() && m_state == State::netlist && (m_key == "gates" || m_key == "nets" || m_key == "modules"))
+                    {
+                        return start_section();
+                    }
+                    m_builder.start_container(rapidjson::kArrayType);
+                    return true;
+                }
+
+                bool EndArray(rapidjson::SizeType)
+                {
+                    if (m_builder.is_building())
+                    {
+                        return end_container();
+                    }
+
+                    m_read_members.insert(m_section);
+                    m_state = State::netlist;
+                    return true;
+                }
+
+                /**
+                 * Check whether the handler stopped because a member arrived before the members it depends on.
+                 *
+                 * @returns `true` if the document has to be read as a whole, `false` otherwise.
+                 */
+                bool requires_document() const
+                {
+                    return m_requires_document;
+                }
+
+                /**
+                 * Check whether the handler stopped because deserializing the netlist failed.
+                 * The reason has already been logged in that case.
+                 *
+                 * @returns `true` if deserialization failed, `false` otherwise.
+                 */
+                bool has_failed() const
+                {
+                    return m_failed;
+                }
+
+                /**
+                 * Get the deserialized netlist after the whole input has been read.
+                 *
+                 * @returns The netlist on success, a `nullptr` otherwise.
+                 */
+                std::unique_ptr<Netlist> get_netlist()
+                {
+                    if (!m_netlist_read)
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: file has no 'netlist' node");
+                        return nullptr;
+                    }
+                    return std::move(m_netlist);
+                }
+
+            private:
+                enum class State
+                {
+                    document,
+                    root,
+                    netlist,
+                    section
+                };
+
+                GateLibrary* m_gatelib;
+                std::unique_ptr<Netlist> m_netlist;
+                std::unordered_map<std::string, GateType*> m_gate_types;
+                std::unordered_map<Module*, std::vector<PinGroupInformation>> m_pin_group_cache;
+
+                ValueBuilder m_builder;
+                State m_state = State::document;
+                std::string m_key;
+                std::string m_section;
+                std::set<std::string> m_read_members;
+
+                bool m_version_read      = false;
+                bool m_netlist_started   = false;
+                bool m_netlist_read      = false;
+                bool m_requires_document = false;
+                bool m_failed            = false;
+
+                std::string m_gate_library_path;
+                u32 m_id = 0;
+                std::string m_input_filename;
+                std::string m_design_name;
+                std::string m_device_name;
+
+                bool requires(const std::vector<std::string>& members)
+                {
+                    for (const std::string& member : members)
+                    {
+                        if (m_read_members.find(member) == m_read_members.end())
+                        {
+                            m_requires_document = true;
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                bool fail()
+                {
+                    m_failed = true;
+                    return false;
+                }
+
+                bool on_value(rapidjson::Value& value)
+                {
+                    if (m_builder.is_building())
+                    {
+                        m_builder.add(value);
+                        return true;
+                    }
+
+                    bool res = handle_value(value);
+                    m_builder.clear();
+                    return res;
+                }
+
+                bool end_container()
+                {
+                    if (!m_builder.end_container())
+                    {
+                        return true;
+                    }
+
+                    bool res = handle_value(m_builder.get_value());
+                    m_builder.clear();
+                    return res;
+                }
+
+                bool start_netlist()
+                {
+                    m_netlist_started = true;
+                    m_state           = State::netlist;
+                    return true;
+                }
+
+                bool start_section()
+                {
+                    m_section = m_key;
+                    if (m_section == "gates")
+                    {
+                        if (!create_netlist())
+                        {
+                            return false;
+                        }
+                    }
+                    else if (m_section == "nets" && !requires({"gates"}))
+                    {
+                        return false;
+                    }
+                    else if (m_section == "modules" && !requires({"gates", "nets"}))
+                    {
+                        return false;
+                    }
+                    m_state = State::section;
+                    return true;
+                }
+
+                bool create_netlist()
+                {
+                    if (!m_gatelib)
+                    {
+                        // no preferred gate library explicitly given
+                        if (!requires({"gate_library"}))
+                        {
+                            return false;
+                        }
+
+                        m_gatelib = load_gate_library(m_gate_library_path);
+                        if (m_gatelib == nullptr)
+                        {
+                            return fail();
+                        }
+                    }
+
+                    m_netlist = std::make_unique<Netlist>(m_gatelib);
+
+                    // disable automatically checking module nets
+                    m_netlist->enable_automatic_net_checks(false);
+
+                    m_netlist->set_id(m_id);
+                    m_netlist->set_input_filename(m_input_filename);
+                    m_netlist->set_design_name(m_design_name);
+                    m_netlist->set_device_name(m_device_name);
+
+                    m_gate_types = m_netlist->get_gate_library()->get_gate_types();
+                    return true;
+                }
+
+                bool handle_value(rapidjson::Value& value)
+                {
+                    if (m_state == State::root && m_key == "serialization_format_version")
+                    {
+                        if (m_netlist_started)
+                        {
+                            // the format version affects how endpoints are read
+                            m_requires_document = true;
+                            return false;
+                        }
+                        m_version_read = true;
+                        set_format_version(value.GetUint());
+                    }
+                    else if (m_state == State::netlist)
+                    {
+                        m_read_members.insert(m_key);
+                        return handle_netlist_member(value);
+                    }
+                    else if (m_state == State::section)
+                    {
+                        return handle_section_entry(value);
+                    }
+                    return true;
+                }
+
+                bool handle_netlist_member(const rapidjson::Value& value)
+                {
+                    if (m_key == "gate_library")
+                    {
+                        m_gate_library_path = value.GetString();
+                    }
+                    else if (m_key == "id")
+                    {
+                        m_id = value.GetUint();
+                        if (m_netlist)
+                        {
+                            m_netlist->set_id(m_id);
+                        }
+                    }
+                    else if (m_key == "input_file")
+                    {
+                        m_input_filename = value.GetString();
+                        if (m_netlist)
+                        {
+                            m_netlist->set_input_filename(m_input_filename);
+                        }
+                    }
+                    else if (m_key == "design_name")
+                    {
+                        m_design_name = value.GetString();
+                        if (m_netlist)
+                        {
+                            m_netlist->set_design_name(m_design_name);
+                        }
+                    }
+                    else if (m_key == "device_name")
+                    {
+                        m_device_name = value.GetString();
+                        if (m_netlist)
+                        {
+                            m_netlist->set_device_name(m_device_name);
+                        }
+                    }
+                    else if (m_key == "global_vcc" || m_key == "global_gnd")
+                    {
+                        if (!requires({"gates"}))
+                        {
+                            return false;
+                        }
+
+                        const bool vcc = m_key == "global_vcc";
+                        for (auto& gate_node : value.GetArray())
+                        {
+                            Gate* gate = m_netlist->get_gate_by_id(gate_node.GetUint());
+                            if (vcc ? !m_netlist->mark_vcc_gate(gate) : !m_netlist->mark_gnd_gate(gate))
+                            {
+                                log_error("netlist_persistent", "could not deserialize netlist: failed to mark {} gate", vcc ? "VCC" : "GND");
+                                return fail();
+                            }
+                        }
+                    }
+                    else if (m_key == "global_in" || m_key == "global_out")
+                    {
+                        if (!requires({"nets"}))
+                        {
+                            return false;
+                        }
+
+                        const bool input = m_key == "global_in";
+                        for (auto& net_node : value.GetArray())
+                        {
+                            Net* net = m_netlist->get_net_by_id(net_node.GetUint());
+                            if (input ? !m_netlist->mark_global_input_net(net) : !m_netlist->mark_global_output_net(net))
+                            {
+                                log_error("netlist_persistent", "could not deserialize netlist: failed to mark global {} net", input ? "input" : "output");
+                                return fail();
+                            }
+                        }
+                    }
+                    return true;
+                }
+
+                bool handle_section_entry(const rapidjson::Value& value)
+                {
+                    if (m_section == "gates")
+                    {
+                        if (!deserialize_gate(m_netlist.get(), value, m_gate_types))
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize gate");
+                            return fail();
+                        }
+                    }
+                    else if (m_section == "nets")
+                    {
+                        if (!deserialize_net(m_netlist.get(), value))
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize net");
+                            return fail();
+                        }
+                    }
+                    else if (!deserialize_module(m_netlist.get(), value, m_pin_group_cache))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module");
+                        return fail();
+                    }
+                    return true;
+                }
+
+                bool finish_netlist()
+                {
+                    if (!m_version_read)
+                    {
+                        log_warning("netlist_persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
+                    }
+
+                    std::vector<std::string> required_members = {"id", "input_file", "design_name", "device_name", "gates", "global_vcc", "global_gnd", "nets", "global_in", "global_out", "modules"};
+                    if (!m_gatelib)
+                    {
+                        required_members.insert(required_members.begin(), "gate_library");
+                    }
+                    for (const std::string& member : required_members)
+                    {
+                        if (m_read_members.find(member) == m_read_members.end())
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node '{}'", member);
+                            return fail();
+                        }
+                    }
+
+                    // update module nets, internal nets, input nets, and output nets
+                    for (Module* mod : m_netlist->get_modules())
+                    {
+                        mod->update_nets();
+                    }
+
+                    // load module pins (nets must have been updated beforehand)
+                    if (!deserialize_module_pins(m_pin_group_cache))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module pins");
+                        return fail();
+                    }
+
+                    // re-enable automatically checking module nets
+                    m_netlist->enable_automatic_net_checks(true);
+
+                    m_netlist_read = true;
+                    return true;
+                }
+            };
+
+            /**
+             * Deserialize a netlist while it is read from the stream.
+             * Sets `requires_document` if the netlist could not be read that way and the caller has to parse the whole document instead.
+             */
+            template<typename InputStream>
+            std::unique_ptr<Netlist> deserialize_stream(InputStream& stream, GateLibrary* gatelib, bool& requires_document)
+            {
+                NetlistStreamHandler handler(gatelib);
+                rapidjson::Reader reader;
+                reader.Parse<rapidjson::kParseDefaultFlags>(stream, handler);
+
+                if (handler.requires_document())
+                {
+                    requires_document = true;
+                    return nullptr;
+                }
+
+                if (reader.HasParseError())
+                {
+                    if (!handler.has_failed())
+                    {
+                        log_error("netlist_persistent", "invalid json string for deserialization");
+                    }
+                    return nullptr;
+                }
+
+                return handler.get_netlist();
+            }
+
         }    // namespace
 
         bool serialize_to_file(const Netlist* nl, const std::filesystem::path& hal_file)
@@ -1041,8 +1637,23 @@ namespace hal
 
             char buffer[65536];
             rapidjson::FileReadStream is(pFile, buffer, sizeof(buffer));
+            bool requires_document = false;
+            auto netlist           = deserialize_stream(is, gatelib, requires_document);
+            if (!requires_document)
+            {
+                fclose(pFile);
+                if (netlist)
+                {
+                    log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", hal_file.string(), DURATION(begin_time));
+                }
+                return netlist;
+            }
+
+            // the members of the file are not in the order they depend on each other, hence the whole document has to be read
+            rewind(pFile);
+            rapidjson::FileReadStream document_is(pFile, buffer, sizeof(buffer));
             rapidjson::Document document;
-            document.ParseStream<0, rapidjson::UTF8<>, rapidjson::FileReadStream>(is);
+            document.ParseStream<0, rapidjson::UTF8<>, rapidjson::FileReadStream>(document_is);
             fclose(pFile);
 
             return deserialize_document(document, gatelib, hal_file.string(), begin_time);
@@ -1054,6 +1665,19 @@ namespace hal
 
             // event_controls::enable_all(false);
 
+            rapidjson::StringStream is(hal_string.c_str());
+            bool requires_document = false;
+            auto netlist           = deserialize_stream(is, gatelib, requires_document);
+            if (!requires_document)
+            {
+                if (netlist)
+                {
+                    log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", "source string", DURATION(begin_time));
+                }
+                return netlist;
+            }
+
+            // the members of the string are not in the order they depend on each other, hence the whole document has to be read
             rapidjson::Document document;
             document.Parse<0, rapidjson::UTF8<> >(hal_string.c_str());
 
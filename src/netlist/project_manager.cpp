@@ -3,6 +3,7 @@
 #include "hal_core/netlist/gate_library/gate_library.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
 #include "hal_core/netlist/project_serializer.h"
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
@@ -29,7 +30,7 @@ namespace hal
 
     const std::string ProjectManager::s_project_file = ".project.json";
 
-    ProjectManager::ProjectManager() : m_project_status(ProjectStatus::NONE)
+    ProjectManager::ProjectManager() : m_project_status(ProjectStatus::NONE), m_netlist_format(NetlistFormat::JSON)
     {
         ;
     }
@@ -107,7 +108,7 @@ namespace hal
         }
         if (!success)
             return false;
-        m_netlist_file = m_proj_dir.get_default_filename(".hal");
+        m_netlist_file = m_proj_dir.get_default_filename(get_netlist_extension());
 
         std::filesystem::create_directory(m_proj_dir.get_filename("py"));
         std::filesystem::create_directory(m_proj_dir.get_filename(ProjectDirectory::s_shadow_dir));
@@ -131,6 +132,21 @@ namespace hal
         return m_project_status;
     }
 
+    ProjectManager::NetlistFormat ProjectManager::get_netlist_format() const
+    {
+        return m_netlist_format;
+    }
+
+    void ProjectManager::set_netlist_format(NetlistFormat format)
+    {
+        m_netlist_format = format;
+    }
+
+    std::string ProjectManager::get_netlist_extension() const
+    {
+        return (m_netlist_format == NetlistFormat::BINARY) ? netlist_binary_serializer::FILE_EXTENSION : std::string(".hal");
+    }
+
     void ProjectManager::set_gate_library_path(const std::string& glpath)
     {
         m_gatelib_path = glpath;
@@ -146,11 +162,13 @@ namespace hal
         if (gl)
             m_gatelib_path = gl->get_path().string();
         if (shadow)
-            m_netlist_file = m_proj_dir.get_shadow_filename(".hal");
+            m_netlist_file = m_proj_dir.get_shadow_filename(get_netlist_extension());
         else
-            m_netlist_file = m_proj_dir.get_default_filename(".hal");
+            m_netlist_file = m_proj_dir.get_default_filename(get_netlist_extension());
 
-        if (!netlist_serializer::serialize_to_file(m_netlist_save, m_netlist_file))
+        bool netlist_saved = (m_netlist_format == NetlistFormat::BINARY) ? netlist_binary_serializer::serialize_to_file(m_netlist_save, m_netlist_file)
+                                                                         : netlist_serializer::serialize_to_file(m_netlist_save, m_netlist_file);
+        if (!netlist_saved)
             return false;
 
         if (!serialize_external(shadow))
@@ -249,6 +267,8 @@ namespace hal
                     log_error("project_manager", "cannot load netlist {}.", netlistPath.string());
                     return false;
                 }
+                // keep saving the netlist in the format it was stored in
+                m_netlist_format = (netlistPath.extension() == netlist_binary_serializer::FILE_EXTENSION) ? NetlistFormat::BINARY : NetlistFormat::JSON;
             }
             else
             {
@@ -81,5 +81,32 @@ namespace hal
             :returns: A list of paths.
             :rtype: list[pathlib.Path]
     )");
+
+        py_core_utils.def(
+            "get_num_threads", []() { return ThreadPool::get_global().get_num_threads(); }, R"(
+            Get the number of worker threads of the thread pool that is shared by HAL and its plugins.
+            The thread that waits for a parallel operation executes tasks as well.
+
+            :returns: The number of worker threads.
+            :rtype: int
+    )");
+
+        py_core_utils.def(
+            "set_num_threads", [](u32 num_threads) { return ThreadPool::get_global().set_num_threads(num_threads); }, py::arg("num_threads"), R"(
+            Set the number of worker threads of the thread pool that is shared by HAL and its plugins.
+            Pending tasks are executed before the workers are replaced, so this must not be called while a parallel operation is running.
+
+            :param int num_threads: The number of worker threads, ``0`` for the default number.
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+    )");
+
+        py_core_utils.def("get_default_num_threads", &ThreadPool::get_default_num_threads, R"(
+            Get the number of worker threads the thread pool is created with by default.
+            This is one less than the number of hardware threads, but at least one.
+
+            :returns: The default number of worker threads.
+            :rtype: int
+    )");
     }
 }    // namespace hal
@@ -494,6 +494,40 @@ namespace hal
             :param bool enable_checks: Set ``True`` to enable automatic checks, ``False`` otherwise.
         )");
 
+        py_netlist.def("begin_transaction", &Netlist::begin_transaction, R"(
+            Start an edit transaction.
+            Within a transaction, assigning gates to modules, changing the module hierarchy, and connecting or disconnecting nets no longer update the input, output, and internal nets and the pins of all affected modules after every single change.
+            Instead, every affected net is checked exactly once for every affected module when the transaction is committed, and all pin events of a module are replaced by a single reload event.
+            Until then, the nets and pins of the modules may be outdated.
+            Transactions can be nested, only committing the outermost transaction updates the modules.
+            See :class:`hal_py.NetlistTransaction` for a transaction to be used in a ``with`` statement.
+        )");
+
+        py_netlist.def(
+            "commit_transaction",
+            [](Netlist& self) -> bool {
+                if (auto res = self.commit_transaction(); res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+                return true;
+            },
+            R"(
+            Commit the edit transaction that has been started last.
+            Committing the outermost transaction updates the nets and pins of all modules affected by the transaction and sends the pin events.
+
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist.def("is_transaction_active", &Netlist::is_transaction_active, R"(
+            Check whether an edit transaction is active.
+
+            :returns: ``True`` if a transaction is active, ``False`` otherwise.
+            :rtype: bool
+        )");
+
         py_netlist.def("get_unique_module_id", &Netlist::get_unique_module_id, R"(
             Get a spare module ID.
             The value of 0 is reserved and represents an invalid ID.
@@ -840,5 +874,44 @@ namespace hal
             :returns: ``True`` on success, ``False`` otherwise.
             :rtype: bool
         )");
+
+        py::class_<NetlistTransaction> py_netlist_transaction(m, "NetlistTransaction", R"(
+            An edit transaction on a netlist to be used in a ``with`` statement.
+            The transaction is started on construction and committed when the ``with`` block is left, unless it has been committed before.
+            See :func:`hal_py.Netlist.begin_transaction` for the effects of a transaction.
+        )");
+
+        py_netlist_transaction.def(py::init<Netlist*>(), py::arg("netlist"), py::keep_alive<1, 2>(), R"(
+            Start an edit transaction on the given netlist.
+
+            :param hal_py.Netlist netlist: The netlist.
+        )");
+
+        py_netlist_transaction.def(
+            "commit",
+            [](NetlistTransaction& self) -> bool {
+                if (auto res = self.commit(); res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+                return true;
+            },
+            R"(
+            Commit the transaction.
+            Does nothing if the transaction has been committed before.
+
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist_transaction.def("__enter__", [](NetlistTransaction& self) -> NetlistTransaction& { return self; }, py::return_value_policy::reference);
+
+        py_netlist_transaction.def("__exit__", [](NetlistTransaction& self, const py::object&, const py::object&, const py::object&) {
+            if (auto res = self.commit(); res.is_error())
+            {
+                log_error("python_context", "{}", res.get_error().get());
+            }
+        });
     }
 }    // namespace hal
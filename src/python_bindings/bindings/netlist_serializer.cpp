@@ -46,5 +46,33 @@ namespace hal
                 :returns: The deserialized netlist on success, ``None`` otherwise.
                 :rtype: hal_py.Netlist or None
             )");
+
+        auto py_netlist_binary_serializer = m.def_submodule("NetlistBinarySerializer", R"(
+            HAL Netlist Binary Serializer functions.
+        )");
+
+        py_netlist_binary_serializer.def("serialize_to_file", netlist_binary_serializer::serialize_to_file, py::arg("netlist"), py::arg("halb_file"), R"(
+            Serializes a netlist into a binary ``.halb`` file.
+
+            :param hal_py.Netlist netlist: The netlist to serialize.
+            :param pathlib.Path halb_file: The path to the ``.halb`` file.
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist_binary_serializer.def(
+            "deserialize_from_file",
+            [](const std::filesystem::path& halb_file, GateLibrary* gate_lib = nullptr) { return std::shared_ptr<Netlist>(netlist_binary_serializer::deserialize_from_file(halb_file, gate_lib)); },
+            py::arg("halb_file"),
+            py::arg("gate_lib") = nullptr,
+            R"(
+                Deserializes a netlist from a binary ``.halb`` file using the provided gate library.
+                If no gate library is provided, the gate library path stored within the ``.halb`` file is used.
+
+                :param pathlib.Path halb_file: The path to the ``.halb`` file.
+                :param hal_py.GateLibrary gate_lib: The gate library. Defaults to ``None``.
+                :returns: The deserialized netlist on success, ``None`` otherwise.
+                :rtype: hal_py.Netlist or None
+            )");
     }
 }    // namespace hal
@@ -17,6 +17,14 @@ namespace hal
             .value("SAVED", ProjectManager::ProjectStatus::SAVED, R"(Represents a saved project state.)")
             .export_values();
 
+        py::enum_<ProjectManager::NetlistFormat> py_netlist_format(py_project_manager, "NetlistFormat", R"(
+            Represents the file format the netlist of the project is serialized to.
+        )");
+
+        py_netlist_format.value("JSON", ProjectManager::NetlistFormat::JSON, R"(Represents the JSON-based ``.hal`` format.)")
+            .value("BINARY", ProjectManager::NetlistFormat::BINARY, R"(Represents the binary ``.halb`` format.)")
+            .export_values();
+
         py::class_<ProjectDirectory> py_project_directory(m, "ProjectDirectory", R"(
             Represents a project directory.
         )");
@@ -116,6 +124,20 @@ namespace hal
             :rtype: str
         )");
 
+        py_project_manager.def("get_netlist_format", &ProjectManager::get_netlist_format, R"(
+            Returns the file format the netlist is serialized to when saving the project.
+
+            :returns: The netlist format.
+            :rtype: hal_py.ProjectManager.NetlistFormat
+        )");
+
+        py_project_manager.def("set_netlist_format", &ProjectManager::set_netlist_format, py::arg("format"), R"(
+            Set the file format the netlist is serialized to when saving the project.
+            Opening a project sets the format to the one of the stored netlist file.
+
+            :param hal_py.ProjectManager.NetlistFormat format: The netlist format.
+        )");
+
         py_project_manager.def("set_gate_library_path", &ProjectManager::set_gate_library_path, py::arg("gl_path"), R"(
             Set the path to the gate library file.
 
@@ -238,6 +238,35 @@ namespace hal
             :rtype: hal_py.SMT.Model or None
         )");
 
+        py_smt_model.def_static(
+            "parse",
+            [](const std::string& model_str, const SMT::SolverType& solver, const std::set<std::string>& variables) -> std::optional<SMT::Model> {
+                auto res = SMT::Model::parse(model_str, solver, variables);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("model_str"),
+            py::arg("solver"),
+            py::arg("variables"),
+            R"(
+            Parses only the given variables of an SMT-Lib model from a string output by a solver of the given type.
+            The remaining definitions of the model are skipped without being parsed and scanning stops as soon as all given variables have been found, which makes this considerably faster than parsing the entire model for large models.
+            Variables that are not defined in the model are not part of the returned model.
+
+            :param str model_str: The SMT-Lib model string.
+            :param hal_py.SMT.SolverType solver: The solver that computed the model.
+            :param set[str] variables: The names of the variables to extract.
+            :returns: The model restricted to the given variables on success, ``None`` otherwise.
+            :rtype: hal_py.SMT.Model or None
+        )");
+
         py_smt_model.def(
             "evaluate",
             [](const SMT::Model& self, const BooleanFunction& bf) -> std::optional<BooleanFunction> {
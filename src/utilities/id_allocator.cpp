@@ -0,0 +1,231 @@
+#include "hal_core/utilities/id_allocator.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace hal
+{
+    bool IdAllocator::RangeSet::contains(u32 id) const
+    {
+        auto it = m_ranges.upper_bound(id);
+        if (it == m_ranges.begin())
+        {
+            return false;
+        }
+        return id <= std::prev(it)->second;
+    }
+
+    void IdAllocator::RangeSet::insert(u32 id)
+    {
+        if (contains(id))
+        {
+            return;
+        }
+
+        // no range contains the ID, so the ranges next to it end below and start above the ID
+        auto next_it         = m_ranges.upper_bound(id);
+        const bool join_prev = next_it != m_ranges.begin() && std::prev(next_it)->second + 1 == id;
+        const bool join_next = next_it != m_ranges.end() && next_it->first == id + 1;
+
+        if (join_prev && join_next)
+        {
+            std::prev(next_it)->second = next_it->second;
+            m_ranges.erase(next_it);
+        }
+        else if (join_prev)
+        {
+            std::prev(next_it)->second = id;
+        }
+        else if (join_next)
+        {
+            const u32 last = next_it->second;
+            m_ranges.erase(next_it);
+            m_ranges.emplace(id, last);
+        }
+        else
+        {
+            m_ranges.emplace_hint(next_it, id, id);
+        }
+    }
+
+    void IdAllocator::RangeSet::erase(u32 id)
+    {
+        auto it = m_ranges.upper_bound(id);
+        if (it == m_ranges.begin() || std::prev(it)->second < id)
+        {
+            return;
+        }
+        --it;
+
+        const u32 first = it->first;
+        const u32 last  = it->second;
+        if (first == last)
+        {
+            m_ranges.erase(it);
+        }
+        else if (id == first)
+        {
+            m_ranges.erase(it);
+            m_ranges.emplace(id + 1, last);
+        }
+        else if (id == last)
+        {
+            it->second = id - 1;
+        }
+        else
+        {
+            it->second = id - 1;
+            m_ranges.emplace(id + 1, last);
+        }
+    }
+
+    void IdAllocator::RangeSet::assign(const std::vector<Range>& ranges)
+    {
+        std::vector<Range> sorted;
+        sorted.reserve(ranges.size());
+        for (const auto& [first, last] : ranges)
+        {
+            if (first <= last)
+            {
+                sorted.emplace_back(first, last);
+            }
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        // merge overlapping and adjacent ranges
+        m_ranges.clear();
+        for (const auto& [first, last] : sorted)
+        {
+            if (!m_ranges.empty())
+            {
+                auto prev_it = std::prev(m_ranges.end());
+                if (prev_it->second == UINT32_MAX || first <= prev_it->second + 1)
+                {
+                    prev_it->second = std::max(prev_it->second, last);
+                    continue;
+                }
+            }
+            m_ranges.emplace_hint(m_ranges.end(), first, last);
+        }
+    }
+
+    void IdAllocator::RangeSet::assign(const std::set<u32>& ids)
+    {
+        // the IDs are sorted, so every ID either extends the last range or starts a new one
+        m_ranges.clear();
+        for (u32 id : ids)
+        {
+            if (!m_ranges.empty() && std::prev(m_ranges.end())->second + 1 == id)
+            {
+                std::prev(m_ranges.end())->second = id;
+            }
+            else
+            {
+                m_ranges.emplace_hint(m_ranges.end(), id, id);
+            }
+        }
+    }
+
+    std::set<u32> IdAllocator::RangeSet::get_ids() const
+    {
+        std::set<u32> ids;
+        for (const auto& [first, last] : m_ranges)
+        {
+            for (u64 id = first; id <= last; id++)
+            {
+                ids.insert(ids.end(), (u32)id);
+            }
+        }
+        return ids;
+    }
+
+    std::vector<IdAllocator::Range> IdAllocator::RangeSet::get_ranges() const
+    {
+        return std::vector<Range>(m_ranges.begin(), m_ranges.end());
+    }
+
+    u32 IdAllocator::get_unique_id()
+    {
+        if (!m_free.m_ranges.empty())
+        {
+            return m_free.m_ranges.begin()->first;
+        }
+
+        // adjacent used IDs are merged into one range, so the ID following the range that contains the next ID is unused
+        if (auto it = m_used.m_ranges.upper_bound(m_next_id); it != m_used.m_ranges.begin())
+        {
+            if (--it; m_next_id <= it->second)
+            {
+                m_next_id = it->second + 1;
+            }
+        }
+        return m_next_id;
+    }
+
+    bool IdAllocator::is_used(u32 id) const
+    {
+        return m_used.contains(id);
+    }
+
+    void IdAllocator::mark_used(u32 id)
+    {
+        m_free.erase(id);
+        m_used.insert(id);
+    }
+
+    void IdAllocator::release(u32 id)
+    {
+        m_free.insert(id);
+        m_used.erase(id);
+    }
+
+    u32 IdAllocator::get_next_id() const
+    {
+        return m_next_id;
+    }
+
+    void IdAllocator::set_next_id(u32 id)
+    {
+        m_next_id = id;
+    }
+
+    std::set<u32> IdAllocator::get_used_ids() const
+    {
+        return m_used.get_ids();
+    }
+
+    void IdAllocator::set_used_ids(const std::set<u32>& ids)
+    {
+        m_used.assign(ids);
+    }
+
+    std::set<u32> IdAllocator::get_free_ids() const
+    {
+        return m_free.get_ids();
+    }
+
+    void IdAllocator::set_free_ids(const std::set<u32>& ids)
+    {
+        m_free.assign(ids);
+    }
+
+    std::vector<IdAllocator::Range> IdAllocator::get_used_ranges() const
+    {
+        return m_used.get_ranges();
+    }
+
+    void IdAllocator::set_used_ranges(const std::vector<Range>& ranges)
+    {
+        m_used.assign(ranges);
+    }
+
+    std::vector<IdAllocator::Range> IdAllocator::get_free_ranges() const
+    {
+        return m_free.get_ranges();
+    }
+
+    void IdAllocator::set_free_ranges(const std::vector<Range>& ranges)
+    {
+        m_free.assign(ranges);
+    }
+}    // namespace hal
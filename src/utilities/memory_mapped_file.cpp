@@ -0,0 +1,102 @@
+#include "hal_core/utilities/memory_mapped_file.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hal
+{
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        close();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept : m_data(other.m_data), m_size(other.m_size), m_is_open(other.m_is_open)
+    {
+        other.m_data    = nullptr;
+        other.m_size    = 0;
+        other.m_is_open = false;
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            m_data          = other.m_data;
+            m_size          = other.m_size;
+            m_is_open       = other.m_is_open;
+            other.m_data    = nullptr;
+            other.m_size    = 0;
+            other.m_is_open = false;
+        }
+        return *this;
+    }
+
+    Result<std::monostate> MemoryMappedFile::open(const std::filesystem::path& file_path)
+    {
+        close();
+
+        int fd = ::open(file_path.string().c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return ERR("could not map file '" + file_path.string() + "' into memory: unable to open file (" + std::strerror(errno) + ")");
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) != 0)
+        {
+            const std::string reason = std::strerror(errno);
+            ::close(fd);
+            return ERR("could not map file '" + file_path.string() + "' into memory: unable to determine file size (" + reason + ")");
+        }
+
+        // mapping an empty file is not allowed, so we only mark the file as open
+        if (info.st_size > 0)
+        {
+            void* data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                const std::string reason = std::strerror(errno);
+                ::close(fd);
+                return ERR("could not map file '" + file_path.string() + "' into memory: mmap failed (" + reason + ")");
+            }
+
+            // files are usually read front to back, so ask the kernel for an aggressive read-ahead
+            madvise(data, info.st_size, MADV_SEQUENTIAL);
+
+            m_data = static_cast<const char*>(data);
+            m_size = info.st_size;
+        }
+
+        // the mapping stays valid after the file descriptor is closed
+        ::close(fd);
+        m_is_open = true;
+
+        return OK({});
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (m_data != nullptr)
+        {
+            munmap(const_cast<char*>(m_data), m_size);
+        }
+        m_data    = nullptr;
+        m_size    = 0;
+        m_is_open = false;
+    }
+
+    bool MemoryMappedFile::is_open() const
+    {
+        return m_is_open;
+    }
+
+    std::string_view MemoryMappedFile::get_data() const
+    {
+        return std::string_view(m_data, m_size);
+    }
+}    // namespace hal
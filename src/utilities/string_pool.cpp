@@ -0,0 +1,49 @@
+#include "hal_core/utilities/string_pool.h"
+
+#include <mutex>
+
+namespace hal
+{
+    StringPool& StringPool::get_global()
+    {
+        static StringPool pool;
+        return pool;
+    }
+
+    const std::string* StringPool::intern(std::string_view str)
+    {
+        if (const std::string* pooled = find(str); pooled != nullptr)
+        {
+            return pooled;
+        }
+
+        std::unique_lock lock(m_mutex);
+
+        // another thread may have added the string in between
+        if (const auto it = m_index.find(str); it != m_index.end())
+        {
+            return it->second;
+        }
+
+        // the deque never relocates its elements, hence the views in the index stay valid
+        const std::string* pooled = &m_strings.emplace_back(str);
+        m_index.emplace(*pooled, pooled);
+        return pooled;
+    }
+
+    const std::string* StringPool::find(std::string_view str) const
+    {
+        std::shared_lock lock(m_mutex);
+        if (const auto it = m_index.find(str); it != m_index.end())
+        {
+            return it->second;
+        }
+        return nullptr;
+    }
+
+    u64 StringPool::size() const
+    {
+        std::shared_lock lock(m_mutex);
+        return m_strings.size();
+    }
+}    // namespace hal
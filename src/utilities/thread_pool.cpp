@@ -0,0 +1,323 @@
+#include "hal_core/utilities/thread_pool.h"
+
+#include "hal_core/utilities/log.h"
+
+#include <chrono>
+#include <utility>
+
+namespace hal
+{
+    namespace
+    {
+        // the pool the current thread is a worker of and the index of its queue
+        thread_local const ThreadPool* tl_pool = nullptr;
+        thread_local u32 tl_queue_index        = 0;
+
+        // the pool whose task the current thread is executing, which may also be a thread waiting for a task group
+        thread_local const ThreadPool* tl_executing = nullptr;
+    }    // namespace
+
+    ThreadPool::ThreadPool(u32 num_threads)
+    {
+        start(num_threads);
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        stop();
+    }
+
+    ThreadPool& ThreadPool::get_global()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    u32 ThreadPool::get_default_num_threads()
+    {
+        const u32 hardware_threads = std::thread::hardware_concurrency();
+        return (hardware_threads > 1) ? hardware_threads - 1 : 1;
+    }
+
+    u32 ThreadPool::get_num_threads() const
+    {
+        return m_workers.size();
+    }
+
+    bool ThreadPool::set_num_threads(u32 num_threads)
+    {
+        if (tl_pool == this || tl_executing == this)
+        {
+            log_error("core", "cannot change the number of threads of a thread pool from within one of its tasks.");
+            return false;
+        }
+
+        stop();
+        start(num_threads);
+        return true;
+    }
+
+    void ThreadPool::submit(Task task)
+    {
+        {
+            // counted before the task is queued so that the counter never drops below the number of queued tasks,
+            // and under the sleep mutex so that a worker cannot miss the task between checking the counter and going to sleep
+            std::lock_guard lock(m_sleep_mutex);
+            m_num_pending++;
+        }
+
+        const u32 index = (tl_pool == this) ? tl_queue_index : m_queues.size() - 1;
+        {
+            std::lock_guard lock(m_queues[index]->mutex);
+            m_queues[index]->tasks.push_back(std::move(task));
+        }
+        m_wake_up.notify_one();
+    }
+
+    bool ThreadPool::run_pending_task()
+    {
+        Task task;
+        if (!pop_task((tl_pool == this) ? tl_queue_index : m_queues.size() - 1, task))
+        {
+            return false;
+        }
+
+        const ThreadPool* executing = std::exchange(tl_executing, this);
+        task();
+        tl_executing = executing;
+        return true;
+    }
+
+    bool ThreadPool::is_worker_thread() const
+    {
+        return tl_pool == this;
+    }
+
+    void ThreadPool::start(u32 num_threads)
+    {
+        if (num_threads == 0)
+        {
+            num_threads = get_default_num_threads();
+        }
+
+        m_stop = false;
+        m_queues.clear();
+        for (u32 i = 0; i <= num_threads; i++)
+        {
+            m_queues.push_back(std::make_unique<TaskQueue>());
+        }
+
+        m_workers.reserve(num_threads);
+        for (u32 i = 0; i < num_threads; i++)
+        {
+            m_workers.emplace_back([this, i]() { work(i); });
+        }
+    }
+
+    void ThreadPool::stop()
+    {
+        {
+            std::lock_guard lock(m_sleep_mutex);
+            m_stop = true;
+        }
+        m_wake_up.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+        m_workers.clear();
+
+        // without workers, the remaining tasks are executed by the calling thread
+        while (run_pending_task())
+        {
+        }
+    }
+
+    void ThreadPool::work(u32 index)
+    {
+        tl_pool        = this;
+        tl_queue_index = index;
+        tl_executing   = this;
+
+        Task task;
+        while (true)
+        {
+            if (pop_task(index, task))
+            {
+                task();
+                task = nullptr;
+                continue;
+            }
+
+            std::unique_lock lock(m_sleep_mutex);
+            m_wake_up.wait(lock, [this]() { return m_num_pending > 0 || m_stop; });
+            if (m_stop && m_num_pending == 0)
+            {
+                break;
+            }
+        }
+
+        tl_pool      = nullptr;
+        tl_executing = nullptr;
+    }
+
+    bool ThreadPool::pop_task(u32 index, Task& task)
+    {
+        if (m_num_pending == 0)
+        {
+            return false;
+        }
+
+        // own queue first, newest task of a worker queue but oldest task of the queue shared by all threads outside the pool
+        {
+            TaskQueue& own_queue = *m_queues[index];
+            std::lock_guard lock(own_queue.mutex);
+            if (!own_queue.tasks.empty())
+            {
+                if (index == m_queues.size() - 1)
+                {
+                    task = std::move(own_queue.tasks.front());
+                    own_queue.tasks.pop_front();
+                }
+                else
+                {
+                    task = std::move(own_queue.tasks.back());
+                    own_queue.tasks.pop_back();
+                }
+                m_num_pending--;
+                return true;
+            }
+        }
+
+        // otherwise steal the oldest task of another queue, starting with the next one so that not all threads steal from the same queue
+        const u32 num_queues = m_queues.size();
+        for (u32 offset = 1; offset < num_queues; offset++)
+        {
+            TaskQueue& queue = *m_queues[(index + offset) % num_queues];
+            std::lock_guard lock(queue.mutex);
+            if (!queue.tasks.empty())
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                m_num_pending--;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    TaskGroup::TaskGroup(ThreadPool& pool) : m_pool(pool)
+    {
+    }
+
+    TaskGroup::~TaskGroup()
+    {
+        try
+        {
+            wait();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    void TaskGroup::run(ThreadPool::Task task)
+    {
+        m_num_tasks++;
+        m_pool.submit([this, task = std::move(task)]() {
+            if (!m_cancelled)
+            {
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(m_mutex);
+                    if (!m_exception)
+                    {
+                        m_exception = std::current_exception();
+                    }
+                    m_cancelled = true;
+                }
+            }
+
+            // the waiting thread may destroy the group as soon as the last task is counted, so the group must not be accessed afterwards
+            std::lock_guard lock(m_mutex);
+            m_num_finished++;
+            m_finished.notify_all();
+        });
+    }
+
+    void TaskGroup::wait(const ProgressCallback& on_progress)
+    {
+        u32 reported = 0;
+        while (true)
+        {
+            const u32 finished = m_num_finished;
+            if (on_progress && finished != reported)
+            {
+                reported = finished;
+                on_progress(finished, m_num_tasks);
+            }
+
+            if (finished == m_num_tasks)
+            {
+                break;
+            }
+
+            if (!m_pool.run_pending_task())
+            {
+                // all remaining tasks of the group are running on other threads, tasks they submit are picked up after a short while
+                std::unique_lock lock(m_mutex);
+                m_finished.wait_for(lock, std::chrono::milliseconds(10), [this]() { return m_num_finished == m_num_tasks; });
+            }
+        }
+
+        std::exception_ptr exception;
+        {
+            std::lock_guard lock(m_mutex);
+            std::swap(exception, m_exception);
+        }
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void TaskGroup::cancel()
+    {
+        m_cancelled = true;
+    }
+
+    bool TaskGroup::is_cancelled() const
+    {
+        return m_cancelled;
+    }
+
+    u32 TaskGroup::get_num_tasks() const
+    {
+        return m_num_tasks;
+    }
+
+    u32 TaskGroup::get_num_finished() const
+    {
+        return m_num_finished;
+    }
+
+    ThreadPool& TaskGroup::get_pool() const
+    {
+        return m_pool;
+    }
+
+    namespace thread_pool_utils
+    {
+        u32 get_chunk_size(const ThreadPool& pool, u32 begin, u32 end)
+        {
+            const u32 num_chunks = 4 * (pool.get_num_threads() + 1);
+            return std::max(1u, (end - begin + num_chunks - 1) / num_chunks);
+        }
+    }    // namespace thread_pool_utils
+}    // namespace hal
@@ -0,0 +1,133 @@
+#include "hal_core/utilities/id_allocator.h"
+#include "netlist_test_utils.h"
+
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+namespace hal
+{
+    using Ranges = std::vector<IdAllocator::Range>;
+
+    class IdAllocatorTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+    };
+
+    /**
+     * Testing that IDs are handed out in the same order as by a set of used and a set of freed IDs.
+     *
+     * Functions: get_unique_id, is_used, mark_used, release, get_next_id
+     */
+    TEST_F(IdAllocatorTest, check_unique_ids)
+    {
+        TEST_START
+        {
+            // IDs are handed out consecutively, but only marking them as used makes them unavailable
+            IdAllocator ids;
+            EXPECT_EQ(ids.get_unique_id(), 1);
+            EXPECT_EQ(ids.get_unique_id(), 1);
+            for (u32 i = 0; i < 10; i++)
+            {
+                ids.mark_used(ids.get_unique_id());
+            }
+            EXPECT_EQ(ids.get_used_ranges(), Ranges({{1, 10}}));
+            EXPECT_EQ(ids.get_unique_id(), 11);
+            EXPECT_TRUE(ids.is_used(10));
+            EXPECT_FALSE(ids.is_used(11));
+            EXPECT_FALSE(ids.is_used(0));
+        }
+        {
+            // freed IDs are handed out again smallest first, before any unused ID
+            IdAllocator ids;
+            for (u32 i = 1; i <= 10; i++)
+            {
+                ids.mark_used(i);
+            }
+            ids.release(7);
+            ids.release(3);
+            ids.release(4);
+            EXPECT_EQ(ids.get_used_ranges(), Ranges({{1, 2}, {5, 6}, {8, 10}}));
+            EXPECT_EQ(ids.get_free_ranges(), Ranges({{3, 4}, {7, 7}}));
+            EXPECT_EQ(ids.get_free_ids(), std::set<u32>({3, 4, 7}));
+
+            EXPECT_EQ(ids.get_unique_id(), 3);
+            ids.mark_used(3);
+            EXPECT_EQ(ids.get_unique_id(), 4);
+            ids.mark_used(4);
+            EXPECT_EQ(ids.get_unique_id(), 7);
+            ids.mark_used(7);
+            EXPECT_EQ(ids.get_unique_id(), 11);
+            EXPECT_EQ(ids.get_used_ranges(), Ranges({{1, 10}}));
+            EXPECT_TRUE(ids.get_free_ids().empty());
+        }
+        {
+            // IDs that are used out of order are skipped
+            IdAllocator ids;
+            ids.mark_used(2);
+            ids.mark_used(3);
+            ids.mark_used(5);
+            EXPECT_EQ(ids.get_unique_id(), 1);
+            ids.mark_used(1);
+            EXPECT_EQ(ids.get_unique_id(), 4);
+            ids.mark_used(4);
+            EXPECT_EQ(ids.get_unique_id(), 6);
+            EXPECT_EQ(ids.get_next_id(), 6);
+            EXPECT_EQ(ids.get_used_ranges(), Ranges({{1, 5}}));
+        }
+        {
+            // splitting a range and releasing IDs that are not used
+            IdAllocator ids;
+            ids.set_used_ranges({{1, 100}});
+            ids.release(50);
+            ids.release(1);
+            ids.release(100);
+            ids.release(200);
+            EXPECT_EQ(ids.get_used_ranges(), Ranges({{2, 49}, {51, 99}}));
+            EXPECT_EQ(ids.get_free_ranges(), Ranges({{1, 1}, {50, 50}, {100, 100}, {200, 200}}));
+            EXPECT_FALSE(ids.is_used(50));
+            EXPECT_TRUE(ids.is_used(51));
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the conversion between sets of IDs and ranges of IDs.
+     *
+     * Functions: get_used_ids, set_used_ids, get_free_ids, set_free_ids, get_used_ranges, set_used_ranges, get_free_ranges, set_free_ranges
+     */
+    TEST_F(IdAllocatorTest, check_ranges)
+    {
+        TEST_START
+        {
+            IdAllocator ids;
+            ids.set_used_ids({1, 2, 3, 5, 7, 8});
+            EXPECT_EQ(ids.get_used_ranges(), Ranges({{1, 3}, {5, 5}, {7, 8}}));
+            EXPECT_EQ(ids.get_used_ids(), std::set<u32>({1, 2, 3, 5, 7, 8}));
+
+            ids.set_free_ids({4, 6});
+            EXPECT_EQ(ids.get_free_ranges(), Ranges({{4, 4}, {6, 6}}));
+            EXPECT_EQ(ids.get_unique_id(), 4);
+        }
+        {
+            // overlapping and adjacent ranges are merged, invalid ranges are ignored
+            IdAllocator ids;
+            ids.set_used_ranges({{10, 20}, {1, 5}, {15, 25}, {6, 8}, {30, 29}, {0xFFFFFFF0, 0xFFFFFFFF}});
+            EXPECT_EQ(ids.get_used_ranges(), Ranges({{1, 8}, {10, 25}, {0xFFFFFFF0, 0xFFFFFFFF}}));
+            EXPECT_TRUE(ids.is_used(0xFFFFFFFF));
+            EXPECT_EQ(ids.get_unique_id(), 9);
+
+            ids.set_free_ranges({{3, 4}});
+            EXPECT_EQ(ids.get_free_ids(), std::set<u32>({3, 4}));
+        }
+        TEST_END
+    }
+}    // namespace hal
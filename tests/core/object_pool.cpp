@@ -0,0 +1,159 @@
+#include "hal_core/utilities/object_pool.h"
+#include "netlist_test_utils.h"
+
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+
+namespace hal
+{
+    namespace
+    {
+        struct Entry
+        {
+            u64 value;
+            u32 index;
+
+            Entry(u64 v, u32 i) : value(v), index(i)
+            {
+            }
+        };
+    }    // namespace
+
+    class ObjectPoolTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+    };
+
+    /**
+     * Testing that the storage of destroyed objects is handed out again before any new storage, the most recently destroyed first.
+     *
+     * Functions: allocate, destroy
+     */
+    TEST_F(ObjectPoolTest, check_slot_reuse)
+    {
+        TEST_START
+        {
+            ObjectPool<Entry> pool(4);
+            Entry* a = new (pool.allocate()) Entry(1, 0);
+            Entry* b = new (pool.allocate()) Entry(2, 1);
+            Entry* c = new (pool.allocate()) Entry(3, 2);
+            EXPECT_NE(a, b);
+            EXPECT_NE(b, c);
+
+            pool.destroy(b);
+            Entry* d = new (pool.allocate()) Entry(4, 3);
+            EXPECT_EQ(d, b);
+
+            pool.destroy(a);
+            pool.destroy(c);
+            EXPECT_EQ(pool.allocate(), c);
+            EXPECT_EQ(pool.allocate(), a);
+
+            // the reused slots do not overlap the remaining object
+            EXPECT_EQ(d->value, 4);
+            EXPECT_EQ(d->index, 3);
+
+            // once all freed slots are used up, fresh storage is handed out
+            void* e = pool.allocate();
+            EXPECT_NE(e, a);
+            EXPECT_NE(e, c);
+            EXPECT_NE(e, d);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that the pool fills its blocks consecutively and adds blocks as needed, also for a block size of 0, which is treated as 1.
+     *
+     * Functions: ObjectPool, allocate
+     */
+    TEST_F(ObjectPoolTest, check_block_growth)
+    {
+        TEST_START
+        {
+            const u32 objects_per_block = 8;
+            ObjectPool<Entry> pool(objects_per_block);
+
+            std::vector<Entry*> entries;
+            for (u32 i = 0; i < 5 * objects_per_block + 3; i++)
+            {
+                entries.push_back(new (pool.allocate()) Entry(i, i));
+            }
+            EXPECT_EQ(std::set<Entry*>(entries.begin(), entries.end()).size(), entries.size());
+
+            // objects of the same block are placed next to each other
+            const auto stride = reinterpret_cast<const char*>(entries.at(1)) - reinterpret_cast<const char*>(entries.at(0));
+            EXPECT_GE(stride, (std::ptrdiff_t)sizeof(Entry));
+            for (u32 i = 0; i < entries.size(); i++)
+            {
+                if (i % objects_per_block != 0)
+                {
+                    EXPECT_EQ(reinterpret_cast<const char*>(entries.at(i)) - reinterpret_cast<const char*>(entries.at(i - 1)), stride) << i;
+                }
+                EXPECT_EQ(reinterpret_cast<std::uintptr_t>(entries.at(i)) % alignof(Entry), 0) << i;
+            }
+
+            ObjectPool<Entry> single_pool(0);
+            Entry* a = new (single_pool.allocate()) Entry(1, 0);
+            Entry* b = new (single_pool.allocate()) Entry(2, 1);
+            EXPECT_NE(a, b);
+            EXPECT_EQ(a->value, 1);
+            EXPECT_EQ(b->value, 2);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that objects keep their addresses and values while the pool grows and other objects are destroyed and created.
+     *
+     * Functions: allocate, destroy
+     */
+    TEST_F(ObjectPoolTest, check_pointer_stability)
+    {
+        TEST_START
+        {
+            ObjectPool<Entry> pool(16);
+
+            std::vector<Entry*> entries;
+            for (u32 i = 0; i < 100; i++)
+            {
+                entries.push_back(new (pool.allocate()) Entry(1000 + i, i));
+            }
+            const std::vector<Entry*> addresses = entries;
+
+            // destroy every third object and fill the pool with new ones
+            for (u32 i = 0; i < entries.size(); i += 3)
+            {
+                pool.destroy(entries.at(i));
+                entries.at(i) = nullptr;
+            }
+            for (u32 i = 0; i < 200; i++)
+            {
+                new (pool.allocate()) Entry(0, 0);
+            }
+
+            for (u32 i = 0; i < entries.size(); i++)
+            {
+                if (entries.at(i) == nullptr)
+                {
+                    continue;
+                }
+                EXPECT_EQ(entries.at(i), addresses.at(i));
+                EXPECT_EQ(entries.at(i)->value, 1000 + i);
+                EXPECT_EQ(entries.at(i)->index, i);
+            }
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -0,0 +1,109 @@
+#include "hal_core/utilities/string_pool.h"
+#include "netlist_test_utils.h"
+
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+namespace hal
+{
+    class StringPoolTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+    };
+
+    /**
+     * Testing that equal strings are stored once and that lookups do not add strings to the pool.
+     *
+     * Functions: intern, find, size
+     */
+    TEST_F(StringPoolTest, check_intern_and_find)
+    {
+        TEST_START
+        {
+            StringPool pool;
+            EXPECT_EQ(pool.size(), 0);
+            EXPECT_EQ(pool.find("a"), nullptr);
+            EXPECT_EQ(pool.size(), 0);
+
+            const std::string* a = pool.intern("a");
+            ASSERT_NE(a, nullptr);
+            EXPECT_EQ(*a, "a");
+            EXPECT_EQ(pool.size(), 1);
+
+            // equal strings from different sources map to the same pooled string
+            const std::string source = "xa";
+            EXPECT_EQ(pool.intern(std::string_view(source).substr(1)), a);
+            EXPECT_EQ(pool.intern(std::string("a")), a);
+            EXPECT_EQ(pool.find("a"), a);
+            EXPECT_EQ(pool.size(), 1);
+
+            const std::string* b     = pool.intern("b");
+            const std::string* empty = pool.intern("");
+            EXPECT_NE(b, a);
+            EXPECT_NE(empty, a);
+            EXPECT_EQ(*empty, "");
+            EXPECT_EQ(pool.size(), 3);
+
+            // pooled strings keep their addresses while the pool grows
+            for (u32 i = 0; i < 1000; i++)
+            {
+                pool.intern("string_" + std::to_string(i));
+            }
+            EXPECT_EQ(pool.size(), 1003);
+            EXPECT_EQ(pool.find("a"), a);
+            EXPECT_EQ(*a, "a");
+            EXPECT_EQ(pool.find("b"), b);
+            EXPECT_EQ(*pool.find("string_500"), "string_500");
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that threads interning the same strings at once receive the same pooled strings.
+     *
+     * Functions: intern, size
+     */
+    TEST_F(StringPoolTest, check_concurrent_intern)
+    {
+        TEST_START
+        {
+            const u32 num_threads = 4;
+            const u32 num_strings = 500;
+
+            StringPool pool;
+            std::vector<std::vector<const std::string*>> results(num_threads);
+            std::vector<std::thread> threads;
+            for (u32 t = 0; t < num_threads; t++)
+            {
+                threads.emplace_back([&pool, &results, t]() {
+                    for (u32 i = 0; i < num_strings; i++)
+                    {
+                        results.at(t).push_back(pool.intern("string_" + std::to_string(i)));
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            EXPECT_EQ(pool.size(), num_strings);
+            for (u32 t = 1; t < num_threads; t++)
+            {
+                EXPECT_EQ(results.at(t), results.at(0));
+            }
+        }
+        TEST_END
+    }
+}    // namespace hal
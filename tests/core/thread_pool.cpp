@@ -0,0 +1,202 @@
+#include "hal_core/utilities/thread_pool.h"
+#include "netlist_test_utils.h"
+
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+namespace hal
+{
+    class ThreadPoolTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+    };
+
+    /**
+     * Testing that every index of a parallel loop is processed exactly once, also when loops are nested and when the pool has a single worker.
+     *
+     * Functions: parallel_for, ThreadPool::set_num_threads, ThreadPool::get_num_threads
+     */
+    TEST_F(ThreadPoolTest, check_parallel_for)
+    {
+        TEST_START
+        {
+            // every index is visited exactly once, also for a range that does not start at zero
+            std::vector<std::atomic<u32>> visits(1000);
+            parallel_for(100, 1000, [&visits](u32 i) { visits[i]++; });
+            for (u32 i = 0; i < 1000; i++)
+            {
+                EXPECT_EQ(visits[i], (i < 100) ? 0 : 1);
+            }
+
+            // empty ranges do nothing
+            parallel_for(5, 5, [](u32) { FAIL(); });
+            parallel_for(5, 3, [](u32) { FAIL(); });
+        }
+        {
+            // nested loops on a pool with a single worker neither deadlock nor skip indices
+            ThreadPool pool(1);
+            EXPECT_EQ(pool.get_num_threads(), 1);
+
+            std::atomic<u32> sum = 0;
+            TaskGroup outer(pool);
+            parallel_for(outer, 0, 20, [&pool, &sum](u32 i) {
+                TaskGroup inner(pool);
+                parallel_for(inner, 0, 50, [&sum, i](u32 j) { sum += i * j; });
+            });
+            EXPECT_EQ(sum, 190 * 1225);
+
+            EXPECT_TRUE(pool.set_num_threads(3));
+            EXPECT_EQ(pool.get_num_threads(), 3);
+            EXPECT_TRUE(pool.set_num_threads(0));
+            EXPECT_EQ(pool.get_num_threads(), ThreadPool::get_default_num_threads());
+        }
+        {
+            // the number of threads cannot be changed from within a task
+            ThreadPool pool(2);
+            TaskGroup group(pool);
+            std::atomic<bool> changed = true;
+            group.run([&pool, &changed]() { changed = pool.set_num_threads(4); });
+            group.wait();
+            EXPECT_FALSE(changed);
+            EXPECT_EQ(pool.get_num_threads(), 2);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that map-reduce combines the values of all indices in order.
+     *
+     * Functions: parallel_map_reduce
+     */
+    TEST_F(ThreadPoolTest, check_parallel_map_reduce)
+    {
+        TEST_START
+        {
+            const u64 sum = parallel_map_reduce(
+                1, 100001, u64(0), [](u32 i) { return u64(i); }, [](u64 a, u64 b) { return a + b; });
+            EXPECT_EQ(sum, u64(100000) * 100001 / 2);
+
+            // concatenation is associative but not commutative, so the order of the chunks is preserved
+            const std::string text = parallel_map_reduce(
+                0, 500, std::string(), [](u32 i) { return std::string(1, char('a' + i % 26)); }, [](std::string a, const std::string& b) { return a + b; });
+            ASSERT_EQ(text.size(), 500);
+            for (u32 i = 0; i < 500; i++)
+            {
+                EXPECT_EQ(text[i], char('a' + i % 26));
+            }
+
+            const bool all_even = parallel_map_reduce(
+                0, 100, true, [](u32 i) { return i % 2 == 0; }, [](bool a, bool b) { return a && b; });
+            EXPECT_FALSE(all_even);
+
+            EXPECT_EQ(parallel_map_reduce(
+                          3, 3, 7, [](u32) { return 0; }, [](int a, int b) { return a + b; }),
+                      7);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing cancellation, exceptions and progress reporting of task groups.
+     *
+     * Functions: TaskGroup::run, TaskGroup::wait, TaskGroup::cancel, TaskGroup::is_cancelled, TaskGroup::get_num_tasks, TaskGroup::get_num_finished
+     */
+    TEST_F(ThreadPoolTest, check_task_group)
+    {
+        TEST_START
+        {
+            // indices after the cancellation are skipped
+            ThreadPool pool(2);
+            TaskGroup group(pool);
+            std::atomic<u32> processed = 0;
+            parallel_for(group, 0, 100000, [&group, &processed](u32) {
+                if (++processed == 100)
+                {
+                    group.cancel();
+                }
+            });
+            EXPECT_TRUE(group.is_cancelled());
+            EXPECT_LT(processed, 100000);
+            EXPECT_EQ(group.get_num_finished(), group.get_num_tasks());
+        }
+        {
+            // the exception of a task is rethrown by the waiting thread and cancels the group
+            ThreadPool pool(2);
+            TaskGroup group(pool);
+            group.run([]() { throw std::runtime_error("task failed"); });
+            EXPECT_THROW(group.wait(), std::runtime_error);
+            EXPECT_TRUE(group.is_cancelled());
+            EXPECT_NO_THROW(group.wait());
+        }
+        {
+            // progress is reported in increasing numbers of processed indices and ends with all of them
+            ThreadPool pool(2);
+            TaskGroup group(pool);
+            std::vector<u32> reported;
+            parallel_for(
+                group, 0, 1000, [](u32) {}, [&reported](u32 done, u32 total) {
+                    EXPECT_EQ(total, 1000);
+                    reported.push_back(done);
+                });
+            ASSERT_FALSE(reported.empty());
+            EXPECT_TRUE(std::is_sorted(reported.begin(), reported.end()));
+            EXPECT_EQ(reported.back(), 1000);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that a thread outside the pool executes the pending tasks in the order they were submitted in.
+     *
+     * Functions: ThreadPool::submit, ThreadPool::run_pending_task, ThreadPool::is_worker_thread
+     */
+    TEST_F(ThreadPoolTest, check_run_pending_task)
+    {
+        TEST_START
+        {
+            ThreadPool pool(1);
+            EXPECT_FALSE(pool.is_worker_thread());
+
+            // keep the only worker busy so that all further tasks are left to the calling thread
+            std::atomic<bool> started = false;
+            std::atomic<bool> release = false;
+            pool.submit([&started, &release]() {
+                started = true;
+                while (!release)
+                {
+                    std::this_thread::yield();
+                }
+            });
+            while (!started)
+            {
+                std::this_thread::yield();
+            }
+
+            std::vector<u32> order;
+            for (u32 i = 0; i < 5; i++)
+            {
+                pool.submit([&order, i]() { order.push_back(i); });
+            }
+            while (pool.run_pending_task())
+            {
+            }
+            release = true;
+
+            EXPECT_EQ(order, std::vector<u32>({0, 1, 2, 3, 4}));
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -1,11 +1,21 @@
 #include "netlist_test_utils.h"
 #include "gtest/gtest.h"
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/compiled_function.h"
 #include "hal_core/netlist/boolean_function/solver.h"
+#include "hal_core/netlist/boolean_function/equivalence_checker.h"
+#include "hal_core/netlist/boolean_function/simplification.h"
+#include "hal_core/netlist/boolean_function/solver_session.h"
 #include "hal_core/netlist/boolean_function/types.h"
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <iomanip>
 #include <iostream>
+#include <random>
+#include <sstream>
+#include <thread>
 #include <type_traits>
 #include <variant>
 
@@ -1070,6 +1080,124 @@ namespace hal {
         const auto duration_in_seconds = std::chrono::duration<double>(std::chrono::system_clock::now() - start).count();
     }
 
+    namespace {
+        /**
+         * Generates a corpus of gate-level functions, i.e., random And/Or/Xor/Not
+         * functions over up to six inputs. Each function is instantiated several
+         * times with distinct input names to mimic the gates of a netlist.
+         *
+         * @param[in] seed - The seed of the random generator.
+         * @param[in] num_types - The number of distinct functions.
+         * @param[in] num_instances - The number of instances per function.
+         * @returns The corpus of gate-level functions.
+         */
+        std::vector<BooleanFunction> generate_gate_functions(u32 seed, u32 num_types, u32 num_instances) {
+            std::mt19937 rng(seed);
+
+            std::function<BooleanFunction(u32, u32)> generate = [&](u32 num_inputs, u32 depth) -> BooleanFunction {
+                if (depth == 0 || rng() % 4 == 0) {
+                    return BooleanFunction::Var("I" + std::to_string(rng() % num_inputs));
+                }
+                switch (rng() % 4) {
+                    case 0:
+                        return generate(num_inputs, depth - 1) & generate(num_inputs, depth - 1);
+                    case 1:
+                        return generate(num_inputs, depth - 1) | generate(num_inputs, depth - 1);
+                    case 2:
+                        return generate(num_inputs, depth - 1) ^ generate(num_inputs, depth - 1);
+                    default:
+                        return ~generate(num_inputs, depth - 1);
+                }
+            };
+
+            std::vector<BooleanFunction> corpus;
+            for (u32 type = 0; type < num_types; type++) {
+                const auto function = generate(2 + rng() % 5, 5);
+                for (u32 instance = 0; instance < num_instances; instance++) {
+                    std::map<std::string, std::string> names;
+                    for (const auto& variable : function.get_variable_names()) {
+                        names[variable] = "gate_" + std::to_string(type) + "_" + std::to_string(instance) + "_" + variable;
+                    }
+                    corpus.push_back(function.substitute(names));
+                }
+            }
+            return corpus;
+        }
+
+        /**
+         * Simplifies all functions of a corpus using the given number of threads.
+         *
+         * @param[in] corpus - The corpus of functions.
+         * @param[in] num_threads - The number of threads.
+         * @returns The simplified functions.
+         */
+        std::vector<BooleanFunction> simplify_in_parallel(const std::vector<BooleanFunction>& corpus, u32 num_threads) {
+            std::vector<BooleanFunction> simplified(corpus.size());
+            std::atomic<u32> next{0};
+
+            std::vector<std::thread> workers;
+            for (u32 t = 0; t < num_threads; t++) {
+                workers.emplace_back([&]() {
+                    for (u32 i = next++; i < corpus.size(); i = next++) {
+                        simplified[i] = corpus[i].simplify();
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            return simplified;
+        }
+    }    // namespace
+
+    TEST(BooleanFunction, ParallelSimplification) {
+        const auto corpus = generate_gate_functions(0x5eed, 16, 8);
+
+        // reference results of a serial simplification, each without results cached from other functions
+        std::vector<BooleanFunction> expected;
+        for (const auto& function : corpus) {
+            Simplification::clear_abc_cache();
+            expected.push_back(function.simplify());
+        }
+
+        Simplification::clear_abc_cache();
+        const auto parallel = simplify_in_parallel(corpus, 4);
+
+        for (u32 i = 0; i < corpus.size(); i++) {
+            EXPECT_EQ(parallel[i], expected[i]) << corpus[i].to_string();
+
+            // the simplification preserves the semantics of the function
+            const auto variables = corpus[i].get_variable_names();
+            const std::vector<std::string> inputs(variables.begin(), variables.end());
+            for (u32 assignment = 0; assignment < (1u << inputs.size()); assignment++) {
+                std::unordered_map<std::string, BooleanFunction::Value> values;
+                for (u32 j = 0; j < inputs.size(); j++) {
+                    values[inputs[j]] = ((assignment >> j) & 1) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO;
+                }
+                EXPECT_EQ(corpus[i].evaluate(values).get(), parallel[i].evaluate(values).get()) << corpus[i].to_string() << " simplified to " << parallel[i].to_string();
+            }
+        }
+    }
+
+    TEST(BooleanFunction, DISABLED_ParallelSimplificationThroughput) {
+        // reports the throughput of the simplification on a corpus of gate-level
+        // functions for an increasing number of threads, the cache is cleared
+        // before each run so that no simplification results are shared between runs.
+        // The benchmark is disabled by default, run it with '--gtest_also_run_disabled_tests'.
+        const auto corpus     = generate_gate_functions(0x5eed, 32, 16);
+        const u32 max_threads = std::max(4u, std::thread::hardware_concurrency());
+        for (u32 num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+            Simplification::clear_abc_cache();
+
+            const auto start = std::chrono::steady_clock::now();
+            simplify_in_parallel(corpus, num_threads);
+            const auto duration_in_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << "[ simplify ] " << num_threads << " thread(s): " << corpus.size() << " functions in " << duration_in_seconds << "s ("
+                      << (corpus.size() / duration_in_seconds) << " functions/s)" << std::endl;
+        }
+    }
+
     TEST(BooleanFunction, Substitution) {
         const auto  a = BooleanFunction::Var("A"),
                     b = BooleanFunction::Var("B"),
@@ -1411,6 +1539,88 @@ namespace hal {
         }
     }
 
+    TEST(BooleanFunction, CompiledEvaluation) {
+        using Value = BooleanFunction::Value;
+
+        const auto a = BooleanFunction::Var("A"),
+                   b = BooleanFunction::Var("B"),
+                   c = BooleanFunction::Var("C"),
+                  _0 = BooleanFunction::Const(0, 1),
+                  _1 = BooleanFunction::Const(1, 1);
+
+        const std::vector<std::string> slots = {"A", "B", "C"};
+        const std::vector<Value> values = {Value::ZERO, Value::ONE, Value::X, Value::Z};
+
+        const std::vector<BooleanFunction> functions = {
+            a,
+            ~a,
+            a & b,
+            a | b,
+            a ^ b,
+            (a & b) | ~c,
+            ~(a ^ (b | c)) & (a | _0),
+            (a & _1) ^ (b & _0),
+            _1 | c,
+            BooleanFunction::Ite(a.clone(), b.clone(), c.clone(), 1).get(),
+        };
+
+        // the compiled form has to agree with the name-based evaluation for every assignment of all four values
+        for (const auto& function : functions) {
+            const auto compiled = CompiledBooleanFunction::compile(function, slots);
+            ASSERT_TRUE(compiled.is_ok()) << function.to_string();
+            EXPECT_EQ(compiled.get().get_slot_count(), 3u);
+
+            for (const auto va : values) {
+                for (const auto vb : values) {
+                    for (const auto vc : values) {
+                        const Value input[3] = {va, vb, vc};
+                        const auto expected = function.evaluate(std::unordered_map<std::string, Value>({{"A", va}, {"B", vb}, {"C", vc}}));
+                        ASSERT_TRUE(expected.is_ok());
+                        EXPECT_EQ(expected.get(), compiled.get().evaluate(input)) << function.to_string() << " with A=" << va << ", B=" << vb << ", C=" << vc;
+                    }
+                }
+            }
+        }
+
+        {
+            // evaluating all assignments of the three values side by side in one lane each has to agree with evaluating them one after another
+            const std::vector<Value> lane_values = {Value::ZERO, Value::ONE, Value::X};
+            for (const auto& function : functions) {
+                const auto compiled = CompiledBooleanFunction::compile(function, slots).get();
+
+                CompiledBooleanFunction::Lanes input[3];
+                for (u32 lane = 0; lane < 27; lane++) {
+                    input[0].set(lane, lane_values[lane % 3]);
+                    input[1].set(lane, lane_values[(lane / 3) % 3]);
+                    input[2].set(lane, lane_values[lane / 9]);
+                }
+
+                const auto result = compiled.evaluate(input);
+                for (u32 lane = 0; lane < 27; lane++) {
+                    const Value scalar_input[3] = {input[0].get(lane), input[1].get(lane), input[2].get(lane)};
+                    EXPECT_EQ(compiled.evaluate(scalar_input), result.get(lane)) << function.to_string() << " in lane " << lane;
+                }
+            }
+        }
+        {
+            // operations on constants are folded away during compilation
+            const auto compiled = CompiledBooleanFunction::compile((_1 & _0) | a, slots);
+            ASSERT_TRUE(compiled.is_ok());
+            EXPECT_EQ(compiled.get().get_instruction_count(), 1u);
+        }
+        {
+            // an empty function evaluates to X
+            const auto compiled = CompiledBooleanFunction::compile(BooleanFunction(), slots);
+            ASSERT_TRUE(compiled.is_ok());
+            const Value input[3] = {Value::ONE, Value::ONE, Value::ONE};
+            EXPECT_EQ(compiled.get().evaluate(input), Value::X);
+        }
+
+        EXPECT_TRUE(CompiledBooleanFunction::compile(a & BooleanFunction::Var("D"), slots).is_error());
+        EXPECT_TRUE(CompiledBooleanFunction::compile(BooleanFunction::Var("A", 4), slots).is_error());
+        EXPECT_TRUE(CompiledBooleanFunction::compile(BooleanFunction::Eq(a.clone(), b.clone(), 1).get(), slots).is_error());
+    }
+
     namespace {
         /**
          * Checks that simplifying a function does not change the value it computes for any input, by
@@ -1983,6 +2193,201 @@ namespace hal {
         }
     }
 
+    TEST(BooleanFunction, SolverSession) {
+        const auto  a = BooleanFunction::Var("A"),
+                    b = BooleanFunction::Var("B"),
+                    c = BooleanFunction::Var("C", 4),
+                   _0 = BooleanFunction::Const(0, 1),
+                   _1 = BooleanFunction::Const(1, 1);
+
+        const auto config = SMT::QueryConfig()
+            .with_solver(SMT::SolverType::Z3)
+            .with_local_solver()
+            .with_model_generation()
+            .with_timeout(1000);
+
+        if (!SMT::SolverSession::is_supported(config)) {
+            return;
+        }
+
+        {
+            // constraints persist across checks, assumptions and scoped constraints do not
+            auto session_res = SMT::SolverSession::start(config);
+            ASSERT_TRUE(session_res.is_ok());
+            auto session = session_res.get();
+
+            ASSERT_TRUE(session->add_constraints({SMT::Constraint(a.clone() | b.clone(), _1.clone())}).is_ok());
+            ASSERT_TRUE(session->push().is_ok());
+            ASSERT_TRUE(session->add_constraints({SMT::Constraint(a.clone(), _0.clone())}).is_ok());
+            EXPECT_EQ(session->get_num_scopes(), 1);
+
+            auto result = session->check({~b.clone()});
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_unsat());
+
+            result = session->check();
+            ASSERT_TRUE(result.is_ok());
+            ASSERT_TRUE(result.get().is_sat());
+            ASSERT_TRUE(result.get().model.has_value());
+            EXPECT_EQ(result.get().model->model.at("A"), std::make_tuple(u64(0), u16(1)));
+            EXPECT_EQ(result.get().model->model.at("B"), std::make_tuple(u64(1), u16(1)));
+
+            ASSERT_TRUE(session->pop().is_ok());
+            EXPECT_EQ(session->get_num_scopes(), 0);
+            EXPECT_TRUE(session->pop().is_error());
+
+            result = session->check({a.clone() & ~b.clone()});
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_sat());
+
+            // a query leaves the session unchanged, variables it declared are declared again by the next query
+            result = session->query({SMT::Constraint(a.clone(), _0.clone()), SMT::Constraint(b.clone(), _0.clone())});
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_unsat());
+            result = session->query({SMT::Constraint(BooleanFunction::Add(c.clone(), c.clone(), 4).get(), BooleanFunction::Const(3, 4))});
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_unsat());
+            result = session->query({SMT::Constraint(BooleanFunction::Add(c.clone(), c.clone(), 4).get(), BooleanFunction::Const(4, 4))});
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_sat());
+            EXPECT_EQ(session->get_num_scopes(), 0);
+            EXPECT_TRUE(session->is_alive());
+
+            // invalid input is reported without ending the session
+            EXPECT_TRUE(session->add_constraints({SMT::Constraint(c.clone(), _1.clone())}).is_error());
+            EXPECT_TRUE(session->is_alive());
+            result = session->check();
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_TRUE(result.get().is_sat());
+        }
+        {
+            // a pool shared by several threads never runs more sessions than allowed
+            SMT::SolverSessionPool pool(config, 2);
+            std::atomic<u32> num_errors = 0;
+            std::vector<std::thread> threads;
+            for (u32 t = 0; t < 4; t++) {
+                threads.emplace_back([&pool, &num_errors, &a, &b, &_0, &_1, t]() {
+                    for (u32 i = 0; i < 10; i++) {
+                        const bool expect_sat = ((t + i) % 2) == 0;
+                        auto result = pool.query({SMT::Constraint(a.clone() & b.clone(), _1.clone()), SMT::Constraint(a.clone(), expect_sat ? _1.clone() : _0.clone())});
+                        if (result.is_error() || result.get().is_sat() != expect_sat) {
+                            num_errors++;
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            EXPECT_EQ(num_errors, 0);
+            EXPECT_LE(pool.get_num_sessions(), 2);
+
+            // constraints a lessee adds to the scope it was handed out with do not reach the next lessee
+            SMT::SolverSessionPool single_pool(config, 1);
+            {
+                auto lease = single_pool.acquire();
+                ASSERT_TRUE(lease.is_ok());
+                EXPECT_EQ(lease.get()->get_num_scopes(), 1);
+                ASSERT_TRUE(lease.get()->add_constraints({SMT::Constraint(a.clone(), _0.clone())}).is_ok());
+                auto result = lease.get()->check({a.clone()});
+                ASSERT_TRUE(result.is_ok());
+                EXPECT_TRUE(result.get().is_unsat());
+                ASSERT_TRUE(lease.get()->push().is_ok());
+            }
+            {
+                auto lease = single_pool.acquire();
+                ASSERT_TRUE(lease.is_ok());
+                EXPECT_EQ(single_pool.get_num_sessions(), 1);
+                EXPECT_EQ(lease.get()->get_num_scopes(), 1);
+                auto result = lease.get()->check({a.clone()});
+                ASSERT_TRUE(result.is_ok());
+                EXPECT_TRUE(result.get().is_sat());
+            }
+        }
+    }
+
+    TEST(BooleanFunction, EquivalenceChecker) {
+        const auto a = BooleanFunction::Var("A"),
+                   b = BooleanFunction::Var("B"),
+                   x = BooleanFunction::Var("X", 8),
+                   y = BooleanFunction::Var("Y", 8),
+                   u = BooleanFunction::Var("U", 16),
+                   v = BooleanFunction::Var("V", 16);
+
+        const auto index = [](u16 value, u16 size) { return BooleanFunction::Index(value, size); };
+
+        SMT::EquivalenceChecker checker(SMT::QueryConfig().with_model_generation());
+
+        const auto expect_verdict = [&checker](const BooleanFunction& lhs, const BooleanFunction& rhs, bool equivalent, SMT::EquivalenceChecker::Stage stage) {
+            auto verdict = checker.check(lhs, rhs);
+            ASSERT_TRUE(verdict.is_ok());
+            EXPECT_EQ(verdict.get().is_equivalent(), equivalent) << lhs << " vs. " << rhs;
+            EXPECT_EQ(verdict.get().stage, stage) << lhs << " vs. " << rhs;
+            if (!equivalent) {
+                // the distinguishing assignment has to tell both functions apart
+                ASSERT_TRUE(verdict.get().result.model.has_value());
+                const auto& model = verdict.get().result.model.value();
+                EXPECT_NE(model.evaluate(lhs).get(), model.evaluate(rhs).get()) << lhs << " vs. " << rhs;
+            }
+        };
+
+        {
+            // supports of up to 16 input bits are decided by their truth tables
+            const auto truth_table = SMT::EquivalenceChecker::Stage::TruthTable;
+
+            expect_verdict(a & b, b & a, true, truth_table);
+            expect_verdict(a ^ b, (a | b) & ~(a & b), true, truth_table);
+            expect_verdict(a & b, a | b, false, truth_table);
+            expect_verdict(a, a | BooleanFunction::Const(0, 1), true, truth_table);
+            expect_verdict(x + y, y + x, true, truth_table);
+            expect_verdict(x - y, x + (~y + BooleanFunction::Const(1, 8)), true, truth_table);
+            expect_verdict(x * y, y * x, true, truth_table);
+            expect_verdict(x * BooleanFunction::Const(2, 8), BooleanFunction::Shl(x.clone(), index(1, 8), 8).get(), true, truth_table);
+            expect_verdict(x * y, x + y, false, truth_table);
+            expect_verdict(BooleanFunction::Rol(x.clone(), index(3, 8), 8).get(), BooleanFunction::Ror(x.clone(), index(5, 8), 8).get(), true, truth_table);
+            expect_verdict(BooleanFunction::Lshr(x.clone(), index(2, 8), 8).get(), BooleanFunction::Ashr(x.clone(), index(2, 8), 8).get(), false, truth_table);
+            expect_verdict(BooleanFunction::Slice(BooleanFunction::Concat(x.clone(), y.clone(), 16).get(), index(0, 16), index(7, 16), 8).get(), y, true, truth_table);
+            expect_verdict(BooleanFunction::Zext(x.clone(), index(16, 16), 16).get(), BooleanFunction::Sext(x.clone(), index(16, 16), 16).get(), false, truth_table);
+            expect_verdict(BooleanFunction::Ult(x.clone(), y.clone(), 1).get(), ~BooleanFunction::Ule(y.clone(), x.clone(), 1).get(), true, truth_table);
+            expect_verdict(BooleanFunction::Sle(x.clone(), y.clone(), 1).get(), ~BooleanFunction::Slt(y.clone(), x.clone(), 1).get(), true, truth_table);
+            expect_verdict(BooleanFunction::Slt(x.clone(), y.clone(), 1).get(), BooleanFunction::Ult(x.clone(), y.clone(), 1).get(), false, truth_table);
+            expect_verdict(BooleanFunction::Eq(x.clone(), y.clone(), 1).get(), ~BooleanFunction::Eq(x - y, BooleanFunction::Const(0, 8), 1).get(), false, truth_table);
+            expect_verdict(BooleanFunction::Ite(a.clone(), x.clone(), ~x, 8).get(), BooleanFunction::Ite(~a, ~x, x.clone(), 8).get(), true, truth_table);
+        }
+
+        {
+            // larger supports are refuted by random simulation
+            const auto simulation = SMT::EquivalenceChecker::Stage::Simulation;
+
+            expect_verdict(u + v, u | v, false, simulation);
+            expect_verdict(u * v, u * v + BooleanFunction::Const(1, 16), false, simulation);
+            expect_verdict(BooleanFunction::Eq(u.clone(), v.clone(), 1).get(), BooleanFunction::Const(0, 1), false, simulation);
+        }
+
+        {
+            // sizes have to match
+            EXPECT_TRUE(checker.check(x, u).is_error());
+        }
+
+        const auto statistics = checker.get_statistics();
+        EXPECT_EQ(statistics.truth_table_equivalent, 12);
+        EXPECT_EQ(statistics.truth_table_different, 6);
+        EXPECT_EQ(statistics.simulation_different, 3);
+        EXPECT_EQ(statistics.get_num_filtered(), statistics.get_num_checks());
+
+        checker.reset_statistics();
+        EXPECT_EQ(checker.get_statistics().get_num_checks(), 0);
+
+        if (SMT::Solver::has_local_solver_for(SMT::SolverType::Z3, SMT::SolverCall::Binary)) {
+            // pairs that agree on all simulated assignments and functions that cannot be simulated are handed to the solver
+            const auto solver = SMT::EquivalenceChecker::Stage::Solver;
+
+            expect_verdict(u + v, v + u, true, solver);
+            expect_verdict(BooleanFunction::Udiv(x.clone(), y.clone(), 8).get(), BooleanFunction::Udiv(x.clone(), y.clone(), 8).get(), true, solver);
+            EXPECT_EQ(checker.get_statistics().solver_equivalent, 2);
+        }
+    }
+
     TEST(BooleanFunction, FunctionConstraint) {
         const auto  a = BooleanFunction::Var("A"),
                     b = BooleanFunction::Var("B"),
@@ -2156,4 +2561,44 @@ namespace hal {
             }
         }
     }
+
+    TEST(BooleanFunction, ModelParsing) {
+        const std::string z3_model = "(\n  (define-fun A () (_ BitVec 1)\n    #b1)\n  (define-fun B () (_ BitVec 4)\n    #xa)\n  (define-fun CD () (_ BitVec 8) #b00101010)\n)";
+        const std::string boolector_model = "(model (define-fun A () (_ BitVec 1) #b1)(define-fun B () (_ BitVec 4) #b1010)(define-fun CD () (_ BitVec 8) #x2a))";
+        const auto expected = SMT::Model({{"A", {1, 1}}, {"B", {10, 4}}, {"CD", {42, 8}}});
+
+        EXPECT_EQ(SMT::Model::parse(z3_model, SMT::SolverType::Z3).get(), expected);
+        EXPECT_EQ(SMT::Model::parse(boolector_model, SMT::SolverType::Boolector).get(), expected);
+        EXPECT_TRUE(SMT::Model::parse("(define-fun A () (_ BitVec 1) #b1", SMT::SolverType::Z3).is_error());
+
+        // extraction of a subset of the variables
+        for (const auto& [model_str, type] : std::vector<std::pair<std::string, SMT::SolverType>>{{z3_model, SMT::SolverType::Z3}, {boolector_model, SMT::SolverType::Boolector}}) {
+            EXPECT_EQ(SMT::Model::parse(model_str, type, {"B"}).get(), SMT::Model(std::map<std::string, std::tuple<u64, u16>>{{"B", {10, 4}}}));
+            EXPECT_EQ(SMT::Model::parse(model_str, type, {"A", "CD"}).get(), SMT::Model({{"A", {1, 1}}, {"CD", {42, 8}}}));
+            EXPECT_EQ(SMT::Model::parse(model_str, type, {"C", "X"}).get(), SMT::Model());
+            EXPECT_EQ(SMT::Model::parse(model_str, type, {}).get(), SMT::Model());
+        }
+        EXPECT_TRUE(SMT::Model::parse("(model (define-fun A () (_ BitVec 1) #b2))", SMT::SolverType::Boolector, {"A"}).is_error());
+
+        // concurrent parsing
+        std::vector<std::thread> workers;
+        std::atomic<u32> failures{0};
+        for (u32 t = 0; t < 4; t++) {
+            workers.emplace_back([&, t]() {
+                for (u32 i = 0; i < 250; i++) {
+                    const auto value = t * 1000 + i;
+                    std::stringstream hex;
+                    hex << std::hex << std::setw(4) << std::setfill('0') << value;
+                    const auto model = SMT::Model::parse("((define-fun V" + std::to_string(t) + " () (_ BitVec 16) #x" + hex.str() + "))", SMT::SolverType::Z3);
+                    if (model.is_error() || model.get() != SMT::Model(std::map<std::string, std::tuple<u64, u16>>{{"V" + std::to_string(t), {value, 16}}})) {
+                        failures++;
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        EXPECT_EQ(failures, 0);
+    }
 } //namespace hal
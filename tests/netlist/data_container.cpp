@@ -1,4 +1,5 @@
 #include "hal_core/netlist/data_container.h"
+#include "hal_core/utilities/string_pool.h"
 
 #include "netlist_test_utils.h"
 
@@ -233,4 +234,103 @@ TEST_F(DataContainerTest, check_get_data)
 
     TEST_END
 }
+
+/**
+     * Testing that equal strings of different containers are stored once in the global string pool, and that lookups of unknown strings do not add them to the pool.
+     *
+     * Functions: set_data, has_data, get_data
+     */
+TEST_F(DataContainerTest, check_string_interning)
+{
+    TEST_START
+    StringPool& pool = StringPool::get_global();
+
+    TestDataContainer d_cont_0;
+    TestDataContainer d_cont_1;
+    d_cont_0.set_data("interning_category", "interning_key", "interning_type", "value_0");
+    const u64 pool_size = pool.size();
+    d_cont_1.set_data("interning_category", "interning_key", "interning_type", "value_1");
+    EXPECT_EQ(pool.size(), pool_size);
+
+    const std::string* category = pool.find("interning_category");
+    ASSERT_NE(category, nullptr);
+    EXPECT_EQ(pool.intern(std::string("interning_") + "category"), category);
+
+    // the values are stored per container
+    EXPECT_EQ(d_cont_0.get_data("interning_category", "interning_key"), std::make_tuple("interning_type", "value_0"));
+    EXPECT_EQ(d_cont_1.get_data("interning_category", "interning_key"), std::make_tuple("interning_type", "value_1"));
+
+    EXPECT_FALSE(d_cont_0.has_data("interning_category", "interning_unknown_key"));
+    EXPECT_EQ(d_cont_0.get_data("interning_unknown_category", "interning_key"), m_empty_pair);
+    EXPECT_TRUE(d_cont_0.delete_data("interning_unknown_category", "interning_unknown_key"));
+    EXPECT_EQ(pool.find("interning_unknown_category"), nullptr);
+    EXPECT_EQ(pool.find("interning_unknown_key"), nullptr);
+    EXPECT_EQ(pool.size(), pool_size);
+
+    TEST_END
+}
+
+/**
+     * Testing that overwriting an entry replaces its type and value, and that deleting it leaves the other entries untouched.
+     *
+     * Functions: set_data, get_data, has_data, delete_data, operator==
+     */
+TEST_F(DataContainerTest, check_overwrite_and_delete)
+{
+    TEST_START
+    TestDataContainer d_cont;
+    d_cont.set_data("category_0", "key_0", "data_type_0", "value_0");
+    d_cont.set_data("category_0", "key_1", "data_type_1", "value_1");
+    d_cont.set_data("category_1", "key_0", "data_type_2", "value_2");
+
+    d_cont.set_data("category_0", "key_0", "data_type_3", "value_3");
+    EXPECT_EQ(d_cont.get_data("category_0", "key_0"), std::make_tuple("data_type_3", "value_3"));
+    EXPECT_EQ(d_cont.get_data_map().size(), 3);
+
+    EXPECT_TRUE(d_cont.delete_data("category_0", "key_0"));
+    EXPECT_FALSE(d_cont.has_data("category_0", "key_0"));
+    EXPECT_EQ(d_cont.get_data("category_0", "key_0"), m_empty_pair);
+    EXPECT_EQ(d_cont.get_data("category_0", "key_1"), std::make_tuple("data_type_1", "value_1"));
+    EXPECT_EQ(d_cont.get_data("category_1", "key_0"), std::make_tuple("data_type_2", "value_2"));
+
+    // containers with the same entries are equal regardless of the order in which the entries were set
+    TestDataContainer other;
+    other.set_data("category_1", "key_0", "data_type_2", "value_2");
+    other.set_data("category_0", "key_1", "data_type_1", "value_1");
+    EXPECT_TRUE(d_cont == other);
+
+    other.set_data("category_0", "key_1", "data_type_1", "value_4");
+    EXPECT_TRUE(d_cont != other);
+
+    TEST_END
+}
+
+/**
+     * Testing that get_data_map returns a copy that is independent of the container.
+     *
+     * Functions: get_data_map, set_data_map
+     */
+TEST_F(DataContainerTest, check_get_data_map_copy)
+{
+    TEST_START
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> data;
+    {
+        TestDataContainer d_cont;
+        d_cont.set_data("category_0", "key_0", "data_type_0", "value_0");
+
+        data = d_cont.get_data_map();
+        std::get<1>(data.at(std::make_tuple("category_0", "key_0"))) = "value_1";
+        EXPECT_EQ(d_cont.get_data("category_0", "key_0"), std::make_tuple("data_type_0", "value_0"));
+
+        d_cont.delete_data("category_0", "key_0");
+    }
+    EXPECT_EQ(data.at(std::make_tuple("category_0", "key_0")), std::make_tuple("data_type_0", "value_1"));
+
+    TestDataContainer d_cont;
+    d_cont.set_data_map(data);
+    EXPECT_EQ(d_cont.get_data("category_0", "key_0"), std::make_tuple("data_type_0", "value_1"));
+    EXPECT_EQ(d_cont.get_data_map(), data);
+
+    TEST_END
+}
 }
@@ -4,6 +4,8 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "netlist_test_utils.h"
 
+#include <chrono>
+
 namespace hal {
 
     using test_utils::MIN_MODULE_ID;
@@ -1677,4 +1679,227 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing the ancestry queries after every kind of hierarchy modification against the submodules collected by a traversal.
+     *
+     * Functions: is_parent_module_of, is_submodule_of, contains_gate, set_parent_module, delete_module
+     */
+    TEST_F(ModuleTest, check_hierarchy_index) {
+        TEST_START
+            auto nl = test_utils::create_empty_netlist();
+            Module* top_module = nl->get_top_module();
+
+            auto check_hierarchy = [&nl]() {
+                for (Module* ancestor : nl->get_modules())
+                {
+                    const auto descendants = ancestor->get_submodules(nullptr, true);
+                    for (Module* mod : nl->get_modules())
+                    {
+                        const bool expected = std::find(descendants.begin(), descendants.end(), mod) != descendants.end();
+                        EXPECT_EQ(ancestor->is_parent_module_of(mod, true), expected) << ancestor->get_name() << " / " << mod->get_name();
+                        EXPECT_EQ(mod->is_submodule_of(ancestor, true), expected) << mod->get_name() << " / " << ancestor->get_name();
+                    }
+                    for (Gate* gate : nl->get_gates())
+                    {
+                        const bool expected = gate->get_module() == ancestor || std::find(descendants.begin(), descendants.end(), gate->get_module()) != descendants.end();
+                        EXPECT_EQ(ancestor->contains_gate(gate, true), expected) << ancestor->get_name() << " / " << gate->get_name();
+                    }
+                }
+            };
+
+            Module* m_0 = nl->create_module("m_0", top_module);
+            Module* m_1 = nl->create_module("m_1", m_0);
+            Module* m_2 = nl->create_module("m_2", m_1);
+            Module* m_3 = nl->create_module("m_3", top_module);
+            Module* m_4 = nl->create_module("m_4", m_3);
+            for (Module* mod : {top_module, m_0, m_1, m_2, m_3, m_4})
+            {
+                Gate* gate = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("BUF"), "gate_" + mod->get_name());
+                ASSERT_NE(gate, nullptr);
+                if (mod != top_module)
+                {
+                    ASSERT_TRUE(mod->assign_gate(gate));
+                }
+            }
+            check_hierarchy();
+
+            // move a subtree
+            ASSERT_TRUE(m_1->set_parent_module(m_4));
+            check_hierarchy();
+
+            // move a module below one of its own submodules
+            ASSERT_TRUE(m_3->set_parent_module(m_2));
+            check_hierarchy();
+
+            // delete a module with submodules
+            ASSERT_TRUE(nl->delete_module(m_1));
+            check_hierarchy();
+
+            // create a module below a leaf
+            Module* m_5 = nl->create_module("m_5", m_4);
+            ASSERT_NE(m_5, nullptr);
+            check_hierarchy();
+
+            // modules of other netlists are never related
+            auto other_nl = test_utils::create_empty_netlist();
+            EXPECT_FALSE(top_module->is_parent_module_of(other_nl->get_top_module(), true));
+            EXPECT_FALSE(other_nl->get_top_module()->is_submodule_of(top_module, true));
+        TEST_END
+    }
+
+    /**
+     * Testing the nets and gates of a chain of nested modules after the chain is split and one of its modules is deleted.
+     * Module 'm_i' holds the gates 'g_i_0' and 'g_i_1', which are connected by a net within the module, and net 'n_i' connects 'g_i_1' to 'g_(i+1)_0' of the next module.
+     *
+     * Functions: get_input_nets, get_output_nets, contains_gate, is_parent_module_of, set_parent_module, delete_module
+     */
+    TEST_F(ModuleTest, check_deep_hierarchy) {
+        TEST_START
+            const u32 num_modules = 6;
+
+            auto nl            = test_utils::create_empty_netlist();
+            GateType* buf      = nl->get_gate_library()->get_gate_type_by_name("BUF");
+            Module* top_module = nl->get_top_module();
+            ASSERT_NE(buf, nullptr);
+
+            std::vector<Module*> modules;
+            std::vector<std::pair<Gate*, Gate*>> gates;
+            std::vector<Net*> nets;
+            for (u32 i = 0; i < num_modules; i++)
+            {
+                Module* mod = nl->create_module("m_" + std::to_string(i), (i == 0) ? top_module : modules.back());
+                ASSERT_NE(mod, nullptr);
+                Gate* g_0 = nl->create_gate(buf, "g_" + std::to_string(i) + "_0");
+                Gate* g_1 = nl->create_gate(buf, "g_" + std::to_string(i) + "_1");
+                ASSERT_TRUE(mod->assign_gates({g_0, g_1}));
+                test_utils::connect(nl.get(), g_0, "O", g_1, "I");
+                if (i > 0)
+                {
+                    Net* net = test_utils::connect(nl.get(), gates.back().second, "O", g_0, "I");
+                    ASSERT_NE(net, nullptr);
+                    nets.push_back(net);
+                }
+                modules.push_back(mod);
+                gates.push_back({g_0, g_1});
+            }
+
+            // every module contains the gates of all deeper modules, and only the net from its parent enters it
+            for (u32 i = 0; i < num_modules; i++)
+            {
+                for (u32 j = 0; j < num_modules; j++)
+                {
+                    EXPECT_EQ(modules.at(i)->contains_gate(gates.at(j).first, true), j >= i) << i << " / " << j;
+                    EXPECT_EQ(modules.at(i)->contains_gate(gates.at(j).first, false), j == i) << i << " / " << j;
+                    EXPECT_EQ(modules.at(i)->is_parent_module_of(modules.at(j), true), j > i) << i << " / " << j;
+                }
+                EXPECT_EQ(modules.at(i)->get_input_nets(), (i == 0) ? std::unordered_set<Net*>() : std::unordered_set<Net*>({nets.at(i - 1)}));
+                EXPECT_TRUE(modules.at(i)->get_output_nets().empty());
+            }
+
+            // split the chain below m_2, so that net n_2 leaves m_0, m_1 and m_2 and enters m_3
+            ASSERT_TRUE(modules.at(3)->set_parent_module(top_module));
+            for (u32 i = 0; i < num_modules; i++)
+            {
+                for (u32 j = 0; j < num_modules; j++)
+                {
+                    EXPECT_EQ(modules.at(i)->contains_gate(gates.at(j).second, true), (i < 3) ? (j >= i && j < 3) : (j >= i)) << i << " / " << j;
+                }
+                EXPECT_EQ(modules.at(i)->get_output_nets(), (i < 3) ? std::unordered_set<Net*>({nets.at(2)}) : std::unordered_set<Net*>());
+            }
+            EXPECT_EQ(modules.at(3)->get_input_nets(), std::unordered_set<Net*>({nets.at(2)}));
+            EXPECT_FALSE(modules.at(0)->is_parent_module_of(modules.at(5), true));
+            EXPECT_TRUE(modules.at(3)->is_parent_module_of(modules.at(5), true));
+
+            // deleting m_4 moves its gates to m_3 and makes m_5 a submodule of m_3
+            ASSERT_TRUE(nl->delete_module(modules.at(4)));
+            EXPECT_EQ(gates.at(4).first->get_module(), modules.at(3));
+            EXPECT_EQ(modules.at(5)->get_parent_module(), modules.at(3));
+            EXPECT_TRUE(modules.at(3)->contains_gate(gates.at(4).second, false));
+            EXPECT_TRUE(modules.at(3)->contains_gate(gates.at(5).second, true));
+            EXPECT_FALSE(modules.at(5)->contains_gate(gates.at(4).second, true));
+            EXPECT_EQ(modules.at(3)->get_input_nets(), std::unordered_set<Net*>({nets.at(2)}));
+            EXPECT_EQ(modules.at(5)->get_input_nets(), std::unordered_set<Net*>({nets.at(4)}));
+            EXPECT_TRUE(modules.at(3)->get_output_nets().empty());
+        TEST_END
+    }
+
+    /**
+     * Reports the time it takes to build a deep module hierarchy over a netlist of one million gates.
+     * Every module of the hierarchy is a submodule of the previous one and receives an equal share of the gates, the shares are then connected to each other, which checks every connected net against all modules above it.
+     * The benchmark is disabled by default, run it with '--gtest_also_run_disabled_tests'.
+     *
+     * Functions: assign_gates, is_parent_module_of, contains_gate
+     */
+    TEST_F(ModuleTest, DISABLED_check_deep_hierarchy_performance) {
+        TEST_START
+            const u32 num_gates   = 1000000;
+            const u32 num_modules = 1000;
+
+            auto nl       = test_utils::create_empty_netlist();
+            GateType* buf = nl->get_gate_library()->get_gate_type_by_name("BUF");
+            ASSERT_NE(buf, nullptr);
+
+            std::vector<Gate*> gates;
+            gates.reserve(num_gates);
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                gates.push_back(nl->create_gate(buf, "gate_" + std::to_string(i)));
+            }
+
+            auto start     = std::chrono::steady_clock::now();
+            Module* parent = nl->get_top_module();
+            std::vector<Module*> modules;
+            for (u32 i = 0; i < num_modules; i++)
+            {
+                Module* mod = nl->create_module("module_" + std::to_string(i), parent);
+                ASSERT_NE(mod, nullptr);
+                const auto first = gates.begin() + (u64)i * num_gates / num_modules;
+                const auto last  = gates.begin() + (u64)(i + 1) * num_gates / num_modules;
+                ASSERT_TRUE(mod->assign_gates(std::vector<Gate*>(first, last)));
+                modules.push_back(mod);
+                parent = mod;
+            }
+
+            std::cout << "[ hierarchy ] assigned " << num_gates << " gates to " << num_modules << " nested modules in "
+                      << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << "s" << std::endl;
+
+            // connect the last gate of every module to the first gate of the next one
+            start = std::chrono::steady_clock::now();
+            for (u32 i = 0; i + 1 < num_modules; i++)
+            {
+                Net* net = nl->create_net("net_" + std::to_string(i));
+                ASSERT_NE(net, nullptr);
+                ASSERT_NE(net->add_source(gates.at((u64)(i + 1) * num_gates / num_modules - 1), "O"), nullptr);
+                ASSERT_NE(net->add_destination(gates.at((u64)(i + 1) * num_gates / num_modules), "I"), nullptr);
+            }
+
+            std::cout << "[ hierarchy ] connected " << num_modules << " nested modules in " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << "s" << std::endl;
+
+            // every nested module contains the remainder of the chain, which is only entered by a single net
+            for (u32 i = 1; i < num_modules; i++)
+            {
+                EXPECT_EQ(modules.at(i)->get_input_nets().size(), 1);
+                EXPECT_TRUE(modules.at(i)->get_output_nets().empty());
+            }
+
+            start     = std::chrono::steady_clock::now();
+            u64 found = 0;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                found += modules.at(i % num_modules)->contains_gate(gates[i], true);
+            }
+
+            std::cout << "[ hierarchy ] answered " << num_gates << " containment queries in " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << "s"
+                      << std::endl;
+
+            // gate i is contained in module j (recursively) iff it belongs to module j or to one of its descendants
+            u64 expected = 0;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                expected += (u64)i * num_modules / num_gates >= i % num_modules;
+            }
+            EXPECT_EQ(found, expected);
+        TEST_END
+    }
+
 } //namespace hal
@@ -5,6 +5,16 @@
 #include "netlist_test_utils.h"
 #include "gate_library_test_utils.h"
 
+#include <chrono>
+#include <map>
+#include <set>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <fstream>
+#include <unistd.h>
+#endif
+
 namespace hal {
     using test_utils::MIN_NETLIST_ID;
     using test_utils::MIN_MODULE_ID;
@@ -12,6 +22,27 @@ namespace hal {
     using test_utils::MIN_NET_ID;
     using test_utils::MIN_GROUPING_ID;
 
+    namespace
+    {
+        /**
+         * Get the number of bytes of the process that currently reside in memory.
+         *
+         * @returns The resident memory in bytes, or 0 if it cannot be determined on this platform.
+         */
+        u64 get_resident_memory()
+        {
+#ifdef __linux__
+            std::ifstream statm("/proc/self/statm");
+            u64 size     = 0;
+            u64 resident = 0;
+            statm >> size >> resident;
+            return resident * (u64)sysconf(_SC_PAGESIZE);
+#else
+            return 0;
+#endif
+        }
+    }    // namespace
+
     class NetlistTest : public ::testing::Test {
     protected:
         virtual void SetUp() {
@@ -1698,4 +1729,431 @@ namespace hal {
         TEST_END
     }
 
+    namespace
+    {
+        /**
+         * Builds a chain of buffers in the top module of the given netlist and applies a fixed sequence of modifications to it that affect the nets and pins of several modules.
+         *
+         * @param[in] nl - The netlist.
+         * @param[in] num_gates - The number of buffers.
+         */
+        void apply_module_modifications(Netlist* nl, u32 num_gates)
+        {
+            GateType* buf = nl->get_gate_library()->get_gate_type_by_name("BUF");
+            std::vector<Gate*> gates;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                gates.push_back(nl->create_gate(i + 1, buf, "gate_" + std::to_string(i)));
+            }
+            for (u32 i = 0; i + 1 < num_gates; i++)
+            {
+                Net* net = nl->create_net(i + 1, "net_" + std::to_string(i));
+                net->add_source(gates.at(i), "O");
+                net->add_destination(gates.at(i + 1), "I");
+            }
+            nl->mark_global_input_net(nl->create_net(num_gates, "in"));
+            nl->get_net_by_id(num_gates)->add_destination(gates.front(), "I");
+
+            Module* m_0 = nl->create_module(2, "m_0", nl->get_top_module());
+            Module* m_1 = nl->create_module(3, "m_1", m_0);
+            Module* m_2 = nl->create_module(4, "m_2", nl->get_top_module());
+
+            m_0->assign_gates(std::vector<Gate*>(gates.begin(), gates.begin() + num_gates / 2));
+            m_1->assign_gates(std::vector<Gate*>(gates.begin() + num_gates / 4, gates.begin() + num_gates / 2));
+            m_2->assign_gates(std::vector<Gate*>(gates.begin() + num_gates / 2, gates.end()));
+
+            // move a module, cut the chain, and drive the end of the chain from the middle
+            m_1->set_parent_module(m_2);
+            nl->delete_net(nl->get_net_by_id(num_gates / 2));
+            nl->get_net_by_id(num_gates / 4)->add_destination(gates.at(num_gates / 2), "I");
+            nl->mark_global_output_net(nl->get_net_by_id(num_gates - 1));
+        }
+
+        /**
+         * Describes the nets and pins of a module by net IDs, independent of the IDs and the order of the pins.
+         *
+         * @param[in] mod - The module.
+         * @returns The input, output, and internal nets as well as the nets and directions of the pins.
+         */
+        std::tuple<std::set<u32>, std::set<u32>, std::set<u32>, std::set<std::pair<u32, PinDirection>>> get_module_nets(const Module* mod)
+        {
+            std::set<u32> input_nets, output_nets, internal_nets;
+            std::set<std::pair<u32, PinDirection>> pins;
+            for (const Net* net : mod->get_input_nets())
+            {
+                input_nets.insert(net->get_id());
+            }
+            for (const Net* net : mod->get_output_nets())
+            {
+                output_nets.insert(net->get_id());
+            }
+            for (const Net* net : mod->get_internal_nets())
+            {
+                internal_nets.insert(net->get_id());
+            }
+            for (const ModulePin* pin : mod->get_pins())
+            {
+                pins.insert({pin->get_net()->get_id(), pin->get_direction()});
+            }
+            return {input_nets, output_nets, internal_nets, pins};
+        }
+    }    // namespace
+
+    /**
+     * Testing that modifications within a transaction update the nets and pins of the modules only on commit and that the result does not differ from the immediate updates.
+     *
+     * Functions: begin_transaction, commit_transaction, is_transaction_active, NetlistTransaction
+     */
+    TEST_F(NetlistTest, check_transaction) {
+        TEST_START
+            const u32 num_gates = 40;
+            {
+                // a transaction yields the same module nets and pins as the immediate updates
+                auto nl_reference = test_utils::create_empty_netlist();
+                apply_module_modifications(nl_reference.get(), num_gates);
+
+                auto nl = test_utils::create_empty_netlist();
+                std::map<Module*, u32> pin_events;
+                nl->get_event_handler()->register_callback("pin_listener", std::function<void(ModuleEvent::event, Module*, u32)>([&pin_events](ModuleEvent::event ev, Module* m, u32 data) {
+                                                               if (ev == ModuleEvent::event::pin_changed)
+                                                               {
+                                                                   EXPECT_EQ(data & 0xF, (u32)PinEvent::PinsReload);
+                                                                   pin_events[m]++;
+                                                               }
+                                                           }));
+
+                EXPECT_FALSE(nl->is_transaction_active());
+                nl->begin_transaction();
+                EXPECT_TRUE(nl->is_transaction_active());
+                apply_module_modifications(nl.get(), num_gates);
+
+                // the modules are not updated before the commit
+                EXPECT_TRUE(pin_events.empty());
+                EXPECT_TRUE(nl->get_module_by_id(2)->get_input_nets().empty());
+                EXPECT_TRUE(nl->get_module_by_id(2)->get_pins().empty());
+
+                ASSERT_TRUE(nl->commit_transaction().is_ok());
+                EXPECT_FALSE(nl->is_transaction_active());
+
+                for (const Module* reference_module : nl_reference->get_modules())
+                {
+                    const Module* mod = nl->get_module_by_id(reference_module->get_id());
+                    ASSERT_NE(mod, nullptr);
+                    EXPECT_EQ(get_module_nets(mod), get_module_nets(reference_module)) << mod->get_name();
+                }
+
+                // every module with pins got a single reload event
+                for (Module* mod : nl->get_modules())
+                {
+                    EXPECT_EQ(pin_events[mod], mod->get_pins().empty() ? 0 : 1) << mod->get_name();
+                }
+                nl->get_event_handler()->unregister_callback("pin_listener");
+            }
+            {
+                // nested transactions are only committed by the outermost commit
+                auto nl_reference = test_utils::create_empty_netlist();
+                apply_module_modifications(nl_reference.get(), num_gates);
+
+                auto nl = test_utils::create_empty_netlist();
+                {
+                    NetlistTransaction outer(nl.get());
+                    {
+                        NetlistTransaction inner(nl.get());
+                        apply_module_modifications(nl.get(), num_gates);
+                    }
+                    EXPECT_TRUE(nl->is_transaction_active());
+                    EXPECT_TRUE(nl->get_module_by_id(2)->get_input_nets().empty());
+                    ASSERT_TRUE(outer.commit().is_ok());
+                    EXPECT_FALSE(nl->is_transaction_active());
+                }
+                EXPECT_FALSE(nl->is_transaction_active());
+
+                for (const Module* reference_module : nl_reference->get_modules())
+                {
+                    EXPECT_EQ(get_module_nets(nl->get_module_by_id(reference_module->get_id())), get_module_nets(reference_module)) << reference_module->get_name();
+                }
+            }
+            {
+                // a transaction does not hold back the pin events of other netlists
+                auto nl       = test_utils::create_empty_netlist();
+                auto nl_other = test_utils::create_empty_netlist();
+                u32 num_pin_events = 0;
+                nl_other->get_event_handler()->register_callback("pin_listener", std::function<void(ModuleEvent::event, Module*, u32)>([&num_pin_events](ModuleEvent::event ev, Module*, u32) {
+                                                                     if (ev == ModuleEvent::event::pin_changed)
+                                                                     {
+                                                                         num_pin_events++;
+                                                                     }
+                                                                 }));
+
+                NetlistTransaction transaction(nl.get());
+                apply_module_modifications(nl_other.get(), num_gates);
+                EXPECT_GT(num_pin_events, 0);
+                EXPECT_FALSE(nl_other->get_module_by_id(2)->get_pins().empty());
+
+                const u32 num_pin_events_before_commit = num_pin_events;
+                ASSERT_TRUE(transaction.commit().is_ok());
+                EXPECT_EQ(num_pin_events, num_pin_events_before_commit);
+                nl_other->get_event_handler()->unregister_callback("pin_listener");
+            }
+            {
+                // committing without a transaction fails
+                auto nl = test_utils::create_empty_netlist();
+                EXPECT_TRUE(nl->commit_transaction().is_error());
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing that the events emitted during a bulk are recorded and handed to the bulk callbacks once the outermost bulk ends.
+     *
+     * Functions: begin_bulk, end_bulk, is_bulk_active, register_callback, EventBulkScope
+     */
+    TEST_F(NetlistTest, check_bulk_events) {
+        TEST_START
+            using IdPairs = std::set<std::pair<u32, u32>>;
+            {
+                // events within nested bulks are recorded once and the single gate events are still emitted
+                auto nl = test_utils::create_empty_netlist();
+                EventHandler* eh = nl->get_event_handler();
+                GateType* buf = nl->get_gate_library()->get_gate_type_by_name("BUF");
+
+                std::vector<std::pair<BulkEvent::event, BulkChanges>> bulk_events;
+                eh->register_callback("bulk_listener", std::function<void(BulkEvent::event, const BulkChanges&)>([&bulk_events](BulkEvent::event ev, const BulkChanges& changes) {
+                                          bulk_events.push_back({ev, changes});
+                                      }));
+                u32 num_gate_events = 0;
+                eh->register_callback("gate_listener", std::function<void(GateEvent::event, Gate*, u32)>([&num_gate_events](GateEvent::event, Gate*, u32) { num_gate_events++; }));
+
+                EXPECT_FALSE(eh->is_bulk_active());
+                eh->begin_bulk();
+                eh->begin_bulk();
+                EXPECT_TRUE(eh->is_bulk_active());
+                ASSERT_EQ(bulk_events.size(), 1);
+                EXPECT_EQ(bulk_events.at(0).first, BulkEvent::event::bulk_begin);
+
+                Gate* g_0 = nl->create_gate(1, buf, "gate_0");
+                Gate* g_1 = nl->create_gate(2, buf, "gate_1");
+                g_0->set_name("renamed");
+                g_0->set_name("renamed_again");
+                Net* n = nl->create_net(1, "net_0");
+                n->add_source(g_0, "O");
+                n->add_destination(g_1, "I");
+                Module* m = nl->create_module(2, "mod", nl->get_top_module());
+                m->assign_gate(g_1);
+                nl->delete_gate(g_0);
+
+                eh->end_bulk();
+                EXPECT_TRUE(eh->is_bulk_active());
+                EXPECT_EQ(bulk_events.size(), 1);
+                eh->end_bulk();
+                EXPECT_FALSE(eh->is_bulk_active());
+                EXPECT_EQ(num_gate_events, 5);
+
+                ASSERT_EQ(bulk_events.size(), 2);
+                EXPECT_EQ(bulk_events.at(1).first, BulkEvent::event::bulk_end);
+                const BulkChanges& changes = bulk_events.at(1).second;
+                EXPECT_EQ(changes.gate_events.at(GateEvent::event::created), std::set<u32>({1, 2}));
+                EXPECT_EQ(changes.gate_events.at(GateEvent::event::name_changed), std::set<u32>({1}));
+                EXPECT_EQ(changes.gate_events.at(GateEvent::event::removed), std::set<u32>({1}));
+                EXPECT_EQ(changes.net_events.at(NetEvent::event::src_added), IdPairs({{1, 1}}));
+                EXPECT_EQ(changes.net_events.at(NetEvent::event::src_removed), IdPairs({{1, 1}}));
+                EXPECT_EQ(changes.net_events.at(NetEvent::event::dst_added), IdPairs({{1, 2}}));
+                EXPECT_EQ(changes.module_events.at(ModuleEvent::event::gate_assigned), IdPairs({{1, 1}, {1, 2}, {2, 2}}));
+                EXPECT_EQ(changes.module_events.at(ModuleEvent::event::submodule_added), IdPairs({{1, 2}}));
+                EXPECT_EQ(changes.netlist_events.size(), 0);
+
+                // ending a bulk that has not been started has no effect
+                eh->end_bulk();
+                EXPECT_EQ(bulk_events.size(), 2);
+
+                // without any changes, an empty bulk is reported
+                eh->begin_bulk();
+                eh->end_bulk();
+                ASSERT_EQ(bulk_events.size(), 4);
+                EXPECT_TRUE(bulk_events.at(3).second.empty());
+
+                eh->unregister_callback("bulk_listener");
+                eh->unregister_callback("gate_listener");
+            }
+            {
+                // a transaction is reported as a single bulk that includes the coalesced pin events
+                auto nl = test_utils::create_empty_netlist();
+                u32 num_bulk_ends = 0;
+                BulkChanges changes;
+                nl->get_event_handler()->register_callback("bulk_listener",
+                                                           std::function<void(BulkEvent::event, const BulkChanges&)>([&num_bulk_ends, &changes](BulkEvent::event ev, const BulkChanges& c) {
+                                                               if (ev == BulkEvent::event::bulk_end)
+                                                               {
+                                                                   num_bulk_ends++;
+                                                                   changes = c;
+                                                               }
+                                                           }));
+                {
+                    NetlistTransaction transaction(nl.get());
+                    apply_module_modifications(nl.get(), 40);
+                    EXPECT_TRUE(nl->get_event_handler()->is_bulk_active());
+                }
+                EXPECT_FALSE(nl->get_event_handler()->is_bulk_active());
+                EXPECT_EQ(num_bulk_ends, 1);
+                EXPECT_EQ(changes.gate_events.at(GateEvent::event::created).size(), 40);
+                EXPECT_EQ(changes.net_events.at(NetEvent::event::removed), IdPairs({{20, 0xFFFFFFFF}}));
+                EXPECT_EQ(changes.netlist_events.at(NetlistEvent::event::marked_global_output), std::set<u32>({39}));
+                for (const auto& [module_id, data] : changes.module_events.at(ModuleEvent::event::pin_changed))
+                {
+                    EXPECT_EQ(data & 0xF, (u32)PinEvent::PinsReload);
+                }
+                EXPECT_FALSE(changes.module_events.at(ModuleEvent::event::pin_changed).empty());
+            }
+            {
+                // a bulk scope also ends its bulk if the enclosed modifications throw
+                auto nl = test_utils::create_empty_netlist();
+                EventHandler* eh = nl->get_event_handler();
+                u32 num_bulk_ends = 0;
+                eh->register_callback("bulk_listener", std::function<void(BulkEvent::event, const BulkChanges&)>([&num_bulk_ends](BulkEvent::event ev, const BulkChanges&) {
+                                          if (ev == BulkEvent::event::bulk_end)
+                                          {
+                                              num_bulk_ends++;
+                                          }
+                                      }));
+                try
+                {
+                    EventBulkScope bulk(eh);
+                    EXPECT_TRUE(eh->is_bulk_active());
+                    nl->create_net("net");
+                    throw std::runtime_error("modification failed");
+                }
+                catch (const std::runtime_error&)
+                {
+                }
+                EXPECT_FALSE(eh->is_bulk_active());
+                EXPECT_EQ(num_bulk_ends, 1);
+            }
+        TEST_END
+    }
+
+    /**
+     * Reports the memory it takes to store the connectivity of a netlist of one million gates and how fast it is traversed.
+     * Every gate drives a net that ends at the two gates following it, so that every gate has two fan-in and one fan-out endpoints.
+     * The memory is measured as the growth of the resident memory of the process, which is only meaningful if the test runs on its own.
+     * The benchmark is disabled by default, run it with '--gtest_also_run_disabled_tests'.
+     *
+     * Functions: create_gate, create_net, add_source, add_destination, get_fan_out_nets, get_fan_in_endpoints, get_destinations, get_sources
+     */
+    TEST_F(NetlistTest, DISABLED_check_connectivity_performance) {
+        TEST_START
+            const u32 num_gates  = 1000000;
+            const u32 num_passes = 10;
+
+            auto nl        = test_utils::create_empty_netlist();
+            GateType* and2 = nl->get_gate_library()->get_gate_type_by_name("AND2");
+            ASSERT_NE(and2, nullptr);
+            GatePin* in_0 = and2->get_pin_by_name("I0");
+            GatePin* in_1 = and2->get_pin_by_name("I1");
+            GatePin* out  = and2->get_pin_by_name("O");
+
+            const u64 memory_before = get_resident_memory();
+            auto start              = std::chrono::steady_clock::now();
+
+            std::vector<Gate*> gates;
+            std::vector<Net*> nets;
+            gates.reserve(num_gates);
+            nets.reserve(num_gates);
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                gates.push_back(nl->create_gate(and2, "gate_" + std::to_string(i)));
+                nets.push_back(nl->create_net("net_" + std::to_string(i)));
+            }
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                ASSERT_NE(nets[i]->add_source(gates[i], out), nullptr);
+                ASSERT_NE(nets[i]->add_destination(gates[(i + 1) % num_gates], in_0), nullptr);
+                ASSERT_NE(nets[i]->add_destination(gates[(i + 2) % num_gates], in_1), nullptr);
+            }
+
+            const u64 memory_after = get_resident_memory();
+            std::cout << "[ connectivity ] built " << num_gates << " gates and nets in " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << "s using "
+                      << (memory_after - memory_before) / num_gates << " bytes per gate and net" << std::endl;
+
+            // walk from every gate to its successors and back to its predecessors
+            start         = std::chrono::steady_clock::now();
+            u64 checksum  = 0;
+            u64 num_steps = 0;
+            for (u32 pass = 0; pass < num_passes; pass++)
+            {
+                for (const Gate* gate : gates)
+                {
+                    for (const Net* net : gate->get_fan_out_nets())
+                    {
+                        for (const Endpoint* ep : net->get_destinations())
+                        {
+                            checksum += ep->get_gate()->get_id();
+                            num_steps++;
+                        }
+                    }
+                    for (const Endpoint* ep : gate->get_fan_in_endpoints())
+                    {
+                        for (const Endpoint* src : ep->get_net()->get_sources())
+                        {
+                            checksum -= src->get_gate()->get_id();
+                            num_steps++;
+                        }
+                    }
+                }
+            }
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "[ connectivity ] traversed " << num_steps << " endpoints in " << seconds << "s (" << (u64)(num_steps / seconds) << " endpoints per second)" << std::endl;
+
+            // every gate is reached once from each of its two predecessors and reaches each of them once in return
+            EXPECT_EQ(num_steps, (u64)num_passes * num_gates * 4);
+            EXPECT_EQ(checksum, 0);
+        TEST_END
+    }
+
+    /**
+     * Reports the memory it takes to annotate one million gates with the kind of data entries a netlist parser attaches to them and how fast the entries are looked up.
+     * The memory is measured as the growth of the resident memory of the process, which is only meaningful if the test runs on its own.
+     * The benchmark is disabled by default, run it with '--gtest_also_run_disabled_tests'.
+     *
+     * Functions: set_data, get_data, has_data
+     */
+    TEST_F(NetlistTest, DISABLED_check_data_performance) {
+        TEST_START
+            const u32 num_gates = 1000000;
+
+            auto nl       = test_utils::create_empty_netlist();
+            GateType* buf = nl->get_gate_library()->get_gate_type_by_name("BUF");
+            ASSERT_NE(buf, nullptr);
+
+            std::vector<Gate*> gates;
+            gates.reserve(num_gates);
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                gates.push_back(nl->create_gate(buf, "gate_" + std::to_string(i)));
+            }
+
+            const u64 memory_before = get_resident_memory();
+            auto start              = std::chrono::steady_clock::now();
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                ASSERT_TRUE(gates[i]->set_data("attribute", "src", "string", "top.v:" + std::to_string(i)));
+                ASSERT_TRUE(gates[i]->set_data("attribute", "keep_hierarchy", "string", "yes"));
+                ASSERT_TRUE(gates[i]->set_data("generic", "INIT", "bit_vector", "96"));
+            }
+            const u64 memory_after = get_resident_memory();
+            std::cout << "[ data ] added " << 3 * num_gates << " data entries in " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << "s using "
+                      << (memory_after - memory_before) / num_gates << " bytes per gate" << std::endl;
+
+            start     = std::chrono::steady_clock::now();
+            u64 found = 0;
+            for (const Gate* gate : gates)
+            {
+                found += std::get<1>(gate->get_data("generic", "INIT")) == "96";
+                found += gate->has_data("attribute", "src");
+                found += gate->has_data("attribute", "dont_touch");
+            }
+            std::cout << "[ data ] looked up " << 3 * num_gates << " data entries in " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << "s" << std::endl;
+            EXPECT_EQ(found, 2 * num_gates);
+        TEST_END
+    }
+
 } //namespace hal
@@ -1,4 +1,5 @@
 #include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
@@ -10,8 +11,13 @@
 #include "hal_core/plugin_system/plugin_manager.h"
 #include "gate_library_test_utils.h"
 #include "netlist_test_utils.h"
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
 
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 
 namespace hal {
     using test_utils::MIN_GATE_ID;
@@ -275,4 +281,188 @@ namespace hal {
              }
          TEST_END
      }
+
+     /**
+      * Testing the deserialization of files and strings whose members are not stored in the order the serializer writes them in.
+      * Such netlists cannot be created while they are read and are deserialized from the whole document instead.
+      *
+      * Functions: deserialize_from_file, deserialize_from_string
+      */
+     TEST_F(NetlistSerializerTest, check_deserialize_member_order) {
+         TEST_START
+             auto nl = create_example_serializer_netlist();
+
+             std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+             ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+             std::ifstream hal_file_stream(test_hal_file_path.string());
+             std::stringstream hal_buffer;
+             hal_buffer << hal_file_stream.rdbuf();
+             const std::string hal_string = hal_buffer.str();
+             hal_file_stream.close();
+
+             {
+                 // Deserialize the netlist from a string in the order it has been written in
+                 auto des_nl = netlist_serializer::deserialize_from_string(hal_string);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+             }
+             {
+                 // Reverse the order of all members of the root node and of the 'netlist' node
+                 rapidjson::Document document;
+                 document.Parse(hal_string.c_str());
+                 ASSERT_FALSE(document.HasParseError());
+
+                 rapidjson::Value reversed_netlist(rapidjson::kObjectType);
+                 for (auto it = document["netlist"].MemberEnd(); it != document["netlist"].MemberBegin();)
+                 {
+                     --it;
+                     reversed_netlist.AddMember(it->name, it->value, document.GetAllocator());
+                 }
+                 rapidjson::Document reversed_document;
+                 reversed_document.SetObject();
+                 reversed_document.AddMember("netlist", reversed_netlist, reversed_document.GetAllocator());
+                 reversed_document.AddMember("serialization_format_version", document["serialization_format_version"].GetUint(), reversed_document.GetAllocator());
+
+                 rapidjson::StringBuffer strbuf;
+                 rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+                 reversed_document.Accept(writer);
+                 const std::string reversed_string = strbuf.GetString();
+
+                 auto des_nl = netlist_serializer::deserialize_from_string(reversed_string);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+
+                 std::ofstream reversed_file_stream(test_hal_file_path.string());
+                 reversed_file_stream << reversed_string;
+                 reversed_file_stream.close();
+
+                 des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+             }
+             {
+                 // Deserialize a string that is cut off in the middle of the netlist
+                 NO_COUT_TEST_BLOCK;
+                 EXPECT_EQ(netlist_serializer::deserialize_from_string(hal_string.substr(0, hal_string.size() / 2)), nullptr);
+             }
+         TEST_END
+     }
+
+     /**
+      * Testing the serialization and a followed deserialization of the example netlist using the binary file format.
+      *
+      * Functions: netlist_binary_serializer::serialize_to_file, netlist_binary_serializer::deserialize_from_file, NetlistImage::open, NetlistImage::materialize
+      */
+     TEST_F(NetlistSerializerTest, check_binary_serialize_and_deserialize) {
+         TEST_START
+             {
+                 // Serialize and deserialize the example netlist and compare the result with the original netlist
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_halb_file_path));
+                 auto des_nl = netlist_binary_serializer::deserialize_from_file(test_halb_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+             }
+             {
+                 // Query the general information of a binary file without materializing the netlist
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_halb_file_path));
+                 auto image_res = netlist_binary_serializer::NetlistImage::open(test_halb_file_path);
+                 ASSERT_TRUE(image_res.is_ok());
+                 auto image = image_res.get();
+                 EXPECT_EQ(image->get_format_version(), netlist_binary_serializer::BINARY_FORMAT_VERSION);
+                 EXPECT_EQ(image->get_netlist_id(), nl->get_id());
+                 EXPECT_EQ(image->get_design_name(), nl->get_design_name());
+                 EXPECT_EQ(image->get_device_name(), nl->get_device_name());
+                 EXPECT_EQ(image->get_gate_library_path(), nl->get_gate_library()->get_path().string());
+                 EXPECT_EQ(image->get_gate_count(), nl->get_gates().size());
+                 EXPECT_EQ(image->get_net_count(), nl->get_nets().size());
+                 EXPECT_EQ(image->get_module_count(), nl->get_modules().size());
+
+                 // materialize the same image twice
+                 auto first_res = image->materialize();
+                 ASSERT_TRUE(first_res.is_ok());
+                 auto second_res = image->materialize(nl->get_gate_library());
+                 ASSERT_TRUE(second_res.is_ok());
+                 EXPECT_TRUE(*nl == *first_res.get());
+                 EXPECT_TRUE(*nl == *second_res.get());
+             }
+             {
+                 // Convert a netlist from the JSON format to the binary format and back
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_hal_file_path  = test_utils::create_sandbox_path("test_hal_file.hal");
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                 auto json_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(json_nl, nullptr);
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(json_nl.get(), test_halb_file_path));
+                 auto binary_nl = netlist_binary_serializer::deserialize_from_file(test_halb_file_path);
+                 ASSERT_NE(binary_nl, nullptr);
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(binary_nl.get(), test_hal_file_path));
+                 auto des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+             }
+             {
+                 // Serialize and deserialize an empty netlist and compare the result with the original netlist
+                 auto nl = std::make_unique<Netlist>(m_gl);
+
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_halb_file_path));
+                 auto des_nl = netlist_binary_serializer::deserialize_from_file(test_halb_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+             }
+         TEST_END
+     }
+
+     /**
+      * Testing the serialization and deserialization of a netlist with invalid input using the binary file format.
+      *
+      * Functions: netlist_binary_serializer::serialize_to_file, netlist_binary_serializer::deserialize_from_file
+      */
+     TEST_F(NetlistSerializerTest, check_binary_serialize_and_deserialize_negative) {
+         TEST_START
+             {
+                 // Serialize a netlist which is a nullptr
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 EXPECT_FALSE(netlist_binary_serializer::serialize_to_file(nullptr, test_halb_file_path));
+             }
+             {
+                 // Serialize a netlist to an invalid path
+                 NO_COUT_TEST_BLOCK;
+                 auto nl = create_example_serializer_netlist();
+                 EXPECT_FALSE(netlist_binary_serializer::serialize_to_file(nl.get(), std::filesystem::path("")));
+             }
+             {
+                 // Deserialize a netlist from a non existing path
+                 NO_COUT_TEST_BLOCK;
+                 EXPECT_EQ(netlist_binary_serializer::deserialize_from_file(std::filesystem::path("/using/this/file/is/let.halb")), nullptr);
+             }
+             {
+                 // Deserialize invalid input
+                 NO_COUT_TEST_BLOCK;
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 std::ofstream myfile;
+                 myfile.open(test_halb_file_path.string());
+                 myfile << "I h4ve no binary f0rmat!!!\n(Temporary file for testing. Should be already deleted...)";
+                 myfile.close();
+                 EXPECT_EQ(netlist_binary_serializer::deserialize_from_file(test_halb_file_path), nullptr);
+             }
+             {
+                 // Deserialize a truncated file
+                 NO_COUT_TEST_BLOCK;
+                 auto nl = create_example_serializer_netlist();
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_halb_file_path));
+                 std::filesystem::resize_file(test_halb_file_path, std::filesystem::file_size(test_halb_file_path) / 2);
+                 EXPECT_EQ(netlist_binary_serializer::deserialize_from_file(test_halb_file_path), nullptr);
+             }
+         TEST_END
+     }
 }    //namespace hal
@@ -28,7 +28,7 @@ from pathlib import Path
 # later in the run cannot be blamed on an earlier call having mutated the netlist out from under it.
 MUTATING_PREFIXES = (
     "create_", "delete_", "remove_", "add_", "set_", "assign_", "mark_", "unmark_",
-    "clear_", "reset_", "enable_", "disable_", "unassign_", "move_", "rename_",
+    "clear_", "reset_", "enable_", "disable_", "unassign_", "move_", "rename_", "begin_", "commit_",
     # load_ and unload_ matter more than they look: plugin_manager.unload_all_plugins() and
     # GateLibraryManager.load_all() take no arguments, and calling either pulls the gate library out
     # from under the netlist this test is holding, which aborts the interpreter at exit.